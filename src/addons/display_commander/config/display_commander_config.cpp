@@ -2,163 +2,152 @@
 #include "../utils.hpp"
 #include "../utils/logging.hpp"
 #include "../utils/display_commander_logger.hpp"
+#include "../utils/indexed_ini.hpp"
 #include "../utils/srwlock_wrapper.hpp"
-#include <fstream>
-#include <sstream>
 #include <filesystem>
 #include <cstring>
 #include <algorithm>
 #include <cctype>
+#include <string_view>
+#include <thread>
 
 namespace display_commander::config {
 
-// Simple INI file parser/writer
+namespace {
+
+// Quiet time after the last change before the saver thread writes the file, and the longest a change may wait
+constexpr ULONGLONG kSaveDebounceMs = 500;
+constexpr ULONGLONG kSaveMaxDelayMs = 2000;
+
+bool IsLegacyDeviceIdKey(std::string_view key) {
+    return key.find("device_id") != std::string_view::npos || key.find("display_device_id") != std::string_view::npos ||
+           key == "target_display";
+}
+
+// Write to a temp file first, then move it over the config for an atomic replace
+bool WriteFileAtomically(const std::string& filepath, const std::string& contents) {
+    const std::string temp_filepath = filepath + ".temp";
+    HANDLE file = CreateFileA(temp_filepath.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    DWORD written = 0;
+    const bool write_ok = WriteFile(file, contents.data(), static_cast<DWORD>(contents.size()), &written, nullptr) != 0 &&
+                          written == contents.size();
+    CloseHandle(file);
+
+    if (!write_ok || MoveFileExA(temp_filepath.c_str(), filepath.c_str(), MOVEFILE_REPLACE_EXISTING) == 0) {
+        // Clean up temp file on failure
+        DeleteFileA(temp_filepath.c_str());
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+// INI file contents: utils::IndexedIni plus file I/O and the ReShade value conventions
 class IniFile {
 public:
-    struct Section {
-        std::string name;
-        std::vector<std::pair<std::string, std::string>> key_values;
-    };
-
+    // Maps the file and parses it in one pass
     bool LoadFromFile(const std::string& filepath) {
-        std::ifstream file(filepath);
-        if (!file.is_open()) {
+        HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                  nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
             return false;
         }
 
-        sections_.clear();
-        std::string line;
-        Section* current_section = nullptr;
-
-        while (std::getline(file, line)) {
-            // Remove leading/trailing whitespace
-            line.erase(0, line.find_first_not_of(" \t\r\n"));
-            line.erase(line.find_last_not_of(" \t\r\n") + 1);
-
-            // Skip empty lines and comments
-            if (line.empty() || line[0] == ';' || line[0] == '#') {
-                continue;
-            }
-
-            // Check for section header [section_name]
-            if (line[0] == '[' && line.back() == ']') {
-                std::string section_name = line.substr(1, line.length() - 2);
-                sections_.push_back({section_name, {}});
-                current_section = &sections_.back();
-            }
-            // Check for key=value pair
-            else if (current_section != nullptr) {
-                size_t equal_pos = line.find('=');
-                if (equal_pos != std::string::npos) {
-                    std::string key = line.substr(0, equal_pos);
-                    std::string value = line.substr(equal_pos + 1);
-
-                    // Remove leading/trailing whitespace from key and value
-                    key.erase(0, key.find_first_not_of(" \t"));
-                    key.erase(key.find_last_not_of(" \t") + 1);
-                    value.erase(0, value.find_first_not_of(" \t"));
-                    value.erase(value.find_last_not_of(" \t") + 1);
-
-                    current_section->key_values.push_back({key, value});
-                }
-            }
+        LARGE_INTEGER size = {};
+        if (GetFileSizeEx(file, &size) == 0) {
+            CloseHandle(file);
+            return false;
+        }
+        if (size.QuadPart == 0) {
+            // Empty files cannot be mapped
+            CloseHandle(file);
+            ini_.Clear();
+            return true;
         }
 
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr) {
+            return false;
+        }
+        const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (view == nullptr) {
+            return false;
+        }
+        ini_.Parse(std::string_view(static_cast<const char*>(view), static_cast<size_t>(size.QuadPart)));
+        UnmapViewOfFile(view);
         return true;
     }
 
-    bool SaveToFile(const std::string& filepath) {
-        // Write to temp file first for atomic operation
-        std::string temp_filepath = filepath + ".temp";
-        std::ofstream file(temp_filepath);
-        if (!file.is_open()) {
+    // Snapshot of the whole file for the saver; the store is clean afterwards
+    bool TakeSnapshot(std::string& contents) {
+        if (!ini_.IsDirty()) {
             return false;
         }
+        ini_.Serialize(contents, "\r\n");
+        ini_.MarkClean();
+        return true;
+    }
 
-        for (const auto& section : sections_) {
-            file << "[" << section.name << "]\n";
-            for (const auto& kv : section.key_values) {
-                file << kv.first << "=" << kv.second << "\n";
-            }
-            file << "\n";
-        }
+    // Make the next save write the file even without changes (new file, failed write)
+    void MarkDirty() { ini_.MarkStructureDirty(); }
 
-        file.close();
+    bool IsDirty() const { return ini_.IsDirty(); }
+    size_t DirtyEntryCount() const { return ini_.DirtyEntryCount(); }
 
-        // Atomically move temp file to final location
-        try {
-            std::filesystem::rename(temp_filepath, filepath);
-            return true;
-        } catch (const std::exception&) {
-            // Clean up temp file on failure
-            std::filesystem::remove(temp_filepath);
+    bool GetValue(std::string_view section, std::string_view key, std::string& value) {
+        const utils::IndexedIni::EntryId id = ini_.Find(section, key);
+        if (id == utils::IndexedIni::kInvalidId) {
             return false;
         }
-    }
-
-    bool GetValue(const std::string& section, const std::string& key, std::string& value) const {
-        for (const auto& s : sections_) {
-            if (s.name == section) {
-                for (const auto& kv : s.key_values) {
-                    if (kv.first == key) {
-                        value = kv.second;
-
-                        // Migration: Check if this is a device ID setting that was saved as an integer
-                        if ((key.find("device_id") != std::string::npos || key.find("display_device_id") != std::string::npos ||
-                             key == "target_display") && !value.empty() &&
-                            std::all_of(value.begin(), value.end(), ::isdigit)) {
-                            // This is likely an old integer value, return empty string to trigger default
-                            value = "";
-                            // Mark for removal from config file
-                            const_cast<IniFile*>(this)->SetValue(section, key, "");
-                        }
-
-                        return true;
-                    }
-                }
-            }
+        const std::string& stored = ini_.GetValue(id);
+
+        // Migration: Check if this is a device ID setting that was saved as an integer
+        if (!stored.empty() && IsLegacyDeviceIdKey(key) &&
+            std::all_of(stored.begin(), stored.end(), [](char c) { return std::isdigit(static_cast<unsigned char>(c)) != 0; })) {
+            // This is likely an old integer value, return empty string to trigger default
+            value.clear();
+            // Mark for removal from config file
+            ini_.SetValue(id, "");
+            return true;
         }
-        return false;
+
+        value = stored;
+        return true;
     }
 
-    void SetValue(const std::string& section, const std::string& key, const std::string& value) {
-        // Find existing section
-        for (auto& s : sections_) {
-            if (s.name == section) {
-                // Find existing key in section
-                for (auto& kv : s.key_values) {
-                    if (kv.first == key) {
-                        kv.second = value;
-                        return;
-                    }
-                }
-                // Key not found, add it
-                s.key_values.push_back({key, value});
-                return;
-            }
-        }
-        // Section not found, create it
-        sections_.push_back({section, {{key, value}}});
+    void SetValue(std::string_view section, std::string_view key, std::string_view value) {
+        ini_.SetValue(section, key, value);
     }
 
-    bool GetValue(const std::string& section, const std::string& key, std::vector<std::string>& values) const {
+    bool GetValue(std::string_view section, std::string_view key, std::vector<std::string>& values) {
         values.clear();
         std::string value_str;
         if (GetValue(section, key, value_str)) {
             // Split by null character (ReShade format)
-            std::stringstream ss(value_str);
-            std::string item;
-            while (std::getline(ss, item, '\0')) {
-                if (!item.empty()) {
-                    values.push_back(item);
+            size_t start = 0;
+            while (start <= value_str.size()) {
+                size_t end = value_str.find('\0', start);
+                if (end == std::string::npos) {
+                    end = value_str.size();
+                }
+                if (end > start) {
+                    values.emplace_back(value_str, start, end - start);
                 }
+                start = end + 1;
             }
             return !values.empty();
         }
         return false;
     }
 
-    void SetValue(const std::string& section, const std::string& key, const std::vector<std::string>& values) {
+    void SetValue(std::string_view section, std::string_view key, const std::vector<std::string>& values) {
         std::string value_str;
         for (size_t i = 0; i < values.size(); ++i) {
             if (i > 0) {
@@ -170,7 +159,7 @@ public:
     }
 
 private:
-    std::vector<Section> sections_;
+    utils::IndexedIni ini_;
 };
 
 // DisplayCommanderConfigManager implementation
@@ -179,10 +168,17 @@ DisplayCommanderConfigManager& DisplayCommanderConfigManager::GetInstance() {
     return instance;
 }
 
+DisplayCommanderConfigManager::~DisplayCommanderConfigManager() {
+    // Static destruction at process exit: the saver thread has already been terminated by the OS
+    if (saver_thread_.joinable()) {
+        saver_thread_.detach();
+    }
+}
+
 void DisplayCommanderConfigManager::Initialize() {
     utils::SRWLockExclusive lock(config_mutex_);
 
-    if (initialized_) {
+    if (initialized_.load()) {
         return;
     }
 
@@ -201,19 +197,24 @@ void DisplayCommanderConfigManager::Initialize() {
 
     // Load existing config if it exists
     if (!config_file_->LoadFromFile(config_path_)) {
+        // Written by the first save
+        config_file_->MarkDirty();
         LogInfo("DisplayCommanderConfigManager: Created new config file at %s", config_path_.c_str());
     } else {
         LogInfo("DisplayCommanderConfigManager: Loaded existing config from %s", config_path_.c_str());
     }
 
-    initialized_ = true;
+    // Writes the file once changes have settled (see SaveConfig); stopped by Shutdown()
+    saver_thread_ = std::thread(&DisplayCommanderConfigManager::SaverThread, this);
+
+    initialized_.store(true);
 }
 
 bool DisplayCommanderConfigManager::GetConfigValue(const char* section, const char* key, std::string& value) {
-    utils::SRWLockExclusive lock(config_mutex_);
-    if (!initialized_) {
+    if (!initialized_.load()) {
         Initialize();
     }
+    utils::SRWLockExclusive lock(config_mutex_);
     return config_file_->GetValue(section != nullptr ? section : "", key != nullptr ? key : "", value);
 }
 
@@ -279,26 +280,26 @@ bool DisplayCommanderConfigManager::GetConfigValue(const char* section, const ch
 }
 
 bool DisplayCommanderConfigManager::GetConfigValue(const char* section, const char* key, std::vector<std::string>& values) {
-    utils::SRWLockExclusive lock(config_mutex_);
-    if (!initialized_) {
+    if (!initialized_.load()) {
         Initialize();
     }
+    utils::SRWLockExclusive lock(config_mutex_);
     return config_file_->GetValue(section != nullptr ? section : "", key != nullptr ? key : "", values);
 }
 
 void DisplayCommanderConfigManager::SetConfigValue(const char* section, const char* key, const std::string& value) {
-    utils::SRWLockExclusive lock(config_mutex_);
-    if (!initialized_) {
+    if (!initialized_.load()) {
         Initialize();
     }
+    utils::SRWLockExclusive lock(config_mutex_);
     config_file_->SetValue(section != nullptr ? section : "", key != nullptr ? key : "", value);
 }
 
 void DisplayCommanderConfigManager::SetConfigValue(const char* section, const char* key, const char* value) {
-    utils::SRWLockExclusive lock(config_mutex_);
-    if (!initialized_) {
+    if (!initialized_.load()) {
         Initialize();
     }
+    utils::SRWLockExclusive lock(config_mutex_);
     config_file_->SetValue(section != nullptr ? section : "", key != nullptr ? key : "", value != nullptr ? value : "");
 }
 
@@ -323,33 +324,128 @@ void DisplayCommanderConfigManager::SetConfigValue(const char* section, const ch
 }
 
 void DisplayCommanderConfigManager::SetConfigValue(const char* section, const char* key, const std::vector<std::string>& values) {
-    utils::SRWLockExclusive lock(config_mutex_);
-    if (!initialized_) {
+    if (!initialized_.load()) {
         Initialize();
     }
+    utils::SRWLockExclusive lock(config_mutex_);
     config_file_->SetValue(section != nullptr ? section : "", key != nullptr ? key : "", values);
 }
 
 void DisplayCommanderConfigManager::SaveConfig(const char* reason) {
+    if (!initialized_.load()) {
+        return;
+    }
+
     utils::SRWLockExclusive lock(config_mutex_);
-    if (!initialized_) {
+    // Nothing changed since the last write (periodic saves, settings set to their current value)
+    if (!config_file_->IsDirty()) {
         return;
     }
 
-    EnsureConfigFileExists();
-    if (config_file_->SaveToFile(config_path_)) {
-        if (reason != nullptr && reason[0] != '\0') {
-            LogInfo("DisplayCommanderConfigManager: Saved config to %s (reason: %s)", config_path_.c_str(), reason);
-        } else {
-            LogInfo("DisplayCommanderConfigManager: Saved config to %s", config_path_.c_str());
+    // Settings save on every change, e.g. each frame while a slider is dragged: coalesce into one write
+    const ULONGLONG now = GetTickCount64();
+    if (!save_requested_) {
+        save_requested_ = true;
+        first_save_request_ms_ = now;
+    }
+    last_save_request_ms_ = now;
+    pending_save_reason_ = (reason != nullptr) ? reason : "";
+    WakeConditionVariable(&save_requested_cv_);
+}
+
+void DisplayCommanderConfigManager::FlushConfig() {
+    if (!initialized_.load()) {
+        return;
+    }
+    // Exit paths: the saver or a crashed thread may hold a lock, so wait briefly only
+    for (int attempt = 0; attempt < 50; ++attempt) {
+        if (TryAcquireSRWLockExclusive(&save_io_mutex_)) {
+            WritePendingChanges();
+            ReleaseSRWLockExclusive(&save_io_mutex_);
+            return;
         }
-    } else {
-        if (reason != nullptr && reason[0] != '\0') {
-            LogError("DisplayCommanderConfigManager: Failed to save config to %s (reason: %s)", config_path_.c_str(), reason);
+        Sleep(1);
+    }
+}
+
+void DisplayCommanderConfigManager::Shutdown() {
+    {
+        utils::SRWLockExclusive lock(config_mutex_);
+        saver_stop_requested_ = true;
+        WakeConditionVariable(&save_requested_cv_);
+    }
+    if (saver_thread_.joinable()) {
+        saver_thread_.join();
+    }
+    // The saver may have been waiting out the debounce delay
+    FlushConfig();
+}
+
+void DisplayCommanderConfigManager::SaverThread() {
+    AcquireSRWLockExclusive(&config_mutex_);
+    while (!saver_stop_requested_) {
+        if (!save_requested_) {
+            SleepConditionVariableSRW(&save_requested_cv_, &config_mutex_, INFINITE, 0);
+            continue;
+        }
+        const ULONGLONG due = (std::min)(last_save_request_ms_ + kSaveDebounceMs, first_save_request_ms_ + kSaveMaxDelayMs);
+        const ULONGLONG now = GetTickCount64();
+        if (now < due) {
+            SleepConditionVariableSRW(&save_requested_cv_, &config_mutex_, static_cast<DWORD>(due - now), 0);
+            continue;
+        }
+
+        ReleaseSRWLockExclusive(&config_mutex_);
+        {
+            utils::SRWLockExclusive io_lock(save_io_mutex_);
+            WritePendingChanges();
+        }
+        AcquireSRWLockExclusive(&config_mutex_);
+    }
+    ReleaseSRWLockExclusive(&config_mutex_);
+}
+
+void DisplayCommanderConfigManager::WritePendingChanges() {
+    // The config lock is only held while taking the snapshot, setters never wait for the disk
+    std::string contents;
+    std::string reason;
+    size_t changed_entries = 0;
+    {
+        utils::SRWLockExclusive lock(config_mutex_);
+        save_requested_ = false;
+        changed_entries = config_file_->DirtyEntryCount();
+        if (!config_file_->TakeSnapshot(contents)) {
+            return;
+        }
+        reason.swap(pending_save_reason_);
+        EnsureConfigFileExists();
+    }
+
+    if (WriteFileAtomically(config_path_, contents)) {
+        if (!reason.empty()) {
+            LogInfo("DisplayCommanderConfigManager: Saved config to %s (reason: %s, %zu changed keys)",
+                    config_path_.c_str(), reason.c_str(), changed_entries);
         } else {
-            LogError("DisplayCommanderConfigManager: Failed to save config to %s", config_path_.c_str());
+            LogInfo("DisplayCommanderConfigManager: Saved config to %s (%zu changed keys)", config_path_.c_str(),
+                    changed_entries);
+        }
+        return;
+    }
+
+    {
+        // Retry with the next save
+        utils::SRWLockExclusive lock(config_mutex_);
+        config_file_->MarkDirty();
+        if (pending_save_reason_.empty()) {
+            pending_save_reason_.swap(reason);
         }
     }
+    if (!reason.empty()) {
+        LogError("DisplayCommanderConfigManager: Failed to save config to %s (reason: %s)", config_path_.c_str(),
+                 reason.c_str());
+    } else {
+        LogError("DisplayCommanderConfigManager: Failed to save config to %s", config_path_.c_str());
+    }
 }
 
 std::string DisplayCommanderConfigManager::GetConfigPath() const {
@@ -466,4 +562,12 @@ void save_config(const char* reason) {
     DisplayCommanderConfigManager::GetInstance().SaveConfig(reason);
 }
 
+void flush_config() {
+    DisplayCommanderConfigManager::GetInstance().FlushConfig();
+}
+
+void shutdown_config() {
+    DisplayCommanderConfigManager::GetInstance().Shutdown();
+}
+
 } // namespace display_commander::config
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <atomic>
 #include <string>
+#include <thread>
 #include <vector>
 #include <memory>
 #include "../utils/srwlock_wrapper.hpp"
@@ -37,25 +39,45 @@ public:
     void SetConfigValue(const char* section, const char* key, bool value);
     void SetConfigValue(const char* section, const char* key, const std::vector<std::string>& values);
 
-    // Save configuration to file
+    // Save configuration to file. Only writes if a value changed; the write happens on a background thread once
+    // changes have been quiet for a moment, so bursts of setting changes end up in one write.
     void SaveConfig(const char* reason = nullptr);
 
+    // Write pending changes now on the calling thread (exit paths)
+    void FlushConfig();
+
+    // Stop and join the saver thread, then write pending changes (DLL detach)
+    void Shutdown();
+
     // Get config file path
     std::string GetConfigPath() const;
 
 private:
     DisplayCommanderConfigManager() = default;
-    ~DisplayCommanderConfigManager() = default;
+    ~DisplayCommanderConfigManager();
     DisplayCommanderConfigManager(const DisplayCommanderConfigManager&) = delete;
     DisplayCommanderConfigManager& operator=(const DisplayCommanderConfigManager&) = delete;
 
     void EnsureConfigFileExists();
     std::string GetConfigFilePath();
+    void SaverThread();
+    // Snapshot the dirty config and write it; the caller holds save_io_mutex_
+    void WritePendingChanges();
 
     std::unique_ptr<IniFile> config_file_;
     std::string config_path_;
     mutable SRWLOCK config_mutex_ = SRWLOCK_INIT;
-    bool initialized_ = false;
+    std::atomic<bool> initialized_{false};
+
+    // Debounced saving, under config_mutex_
+    CONDITION_VARIABLE save_requested_cv_ = CONDITION_VARIABLE_INIT;
+    bool save_requested_ = false;
+    ULONGLONG first_save_request_ms_ = 0;
+    ULONGLONG last_save_request_ms_ = 0;
+    std::string pending_save_reason_;
+    bool saver_stop_requested_ = false;
+    std::thread saver_thread_;
+    SRWLOCK save_io_mutex_ = SRWLOCK_INIT;  // one file write at a time
 };
 
 // Global functions that replace reshade::get_config_value and reshade::set_config_value
@@ -80,5 +102,9 @@ void set_config_value(const char* section, const char* key, const std::vector<st
 
 // Save configuration to file
 void save_config(const char* reason = nullptr);
+// Write pending changes immediately
+void flush_config();
+// Stop the background saver and write pending changes
+void shutdown_config();
 
 } // namespace display_commander::config
@@ -10,6 +10,8 @@
 #include "settings/developer_tab_settings.hpp"
 #include "settings/experimental_tab_settings.hpp"
 #include "settings/main_tab_settings.hpp"
+#include "shared_stats_export.hpp"
+#include "swapchain_frame_stats.hpp"
 #include "ui/new_ui/swapchain_tab.hpp"
 #include "ui/new_ui/hotkeys_tab.hpp"
 #include "utils/logging.hpp"
@@ -46,6 +48,17 @@ void HandleReflexAutoConfigure() {
     uint64_t now_ns = utils::get_now_ns();
     bool is_native_reflex_active = IsNativeReflexActive(now_ns);
 
+    // Nothing to do unless a setting changed (including our own changes below) or the game started/stopped
+    // driving Reflex itself since the last run
+    static uint64_t last_settings_generation = UINT64_MAX;
+    static bool last_native_reflex_active = false;
+    const uint64_t settings_generation = ui::new_ui::g_settings_change_bus.Generation();
+    if (settings_generation == last_settings_generation && is_native_reflex_active == last_native_reflex_active) {
+        return;
+    }
+    last_settings_generation = settings_generation;
+    last_native_reflex_active = is_native_reflex_active;
+
     bool is_reflex_mode =
         static_cast<FpsLimiterMode>(settings::g_mainTabSettings.fps_limiter_mode.GetValue()) == FpsLimiterMode::kReflex;
 
@@ -225,35 +238,26 @@ void every1s_checks() {
 
     // Aggregate FPS/frametime metrics and publish shared text once per second
     {
-        extern std::atomic<uint32_t> g_perf_ring_head;
-        extern PerfSample g_perf_ring[kPerfRingCapacity];
-        extern std::atomic<double> g_perf_time_seconds;
         extern std::atomic<bool> g_perf_reset_requested;
         extern std::atomic<std::shared_ptr<const std::string>> g_perf_text_shared;
 
-        const double now_s = g_perf_time_seconds.load(std::memory_order_acquire);
-
         // Handle reset: clear samples efficiently by advancing head and zeroing text
         if (g_perf_reset_requested.exchange(false, std::memory_order_acq_rel)) {
-            g_perf_ring_head.store(0, std::memory_order_release);
+            g_perf_ring.Reset();
+            g_perf_frame_time_quantiles.RequestReset();
         }
 
-        // Copy samples since last reset into local vectors for computation
-        std::vector<float> fps_values;
-        std::vector<float> frame_times_ms;
-        fps_values.reserve(2048);
-        frame_times_ms.reserve(2048);
-        const uint32_t head = g_perf_ring_head.load(std::memory_order_acquire);
-        const uint32_t count =
-            (head > static_cast<uint32_t>(kPerfRingCapacity)) ? static_cast<uint32_t>(kPerfRingCapacity) : head;
-        const uint32_t start = head - count;
-        for (uint32_t i = start; i < head; ++i) {
-            const PerfSample& s = g_perf_ring[i & (kPerfRingCapacity - 1)];
-            if (s.dt > 0.0f) {
-                fps_values.push_back(1.0f / s.dt);
-                frame_times_ms.push_back(1000.0f * s.dt);
-            }
-        }
+        // Percentiles are maintained incrementally by RecordFrameTime(); reading them never sorts or allocates
+        const auto summary = g_perf_frame_time_quantiles.Summarize();
+
+        // Same numbers (plus histogram and per-frame durations) for external readers; lock-free for them and us
+        PublishSharedStats(summary);
+
+        // Per-swapchain percentiles for the Swapchain tab
+        UpdateSwapchainFrameSummaries();
+
+        // Sim-to-display / GPU-late percentiles from the per-frame latency records
+        g_frame_latency.UpdateSummary();
 
         float fps_display = 0.0f;
         float frame_time_ms = 0.0f;
@@ -262,48 +266,25 @@ void every1s_checks() {
         float p99_frame_time_ms = 0.0f;   // Top 1% (99th percentile) frame time
         float p999_frame_time_ms = 0.0f;  // Top 0.1% (99.9th percentile) frame time
 
-        if (!fps_values.empty()) {
+        if (summary.count > 0) {
             // Average FPS over entire interval since reset = frames / total_time
-            std::vector<float> fps_sorted = fps_values;
-            std::sort(fps_sorted.begin(), fps_sorted.end());
-            const size_t n = fps_sorted.size();
-            double total_frame_time_ms = 0.0;
-            for (float ft : frame_times_ms) total_frame_time_ms += static_cast<double>(ft);
-            const double total_seconds = total_frame_time_ms / 1000.0;
-            fps_display = (total_seconds > 0.0) ? static_cast<float>(static_cast<double>(n) / total_seconds) : 0.0f;
+            fps_display = (summary.total_seconds > 0.0)
+                              ? static_cast<float>(static_cast<double>(summary.count) / summary.total_seconds)
+                              : 0.0f;
             // Median frame time for display in ms
-            std::vector<float> ft_for_median = frame_times_ms;
-            std::sort(ft_for_median.begin(), ft_for_median.end());
-            frame_time_ms =
-                (n % 2 == 1) ? ft_for_median[n / 2] : 0.5f * (ft_for_median[n / 2 - 1] + ft_for_median[n / 2]);
-
-            // Compute lows and top frame times using frame time distribution (more robust)
-            std::vector<float> ft_sorted = frame_times_ms;
-            std::sort(ft_sorted.begin(), ft_sorted.end());  // ascending: fast -> slow
-            const size_t m = ft_sorted.size();
-            const size_t count_1 = (std::max<size_t>)(static_cast<size_t>(static_cast<double>(m) * 0.01), size_t(1));
-            const size_t count_01 = (std::max<size_t>)(static_cast<size_t>(static_cast<double>(m) * 0.001), size_t(1));
+            frame_time_ms = static_cast<float>(1000.0 * summary.median_seconds);
 
             // Average of slowest 1% and 0.1% frametimes, then convert to FPS
-            double sum_ft_1 = 0.0;
-            for (size_t i = m - count_1; i < m; ++i) sum_ft_1 += static_cast<double>(ft_sorted[i]);
-            const double avg_ft_1 = sum_ft_1 / static_cast<double>(count_1);
-            one_percent_low = (avg_ft_1 > 0.0) ? static_cast<float>(1000.0 / avg_ft_1) : 0.0f;
-
-            double sum_ft_01 = 0.0;
-            for (size_t i = m - count_01; i < m; ++i) sum_ft_01 += static_cast<double>(ft_sorted[i]);
-            const double avg_ft_01 = sum_ft_01 / static_cast<double>(count_01);
-            point_one_percent_low = (avg_ft_01 > 0.0) ? static_cast<float>(1000.0 / avg_ft_01) : 0.0f;
+            one_percent_low = (summary.slowest_1pct_mean_seconds > 0.0)
+                                  ? static_cast<float>(1.0 / summary.slowest_1pct_mean_seconds)
+                                  : 0.0f;
+            point_one_percent_low = (summary.slowest_01pct_mean_seconds > 0.0)
+                                        ? static_cast<float>(1.0 / summary.slowest_01pct_mean_seconds)
+                                        : 0.0f;
 
             // Percentile frame times (top 1%/0.1% = 99th/99.9th percentile)
-            const size_t idx_p99 =
-                (m > 1) ? (std::min<size_t>)(m - 1, static_cast<size_t>(std::ceil(static_cast<double>(m) * 0.99)) - 1)
-                        : 0;
-            const size_t idx_p999 =
-                (m > 1) ? (std::min<size_t>)(m - 1, static_cast<size_t>(std::ceil(static_cast<double>(m) * 0.999)) - 1)
-                        : 0;
-            p99_frame_time_ms = ft_sorted[idx_p99];
-            p999_frame_time_ms = ft_sorted[idx_p999];
+            p99_frame_time_ms = static_cast<float>(1000.0 * summary.p99_seconds);
+            p999_frame_time_ms = static_cast<float>(1000.0 * summary.p999_seconds);
         }
 
         // Publish shared text (once per loop ~1s)
@@ -340,6 +321,9 @@ void ContinuousMonitoringThread() {
 #endif
         LogInfo("Continuous monitoring thread started");
 
+        // Off the render thread, before the limiter's precise waits need it
+        utils::calibrate_tsc_rate();
+
         auto start_time = utils::get_now_ns();
         LONGLONG last_cache_refresh_ns = start_time;
         LONGLONG last_60fps_update_ns = start_time;
@@ -405,6 +389,7 @@ void ContinuousMonitoringThread() {
     }
 #endif
 
+    CloseSharedStats();
     LogInfo("Continuous monitoring thread stopped");
 }
 
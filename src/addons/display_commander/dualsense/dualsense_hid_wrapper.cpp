@@ -6,6 +6,7 @@
 #include <setupapi.h>
 #include <hidsdi.h>
 #include <initguid.h>
+#include <algorithm>
 #include <cstring>
 
 // Define GUID_DEVINTERFACE_HID if not already defined
@@ -281,14 +282,15 @@ void DualSenseHIDWrapper::UpdateDeviceFromHID(DualSenseDevice& device) {
                 }
             }
 
-            // Process the input report using Special-K format
-            ParseSpecialKDualSenseData(device, inputReport, bytesRead);
+            // Decode the input report (rejects unknown reports and BT reports with a bad CRC)
+            if (!ProcessInputReport(device, inputReport, bytesRead)) {
+                return;
+            }
 
-            // Update packet number for change detection
-            device.current_state.dwPacketNumber++;
+            // Like XInput, only advance the packet number when the gamepad state changed
+            if (std::memcmp(&device.current_state.Gamepad, &device.previous_state.Gamepad, sizeof(XINPUT_GAMEPAD)) != 0) {
+                device.current_state.dwPacketNumber++;
 
-            // Check for state changes
-            if (device.current_state.dwPacketNumber != device.previous_state.dwPacketNumber) {
                 // State changed - we could trigger events here
                 LogInfo("DualSense input state changed for device %s - Buttons: 0x%04X, LStick: (%d,%d), RStick: (%d,%d), LTrig: %d, RTrig: %d",
                        device.device_name.c_str(), device.current_state.Gamepad.wButtons,
@@ -411,202 +413,63 @@ void UpdateDualSenseDeviceStates() {
 }
 
 // Input report processing methods
-void DualSenseHIDWrapper::ProcessUSBInputReport(DualSenseDevice& device, const BYTE* inputReport, DWORD bytesRead) {
-    // DualSense USB input report format
-    // Report ID 0x01, 64 bytes total
-    if (bytesRead < 64 || inputReport[0] != 0x01) {
-        return;
-    }
-
-    // Parse the input report
-    ParseDualSenseButtons(device, inputReport);
-    ParseDualSenseSticks(device, inputReport);
-    ParseDualSenseTriggers(device, inputReport);
-}
-
-void DualSenseHIDWrapper::ProcessBluetoothInputReport(DualSenseDevice& device, const BYTE* inputReport, DWORD bytesRead) {
-    // DualSense Bluetooth input report format
-    // Report ID 0x31, 78 bytes total
-    if (bytesRead < 78 || inputReport[0] != 0x31) {
-        return;
+bool DualSenseHIDWrapper::ProcessInputReport(DualSenseDevice& device, const BYTE* inputReport, DWORD bytesRead) {
+    // Single pass over the report in place; picks the USB or Bluetooth layout from the report ID
+    const utils::DualSenseDecodeResult result = utils::DecodeDualSenseReport(inputReport, bytesRead, device.decoded_state);
+    if (result != utils::DualSenseDecodeResult::Ok) {
+        if (result == utils::DualSenseDecodeResult::BadCrc && device.crc_error_count++ < 5) {
+            LogWarn("DualSense Bluetooth input report failed CRC check for device %s", device.device_name.c_str());
+        }
+        return false;
     }
 
-    // Parse the input report (same format as USB but with different report ID)
-    ParseDualSenseButtons(device, inputReport);
-    ParseDualSenseSticks(device, inputReport);
-    ParseDualSenseTriggers(device, inputReport);
-}
-
-void DualSenseHIDWrapper::ParseDualSenseButtons(DualSenseDevice& device, const BYTE* inputReport) {
-    // DualSense button layout (based on actual USB report format)
-    // Byte 1: Button states
-    // Bit 0: Square, Bit 1: Cross, Bit 2: Circle, Bit 3: Triangle
-    // Bit 4: L1, Bit 5: R1, Bit 6: L2, Bit 7: R2
-    // Byte 2: Button states continued
-    // Bit 0: Share, Bit 1: Options, Bit 2: L3, Bit 3: R3
-    // Bit 4: PS, Bit 5: Touchpad, Bit 6: Mute, Bit 7: (unused)
-    // Byte 3: D-pad (0-7 for 8 directions, 8 for neutral)
-
-    WORD buttons = 0;
-
-    // Map DualSense buttons to XInput buttons
-    if (inputReport[1] & 0x10) buttons |= XINPUT_GAMEPAD_LEFT_SHOULDER;  // L1
-    if (inputReport[1] & 0x20) buttons |= XINPUT_GAMEPAD_RIGHT_SHOULDER; // R1
-    // Note: L2 and R2 are handled as triggers, not buttons in XInput
-
-    if (inputReport[2] & 0x01) buttons |= XINPUT_GAMEPAD_BACK;           // Share
-    if (inputReport[2] & 0x02) buttons |= XINPUT_GAMEPAD_START;          // Options
-    if (inputReport[2] & 0x04) buttons |= XINPUT_GAMEPAD_LEFT_THUMB;     // L3
-    if (inputReport[2] & 0x08) buttons |= XINPUT_GAMEPAD_RIGHT_THUMB;    // R3
-    // Note: PS button doesn't have a direct XInput equivalent, we'll use a custom constant
-    if (inputReport[2] & 0x10) buttons |= 0x0400;                        // PS (custom constant)
-
-    // Face buttons (mapped to XInput layout)
-    if (inputReport[1] & 0x01) buttons |= XINPUT_GAMEPAD_X;              // Square -> X
-    if (inputReport[1] & 0x02) buttons |= XINPUT_GAMEPAD_A;              // Cross -> A
-    if (inputReport[1] & 0x04) buttons |= XINPUT_GAMEPAD_B;              // Circle -> B
-    if (inputReport[1] & 0x08) buttons |= XINPUT_GAMEPAD_Y;              // Triangle -> Y
-
-    // D-pad
-    BYTE dpad = inputReport[3] & 0x0F;
-    switch (dpad) {
-        case 0: buttons |= XINPUT_GAMEPAD_DPAD_UP; break;
-        case 1: buttons |= XINPUT_GAMEPAD_DPAD_UP | XINPUT_GAMEPAD_DPAD_RIGHT; break;
-        case 2: buttons |= XINPUT_GAMEPAD_DPAD_RIGHT; break;
-        case 3: buttons |= XINPUT_GAMEPAD_DPAD_DOWN | XINPUT_GAMEPAD_DPAD_RIGHT; break;
-        case 4: buttons |= XINPUT_GAMEPAD_DPAD_DOWN; break;
-        case 5: buttons |= XINPUT_GAMEPAD_DPAD_DOWN | XINPUT_GAMEPAD_DPAD_LEFT; break;
-        case 6: buttons |= XINPUT_GAMEPAD_DPAD_LEFT; break;
-        case 7: buttons |= XINPUT_GAMEPAD_DPAD_UP | XINPUT_GAMEPAD_DPAD_LEFT; break;
-        // case 8: neutral (no buttons)
+    // The report ID is more reliable than the device path heuristic
+    if (device.is_wireless != device.decoded_state.bluetooth) {
+        device.is_wireless = device.decoded_state.bluetooth;
+        device.connection_type = device.is_wireless ? "Bluetooth" : "USB";
     }
 
-    device.current_state.Gamepad.wButtons = buttons;
-}
-
-void DualSenseHIDWrapper::ParseDualSenseSticks(DualSenseDevice& device, const BYTE* inputReport) {
-    // Left stick: bytes 4-5 (X), 6-7 (Y)
-    // Right stick: bytes 8-9 (X), 10-11 (Y)
-    // Values are 16-bit signed integers
-
-    // Left stick
-    SHORT leftX = static_cast<SHORT>((inputReport[5] << 8) | inputReport[4]);
-    SHORT leftY = static_cast<SHORT>((inputReport[7] << 8) | inputReport[6]);
-
-    // Right stick
-    SHORT rightX = static_cast<SHORT>((inputReport[9] << 8) | inputReport[8]);
-    SHORT rightY = static_cast<SHORT>((inputReport[11] << 8) | inputReport[10]);
-
-    device.current_state.Gamepad.sThumbLX = leftX;
-    device.current_state.Gamepad.sThumbLY = leftY;
-    device.current_state.Gamepad.sThumbRX = rightX;
-    device.current_state.Gamepad.sThumbRY = rightY;
-
-}
-
-void DualSenseHIDWrapper::ParseDualSenseTriggers(DualSenseDevice& device, const BYTE* inputReport) {
-    // Triggers: bytes 12-13 (L2), 14-15 (R2)
-    // Values are 16-bit unsigned integers (0-65535)
-
-    USHORT leftTrigger = static_cast<USHORT>((inputReport[13] << 8) | inputReport[12]);
-    USHORT rightTrigger = static_cast<USHORT>((inputReport[15] << 8) | inputReport[14]);
-
-    // Convert to 8-bit values (0-255) for XInput
-    device.current_state.Gamepad.bLeftTrigger = static_cast<BYTE>(leftTrigger >> 8);
-    device.current_state.Gamepad.bRightTrigger = static_cast<BYTE>(rightTrigger >> 8);
-}
-
-// Special-K format parsing methods
-void DualSenseHIDWrapper::ParseSpecialKDualSenseData(DualSenseDevice& device, const BYTE* inputReport, DWORD bytesRead) {
-    // Check if we have enough data for the Special-K format
-    // USB: 64 bytes (1 byte report ID + 63 bytes data)
-    // Bluetooth: 78 bytes (2 bytes report ID + sequence + 63 bytes data)
-    if ((device.is_wireless && bytesRead < 78) || (!device.is_wireless && bytesRead < 64)) {
-        return;
-    }
-
-    // Store previous data
+    // Raw payload mirror for the debug views
     device.sk_dualsense_data_prev = device.sk_dualsense_data;
+    const utils::DualSenseReportView view(inputReport, bytesRead);
+    std::memcpy(&device.sk_dualsense_data, view.Payload(), (std::min)(sizeof(SK_HID_DualSense_GetStateData), size_t{63}));
 
-    // Determine data offset based on connection type
-    const BYTE* data_start = inputReport;
-    if (device.is_wireless) {
-        // Bluetooth format: skip report ID (0x31) and sequence number
-        data_start = inputReport + 2;
-    } else {
-        // USB format: skip report ID (0x01)
-        data_start = inputReport + 1;
-    }
-
-    // Direct memory mapping using bit union - much cleaner and more efficient!
-    // This directly maps the raw HID data to our structure
-    std::memcpy(&device.sk_dualsense_data, data_start, sizeof(SK_HID_DualSense_GetStateData));
-
-    // Convert to XInput format
-    ConvertSpecialKToXInput(device);
-
-    // Update device state
-    UpdateSpecialKData(device, device.sk_dualsense_data);
+    ConvertDecodedStateToXInput(device);
+    UpdateDeviceInfo(device);
+    return true;
 }
 
-void DualSenseHIDWrapper::ConvertSpecialKToXInput(DualSenseDevice& device) {
-    const auto& sk_data = device.sk_dualsense_data;
+void DualSenseHIDWrapper::ConvertDecodedStateToXInput(DualSenseDevice& device) {
+    const auto& state = device.decoded_state;
     auto& xinput_state = device.current_state.Gamepad;
 
-    // Clear previous button state
-    xinput_state.wButtons = 0;
-
-    // Map DualSense buttons to XInput buttons
-    if (sk_data.ButtonL1) xinput_state.wButtons |= XINPUT_GAMEPAD_LEFT_SHOULDER;
-    if (sk_data.ButtonR1) xinput_state.wButtons |= XINPUT_GAMEPAD_RIGHT_SHOULDER;
-    if (sk_data.ButtonL3) xinput_state.wButtons |= XINPUT_GAMEPAD_LEFT_THUMB;
-    if (sk_data.ButtonR3) xinput_state.wButtons |= XINPUT_GAMEPAD_RIGHT_THUMB;
-    if (sk_data.ButtonCreate) xinput_state.wButtons |= XINPUT_GAMEPAD_BACK;
-    if (sk_data.ButtonOptions) xinput_state.wButtons |= XINPUT_GAMEPAD_START;
-    if (sk_data.ButtonHome) xinput_state.wButtons |= 0x0400; // PS button (custom constant)
-
-    // Face buttons (mapped to XInput layout)
-    if (sk_data.ButtonSquare) xinput_state.wButtons |= XINPUT_GAMEPAD_X;    // Square -> X
-    if (sk_data.ButtonCross) xinput_state.wButtons |= XINPUT_GAMEPAD_A;     // Cross -> A
-    if (sk_data.ButtonCircle) xinput_state.wButtons |= XINPUT_GAMEPAD_B;    // Circle -> B
-    if (sk_data.ButtonTriangle) xinput_state.wButtons |= XINPUT_GAMEPAD_Y;  // Triangle -> Y
-
-    // D-pad mapping
-    switch (sk_data.DPad) {
-        case Direction::Up: xinput_state.wButtons |= XINPUT_GAMEPAD_DPAD_UP; break;
-        case Direction::UpRight: xinput_state.wButtons |= XINPUT_GAMEPAD_DPAD_UP | XINPUT_GAMEPAD_DPAD_RIGHT; break;
-        case Direction::Right: xinput_state.wButtons |= XINPUT_GAMEPAD_DPAD_RIGHT; break;
-        case Direction::DownRight: xinput_state.wButtons |= XINPUT_GAMEPAD_DPAD_DOWN | XINPUT_GAMEPAD_DPAD_RIGHT; break;
-        case Direction::Down: xinput_state.wButtons |= XINPUT_GAMEPAD_DPAD_DOWN; break;
-        case Direction::DownLeft: xinput_state.wButtons |= XINPUT_GAMEPAD_DPAD_DOWN | XINPUT_GAMEPAD_DPAD_LEFT; break;
-        case Direction::Left: xinput_state.wButtons |= XINPUT_GAMEPAD_DPAD_LEFT; break;
-        case Direction::UpLeft: xinput_state.wButtons |= XINPUT_GAMEPAD_DPAD_UP | XINPUT_GAMEPAD_DPAD_LEFT; break;
-        case Direction::None: // neutral (no buttons)
-        default: break;
-    }
+    // The low 16 bits of the decoded buttons are already in XInput layout (PS -> 0x0400 guide)
+    xinput_state.wButtons = static_cast<WORD>(state.buttons & 0xFFFF);
 
     // Analog sticks - convert from 8-bit to 16-bit signed values
     // DualSense uses 0-255 range, XInput uses -32768 to 32767
-    xinput_state.sThumbLX = static_cast<SHORT>((sk_data.LeftStickX - 128) * 256);
-    xinput_state.sThumbLY = static_cast<SHORT>((127 - sk_data.LeftStickY) * 256);
-    xinput_state.sThumbRX = static_cast<SHORT>((sk_data.RightStickX - 128) * 256);
-    xinput_state.sThumbRY = static_cast<SHORT>((127 - sk_data.RightStickY) * 256);
+    xinput_state.sThumbLX = static_cast<SHORT>((state.left_x - 128) * 256);
+    xinput_state.sThumbLY = static_cast<SHORT>((127 - state.left_y) * 256);
+    xinput_state.sThumbRX = static_cast<SHORT>((state.right_x - 128) * 256);
+    xinput_state.sThumbRY = static_cast<SHORT>((127 - state.right_y) * 256);
 
     // Triggers - convert from 8-bit to 8-bit (already in correct range)
-    xinput_state.bLeftTrigger = sk_data.TriggerLeft;
-    xinput_state.bRightTrigger = sk_data.TriggerRight;
+    xinput_state.bLeftTrigger = state.left_trigger;
+    xinput_state.bRightTrigger = state.right_trigger;
 }
 
-void DualSenseHIDWrapper::UpdateSpecialKData(DualSenseDevice& device, const SK_HID_DualSense_GetStateData& new_data) {
+void DualSenseHIDWrapper::UpdateDeviceInfo(DualSenseDevice& device) {
+    const auto& state = device.decoded_state;
+
     // Update battery information if available
-    if (new_data.PowerPercent <= 10) { // Valid range is 0-10
+    if (state.battery_level <= 10) { // Valid range is 0-10
         device.battery_info_valid = true;
-        device.battery_level = new_data.PowerPercent * 10; // Convert to percentage (0-100)
-        device.battery_type = static_cast<BYTE>(new_data.PowerState);
+        device.battery_level = state.battery_level * 10; // Convert to percentage (0-100)
+        device.battery_type = state.power_state;
     }
 
-    // Update device features based on Special-K data
-    device.has_microphone = (new_data.PluggedMic || new_data.PluggedExternalMic);
+    // Update device features based on the report
+    device.has_microphone = (state.plugged & (utils::DualSensePlugged::kMic | utils::DualSensePlugged::kExternalMic)) != 0;
     device.has_speaker = true; // DualSense always has speaker
     device.has_touchpad = true; // DualSense always has touchpad
     device.has_adaptive_triggers = true; // DualSense always has adaptive triggers
@@ -614,11 +477,11 @@ void DualSenseHIDWrapper::UpdateSpecialKData(DualSenseDevice& device, const SK_H
     // Log additional information if available
     static int debug_count = 0;
     if (debug_count++ < 3) {
-        LogInfo("DualSense Special-K data - Battery: %d%%, Mic: %s, Headphones: %s, USB: %s",
+        LogInfo("DualSense report data - Battery: %d%%, Mic: %s, Headphones: %s, USB: %s",
                device.battery_level,
                device.has_microphone ? "Yes" : "No",
-               new_data.PluggedHeadphones ? "Yes" : "No",
-               new_data.PluggedUsbData ? "Yes" : "No");
+               (state.plugged & utils::DualSensePlugged::kHeadphones) != 0 ? "Yes" : "No",
+               (state.plugged & utils::DualSensePlugged::kUsbData) != 0 ? "Yes" : "No");
     }
 }
 
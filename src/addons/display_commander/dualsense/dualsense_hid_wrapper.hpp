@@ -7,6 +7,8 @@
 #include <atomic>
 #include <string>
 
+#include "../utils/dualsense_report.hpp"
+
 // Forward declarations for XInput_HID types
 using GetInputReport_pfn = bool (*)(void*);
 
@@ -145,7 +147,11 @@ struct DualSenseDevice {
     XINPUT_STATE current_state;
     XINPUT_STATE previous_state;
 
-    // Special-K DualSense HID data
+    // Last decoded input report
+    utils::DualSenseState decoded_state;
+    DWORD crc_error_count;
+
+    // Special-K DualSense HID data (raw payload mirror for the debug views)
     SK_HID_DualSense_GetStateData sk_dualsense_data;
     SK_HID_DualSense_GetStateData sk_dualsense_data_prev;
 
@@ -165,7 +171,7 @@ struct DualSenseDevice {
     GetInputReport_pfn get_input_report;
 
     DualSenseDevice() : vendor_id(0), product_id(0), is_connected(false),
-                       is_wireless(false), last_update_time(0), input_timestamp(0),
+                       is_wireless(false), last_update_time(0), input_timestamp(0), crc_error_count(0),
                        has_adaptive_triggers(false), has_touchpad(false),
                        has_microphone(false), has_speaker(false),
                        battery_info_valid(false), battery_level(0), battery_type(0),
@@ -213,17 +219,10 @@ public:
     // Set HID device type filter
     void SetHIDTypeFilter(int hid_type) { hid_type_filter_ = hid_type; }
 
-    // Input report processing
-    void ProcessUSBInputReport(DualSenseDevice& device, const BYTE* inputReport, DWORD bytesRead);
-    void ProcessBluetoothInputReport(DualSenseDevice& device, const BYTE* inputReport, DWORD bytesRead);
-    void ParseDualSenseButtons(DualSenseDevice& device, const BYTE* inputReport);
-    void ParseDualSenseSticks(DualSenseDevice& device, const BYTE* inputReport);
-    void ParseDualSenseTriggers(DualSenseDevice& device, const BYTE* inputReport);
-
-    // Special-K format parsing
-    void ParseSpecialKDualSenseData(DualSenseDevice& device, const BYTE* inputReport, DWORD bytesRead);
-    void ConvertSpecialKToXInput(DualSenseDevice& device);
-    void UpdateSpecialKData(DualSenseDevice& device, const SK_HID_DualSense_GetStateData& new_data);
+    // Input report processing (USB 0x01 or Bluetooth 0x31); returns false if the report was rejected
+    bool ProcessInputReport(DualSenseDevice& device, const BYTE* inputReport, DWORD bytesRead);
+    void ConvertDecodedStateToXInput(DualSenseDevice& device);
+    void UpdateDeviceInfo(DualSenseDevice& device);
 
 private:
     // Device management
@@ -1,20 +1,35 @@
 #include "custom_fps_limiter.hpp"
+#include "../event_timeline.hpp"
 #include "../globals.hpp"
+#include "../settings/main_tab_settings.hpp"
 #include "utils/timing.hpp"
 
 namespace dxgi::fps_limiter {
-HANDLE m_timer_handle = nullptr;
+
+int64_t SystemPacingClock::NowNs() { return utils::get_now_ns(); }
+
+void SystemPacingClock::WaitUntilNs(int64_t target_ns) {
+    const int64_t wait_start_ns = g_event_timeline.IsEnabled() ? utils::get_now_ns() : 0;
+    utils::wait_until_ns_precise(target_ns);
+    const int64_t wake_ns = utils::get_now_ns();
+    g_frame_trace.Record(utils::FrameTraceEvent::kLimiterWait, g_global_frame_id.load(), wake_ns, target_ns);
+    g_event_timeline.Record(utils::TimelineEvent::kLimiterSleep, wait_start_ns, wake_ns, g_global_frame_id.load(),
+                            wake_ns - target_ns);
+}
 
 CustomFpsLimiter::CustomFpsLimiter() : last_time_point_ns(0) {}
 
 void CustomFpsLimiter::LimitFrameRate(double fps) {
-    LONGLONG start_ts = utils::get_now_ns();
-    LONGLONG wait_target_ns = max(start_ts, last_time_point_ns + (utils::SEC_TO_NS / fps));
-
-    utils::wait_until_ns(wait_target_ns, m_timer_handle);
-    LONGLONG end_time_ns = utils::get_now_ns();
-    late_amount_ns = end_time_ns - wait_target_ns;
+    const bool adaptive = s_onpresent_adaptive_pacing.load();
+    if (adaptive != adaptive_pacing_was_enabled_) {
+        // Start learning from scratch whenever adaptive pacing is toggled
+        pacing_model_.Reset();
+        adaptive_pacing_was_enabled_ = adaptive;
+    }
 
-    last_time_point_ns = wait_target_ns;
+    const int64_t late_ns = PaceFrame(clock_, adaptive ? &pacing_model_ : nullptr, fps, last_time_point_ns);
+    late_amount_ns = late_ns;
+    g_limiter_late_stats.Add(late_ns);
+    adaptive_lead_ns_.store(pacing_model_.GetLeadNs(), std::memory_order_relaxed);
 }
 } // namespace dxgi::fps_limiter
@@ -1,9 +1,20 @@
 #pragma once
 
+#include "frame_pacing_model.hpp"
+
 #include <windows.h>
 
+#include <atomic>
+
 namespace dxgi::fps_limiter {
 
+// PacingClock backed by the addon's QPC time base and the calibrated timer/spin wait engine
+class SystemPacingClock : public PacingClock {
+  public:
+    int64_t NowNs() override;
+    void WaitUntilNs(int64_t target_ns) override;
+};
+
 class CustomFpsLimiter {
   public:
     CustomFpsLimiter();
@@ -12,9 +23,17 @@ class CustomFpsLimiter {
     // Main FPS limiting function - call this in OnPresent
     void LimitFrameRate(double fps);
 
+    // Current wake-up lead learned by the adaptive pacing model (0 when adaptive pacing is off)
+    LONGLONG GetAdaptiveLeadNs() const { return adaptive_lead_ns_.load(std::memory_order_relaxed); }
+
   private:
     // QPC for sleep
     LONGLONG last_time_point_ns = 0;
+
+    SystemPacingClock clock_;
+    FramePacingModel pacing_model_;
+    bool adaptive_pacing_was_enabled_ = false;
+    std::atomic<LONGLONG> adaptive_lead_ns_{0};
 };
 
 } // namespace dxgi::fps_limiter
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "../utils/decaying_duration_histogram.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace dxgi::fps_limiter {
+
+// Time source and wait primitive used by the frame limiter
+class PacingClock {
+  public:
+    virtual ~PacingClock() = default;
+
+    virtual int64_t NowNs() = 0;
+    virtual void WaitUntilNs(int64_t target_ns) = 0;
+};
+
+// Learns how late the wait primitive wakes up and schedules the wait target early by a
+// quantile of that overshoot.
+// Not thread-safe: owned by the thread that runs the limiter.
+class FramePacingModel {
+  public:
+    struct Config {
+        double overshoot_quantile = 0.5;    // how aggressively to compensate the overshoot
+        int64_t max_lead_ns = 1'000'000;    // never schedule more than 1 ms early
+        uint64_t min_samples = 32;          // learn before compensating
+    };
+
+    FramePacingModel() = default;
+    explicit FramePacingModel(const Config& config) : config_(config) {}
+
+    // Target to pass to the wait primitive for a frame that should start at ideal_target_ns
+    int64_t GetWaitTarget(int64_t ideal_target_ns) const { return ideal_target_ns - GetLeadNs(); }
+
+    // Feed back the actual wake-up of a wait issued with wait_target_ns
+    void ObserveWake(int64_t wait_target_ns, int64_t wake_ns) {
+        overshoot_.Add((std::max)(wake_ns - wait_target_ns, int64_t{0}));
+        lead_ns_ = (overshoot_.SampleCount() >= config_.min_samples)
+                       ? (std::min)(overshoot_.Quantile(config_.overshoot_quantile), config_.max_lead_ns)
+                       : 0;
+    }
+
+    int64_t GetLeadNs() const { return lead_ns_; }
+    int64_t GetOvershootQuantileNs(double q) const { return overshoot_.Quantile(q); }
+
+    void Reset() {
+        overshoot_.Reset();
+        lead_ns_ = 0;
+    }
+
+  private:
+    Config config_;
+    utils::DecayingDurationHistogram overshoot_;
+    int64_t lead_ns_ = 0;
+};
+
+// One OnPresentSync limiter step: wait until last_time_point_ns + 1/fps (or now if already late).
+// With a model, the wait is issued early by the learned overshoot lead and the wake is fed back.
+// Returns how late the wake-up was relative to the ideal target.
+inline int64_t PaceFrame(PacingClock& clock, FramePacingModel* model, double fps, int64_t& last_time_point_ns) {
+    const int64_t start_ns = clock.NowNs();
+    const int64_t ideal_target_ns =
+        (std::max)(start_ns, last_time_point_ns + static_cast<int64_t>(1'000'000'000.0 / fps));
+
+    const int64_t wait_target_ns = (model != nullptr) ? model->GetWaitTarget(ideal_target_ns) : ideal_target_ns;
+    clock.WaitUntilNs(wait_target_ns);
+    const int64_t wake_ns = clock.NowNs();
+
+    if (model != nullptr && wait_target_ns > start_ns) {
+        model->ObserveWake(wait_target_ns, wake_ns);
+    }
+
+    // Schedule from the ideal target so early/late wake-ups never accumulate into drift
+    last_time_point_ns = ideal_target_ns;
+    return wake_ns - ideal_target_ns;
+}
+
+} // namespace dxgi::fps_limiter
@@ -0,0 +1,74 @@
+#include "event_timeline.hpp"
+#include "utils/event_timeline_export.hpp"
+#include "utils/general_utils.hpp"
+#include "utils/logging.hpp"
+#include "utils/timing.hpp"
+
+#include <windows.h>
+
+#include <cstdio>
+#include <string>
+
+namespace {
+
+uint32_t CurrentOsThreadId() { return static_cast<uint32_t>(GetCurrentThreadId()); }
+
+utils::TimelineProcess CurrentProcess() {
+    utils::TimelineProcess process;
+    process.pid = static_cast<uint32_t>(GetCurrentProcessId());
+    char path[MAX_PATH] = {};
+    if (GetModuleFileNameA(nullptr, path, MAX_PATH) > 0) {
+        const char* name = path;
+        for (const char* p = path; *p != '\0'; ++p) {
+            if (*p == '\\' || *p == '/') {
+                name = p + 1;
+            }
+        }
+        process.name = name;
+    }
+    return process;
+}
+
+}  // namespace
+
+utils::EventTimeline g_event_timeline(CurrentOsThreadId);
+
+bool DumpEventTimeline(EventTimelineFormat format) {
+    if (!g_event_timeline.IsEnabled()) {
+        LogWarn("Event timeline: not enabled (Developer tab > Debug Tools)");
+        return false;
+    }
+    const utils::TimelineCapture capture = g_event_timeline.Capture(utils::get_now_ns() - kEventTimelineDumpWindowNs);
+    if (capture.records.empty()) {
+        LogWarn("Event timeline: no events in the last %lld s", kEventTimelineDumpWindowNs / utils::SEC_TO_NS);
+        return false;
+    }
+
+    const bool perfetto = (format == EventTimelineFormat::kPerfetto);
+    const std::string data = perfetto ? utils::ExportTimelinePerfetto(capture, CurrentProcess())
+                                      : utils::ExportTimelineChromeJson(capture, CurrentProcess());
+
+    SYSTEMTIME st;
+    GetLocalTime(&st);
+    char file_name[64];
+    snprintf(file_name, sizeof(file_name), "DisplayCommander_%04u%02u%02u_%02u%02u%02u.%s", st.wYear, st.wMonth,
+             st.wDay, st.wHour, st.wMinute, st.wSecond, perfetto ? "perfetto-trace" : "json");
+    // Next to the addon and its log, not the game's working directory
+    const std::string path_string = (GetAddonDirectory() / file_name).string();
+    const char* path = path_string.c_str();
+    std::FILE* file = std::fopen(path, "wb");
+    bool ok = file != nullptr;
+    if (ok) {
+        ok = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+        ok = (std::fclose(file) == 0) && ok;
+    }
+    if (!ok) {
+        LogError("Event timeline: failed to write %s", path);
+        return false;
+    }
+    LogInfo("Event timeline saved to %s (%zu events, %zu threads)", path, capture.records.size(),
+            capture.threads.size());
+    return true;
+}
+
+void ShutdownEventTimeline() { g_event_timeline.ReleaseBuffers(); }
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "utils/event_timeline.hpp"
+
+#include <cstdint>
+
+// Frame event flight recorder (sim, render submit, limiter sleeps, present, GPU completion, Reflex markers).
+// Enabled from the Developer tab; the last few seconds are dumped for chrome://tracing or ui.perfetto.dev.
+
+extern utils::EventTimeline g_event_timeline;
+
+constexpr int64_t kEventTimelineDumpWindowNs = 10LL * 1000000000LL;
+
+enum class EventTimelineFormat { kChromeJson, kPerfetto };
+
+// Writes the last kEventTimelineDumpWindowNs of events to DisplayCommander_<timestamp>.json / .perfetto-trace in
+// the addon directory. Returns false (and logs) if there is nothing to write or the file cannot be written.
+bool DumpEventTimeline(EventTimelineFormat format);
+
+// Disables the timeline and frees its event buffers (DLL detach)
+void ShutdownEventTimeline();
@@ -1,4 +1,5 @@
 #include "exit_handler.hpp"
+#include "config/display_commander_config.hpp"
 #include "display_restore.hpp"
 #include "utils.hpp"
 #include "utils/logging.hpp"
@@ -40,6 +41,13 @@ void OnHandleExit(ExitSource source, const std::string &message) {
     // Write to DisplayCommander.log using the logger system
     WriteToDebugLog(exit_message.str());
 
+    // Settings changed within the save debounce window
+    display_commander::config::flush_config();
+
+    // The writer thread may never run again (crash, ExitProcess); write out everything queued so far
+    display_commander::logger::Flush();
+    FlushDeferredLogs();
+
     if (!g_exit_handled.compare_exchange_strong(expected, true)) {
         // Another thread already handled the exit
         return;
@@ -197,8 +197,9 @@ std::atomic<FpsLimiterMode> s_fps_limiter_mode{FpsLimiterMode::kDisabled};
 // VBlank Sync Divisor (like VSync /2 /3 /4) - 0 to 8, default 1 (0 = off)
 
 // Performance stats (FPS/frametime) shared state
-std::atomic<uint32_t> g_perf_ring_head{0};
-PerfSample g_perf_ring[kPerfRingCapacity] = {};
+PerfRing g_perf_ring;
+PerfFrameTimeQuantiles g_perf_frame_time_quantiles;
+utils::FrameTraceRecorder g_frame_trace;
 std::atomic<double> g_perf_time_seconds{0.0};
 std::atomic<bool> g_perf_reset_requested{false};
 std::atomic<std::shared_ptr<const std::string>> g_perf_text_shared{std::make_shared<const std::string>("")};
@@ -294,38 +295,35 @@ DxgiBypassMode GetFlipStateForAPI(int api) {
 }
 
 // Swapchain event counters - reset on each swapchain creation
-// Separate event counter arrays for each category
-std::array<std::atomic<uint32_t>, NUM_RESHADE_EVENTS> g_reshade_event_counters = {};
-std::array<std::atomic<uint32_t>, NUM_DXGI_CORE_EVENTS> g_dxgi_core_event_counters = {};
-std::array<std::atomic<uint32_t>, NUM_DXGI_SC1_EVENTS> g_dxgi_sc1_event_counters = {};
-std::array<std::atomic<uint32_t>, NUM_DXGI_SC2_EVENTS> g_dxgi_sc2_event_counters = {};
-std::array<std::atomic<uint32_t>, NUM_DXGI_SC3_EVENTS> g_dxgi_sc3_event_counters = {};
-std::array<std::atomic<uint32_t>, NUM_DXGI_FACTORY_EVENTS> g_dxgi_factory_event_counters = {};
-std::array<std::atomic<uint32_t>, NUM_DXGI_SC4_EVENTS> g_dxgi_sc4_event_counters = {};
-std::array<std::atomic<uint32_t>, NUM_DXGI_OUTPUT_EVENTS> g_dxgi_output_event_counters = {};
-std::array<std::atomic<uint32_t>, NUM_DX9_EVENTS> g_dx9_event_counters = {};
-std::array<std::atomic<uint32_t>, NUM_STREAMLINE_EVENTS> g_streamline_event_counters = {};
-std::array<std::atomic<uint32_t>, NUM_D3D11_TEXTURE_EVENTS> g_d3d11_texture_event_counters = {};
-std::array<std::atomic<uint32_t>, NUM_D3D_SAMPLER_EVENTS> g_d3d_sampler_event_counters = {};
-std::array<std::atomic<uint32_t>, NUM_SAMPLER_FILTER_MODES> g_sampler_filter_mode_counters = {};
-std::array<std::atomic<uint32_t>, NUM_SAMPLER_ADDRESS_MODES> g_sampler_address_mode_counters = {};
-std::array<std::atomic<uint32_t>, MAX_ANISOTROPY_LEVELS> g_sampler_anisotropy_level_counters = {};
+// Separate event counter tables for each category, sharded per thread (see utils/counter_registry.hpp)
+utils::CounterRegistry<uint32_t, NUM_RESHADE_EVENTS> g_reshade_event_counters;
+utils::CounterRegistry<uint32_t, NUM_DXGI_CORE_EVENTS> g_dxgi_core_event_counters;
+utils::CounterRegistry<uint32_t, NUM_DXGI_SC1_EVENTS> g_dxgi_sc1_event_counters;
+utils::CounterRegistry<uint32_t, NUM_DXGI_SC2_EVENTS> g_dxgi_sc2_event_counters;
+utils::CounterRegistry<uint32_t, NUM_DXGI_SC3_EVENTS> g_dxgi_sc3_event_counters;
+utils::CounterRegistry<uint32_t, NUM_DXGI_FACTORY_EVENTS> g_dxgi_factory_event_counters;
+utils::CounterRegistry<uint32_t, NUM_DXGI_SC4_EVENTS> g_dxgi_sc4_event_counters;
+utils::CounterRegistry<uint32_t, NUM_DXGI_OUTPUT_EVENTS> g_dxgi_output_event_counters;
+utils::CounterRegistry<uint32_t, NUM_DX9_EVENTS> g_dx9_event_counters;
+utils::CounterRegistry<uint32_t, NUM_STREAMLINE_EVENTS> g_streamline_event_counters;
+utils::CounterRegistry<uint32_t, NUM_D3D11_TEXTURE_EVENTS> g_d3d11_texture_event_counters;
+utils::CounterRegistry<uint32_t, NUM_D3D_SAMPLER_EVENTS> g_d3d_sampler_event_counters;
+utils::CounterRegistry<uint32_t, NUM_SAMPLER_FILTER_MODES> g_sampler_filter_mode_counters;
+utils::CounterRegistry<uint32_t, NUM_SAMPLER_ADDRESS_MODES> g_sampler_address_mode_counters;
+utils::CounterRegistry<uint32_t, MAX_ANISOTROPY_LEVELS> g_sampler_anisotropy_level_counters;
 
 // NVAPI event counters - separate from swapchain events
-std::array<std::atomic<uint32_t>, NUM_NVAPI_EVENTS> g_nvapi_event_counters = {}; // Array for NVAPI events
+utils::CounterRegistry<uint32_t, NUM_NVAPI_EVENTS> g_nvapi_event_counters; // Table for NVAPI events
 
 // NVAPI sleep timestamp tracking
 std::atomic<uint64_t> g_nvapi_last_sleep_timestamp_ns{0}; // Last NVAPI_D3D_Sleep call timestamp in nanoseconds
 
-std::atomic<uint32_t> g_swapchain_event_total_count{0}; // Total events across all types
 
 // OpenGL hook counters
-std::array<std::atomic<uint64_t>, NUM_OPENGL_HOOKS> g_opengl_hook_counters = {}; // Array for all OpenGL hook events
-std::atomic<uint64_t> g_opengl_hook_total_count{0}; // Total OpenGL hook events across all types
+utils::CounterRegistry<uint64_t, NUM_OPENGL_HOOKS> g_opengl_hook_counters; // Table for all OpenGL hook events
 
 // Display settings hook counters
-std::array<std::atomic<uint64_t>, NUM_DISPLAY_SETTINGS_HOOKS> g_display_settings_hook_counters = {}; // Array for all display settings hook events
-std::atomic<uint64_t> g_display_settings_hook_total_count{0}; // Total display settings hook events across all types
+utils::CounterRegistry<uint64_t, NUM_DISPLAY_SETTINGS_HOOKS> g_display_settings_hook_counters; // Table for all display settings hook events
 
 // Present pacing delay as percentage of frame time - 0% to 100%
 // This adds a delay after present to improve frame pacing and reduce CPU usage
@@ -333,6 +331,7 @@ std::atomic<uint64_t> g_display_settings_hook_total_count{0}; // Total display s
 // 0% = no delay, 100% = full frame time delay between simulation start and present
 
 std::atomic<LONGLONG> late_amount_ns{0};
+utils::IntervalAccumulator g_limiter_late_stats;
 
 // GPU completion measurement using EnqueueSetEvent
 std::atomic<HANDLE> g_gpu_completion_event{nullptr};  // Event handle for GPU completion measurement
@@ -342,15 +341,11 @@ std::atomic<LONGLONG> g_gpu_duration_ns{0};  // Last measured GPU duration (smoo
 // GPU completion failure tracking
 std::atomic<const char*> g_gpu_fence_failure_reason{nullptr};  // Reason why GPU fence creation/usage failed (nullptr if no failure)
 
-// Sim-start-to-display latency measurement
-std::atomic<LONGLONG> g_sim_start_ns_for_measurement{0};  // g_sim_start_ns captured when EnqueueGPUCompletion is called
-std::atomic<bool> g_present_update_after2_called{false};  // Tracks if OnPresentUpdateAfter2 was called
-std::atomic<bool> g_gpu_completion_callback_finished{false};  // Tracks if GPU completion callback finished
-std::atomic<LONGLONG> g_sim_to_display_latency_ns{0};  // Measured sim-start-to-display latency (smoothed)
+// Per-frame latency records
+utils::FrameLatencyRing g_frame_latency;
 
-// GPU late time measurement (how much later GPU finishes compared to OnPresentUpdateAfter2)
-std::atomic<LONGLONG> g_present_update_after2_time_ns{0};  // Time when OnPresentUpdateAfter2 was called
-std::atomic<LONGLONG> g_gpu_completion_callback_time_ns{0};  // Time when GPU completion callback finished
+// Sim-start-to-display latency measurement, smoothed over finalized frames
+std::atomic<LONGLONG> g_sim_to_display_latency_ns{0};  // Measured sim-start-to-display latency (smoothed)
 std::atomic<LONGLONG> g_gpu_late_time_ns{0};  // GPU late time (0 if GPU finished first, otherwise difference)
 
 // NVIDIA Reflex minimal controls (disabled by default)
@@ -395,6 +390,8 @@ HWND g_proxy_hwnd = nullptr;
 
 // Experimental tab settings global instance
 namespace settings {
+// Defined before g_experimentalTabSettings, whose wrappers bind to its slots
+ExperimentalHotSettings g_experimental_hot_settings;
 ExperimentalTabSettings g_experimentalTabSettings;
 DeveloperTabSettings g_developerTabSettings;
 MainTabSettings g_mainTabSettings;
@@ -420,7 +417,7 @@ void LoadAllSettingsAtStartup() {
 nvapi::FakeNvapiManager g_fakeNvapiManager;
 
 // NGX Parameter Storage global instance
-UnifiedParameterMap g_ngx_parameters;
+utils::NgxParameterStore g_ngx_parameters;
 
 // NGX Counters global instance
 NGXCounters g_ngx_counters;
@@ -436,10 +433,10 @@ DLSSGSummary GetDLSSGSummary() {
 
     // Get resolutions - using correct parameter names
     unsigned int internal_width, internal_height, output_width, output_height;
-    bool has_internal_width = g_ngx_parameters.get_as_uint("DLSS.Render.Subrect.Dimensions.Width", internal_width);
-    bool has_internal_height = g_ngx_parameters.get_as_uint("DLSS.Render.Subrect.Dimensions.Height", internal_height);
-    bool has_output_width = g_ngx_parameters.get_as_uint("OutWidth", output_width);
-    bool has_output_height = g_ngx_parameters.get_as_uint("OutHeight", output_height);
+    bool has_internal_width = g_ngx_parameters.GetAsUint("DLSS.Render.Subrect.Dimensions.Width", internal_width);
+    bool has_internal_height = g_ngx_parameters.GetAsUint("DLSS.Render.Subrect.Dimensions.Height", internal_height);
+    bool has_output_width = g_ngx_parameters.GetAsUint("OutWidth", output_width);
+    bool has_output_height = g_ngx_parameters.GetAsUint("OutHeight", output_height);
 
     if (has_internal_width && has_internal_height) {
         summary.internal_resolution = std::to_string(internal_width) + "x" + std::to_string(internal_height);
@@ -459,7 +456,7 @@ DLSSGSummary GetDLSSGSummary() {
 
     // Get quality preset based on PerfQualityValue (like Special-K does)
     unsigned int perf_quality;
-    if (g_ngx_parameters.get_as_uint("PerfQualityValue", perf_quality)) {
+    if (g_ngx_parameters.GetAsUint("PerfQualityValue", perf_quality)) {
         switch (perf_quality) {
             case 0: // NVSDK_NGX_PerfQuality_Value_MaxPerf
                 summary.quality_preset = "Performance";
@@ -487,14 +484,14 @@ DLSSGSummary GetDLSSGSummary() {
 
     // Get camera information
     float aspect_ratio;
-    if (g_ngx_parameters.get_as_float("DLSSG.CameraAspectRatio", aspect_ratio)) {
+    if (g_ngx_parameters.GetAsFloat("DLSSG.CameraAspectRatio", aspect_ratio)) {
         char buffer[32];
         snprintf(buffer, sizeof(buffer), "%.4f", aspect_ratio);
         summary.aspect_ratio = std::string(buffer);
     }
 
     float fov;
-    if (g_ngx_parameters.get_as_float("DLSSG.CameraFOV", fov)) {
+    if (g_ngx_parameters.GetAsFloat("DLSSG.CameraFOV", fov)) {
         char buffer[32];
         snprintf(buffer, sizeof(buffer), "%.4f", fov);
         summary.fov = std::string(buffer);
@@ -502,13 +499,13 @@ DLSSGSummary GetDLSSGSummary() {
 
     // Get jitter offset
     float jitter_x, jitter_y;
-    bool has_jitter_x = g_ngx_parameters.get_as_float("DLSSG.JitterOffsetX", jitter_x);
-    bool has_jitter_y = g_ngx_parameters.get_as_float("DLSSG.JitterOffsetY", jitter_y);
+    bool has_jitter_x = g_ngx_parameters.GetAsFloat("DLSSG.JitterOffsetX", jitter_x);
+    bool has_jitter_y = g_ngx_parameters.GetAsFloat("DLSSG.JitterOffsetY", jitter_y);
     if (!has_jitter_x) {
-        has_jitter_x = g_ngx_parameters.get_as_float("Jitter.Offset.X", jitter_x);
+        has_jitter_x = g_ngx_parameters.GetAsFloat("Jitter.Offset.X", jitter_x);
     }
     if (!has_jitter_y) {
-        has_jitter_y = g_ngx_parameters.get_as_float("Jitter.Offset.Y", jitter_y);
+        has_jitter_y = g_ngx_parameters.GetAsFloat("Jitter.Offset.Y", jitter_y);
     }
     if (has_jitter_x && has_jitter_y) {
         char buffer[64];
@@ -518,8 +515,8 @@ DLSSGSummary GetDLSSGSummary() {
 
     // Get exposure information
     float pre_exposure, exposure_scale;
-    bool has_pre_exposure = g_ngx_parameters.get_as_float("DLSS.Pre.Exposure", pre_exposure);
-    bool has_exposure_scale = g_ngx_parameters.get_as_float("DLSS.Exposure.Scale", exposure_scale);
+    bool has_pre_exposure = g_ngx_parameters.GetAsFloat("DLSS.Pre.Exposure", pre_exposure);
+    bool has_exposure_scale = g_ngx_parameters.GetAsFloat("DLSS.Exposure.Scale", exposure_scale);
     if (has_pre_exposure && has_exposure_scale) {
         char buffer[64];
         snprintf(buffer, sizeof(buffer), "Pre: %.2f, Scale: %.2f", pre_exposure, exposure_scale);
@@ -528,25 +525,25 @@ DLSSGSummary GetDLSSGSummary() {
 
     // Get depth inversion status
     int depth_inverted;
-    if (g_ngx_parameters.get_as_int("DLSSG.DepthInverted", depth_inverted)) {
+    if (g_ngx_parameters.GetAsInt("DLSSG.DepthInverted", depth_inverted)) {
         summary.depth_inverted = (depth_inverted == 1) ? "Yes" : "No";
     }
 
     // Get HDR status
     int hdr_enabled;
-    if (g_ngx_parameters.get_as_int("DLSSG.ColorBuffersHDR", hdr_enabled)) {
+    if (g_ngx_parameters.GetAsInt("DLSSG.ColorBuffersHDR", hdr_enabled)) {
         summary.hdr_enabled = (hdr_enabled == 1) ? "Yes" : "No";
     }
 
     // Get motion vectors status
     int motion_included;
-    if (g_ngx_parameters.get_as_int("DLSSG.CameraMotionIncluded", motion_included)) {
+    if (g_ngx_parameters.GetAsInt("DLSSG.CameraMotionIncluded", motion_included)) {
         summary.motion_vectors_included = (motion_included == 1) ? "Yes" : "No";
     }
 
     // Get frame time delta
     float frame_time;
-    if (g_ngx_parameters.get_as_float("FrameTimeDeltaInMsec", frame_time)) {
+    if (g_ngx_parameters.GetAsFloat("FrameTimeDeltaInMsec", frame_time)) {
         char buffer[32];
         snprintf(buffer, sizeof(buffer), "%.2f ms", frame_time);
         summary.frame_time_delta = std::string(buffer);
@@ -554,7 +551,7 @@ DLSSGSummary GetDLSSGSummary() {
 
     // Get sharpness
     float sharpness;
-    if (g_ngx_parameters.get_as_float("Sharpness", sharpness)) {
+    if (g_ngx_parameters.GetAsFloat("Sharpness", sharpness)) {
         char buffer[32];
         snprintf(buffer, sizeof(buffer), "%.3f", sharpness);
         summary.sharpness = std::string(buffer);
@@ -562,17 +559,17 @@ DLSSGSummary GetDLSSGSummary() {
 
     // Get tonemapper type
     unsigned int tonemapper;
-    if (g_ngx_parameters.get_as_uint("TonemapperType", tonemapper)) {
+    if (g_ngx_parameters.GetAsUint("TonemapperType", tonemapper)) {
         summary.tonemapper_type = std::to_string(tonemapper);
     }
 
     // Get DLSS-G frame generation mode
     int enable_interp;
-    if (g_ngx_parameters.get_as_int("DLSSG.EnableInterp", enable_interp)) {
+    if (g_ngx_parameters.GetAsInt("DLSSG.EnableInterp", enable_interp)) {
         if (enable_interp == 1) {
             // DLSS-G is enabled, check MultiFrameCount for mode
             unsigned int multi_frame_count;
-            if (g_ngx_parameters.get_as_uint("DLSSG.MultiFrameCount", multi_frame_count)) {
+            if (g_ngx_parameters.GetAsUint("DLSSG.MultiFrameCount", multi_frame_count)) {
                 if (multi_frame_count == 1) {
                     summary.fg_mode = "2x";
                 } else if (multi_frame_count == 2) {
@@ -596,7 +593,7 @@ DLSSGSummary GetDLSSGSummary() {
 
     // Get NVIDIA Optical Flow Accelerator (OFA) status
     int ofa_enabled;
-    if (g_ngx_parameters.get_as_int("Enable.OFA", ofa_enabled)) {
+    if (g_ngx_parameters.GetAsInt("Enable.OFA", ofa_enabled)) {
         summary.ofa_enabled = (ofa_enabled == 1) ? "Yes" : "No";
     }
 
@@ -705,10 +702,6 @@ size_t GetReShadeRuntimeCount() {
 // NGX preset initialization tracking
 std::atomic<bool> g_ngx_presets_initialized{false};
 
-// Swapchain wrapper statistics
-SwapChainWrapperStats g_swapchain_wrapper_stats_proxy;
-SwapChainWrapperStats g_swapchain_wrapper_stats_native;
-
 // Cached frame statistics (updated in present detour, read by monitoring thread)
 std::atomic<std::shared_ptr<DXGI_FRAME_STATISTICS>> g_cached_frame_stats{nullptr};
 
@@ -718,59 +711,59 @@ DLSSModelProfile GetDLSSModelProfile() {
 
     // Read Super Resolution preset values
     int sr_quality;
-    if (g_ngx_parameters.get_as_int("DLSS.Hint.Render.Preset.Quality", sr_quality)) {
+    if (g_ngx_parameters.GetAsInt("DLSS.Hint.Render.Preset.Quality", sr_quality)) {
         profile.sr_quality_preset = sr_quality;
         profile.is_valid = true;
     }
 
     int sr_balanced;
-    if (g_ngx_parameters.get_as_int("DLSS.Hint.Render.Preset.Balanced", sr_balanced)) {
+    if (g_ngx_parameters.GetAsInt("DLSS.Hint.Render.Preset.Balanced", sr_balanced)) {
         profile.sr_balanced_preset = sr_balanced;
     }
 
     int sr_performance;
-    if (g_ngx_parameters.get_as_int("DLSS.Hint.Render.Preset.Performance", sr_performance)) {
+    if (g_ngx_parameters.GetAsInt("DLSS.Hint.Render.Preset.Performance", sr_performance)) {
         profile.sr_performance_preset = sr_performance;
     }
 
     int sr_ultra_performance;
-    if (g_ngx_parameters.get_as_int("DLSS.Hint.Render.Preset.UltraPerformance", sr_ultra_performance)) {
+    if (g_ngx_parameters.GetAsInt("DLSS.Hint.Render.Preset.UltraPerformance", sr_ultra_performance)) {
         profile.sr_ultra_performance_preset = sr_ultra_performance;
     }
 
     int sr_ultra_quality;
-    if (g_ngx_parameters.get_as_int("DLSS.Hint.Render.Preset.UltraQuality", sr_ultra_quality)) {
+    if (g_ngx_parameters.GetAsInt("DLSS.Hint.Render.Preset.UltraQuality", sr_ultra_quality)) {
         profile.sr_ultra_quality_preset = sr_ultra_quality;
     }
 
     int sr_dlaa;
-    if (g_ngx_parameters.get_as_int("DLSS.Hint.Render.Preset.DLAA", sr_dlaa)) {
+    if (g_ngx_parameters.GetAsInt("DLSS.Hint.Render.Preset.DLAA", sr_dlaa)) {
         profile.sr_dlaa_preset = sr_dlaa;
     }
 
     // Read Ray Reconstruction preset values
     int rr_quality;
-    if (g_ngx_parameters.get_as_int("RayReconstruction.Hint.Render.Preset.Quality", rr_quality)) {
+    if (g_ngx_parameters.GetAsInt("RayReconstruction.Hint.Render.Preset.Quality", rr_quality)) {
         profile.rr_quality_preset = rr_quality;
     }
 
     int rr_balanced;
-    if (g_ngx_parameters.get_as_int("RayReconstruction.Hint.Render.Preset.Balanced", rr_balanced)) {
+    if (g_ngx_parameters.GetAsInt("RayReconstruction.Hint.Render.Preset.Balanced", rr_balanced)) {
         profile.rr_balanced_preset = rr_balanced;
     }
 
     int rr_performance;
-    if (g_ngx_parameters.get_as_int("RayReconstruction.Hint.Render.Preset.Performance", rr_performance)) {
+    if (g_ngx_parameters.GetAsInt("RayReconstruction.Hint.Render.Preset.Performance", rr_performance)) {
         profile.rr_performance_preset = rr_performance;
     }
 
     int rr_ultra_performance;
-    if (g_ngx_parameters.get_as_int("RayReconstruction.Hint.Render.Preset.UltraPerformance", rr_ultra_performance)) {
+    if (g_ngx_parameters.GetAsInt("RayReconstruction.Hint.Render.Preset.UltraPerformance", rr_ultra_performance)) {
         profile.rr_ultra_performance_preset = rr_ultra_performance;
     }
 
     int rr_ultra_quality;
-    if (g_ngx_parameters.get_as_int("RayReconstruction.Hint.Render.Preset.UltraQuality", rr_ultra_quality)) {
+    if (g_ngx_parameters.GetAsInt("RayReconstruction.Hint.Render.Preset.UltraQuality", rr_ultra_quality)) {
         profile.rr_ultra_quality_preset = rr_ultra_quality;
     }
 
@@ -3,8 +3,16 @@
 #include "display_cache.hpp"
 #include "dxgi/custom_fps_limiter.hpp"
 #include "latent_sync/latent_sync_manager.hpp"
+#include "utils/counter_registry.hpp"
+#include "utils/frame_latency_ring.hpp"
+#include "utils/frame_trace.hpp"
+#include "utils/ngx_parameter_store.hpp"
+#include "utils/seqlock_ring.hpp"
+#include "utils/shared_stats_block.hpp"
 #include "utils/srwlock_wrapper.hpp"
+#include "utils/streaming_quantiles.hpp"
 #include "utils/timing.hpp"
+#include "utils/tracked_object_table.hpp"
 
 #include <windows.h>
 
@@ -70,188 +78,8 @@ class LatentSyncManager;
 class LatencyManager;
 class SwapchainTrackingManager;
 
-// Unified parameter value that can hold multiple types
-struct ParameterValue {
-    enum Type { INT, UINT, FLOAT, DOUBLE, ULL };
-    Type type;
-    union {
-        int int_val;
-        unsigned int uint_val;
-        float float_val;
-        double double_val;
-        uint64_t ull_val;
-    };
-
-    ParameterValue() : type(INT), int_val(0) {}
-    ParameterValue(int val) : type(INT), int_val(val) {}
-    ParameterValue(unsigned int val) : type(UINT), uint_val(val) {}
-    ParameterValue(float val) : type(FLOAT), float_val(val) {}
-    ParameterValue(double val) : type(DOUBLE), double_val(val) {}
-    ParameterValue(uint64_t val) : type(ULL), ull_val(val) {}
-
-    // Type conversion methods
-    int get_as_int() const {
-        switch (type) {
-            case INT: return int_val;
-            case UINT: return static_cast<int>(uint_val);
-            case FLOAT: return static_cast<int>(float_val);
-            case DOUBLE: return static_cast<int>(double_val);
-            case ULL: return static_cast<int>(ull_val);
-            default: return 0;
-        }
-    }
-
-    unsigned int get_as_uint() const {
-        switch (type) {
-            case INT: return static_cast<unsigned int>(int_val);
-            case UINT: return uint_val;
-            case FLOAT: return static_cast<unsigned int>(float_val);
-            case DOUBLE: return static_cast<unsigned int>(double_val);
-            case ULL: return static_cast<unsigned int>(ull_val);
-            default: return 0;
-        }
-    }
-
-    float get_as_float() const {
-        switch (type) {
-            case INT: return static_cast<float>(int_val);
-            case UINT: return static_cast<float>(uint_val);
-            case FLOAT: return float_val;
-            case DOUBLE: return static_cast<float>(double_val);
-            case ULL: return static_cast<float>(ull_val);
-            default: return 0.0f;
-        }
-    }
-
-    double get_as_double() const {
-        switch (type) {
-            case INT: return static_cast<double>(int_val);
-            case UINT: return static_cast<double>(uint_val);
-            case FLOAT: return static_cast<double>(float_val);
-            case DOUBLE: return double_val;
-            case ULL: return static_cast<double>(ull_val);
-            default: return 0.0;
-        }
-    }
-
-    uint64_t get_as_ull() const {
-        switch (type) {
-            case INT: return static_cast<uint64_t>(int_val);
-            case UINT: return static_cast<uint64_t>(uint_val);
-            case FLOAT: return static_cast<uint64_t>(float_val);
-            case DOUBLE: return static_cast<uint64_t>(double_val);
-            case ULL: return ull_val;
-            default: return 0;
-        }
-    }
-};
-
-// Unified atomic parameter storage system
-class UnifiedParameterMap {
-private:
-    std::atomic<std::shared_ptr<std::unordered_map<std::string, ParameterValue>>> data_ = std::make_shared<std::unordered_map<std::string, ParameterValue>>();
-
-public:
-    UnifiedParameterMap() {}
-
-    // Update parameter value (thread-safe)
-    void update(const std::string& key, const ParameterValue& value) {
-        // First, try to update existing data without copying
-        {
-            auto current_data = data_.load();
-            if (current_data->find(key) != current_data->end()) {
-                // Key exists, update in place (this is safe because we're only updating values, not structure)
-                (*current_data)[key] = value;
-                return;
-            }
-        }
-
-        // Key doesn't exist, need to copy and update
-        auto current_data = data_.load();
-        auto new_data = std::make_shared<std::unordered_map<std::string, ParameterValue>>(*current_data);
-        (*new_data)[key] = value;
-        data_.store(new_data);
-    }
-
-    // Convenience update methods
-    void update_int(const std::string& key, int value) { update(key, ParameterValue(value)); }
-    void update_uint(const std::string& key, unsigned int value) { update(key, ParameterValue(value)); }
-    void update_float(const std::string& key, float value) { update(key, ParameterValue(value)); }
-    void update_double(const std::string& key, double value) { update(key, ParameterValue(value)); }
-    void update_ull(const std::string& key, uint64_t value) { update(key, ParameterValue(value)); }
-
-    // Get parameter value (thread-safe)
-    bool get(const std::string& key, ParameterValue& value) const {
-        auto current_data = data_.load();
-        auto it = current_data->find(key);
-        if (it != current_data->end()) {
-            value = it->second;
-            return true;
-        }
-        return false;
-    }
-
-    // Type-specific get methods with conversion
-    bool get_as_int(const std::string& key, int& value) const {
-        ParameterValue param;
-        if (get(key, param)) {
-            value = param.get_as_int();
-            return true;
-        }
-        return false;
-    }
-
-    bool get_as_uint(const std::string& key, unsigned int& value) const {
-        ParameterValue param;
-        if (get(key, param)) {
-            value = param.get_as_uint();
-            return true;
-        }
-        return false;
-    }
-
-    bool get_as_float(const std::string& key, float& value) const {
-        ParameterValue param;
-        if (get(key, param)) {
-            value = param.get_as_float();
-            return true;
-        }
-        return false;
-    }
-
-    bool get_as_double(const std::string& key, double& value) const {
-        ParameterValue param;
-        if (get(key, param)) {
-            value = param.get_as_double();
-            return true;
-        }
-        return false;
-    }
-
-    bool get_as_ull(const std::string& key, uint64_t& value) const {
-        ParameterValue param;
-        if (get(key, param)) {
-            value = param.get_as_ull();
-            return true;
-        }
-        return false;
-    }
-
-    // Get all parameters (thread-safe)
-    std::shared_ptr<std::unordered_map<std::string, ParameterValue>> get_all() const {
-        return data_.load();
-    }
-
-    // Get parameter count (thread-safe)
-    size_t size() const {
-        return data_.load()->size();
-    }
-
-    // Clear all parameters (thread-safe)
-    void clear() {
-        data_.store(std::make_shared<std::unordered_map<std::string, ParameterValue>>());
-    }
-};
+// Unified parameter value that can hold multiple types (see utils/ngx_parameter_store.hpp)
+using ParameterValue = utils::NgxParameterValue;
 
 // DLL initialization state
 extern std::atomic<bool> g_dll_initialization_complete;
@@ -359,97 +187,52 @@ struct GlobalWindowState {
     }
 };
 
-// Swapchain tracking manager for thread-safe swapchain management
+// Swapchain tracking manager for thread-safe swapchain management. Lookups from the present hooks are
+// lock-free (see utils::TrackedObjectTable); adding and removing swapchains is rare and serialized.
 class SwapchainTrackingManager {
 private:
-    std::unordered_set<IDXGISwapChain*> hooked_swapchains_;
-    mutable SRWLOCK lock_;
+    utils::TrackedObjectTable<IDXGISwapChain*> hooked_swapchains_;
 
 public:
-    SwapchainTrackingManager() : lock_(SRWLOCK_INIT) {}
+    SwapchainTrackingManager() = default;
 
     // Add a swapchain to the tracked set
-    bool AddSwapchain(IDXGISwapChain* swapchain) {
-        if (swapchain == nullptr) {
-            return false;
-        }
-
-        utils::SRWLockExclusive lock(lock_);
-
-        // Check if already tracked
-        if (hooked_swapchains_.find(swapchain) != hooked_swapchains_.end()) {
-            return false; // Already tracked
-        }
-
-        hooked_swapchains_.insert(swapchain);
-        return true;
-    }
+    bool AddSwapchain(IDXGISwapChain* swapchain) { return hooked_swapchains_.Insert(swapchain); }
 
     // Remove a swapchain from the tracked set
-    bool RemoveSwapchain(IDXGISwapChain* swapchain) {
-        if (swapchain == nullptr) {
-            return false;
-        }
-
-        utils::SRWLockExclusive lock(lock_);
-
-        auto it = hooked_swapchains_.find(swapchain);
-        if (it != hooked_swapchains_.end()) {
-            hooked_swapchains_.erase(it);
-            return true;
-        }
-
-        return false; // Not found
-    }
+    bool RemoveSwapchain(IDXGISwapChain* swapchain) { return hooked_swapchains_.Remove(swapchain); }
 
     // Check if a swapchain is being tracked
-    bool IsSwapchainTracked(IDXGISwapChain* swapchain) const {
-        if (swapchain == nullptr) {
-            return false;
-        }
-
-        utils::SRWLockShared lock(lock_);
-        return hooked_swapchains_.find(swapchain) != hooked_swapchains_.end();
-    }
+    bool IsSwapchainTracked(IDXGISwapChain* swapchain) const { return hooked_swapchains_.Contains(swapchain); }
 
     // Get all tracked swapchains (returns a copy for thread safety)
     std::vector<IDXGISwapChain*> GetAllTrackedSwapchains() const {
-        utils::SRWLockShared lock(lock_);
-        return std::vector<IDXGISwapChain*>(hooked_swapchains_.begin(), hooked_swapchains_.end());
+        std::vector<IDXGISwapChain*> swapchains;
+        ForEachTrackedSwapchain([&swapchains](IDXGISwapChain* swapchain) { swapchains.push_back(swapchain); });
+        return swapchains;
     }
 
     // Get the number of tracked swapchains
-    size_t GetTrackedSwapchainCount() const {
-        utils::SRWLockShared lock(lock_);
-        return hooked_swapchains_.size();
-    }
+    size_t GetTrackedSwapchainCount() const { return hooked_swapchains_.size(); }
 
     // Clear all tracked swapchains
-    void ClearAll() {
-        utils::SRWLockExclusive lock(lock_);
-        hooked_swapchains_.clear();
-    }
+    void ClearAll() { hooked_swapchains_.Clear(); }
 
     // Check if any swapchains are being tracked
-    bool HasTrackedSwapchains() const {
-        utils::SRWLockShared lock(lock_);
-        return !hooked_swapchains_.empty();
-    }
+    bool HasTrackedSwapchains() const { return !hooked_swapchains_.empty(); }
 
-    // Iterate through all tracked swapchains while holding the lock
-    // The callback is called for each swapchain while the lock is held
+    // Iterate through all tracked swapchains; swapchains removed meanwhile may or may not be visited
     template<typename Callback>
     void ForEachTrackedSwapchain(Callback&& callback) const {
-        utils::SRWLockShared lock(lock_);
-        for (IDXGISwapChain* swapchain : hooked_swapchains_) {
+        decltype(hooked_swapchains_)::ReadGuard guard(hooked_swapchains_);
+        hooked_swapchains_.ForEach(guard, [&callback](IDXGISwapChain* swapchain, const utils::NoTrackedPayload&) {
             callback(swapchain);
-        }
+        });
     }
 };
 
-// Performance stats structure
+// Performance stats structure (timestamp is stored per slot by the perf ring)
 struct PerfSample {
-    //double timestamp_seconds;
     float dt;
 };
 
@@ -619,8 +402,6 @@ extern std::atomic<FpsLimiterMode> s_fps_limiter_mode;
 #define FPS_LIMITER_INJECTION_FALLBACK2              2
 
 // Performance stats (FPS/frametime) shared state
-extern std::atomic<uint32_t> g_perf_ring_head;
-extern PerfSample g_perf_ring[];
 extern std::atomic<double> g_perf_time_seconds;
 extern std::atomic<bool> g_perf_reset_requested;
 extern std::atomic<std::shared_ptr<const std::string>> g_perf_text_shared;
@@ -651,6 +432,17 @@ extern std::atomic<ActionNotification> g_action_notification;
 // Lock-free ring buffer for recent FPS samples (60s window at ~240 Hz -> 14400 max)
 constexpr size_t kPerfRingCapacity = 65536;
 
+// Written only by RecordFrameTime(); readers get torn-read-free, timestamped snapshots
+using PerfRing = utils::SeqlockRing<PerfSample, kPerfRingCapacity>;
+extern PerfRing g_perf_ring;
+
+// Streaming frame time percentiles over the same window as g_perf_ring (updated in RecordFrameTime)
+using PerfFrameTimeQuantiles = utils::StreamingQuantileHistogram<kPerfRingCapacity>;
+extern PerfFrameTimeQuantiles g_perf_frame_time_quantiles;
+
+// Frame-pacing pipeline trace (present/GPU/limiter events), recorded on demand from the Developer tab
+extern utils::FrameTraceRecorder g_frame_trace;
+
 // Vector variables
 extern std::atomic<std::shared_ptr<const std::vector<MonitorInfo>>> g_monitors;
 
@@ -966,38 +758,35 @@ enum NvapiEventIndex {
 };
 
 // Swapchain event counters - reset on each swapchain creation
-// Separate event counter arrays for each category
-extern std::array<std::atomic<uint32_t>, NUM_RESHADE_EVENTS> g_reshade_event_counters;
-extern std::array<std::atomic<uint32_t>, NUM_DXGI_CORE_EVENTS> g_dxgi_core_event_counters;
-extern std::array<std::atomic<uint32_t>, NUM_DXGI_SC1_EVENTS> g_dxgi_sc1_event_counters;
-extern std::array<std::atomic<uint32_t>, NUM_DXGI_SC2_EVENTS> g_dxgi_sc2_event_counters;
-extern std::array<std::atomic<uint32_t>, NUM_DXGI_SC3_EVENTS> g_dxgi_sc3_event_counters;
-extern std::array<std::atomic<uint32_t>, NUM_DXGI_FACTORY_EVENTS> g_dxgi_factory_event_counters;
-extern std::array<std::atomic<uint32_t>, NUM_DXGI_SC4_EVENTS> g_dxgi_sc4_event_counters;
-extern std::array<std::atomic<uint32_t>, NUM_DXGI_OUTPUT_EVENTS> g_dxgi_output_event_counters;
-extern std::array<std::atomic<uint32_t>, NUM_DX9_EVENTS> g_dx9_event_counters;
-extern std::array<std::atomic<uint32_t>, NUM_STREAMLINE_EVENTS> g_streamline_event_counters;
-extern std::array<std::atomic<uint32_t>, NUM_D3D11_TEXTURE_EVENTS> g_d3d11_texture_event_counters;
-extern std::array<std::atomic<uint32_t>, NUM_D3D_SAMPLER_EVENTS> g_d3d_sampler_event_counters;
-extern std::array<std::atomic<uint32_t>, NUM_SAMPLER_FILTER_MODES> g_sampler_filter_mode_counters;
-extern std::array<std::atomic<uint32_t>, NUM_SAMPLER_ADDRESS_MODES> g_sampler_address_mode_counters;
-extern std::array<std::atomic<uint32_t>, MAX_ANISOTROPY_LEVELS> g_sampler_anisotropy_level_counters;
+// Separate event counter tables for each category, sharded per thread (see utils/counter_registry.hpp)
+extern utils::CounterRegistry<uint32_t, NUM_RESHADE_EVENTS> g_reshade_event_counters;
+extern utils::CounterRegistry<uint32_t, NUM_DXGI_CORE_EVENTS> g_dxgi_core_event_counters;
+extern utils::CounterRegistry<uint32_t, NUM_DXGI_SC1_EVENTS> g_dxgi_sc1_event_counters;
+extern utils::CounterRegistry<uint32_t, NUM_DXGI_SC2_EVENTS> g_dxgi_sc2_event_counters;
+extern utils::CounterRegistry<uint32_t, NUM_DXGI_SC3_EVENTS> g_dxgi_sc3_event_counters;
+extern utils::CounterRegistry<uint32_t, NUM_DXGI_FACTORY_EVENTS> g_dxgi_factory_event_counters;
+extern utils::CounterRegistry<uint32_t, NUM_DXGI_SC4_EVENTS> g_dxgi_sc4_event_counters;
+extern utils::CounterRegistry<uint32_t, NUM_DXGI_OUTPUT_EVENTS> g_dxgi_output_event_counters;
+extern utils::CounterRegistry<uint32_t, NUM_DX9_EVENTS> g_dx9_event_counters;
+extern utils::CounterRegistry<uint32_t, NUM_STREAMLINE_EVENTS> g_streamline_event_counters;
+extern utils::CounterRegistry<uint32_t, NUM_D3D11_TEXTURE_EVENTS> g_d3d11_texture_event_counters;
+extern utils::CounterRegistry<uint32_t, NUM_D3D_SAMPLER_EVENTS> g_d3d_sampler_event_counters;
+extern utils::CounterRegistry<uint32_t, NUM_SAMPLER_FILTER_MODES> g_sampler_filter_mode_counters;
+extern utils::CounterRegistry<uint32_t, NUM_SAMPLER_ADDRESS_MODES> g_sampler_address_mode_counters;
+extern utils::CounterRegistry<uint32_t, MAX_ANISOTROPY_LEVELS> g_sampler_anisotropy_level_counters;
 
 // NVAPI event counters - separate from swapchain events
-extern std::array<std::atomic<uint32_t>, NUM_NVAPI_EVENTS> g_nvapi_event_counters;  // Array for NVAPI events
+extern utils::CounterRegistry<uint32_t, NUM_NVAPI_EVENTS> g_nvapi_event_counters;  // Table for NVAPI events
 
 // NVAPI sleep timestamp tracking
 extern std::atomic<uint64_t> g_nvapi_last_sleep_timestamp_ns;  // Last NVAPI_D3D_Sleep call timestamp in nanoseconds
-extern std::atomic<uint32_t> g_swapchain_event_total_count;   // Total events across all types
 
 
 // OpenGL hook counters
-extern std::array<std::atomic<uint64_t>, NUM_OPENGL_HOOKS> g_opengl_hook_counters;  // Array for all OpenGL hook events
-extern std::atomic<uint64_t> g_opengl_hook_total_count;   // Total OpenGL hook events across all types
+extern utils::CounterRegistry<uint64_t, NUM_OPENGL_HOOKS> g_opengl_hook_counters;  // Table for all OpenGL hook events
 
 // Display settings hook counters
-extern std::array<std::atomic<uint64_t>, NUM_DISPLAY_SETTINGS_HOOKS> g_display_settings_hook_counters;  // Array for all display settings hook events
-extern std::atomic<uint64_t> g_display_settings_hook_total_count;   // Total display settings hook events across all types
+extern utils::CounterRegistry<uint64_t, NUM_DISPLAY_SETTINGS_HOOKS> g_display_settings_hook_counters;  // Table for all display settings hook events
 
 // Unsorted TODO: Add in correct order above
 extern std::atomic<LONGLONG> g_present_start_time_ns;
@@ -1006,6 +795,9 @@ extern std::atomic<LONGLONG> g_present_start_time_ns;
 
 extern std::atomic<LONGLONG> late_amount_ns;
 
+// Per-frame limiter lateness, drained once per second into the shared stats block
+extern utils::IntervalAccumulator g_limiter_late_stats;
+
 // GPU completion measurement using EnqueueSetEvent
 extern std::atomic<HANDLE> g_gpu_completion_event;  // Event handle for GPU completion measurement
 extern std::atomic<LONGLONG> g_gpu_completion_time_ns;  // Last measured GPU completion time
@@ -1014,15 +806,11 @@ extern std::atomic<LONGLONG> g_gpu_duration_ns;  // Last measured GPU duration (
 // GPU completion failure tracking
 extern std::atomic<const char*> g_gpu_fence_failure_reason;  // Reason why GPU fence creation/usage failed (nullptr if no failure)
 
-// Sim-start-to-display latency measurement
-extern std::atomic<LONGLONG> g_sim_start_ns_for_measurement;  // g_sim_start_ns captured when EnqueueGPUCompletion is called
-extern std::atomic<bool> g_present_update_after2_called;  // Tracks if OnPresentUpdateAfter2 was called
-extern std::atomic<bool> g_gpu_completion_callback_finished;  // Tracks if GPU completion callback finished
-extern std::atomic<LONGLONG> g_sim_to_display_latency_ns;  // Measured sim-start-to-display latency (smoothed)
+// Per-frame latency records keyed by g_global_frame_id (sim start, submit, present, GPU completion)
+extern utils::FrameLatencyRing g_frame_latency;
 
-// GPU late time measurement (how much later GPU finishes compared to OnPresentUpdateAfter2)
-extern std::atomic<LONGLONG> g_present_update_after2_time_ns;  // Time when OnPresentUpdateAfter2 was called
-extern std::atomic<LONGLONG> g_gpu_completion_callback_time_ns;  // Time when GPU completion callback finished
+// Sim-start-to-display latency measurement, smoothed over finalized frames
+extern std::atomic<LONGLONG> g_sim_to_display_latency_ns;  // Measured sim-start-to-display latency (smoothed)
 extern std::atomic<LONGLONG> g_gpu_late_time_ns;  // GPU late time (0 if GPU finished first, otherwise difference)
 
 // NVIDIA Reflex minimal controls
@@ -1038,8 +826,8 @@ extern std::atomic<bool> g_dlss_enabled;          // DLSS Super Resolution enabl
 extern std::atomic<bool> g_dlssg_enabled;         // DLSS Frame Generation enabled
 extern std::atomic<bool> g_ray_reconstruction_enabled; // Ray Reconstruction enabled
 
-// NGX Parameter Storage (unified thread-safe atomic shared_ptr hashmap)
-extern UnifiedParameterMap g_ngx_parameters; // Unified NGX parameters supporting all types
+// NGX Parameter Storage (lock-free, interned parameter names)
+extern utils::NgxParameterStore g_ngx_parameters; // Unified NGX parameters supporting all types
 
 // NGX Counters structure for tracking NGX function calls
 struct NGXCounters {
@@ -1221,26 +1009,7 @@ extern std::atomic<bool> g_ngx_presets_initialized;
 // Cached frame statistics (updated in present detour, read by monitoring thread)
 extern std::atomic<std::shared_ptr<DXGI_FRAME_STATISTICS>> g_cached_frame_stats;
 
-// Swapchain wrapper statistics
-// Frame time ring buffer capacity (must be power of 2 for efficient modulo)
-constexpr size_t kSwapchainFrameTimeCapacity = 256;
-
-struct SwapChainWrapperStats {
-    std::atomic<uint64_t> total_present_calls{0};
-    std::atomic<uint64_t> total_present1_calls{0};
-    std::atomic<uint64_t> last_present_time_ns{0};  // Last Present call time in nanoseconds
-    std::atomic<uint64_t> last_present1_time_ns{0};  // Last Present1 call time in nanoseconds
-    std::atomic<double> smoothed_present_fps{0.0};  // Smoothed FPS for Present (calls per second)
-    std::atomic<double> smoothed_present1_fps{0.0};  // Smoothed FPS for Present1 (calls per second)
-
-    // Frame time ring buffer (stores frame times in milliseconds)
-    std::atomic<uint32_t> frame_time_head{0};  // Ring buffer head index
-    float frame_times[kSwapchainFrameTimeCapacity];  // Frame times in ms (array of floats)
-    std::atomic<uint64_t> last_present_combined_time_ns{0};  // Last call time for any Present/Present1
-};
-
-extern SwapChainWrapperStats g_swapchain_wrapper_stats_proxy;
-extern SwapChainWrapperStats g_swapchain_wrapper_stats_native;
+// Swapchain wrapper statistics are kept per swapchain, see swapchain_frame_stats.hpp
 
 // Continuous monitoring functions
 void StartContinuousMonitoring();
@@ -1,11 +1,15 @@
 #include "gpu_completion_monitoring.hpp"
+#include "event_timeline.hpp"
 #include "globals.hpp"
+#include "hooks/dxgi/dxgi_gpu_completion.hpp"
 #include "utils.hpp"
 #include "utils/logging.hpp"
 #include "utils/timing.hpp"
 #include "swapchain_events.hpp"
 #include "settings/main_tab_settings.hpp"
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <thread>
@@ -15,9 +19,15 @@ namespace {
 std::atomic<bool> g_gpu_monitoring_thread_running{false};
 std::thread g_gpu_monitoring_thread;
 
+// Frame id each in-flight GPU completion fence value was signaled for, indexed by fence value
+constexpr uint64_t kFenceFrameSlots = 64;
+std::array<std::atomic<uint64_t>, kFenceFrameSlots> g_fence_frame_ids{};
+
 // GPU completion monitoring thread function
 void GPUCompletionMonitoringThread() {
     LogInfo("GPU completion monitoring thread started");
+    g_event_timeline.NameCurrentThread("GPU completion monitor");
+    uint64_t last_completed_fence = GetGPUCompletedFenceValue();
 
     while (g_gpu_monitoring_thread_running.load()) {
         // Check if GPU measurement is enabled
@@ -49,6 +59,10 @@ void GPUCompletionMonitoringThread() {
             // GPU work completed - capture the exact completion time
             LONGLONG gpu_completion_time = utils::get_now_ns();
             LONGLONG present_start_time = g_present_start_time_ns.load();
+            g_frame_trace.Record(utils::FrameTraceEvent::kGpuCompletion, g_global_frame_id.load(), gpu_completion_time);
+            g_event_timeline.RecordInstant(utils::TimelineEvent::kGpuCompletion, gpu_completion_time,
+                                           g_global_frame_id.load(),
+                                           present_start_time > 0 ? gpu_completion_time - present_start_time : 0);
 
             // Calculate GPU duration
             if (present_start_time > 0) {
@@ -64,40 +78,19 @@ void GPUCompletionMonitoringThread() {
                 g_gpu_completion_time_ns.store(gpu_completion_time);
             }
 
-            // Sim-to-display latency measurement
-            // Check if this callback finishes second (after OnPresentUpdateAfter2)
-            LONGLONG sim_start_for_measurement = g_sim_start_ns_for_measurement.load();
-            if (sim_start_for_measurement > 0) {
-                g_gpu_completion_callback_finished.store(true);
-                g_gpu_completion_callback_time_ns.store(gpu_completion_time);
-
-                // If OnPresentUpdateAfter2 was already called, we're finishing second
-                if (g_present_update_after2_called.load()) {
-                    // Calculate sim-to-display latency
-                    LONGLONG latency_new_ns = gpu_completion_time - sim_start_for_measurement;
-
-                    // Smooth the latency with exponential moving average
-                    LONGLONG old_latency = g_sim_to_display_latency_ns.load();
-                    LONGLONG smoothed_latency = UpdateRollingAverage(latency_new_ns, old_latency);
-
-                    g_sim_to_display_latency_ns.store(smoothed_latency);
-
-                    // Record frame time for Display Timing mode (GPU finished second, this is actual display time)
-                    RecordFrameTime(FrameTimeMode::kDisplayTiming);
-
-                    // Calculate GPU late time (GPU finished after Present)
-                    LONGLONG present_time = g_present_update_after2_time_ns.load();
-                    if (present_time > 0) {
-                        LONGLONG gpu_late_new_ns = gpu_completion_time - present_time;
-                        LONGLONG old_gpu_late = g_gpu_late_time_ns.load();
-                        LONGLONG smoothed_gpu_late = UpdateRollingAverage(gpu_late_new_ns, old_gpu_late);
-                        g_gpu_late_time_ns.store(smoothed_gpu_late);
-                    }
-                } else {
-                    // GPU finished first, so late time is 0
-                    g_gpu_late_time_ns.store(0);
+            // One wake-up can cover several fences (auto-reset event); stamp every frame whose fence is now done
+            const uint64_t completed_fence = GetGPUCompletedFenceValue();
+            if (completed_fence > last_completed_fence) {
+                // Older fences than the table holds have been overwritten already
+                const uint64_t newly_done = (std::min)(completed_fence - last_completed_fence, kFenceFrameSlots);
+                for (uint64_t i = newly_done; i > 0; --i) {
+                    const uint64_t fence = completed_fence - i + 1;
+                    const uint64_t frame_id = g_fence_frame_ids[fence & (kFenceFrameSlots - 1)].load();
+                    RecordFrameLatencyStage(frame_id, utils::FrameStage::kGpuDone, gpu_completion_time);
                 }
             }
+            // A recreated fence starts over from zero
+            last_completed_fence = completed_fence;
         } else if (result == WAIT_TIMEOUT) {
             // Timeout - GPU hasn't finished yet, loop again
             // This is normal and allows us to check the running flag periodically
@@ -158,6 +151,9 @@ void HandleOpenGLGPUCompletion() {
 
     LONGLONG gpu_completion_time = utils::get_now_ns();
     LONGLONG present_start_time = g_present_start_time_ns.load();
+    g_frame_trace.Record(utils::FrameTraceEvent::kGpuCompletion, g_global_frame_id.load(), gpu_completion_time);
+    g_event_timeline.RecordInstant(utils::TimelineEvent::kGpuCompletion, gpu_completion_time, g_global_frame_id.load(),
+                                   present_start_time > 0 ? gpu_completion_time - present_start_time : 0);
 
     // Calculate GPU duration
     if (present_start_time > 0) {
@@ -173,39 +169,31 @@ void HandleOpenGLGPUCompletion() {
         g_gpu_completion_time_ns.store(gpu_completion_time);
     }
 
-    // Sim-to-display latency measurement
-    // Check if this callback finishes second (after OnPresentUpdateAfter2)
-    LONGLONG sim_start_for_measurement = g_sim_start_ns_for_measurement.load();
-    if (sim_start_for_measurement > 0) {
-        g_gpu_completion_callback_finished.store(true);
-        g_gpu_completion_callback_time_ns.store(gpu_completion_time);
-
-        // If OnPresentUpdateAfter2 was already called, we're finishing second
-        if (g_present_update_after2_called.load()) {
-            // Calculate sim-to-display latency
-            LONGLONG latency_new_ns = gpu_completion_time - sim_start_for_measurement;
-
-            // Smooth the latency with exponential moving average
-            LONGLONG old_latency = g_sim_to_display_latency_ns.load();
-            LONGLONG smoothed_latency = UpdateRollingAverage(latency_new_ns, old_latency);
-
-            g_sim_to_display_latency_ns.store(smoothed_latency);
-
-            // Record frame time for Display Timing mode (GPU finished second, this is actual display time)
-            RecordFrameTime(FrameTimeMode::kDisplayTiming);
-
-            // Calculate GPU late time (GPU finished after Present)
-            LONGLONG present_time = g_present_update_after2_time_ns.load();
-            if (present_time > 0) {
-                LONGLONG gpu_late_new_ns = gpu_completion_time - present_time;
-                LONGLONG old_gpu_late = g_gpu_late_time_ns.load();
-                LONGLONG smoothed_gpu_late = UpdateRollingAverage(gpu_late_new_ns, old_gpu_late);
-                g_gpu_late_time_ns.store(smoothed_gpu_late);
-            }
-        } else {
-            // GPU finished first, so late time is 0
-            g_gpu_late_time_ns.store(0);
-        }
-    }
+    // OpenGL has no fence: the frame's GPU work counts as done when wglSwapBuffers returns
+    const uint64_t frame_id = g_global_frame_id.load();
+    RecordFrameLatencyStage(frame_id, utils::FrameStage::kGpuQueued, gpu_completion_time);
+    RecordFrameLatencyStage(frame_id, utils::FrameStage::kGpuDone, gpu_completion_time);
+}
+
+void NoteGPUCompletionFenceQueued(uint64_t fence_value) {
+    const uint64_t frame_id = g_global_frame_id.load();
+    g_fence_frame_ids[fence_value & (kFenceFrameSlots - 1)].store(frame_id);
+    RecordFrameLatencyStage(frame_id, utils::FrameStage::kGpuQueued, utils::get_now_ns());
 }
 
+void RecordFrameLatencyStage(uint64_t frame_id, utils::FrameStage stage, int64_t now_ns) {
+    utils::FrameLatencyRecord record;
+    if (!g_frame_latency.Record(frame_id, stage, now_ns, &record)) {
+        return;
+    }
+    if (record.Has(utils::FrameStage::kSimStart)) {
+        g_sim_to_display_latency_ns.store(
+            UpdateRollingAverage<LONGLONG>(record.SimToDisplayNs(), g_sim_to_display_latency_ns.load()));
+    }
+    if (record.Has(utils::FrameStage::kGpuDone)) {
+        g_gpu_late_time_ns.store(UpdateRollingAverage<LONGLONG>(record.GpuLateNs(), g_gpu_late_time_ns.load()));
+    }
+
+    // The frame reached the display with whichever stage finished last
+    RecordFrameTime(FrameTimeMode::kDisplayTiming);
+}
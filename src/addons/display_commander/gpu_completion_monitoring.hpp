@@ -1,5 +1,9 @@
 #pragma once
 
+#include "utils/frame_latency_ring.hpp"
+
+#include <cstdint>
+
 // Start/stop functions for GPU completion monitoring thread
 void StartGPUCompletionMonitoring();
 void StopGPUCompletionMonitoring();
@@ -7,3 +11,11 @@ void StopGPUCompletionMonitoring();
 // GPU completion callback for OpenGL (assumes immediate completion)
 void HandleOpenGLGPUCompletion();
 
+// Stamps a stage of a frame in g_frame_latency; the stage that completes the frame updates the smoothed
+// sim-to-display / GPU late values and records the Display Timing frame time
+void RecordFrameLatencyStage(uint64_t frame_id, utils::FrameStage stage, int64_t now_ns);
+
+// Called right before a GPU completion fence value is signaled for the current frame, so the monitoring thread can
+// map completed fence values back to frames even when one wake-up covers several fences
+void NoteGPUCompletionFenceQueued(uint64_t fence_value);
+
@@ -169,7 +169,7 @@ BOOL WINAPI GetGUIThreadInfo_Detour(DWORD idThread, PGUITHREADINFO pgui) {
 // Hooked SetThreadExecutionState function
 EXECUTION_STATE WINAPI SetThreadExecutionState_Detour(EXECUTION_STATE esFlags) {
     // Track total calls
-    g_hook_stats[HOOK_SetThreadExecutionState].increment_total();
+    g_hook_stats.Increment(HOOK_SetThreadExecutionState, HOOK_CALLS_TOTAL);
 
     // Check screensaver mode setting
     ScreensaverMode screensaver_mode = s_screensaver_mode.load();
@@ -180,7 +180,7 @@ EXECUTION_STATE WINAPI SetThreadExecutionState_Detour(EXECUTION_STATE esFlags) {
     }
 
     // Track unsuppressed calls (when we call the original function)
-    g_hook_stats[HOOK_SetThreadExecutionState].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_SetThreadExecutionState, HOOK_CALLS_UNSUPPRESSED);
 
     // Call original function for kDefault mode
     return SetThreadExecutionState_Original ? SetThreadExecutionState_Original(esFlags)
@@ -199,8 +199,7 @@ LONG_PTR WINAPI SetWindowLongPtrW_Detour(HWND hWnd, int nIndex, LONG_PTR dwNewLo
 
 // Hooked SetWindowLongA function
 LONG WINAPI SetWindowLongA_Detour(HWND hWnd, int nIndex, LONG dwNewLong) {
-    g_display_settings_hook_counters[DISPLAY_SETTINGS_HOOK_SETWINDOWLONGA].fetch_add(1);
-    g_display_settings_hook_total_count.fetch_add(1);
+    g_display_settings_hook_counters.Increment(DISPLAY_SETTINGS_HOOK_SETWINDOWLONGA);
 
     // Check if fullscreen prevention is enabled
     ModifyWindowStyle(nIndex, dwNewLong, settings::g_developerTabSettings.prevent_always_on_top.GetValue());
@@ -210,8 +209,7 @@ LONG WINAPI SetWindowLongA_Detour(HWND hWnd, int nIndex, LONG dwNewLong) {
 
 // Hooked SetWindowLongW function
 LONG WINAPI SetWindowLongW_Detour(HWND hWnd, int nIndex, LONG dwNewLong) {
-    g_display_settings_hook_counters[DISPLAY_SETTINGS_HOOK_SETWINDOWLONGW].fetch_add(1);
-    g_display_settings_hook_total_count.fetch_add(1);
+    g_display_settings_hook_counters.Increment(DISPLAY_SETTINGS_HOOK_SETWINDOWLONGW);
 
     // Check if fullscreen prevention is enabled
     ModifyWindowStyle(nIndex, dwNewLong, settings::g_developerTabSettings.prevent_always_on_top.GetValue());
@@ -221,8 +219,7 @@ LONG WINAPI SetWindowLongW_Detour(HWND hWnd, int nIndex, LONG dwNewLong) {
 
 // Hooked SetWindowLongPtrA function
 LONG_PTR WINAPI SetWindowLongPtrA_Detour(HWND hWnd, int nIndex, LONG_PTR dwNewLong) {
-    g_display_settings_hook_counters[DISPLAY_SETTINGS_HOOK_SETWINDOWLONGPTRA].fetch_add(1);
-    g_display_settings_hook_total_count.fetch_add(1);
+    g_display_settings_hook_counters.Increment(DISPLAY_SETTINGS_HOOK_SETWINDOWLONGPTRA);
 
     // Check if fullscreen prevention is enabled
    // if (settings::g_developerTabSettings.prevent_fullscreen.GetValue()) {
@@ -322,8 +319,7 @@ int WINAPI ShowCursor_Detour(BOOL bShow) {
 // Hooked CreateDXGIFactory function
 HRESULT WINAPI CreateDXGIFactory_Detour(REFIID riid, void** ppFactory) {
     // Increment counter
-    g_dxgi_factory_event_counters[DXGI_FACTORY_EVENT_CREATEFACTORY].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_factory_event_counters.Increment(DXGI_FACTORY_EVENT_CREATEFACTORY);
 
     // Call original function
     HRESULT hr =
@@ -342,8 +338,7 @@ HRESULT WINAPI CreateDXGIFactory_Detour(REFIID riid, void** ppFactory) {
 // Hooked CreateDXGIFactory1 function
 HRESULT WINAPI CreateDXGIFactory1_Detour(REFIID riid, void** ppFactory) {
     // Increment counter
-    g_dxgi_factory_event_counters[DXGI_FACTORY_EVENT_CREATEFACTORY1].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_factory_event_counters.Increment(DXGI_FACTORY_EVENT_CREATEFACTORY1);
 
     // Call original function
     HRESULT hr = CreateDXGIFactory1_Original ? CreateDXGIFactory1_Original(riid, ppFactory)
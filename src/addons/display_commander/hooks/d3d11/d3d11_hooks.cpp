@@ -27,7 +27,7 @@ HRESULT STDMETHODCALLTYPE ID3D11Device_CreateTexture2D_Detour(
     ID3D11Texture2D** ppTexture2D
 ) {
     // Increment counter
-    g_d3d11_texture_event_counters[D3D11_EVENT_CREATE_TEXTURE2D].fetch_add(1);
+    g_d3d11_texture_event_counters.Increment(D3D11_EVENT_CREATE_TEXTURE2D);
 
     // Call original function
     if (ID3D11Device_CreateTexture2D_Original != nullptr) {
@@ -49,7 +49,7 @@ void STDMETHODCALLTYPE ID3D11DeviceContext_UpdateSubresource_Detour(
     UINT SrcDepthPitch
 ) {
     // Increment counter
-    g_d3d11_texture_event_counters[D3D11_EVENT_UPDATE_SUBRESOURCE].fetch_add(1);
+    g_d3d11_texture_event_counters.Increment(D3D11_EVENT_UPDATE_SUBRESOURCE);
 
     // Call original function
     if (ID3D11DeviceContext_UpdateSubresource_Original != nullptr) {
@@ -72,7 +72,7 @@ void STDMETHODCALLTYPE ID3D11DeviceContext_UpdateSubresource1_Detour(
     UINT CopyFlags
 ) {
     // Increment counter
-    g_d3d11_texture_event_counters[D3D11_EVENT_UPDATE_SUBRESOURCE1].fetch_add(1);
+    g_d3d11_texture_event_counters.Increment(D3D11_EVENT_UPDATE_SUBRESOURCE1);
 
     // Call original function
     if (ID3D11DeviceContext_UpdateSubresource1_Original != nullptr) {
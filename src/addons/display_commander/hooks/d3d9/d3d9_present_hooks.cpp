@@ -48,8 +48,7 @@ HRESULT STDMETHODCALLTYPE IDirect3DDevice9_Present_Detour(
     }
 
     // Increment DX9 Present counter
-    g_dx9_event_counters[DX9_EVENT_PRESENT].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dx9_event_counters.Increment(DX9_EVENT_PRESENT);
 
     // Call OnPresentFlags2 with flags = 0 (no flags for regular Present)
     uint32_t present_flags = 0;
@@ -140,8 +139,7 @@ HRESULT STDMETHODCALLTYPE IDirect3DDevice9_PresentEx_Detour(
     }
 
     // Increment DX9 Present counter
-    g_dx9_event_counters[DX9_EVENT_PRESENT].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dx9_event_counters.Increment(DX9_EVENT_PRESENT);
 
     // Call OnPresentFlags with the actual flags
     uint32_t present_flags = static_cast<uint32_t>(dwFlags);
@@ -95,7 +95,7 @@ void ClearDInputDevices() {
 // DirectInput8Create detour
 HRESULT WINAPI DirectInput8Create_Detour(HINSTANCE hinst, DWORD dwVersion, REFIID riidltf, LPVOID *ppvOut, LPUNKNOWN punkOuter) {
     // Track total calls
-    g_hook_stats[HOOK_DInput8CreateDevice].increment_total();
+    g_hook_stats.Increment(HOOK_DInput8CreateDevice, HOOK_CALLS_TOTAL);
 
     // Call original function
     HRESULT result = DirectInput8Create_Original(hinst, dwVersion, riidltf, ppvOut, punkOuter);
@@ -103,7 +103,7 @@ HRESULT WINAPI DirectInput8Create_Detour(HINSTANCE hinst, DWORD dwVersion, REFII
     // Check if hooks should be suppressed
     if (!ShouldSuppressDInputHooks()) {
         // Track unsuppressed calls
-        g_hook_stats[HOOK_DInput8CreateDevice].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_DInput8CreateDevice, HOOK_CALLS_UNSUPPRESSED);
 
         if (SUCCEEDED(result) && ppvOut && *ppvOut) {
             // Track device creation
@@ -122,7 +122,7 @@ HRESULT WINAPI DirectInput8Create_Detour(HINSTANCE hinst, DWORD dwVersion, REFII
 // DirectInputCreateA detour
 HRESULT WINAPI DirectInputCreateA_Detour(HINSTANCE hinst, DWORD dwVersion, LPDIRECTINPUTA *ppDI, LPUNKNOWN punkOuter) {
     // Track total calls
-    g_hook_stats[HOOK_DInputCreateDevice].increment_total();
+    g_hook_stats.Increment(HOOK_DInputCreateDevice, HOOK_CALLS_TOTAL);
 
     // Call original function
     HRESULT result = DirectInputCreateA_Original(hinst, dwVersion, ppDI, punkOuter);
@@ -130,7 +130,7 @@ HRESULT WINAPI DirectInputCreateA_Detour(HINSTANCE hinst, DWORD dwVersion, LPDIR
     // Check if hooks should be suppressed
     if (!ShouldSuppressDInputHooks()) {
         // Track unsuppressed calls
-        g_hook_stats[HOOK_DInputCreateDevice].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_DInputCreateDevice, HOOK_CALLS_UNSUPPRESSED);
 
         if (SUCCEEDED(result) && ppDI && *ppDI) {
             // Track device creation
@@ -148,7 +148,7 @@ HRESULT WINAPI DirectInputCreateA_Detour(HINSTANCE hinst, DWORD dwVersion, LPDIR
 // DirectInputCreateW detour
 HRESULT WINAPI DirectInputCreateW_Detour(HINSTANCE hinst, DWORD dwVersion, LPDIRECTINPUTW *ppDI, LPUNKNOWN punkOuter) {
     // Track total calls
-    g_hook_stats[HOOK_DInputCreateDevice].increment_total();
+    g_hook_stats.Increment(HOOK_DInputCreateDevice, HOOK_CALLS_TOTAL);
 
     // Call original function
     HRESULT result = DirectInputCreateW_Original(hinst, dwVersion, ppDI, punkOuter);
@@ -156,7 +156,7 @@ HRESULT WINAPI DirectInputCreateW_Detour(HINSTANCE hinst, DWORD dwVersion, LPDIR
     // Check if hooks should be suppressed
     if (!ShouldSuppressDInputHooks()) {
         // Track unsuppressed calls
-        g_hook_stats[HOOK_DInputCreateDevice].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_DInputCreateDevice, HOOK_CALLS_UNSUPPRESSED);
 
         if (SUCCEEDED(result) && ppDI && *ppDI) {
             // Track device creation
@@ -23,8 +23,7 @@ static std::atomic<bool> g_display_settings_hooks_installed{false};
 
 // Hook detour functions
 LONG WINAPI ChangeDisplaySettingsA_Detour(DEVMODEA *lpDevMode, DWORD dwFlags) {
-    g_display_settings_hook_counters[DISPLAY_SETTINGS_HOOK_CHANGEDISPLAYSETTINGSA].fetch_add(1);
-    g_display_settings_hook_total_count.fetch_add(1);
+    g_display_settings_hook_counters.Increment(DISPLAY_SETTINGS_HOOK_CHANGEDISPLAYSETTINGSA);
 
     // Check if fullscreen prevention is enabled
     if (settings::g_developerTabSettings.prevent_fullscreen.GetValue()) {
@@ -36,8 +35,7 @@ LONG WINAPI ChangeDisplaySettingsA_Detour(DEVMODEA *lpDevMode, DWORD dwFlags) {
 }
 
 LONG WINAPI ChangeDisplaySettingsW_Detour(DEVMODEW *lpDevMode, DWORD dwFlags) {
-    g_display_settings_hook_counters[DISPLAY_SETTINGS_HOOK_CHANGEDISPLAYSETTINGSW].fetch_add(1);
-    g_display_settings_hook_total_count.fetch_add(1);
+    g_display_settings_hook_counters.Increment(DISPLAY_SETTINGS_HOOK_CHANGEDISPLAYSETTINGSW);
 
     // Check if fullscreen prevention is enabled
     if (settings::g_developerTabSettings.prevent_fullscreen.GetValue()) {
@@ -49,8 +47,7 @@ LONG WINAPI ChangeDisplaySettingsW_Detour(DEVMODEW *lpDevMode, DWORD dwFlags) {
 }
 
 LONG WINAPI ChangeDisplaySettingsExA_Detour(LPCSTR lpszDeviceName, DEVMODEA *lpDevMode, HWND hWnd, DWORD dwFlags, LPVOID lParam) {
-    g_display_settings_hook_counters[DISPLAY_SETTINGS_HOOK_CHANGEDISPLAYSETTINGSEXA].fetch_add(1);
-    g_display_settings_hook_total_count.fetch_add(1);
+    g_display_settings_hook_counters.Increment(DISPLAY_SETTINGS_HOOK_CHANGEDISPLAYSETTINGSEXA);
 
     // Check if fullscreen prevention is enabled
     if (settings::g_developerTabSettings.prevent_fullscreen.GetValue()) {
@@ -62,8 +59,7 @@ LONG WINAPI ChangeDisplaySettingsExA_Detour(LPCSTR lpszDeviceName, DEVMODEA *lpD
 }
 
 LONG WINAPI ChangeDisplaySettingsExW_Detour(LPCWSTR lpszDeviceName, DEVMODEW *lpDevMode, HWND hWnd, DWORD dwFlags, LPVOID lParam) {
-    g_display_settings_hook_counters[DISPLAY_SETTINGS_HOOK_CHANGEDISPLAYSETTINGSEXW].fetch_add(1);
-    g_display_settings_hook_total_count.fetch_add(1);
+    g_display_settings_hook_counters.Increment(DISPLAY_SETTINGS_HOOK_CHANGEDISPLAYSETTINGSEXW);
 
     // Check if fullscreen prevention is enabled
     if (settings::g_developerTabSettings.prevent_fullscreen.GetValue()) {
@@ -77,8 +73,7 @@ LONG WINAPI ChangeDisplaySettingsExW_Detour(LPCWSTR lpszDeviceName, DEVMODEW *lp
 // SetWindowPos_Detour function moved to api_hooks.cpp to avoid duplicate hook creation
 
 BOOL WINAPI ShowWindow_Detour(HWND hWnd, int nCmdShow) {
-    g_display_settings_hook_counters[DISPLAY_SETTINGS_HOOK_SHOWWINDOW].fetch_add(1);
-    g_display_settings_hook_total_count.fetch_add(1);
+    g_display_settings_hook_counters.Increment(DISPLAY_SETTINGS_HOOK_SHOWWINDOW);
 
     // Check if fullscreen prevention is enabled
     if (settings::g_developerTabSettings.prevent_fullscreen.GetValue()) {
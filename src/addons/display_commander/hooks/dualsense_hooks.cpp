@@ -247,7 +247,7 @@ bool ConvertDualSenseToXInput(DWORD user_index, XINPUT_STATE* state) {
     state->Gamepad.bRightTrigger = dualsense.right_trigger;
 
     // Update XInput UI structures for proper display
-    auto shared_state = display_commander::widgets::xinput_widget::XInputWidget::GetSharedState();
+    auto *shared_state = display_commander::widgets::xinput_widget::XInputWidget::GetSharedStatePtr();
     if (shared_state) {
         // Thread-safe update
         utils::SRWLockExclusive lock(shared_state->state_lock);
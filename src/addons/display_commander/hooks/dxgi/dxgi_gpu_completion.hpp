@@ -8,3 +8,6 @@
 // command_queue is optional but recommended for D3D12 to signal the fence correctly
 void EnqueueGPUCompletion(reshade::api::swapchain* swapchain, reshade::api::command_queue* command_queue = nullptr);
 
+// Highest fence value the GPU has reached (0 before the first enqueue)
+uint64_t GetGPUCompletedFenceValue();
+
@@ -4,6 +4,7 @@
 #include "../../utils/general_utils.hpp"
 #include "../../utils/logging.hpp"
 #include "../../globals.hpp"
+#include "../../gpu_completion_monitoring.hpp"
 #include "../../settings/main_tab_settings.hpp"
 #include "../../settings/developer_tab_settings.hpp"
 #include "../../dx11_proxy/dx11_proxy_manager.hpp"
@@ -18,9 +19,6 @@
 #include <wrl/client.h>
 #include <string>
 
-// Forward declaration for g_sim_start_ns from swapchain_events.cpp
-extern std::atomic<LONGLONG> g_sim_start_ns;
-
 /*
  * IDXGISwapChain VTable Layout Documentation
  * ==========================================
@@ -120,11 +118,14 @@ namespace {
         }
 
         uint64_t signal_value = g_gpu_state.fence_value.fetch_add(1) + 1;
+        NoteGPUCompletionFenceQueued(signal_value);
 
         // Signal the fence from GPU
         hr = context4->Signal(g_gpu_state.d3d11_fence.Get(), signal_value);
         if (FAILED(hr)) {
             g_gpu_fence_failure_reason.store("D3D11: Failed to signal fence");
+            // No completion will arrive for this frame; don't leave it waiting for one
+            RecordFrameLatencyStage(g_global_frame_id.load(), utils::FrameStage::kGpuDone, utils::get_now_ns());
             return;
         }
 
@@ -132,6 +133,8 @@ namespace {
         hr = g_gpu_state.d3d11_fence->SetEventOnCompletion(signal_value, g_gpu_state.event_handle);
         if (FAILED(hr)) {
             g_gpu_fence_failure_reason.store("D3D11: SetEventOnCompletion failed");
+            // No completion will arrive for this frame; don't leave it waiting for one
+            RecordFrameLatencyStage(g_global_frame_id.load(), utils::FrameStage::kGpuDone, utils::get_now_ns());
             return;
         }
 
@@ -187,11 +190,14 @@ namespace {
 
         // Increment fence value and signal it on the command queue
         uint64_t signal_value = g_gpu_state.fence_value.fetch_add(1) + 1;
+        NoteGPUCompletionFenceQueued(signal_value);
 
         // Set event to trigger when fence reaches this value
         hr = g_gpu_state.d3d12_fence->SetEventOnCompletion(signal_value, g_gpu_state.event_handle);
         if (FAILED(hr)) {
             g_gpu_fence_failure_reason.store("D3D12: SetEventOnCompletion failed");
+            // No completion will arrive for this frame; don't leave it waiting for one
+            RecordFrameLatencyStage(g_global_frame_id.load(), utils::FrameStage::kGpuDone, utils::get_now_ns());
             return;
         }
 
@@ -200,6 +206,8 @@ namespace {
         hr = command_queue->Signal(g_gpu_state.d3d12_fence.Get(), signal_value);
         if (FAILED(hr)) {
             g_gpu_fence_failure_reason.store("D3D12: Failed to signal fence on command queue");
+            // No completion will arrive for this frame; don't leave it waiting for one
+            RecordFrameLatencyStage(g_global_frame_id.load(), utils::FrameStage::kGpuDone, utils::get_now_ns());
             return;
         }
 
@@ -214,12 +222,6 @@ namespace {
             g_gpu_fence_failure_reason.store("Failed to get device from swapchain");
             return;
         }
-        // Capture g_sim_start_ns for sim-to-display latency measurement
-        // Reset tracking flags for this frame
-        g_sim_start_ns_for_measurement.store(g_sim_start_ns.load());
-        g_present_update_after2_called.store(false);
-        g_gpu_completion_callback_finished.store(false);
-
         // Try D3D12 first
 
         // Try D3D11
@@ -237,6 +239,16 @@ namespace {
     }
 } // namespace
 
+uint64_t GetGPUCompletedFenceValue() {
+    if (!g_gpu_state.initialized.load()) {
+        return 0;
+    }
+    if (g_gpu_state.is_d3d12.load()) {
+        return g_gpu_state.d3d12_fence ? g_gpu_state.d3d12_fence->GetCompletedValue() : 0;
+    }
+    return g_gpu_state.d3d11_fence ? g_gpu_state.d3d11_fence->GetCompletedValue() : 0;
+}
+
 // Public API wrapper that works with ReShade swapchain
 void EnqueueGPUCompletion(reshade::api::swapchain* swapchain, reshade::api::command_queue* command_queue) {
     if (swapchain == nullptr) {
@@ -397,8 +409,7 @@ HRESULT STDMETHODCALLTYPE IDXGISwapChain_Present_Detour(IDXGISwapChain *This, UI
     }
 
     // Increment DXGI Present counter
-    g_dxgi_core_event_counters[DXGI_CORE_EVENT_PRESENT].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_core_event_counters.Increment(DXGI_CORE_EVENT_PRESENT);
 
     // Prevent always on top for swapchain window if enabled
     if (settings::g_developerTabSettings.prevent_always_on_top.GetValue()) {
@@ -492,8 +503,7 @@ HRESULT STDMETHODCALLTYPE IDXGISwapChain_Present1_Detour(IDXGISwapChain1 *This,
     }
 
     // Increment DXGI Present1 counter
-    g_dxgi_sc1_event_counters[DXGI_SC1_EVENT_PRESENT1].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc1_event_counters.Increment(DXGI_SC1_EVENT_PRESENT1);
 
     // Prevent always on top for swapchain window if enabled
     if (settings::g_developerTabSettings.prevent_always_on_top.GetValue()) {
@@ -562,8 +572,7 @@ HRESULT STDMETHODCALLTYPE IDXGISwapChain_Present1_Detour(IDXGISwapChain1 *This,
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_GetDesc_Detour(IDXGISwapChain *This, DXGI_SWAP_CHAIN_DESC *pDesc) {
 
     // Increment DXGI GetDesc counter
-    g_dxgi_core_event_counters[DXGI_CORE_EVENT_GETDESC].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_core_event_counters.Increment(DXGI_CORE_EVENT_GETDESC);
 
     // Call original function
     if (IDXGISwapChain_GetDesc_Original != nullptr) {
@@ -629,8 +638,7 @@ HRESULT STDMETHODCALLTYPE IDXGISwapChain_GetDesc_Detour(IDXGISwapChain *This, DX
 // Hooked IDXGISwapChain1::GetDesc1 function
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_GetDesc1_Detour(IDXGISwapChain1 *This, DXGI_SWAP_CHAIN_DESC1 *pDesc) {
     // Increment DXGI GetDesc1 counter
-    g_dxgi_sc1_event_counters[DXGI_SC1_EVENT_GETDESC1].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc1_event_counters.Increment(DXGI_SC1_EVENT_GETDESC1);
 
     // Call original function
     if (IDXGISwapChain_GetDesc1_Original != nullptr) {
@@ -695,8 +703,7 @@ HRESULT STDMETHODCALLTYPE IDXGISwapChain_GetDesc1_Detour(IDXGISwapChain1 *This,
 // Hooked IDXGISwapChain3::CheckColorSpaceSupport function
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_CheckColorSpaceSupport_Detour(IDXGISwapChain3 *This, DXGI_COLOR_SPACE_TYPE ColorSpace, UINT *pColorSpaceSupport) {
     // Increment DXGI CheckColorSpaceSupport counter
-    g_dxgi_sc3_event_counters[DXGI_SC3_EVENT_CHECKCOLORSPACESUPPORT].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc3_event_counters.Increment(DXGI_SC3_EVENT_CHECKCOLORSPACESUPPORT);
 
     // Log the color space check (only on first few calls to avoid spam)
     static int checkcolorspace_log_count = 0;
@@ -758,8 +765,7 @@ HRESULT STDMETHODCALLTYPE IDXGISwapChain_CheckColorSpaceSupport_Detour(IDXGISwap
 // Hooked IDXGIFactory::CreateSwapChain function
 HRESULT STDMETHODCALLTYPE IDXGIFactory_CreateSwapChain_Detour(IDXGIFactory *This, IUnknown *pDevice, DXGI_SWAP_CHAIN_DESC *pDesc, IDXGISwapChain **ppSwapChain) {
     // Increment DXGI Factory CreateSwapChain counter
-    g_dxgi_factory_event_counters[DXGI_FACTORY_EVENT_CREATESWAPCHAIN].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_factory_event_counters.Increment(DXGI_FACTORY_EVENT_CREATESWAPCHAIN);
 
     // Log the swapchain creation parameters (only on first few calls to avoid spam)
     static int createswapchain_log_count = 0;
@@ -801,8 +807,7 @@ HRESULT STDMETHODCALLTYPE IDXGIFactory_CreateSwapChain_Detour(IDXGIFactory *This
 
 // Additional DXGI detour functions
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_GetBuffer_Detour(IDXGISwapChain *This, UINT Buffer, REFIID riid, void **ppSurface) {
-    g_dxgi_core_event_counters[DXGI_CORE_EVENT_GETBUFFER].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_core_event_counters.Increment(DXGI_CORE_EVENT_GETBUFFER);
     return IDXGISwapChain_GetBuffer_Original(This, Buffer, riid, ppSurface);
 }
 
@@ -811,8 +816,7 @@ std::atomic<IDXGIOutput*> g_last_set_fullscreen_target{nullptr};
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_SetFullscreenState_Detour(IDXGISwapChain *This, BOOL Fullscreen, IDXGIOutput *pTarget) {
 
 
-    g_dxgi_core_event_counters[DXGI_CORE_EVENT_SETFULLSCREENSTATE].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_core_event_counters.Increment(DXGI_CORE_EVENT_SETFULLSCREENSTATE);
 
     if (Fullscreen == g_last_set_fullscreen_state.load() && pTarget == g_last_set_fullscreen_target.load()) {
         return S_OK;
@@ -830,8 +834,7 @@ HRESULT STDMETHODCALLTYPE IDXGISwapChain_SetFullscreenState_Detour(IDXGISwapChai
 }
 
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_GetFullscreenState_Detour(IDXGISwapChain *This, BOOL *pFullscreen, IDXGIOutput **ppTarget) {
-    g_dxgi_core_event_counters[DXGI_CORE_EVENT_GETFULLSCREENSTATE].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_core_event_counters.Increment(DXGI_CORE_EVENT_GETFULLSCREENSTATE);
     auto hr = IDXGISwapChain_GetFullscreenState_Original(This, pFullscreen, ppTarget);
 
     // NOTE: we assume that ppTarget is g_last_set_fullscreen_target.load()
@@ -843,20 +846,17 @@ HRESULT STDMETHODCALLTYPE IDXGISwapChain_GetFullscreenState_Detour(IDXGISwapChai
 }
 
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_ResizeBuffers_Detour(IDXGISwapChain *This, UINT BufferCount, UINT Width, UINT Height, DXGI_FORMAT NewFormat, UINT SwapChainFlags) {
-    g_dxgi_core_event_counters[DXGI_CORE_EVENT_RESIZEBUFFERS].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_core_event_counters.Increment(DXGI_CORE_EVENT_RESIZEBUFFERS);
     return IDXGISwapChain_ResizeBuffers_Original(This, BufferCount, Width, Height, NewFormat, SwapChainFlags);
 }
 
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_ResizeTarget_Detour(IDXGISwapChain *This, const DXGI_MODE_DESC *pNewTargetParameters) {
-    g_dxgi_core_event_counters[DXGI_CORE_EVENT_RESIZETARGET].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_core_event_counters.Increment(DXGI_CORE_EVENT_RESIZETARGET);
     return IDXGISwapChain_ResizeTarget_Original(This, pNewTargetParameters);
 }
 
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_GetContainingOutput_Detour(IDXGISwapChain *This, IDXGIOutput **ppOutput) {
-    g_dxgi_core_event_counters[DXGI_CORE_EVENT_GETCONTAININGOUTPUT].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_core_event_counters.Increment(DXGI_CORE_EVENT_GETCONTAININGOUTPUT);
 
     HRESULT hr = IDXGISwapChain_GetContainingOutput_Original(This, ppOutput);
 
@@ -869,27 +869,23 @@ HRESULT STDMETHODCALLTYPE IDXGISwapChain_GetContainingOutput_Detour(IDXGISwapCha
 }
 
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_GetFrameStatistics_Detour(IDXGISwapChain *This, DXGI_FRAME_STATISTICS *pStats) {
-    g_dxgi_core_event_counters[DXGI_CORE_EVENT_GETFRAMESTATISTICS].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_core_event_counters.Increment(DXGI_CORE_EVENT_GETFRAMESTATISTICS);
     return IDXGISwapChain_GetFrameStatistics_Original(This, pStats);
 }
 
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_GetLastPresentCount_Detour(IDXGISwapChain *This, UINT *pLastPresentCount) {
-    g_dxgi_core_event_counters[DXGI_CORE_EVENT_GETLASTPRESENTCOUNT].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_core_event_counters.Increment(DXGI_CORE_EVENT_GETLASTPRESENTCOUNT);
     return IDXGISwapChain_GetLastPresentCount_Original(This, pLastPresentCount);
 }
 
 // IDXGISwapChain1 detour functions
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_GetFullscreenDesc_Detour(IDXGISwapChain1 *This, DXGI_SWAP_CHAIN_FULLSCREEN_DESC *pDesc) {
-    g_dxgi_sc1_event_counters[DXGI_SC1_EVENT_GETFULLSCREENDESC].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc1_event_counters.Increment(DXGI_SC1_EVENT_GETFULLSCREENDESC);
     return IDXGISwapChain_GetFullscreenDesc_Original(This, pDesc);
 }
 
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_GetHwnd_Detour(IDXGISwapChain1 *This, HWND *pHwnd) {
-    g_dxgi_sc1_event_counters[DXGI_SC1_EVENT_GETHWND].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc1_event_counters.Increment(DXGI_SC1_EVENT_GETHWND);
 
     HRESULT hr = IDXGISwapChain_GetHwnd_Original(This, pHwnd);
 
@@ -908,114 +904,96 @@ HRESULT STDMETHODCALLTYPE IDXGISwapChain_GetHwnd_Detour(IDXGISwapChain1 *This, H
 }
 
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_GetCoreWindow_Detour(IDXGISwapChain1 *This, REFIID refiid, void **ppUnk) {
-    g_dxgi_sc1_event_counters[DXGI_SC1_EVENT_GETCOREWINDOW].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc1_event_counters.Increment(DXGI_SC1_EVENT_GETCOREWINDOW);
     return IDXGISwapChain_GetCoreWindow_Original(This, refiid, ppUnk);
 }
 
 BOOL STDMETHODCALLTYPE IDXGISwapChain_IsTemporaryMonoSupported_Detour(IDXGISwapChain1 *This) {
-    g_dxgi_sc1_event_counters[DXGI_SC1_EVENT_ISTEMPORARYMONOSUPPORTED].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc1_event_counters.Increment(DXGI_SC1_EVENT_ISTEMPORARYMONOSUPPORTED);
     return IDXGISwapChain_IsTemporaryMonoSupported_Original(This);
 }
 
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_GetRestrictToOutput_Detour(IDXGISwapChain1 *This, IDXGIOutput **ppRestrictToOutput) {
-    g_dxgi_sc1_event_counters[DXGI_SC1_EVENT_GETRESTRICTTOOUTPUT].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc1_event_counters.Increment(DXGI_SC1_EVENT_GETRESTRICTTOOUTPUT);
     return IDXGISwapChain_GetRestrictToOutput_Original(This, ppRestrictToOutput);
 }
 
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_SetBackgroundColor_Detour(IDXGISwapChain1 *This, const DXGI_RGBA *pColor) {
-    g_dxgi_sc1_event_counters[DXGI_SC1_EVENT_SETBACKGROUNDCOLOR].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc1_event_counters.Increment(DXGI_SC1_EVENT_SETBACKGROUNDCOLOR);
     return IDXGISwapChain_SetBackgroundColor_Original(This, pColor);
 }
 
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_GetBackgroundColor_Detour(IDXGISwapChain1 *This, DXGI_RGBA *pColor) {
-    g_dxgi_sc1_event_counters[DXGI_SC1_EVENT_GETBACKGROUNDCOLOR].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc1_event_counters.Increment(DXGI_SC1_EVENT_GETBACKGROUNDCOLOR);
     return IDXGISwapChain_GetBackgroundColor_Original(This, pColor);
 }
 
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_SetRotation_Detour(IDXGISwapChain1 *This, DXGI_MODE_ROTATION Rotation) {
-    g_dxgi_sc1_event_counters[DXGI_SC1_EVENT_SETROTATION].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc1_event_counters.Increment(DXGI_SC1_EVENT_SETROTATION);
     return IDXGISwapChain_SetRotation_Original(This, Rotation);
 }
 
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_GetRotation_Detour(IDXGISwapChain1 *This, DXGI_MODE_ROTATION *pRotation) {
-    g_dxgi_sc1_event_counters[DXGI_SC1_EVENT_GETROTATION].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc1_event_counters.Increment(DXGI_SC1_EVENT_GETROTATION);
     return IDXGISwapChain_GetRotation_Original(This, pRotation);
 }
 
 // IDXGISwapChain2 detour functions
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_SetSourceSize_Detour(IDXGISwapChain2 *This, UINT Width, UINT Height) {
-    g_dxgi_sc2_event_counters[DXGI_SC2_EVENT_SETSOURCESIZE].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc2_event_counters.Increment(DXGI_SC2_EVENT_SETSOURCESIZE);
     return IDXGISwapChain_SetSourceSize_Original(This, Width, Height);
 }
 
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_GetSourceSize_Detour(IDXGISwapChain2 *This, UINT *pWidth, UINT *pHeight) {
-    g_dxgi_sc2_event_counters[DXGI_SC2_EVENT_GETSOURCESIZE].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc2_event_counters.Increment(DXGI_SC2_EVENT_GETSOURCESIZE);
     return IDXGISwapChain_GetSourceSize_Original(This, pWidth, pHeight);
 }
 
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_SetMaximumFrameLatency_Detour(IDXGISwapChain2 *This, UINT MaxLatency) {
-    g_dxgi_sc2_event_counters[DXGI_SC2_EVENT_SETMAXIMUMFRAMELATENCY].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc2_event_counters.Increment(DXGI_SC2_EVENT_SETMAXIMUMFRAMELATENCY);
     return IDXGISwapChain_SetMaximumFrameLatency_Original(This, MaxLatency);
 }
 
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_GetMaximumFrameLatency_Detour(IDXGISwapChain2 *This, UINT *pMaxLatency) {
-    g_dxgi_sc2_event_counters[DXGI_SC2_EVENT_GETMAXIMUMFRAMELATENCY].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc2_event_counters.Increment(DXGI_SC2_EVENT_GETMAXIMUMFRAMELATENCY);
     return IDXGISwapChain_GetMaximumFrameLatency_Original(This, pMaxLatency);
 }
 
 HANDLE STDMETHODCALLTYPE IDXGISwapChain_GetFrameLatencyWaitableObject_Detour(IDXGISwapChain2 *This) {
-    g_dxgi_sc2_event_counters[DXGI_SC2_EVENT_GETFRAMELATENCYWAIABLEOBJECT].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc2_event_counters.Increment(DXGI_SC2_EVENT_GETFRAMELATENCYWAIABLEOBJECT);
     return IDXGISwapChain_GetFrameLatencyWaitableObject_Original(This);
 }
 
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_SetMatrixTransform_Detour(IDXGISwapChain2 *This, const DXGI_MATRIX_3X2_F *pMatrix) {
-    g_dxgi_sc2_event_counters[DXGI_SC2_EVENT_SETMATRIXTRANSFORM].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc2_event_counters.Increment(DXGI_SC2_EVENT_SETMATRIXTRANSFORM);
     return IDXGISwapChain_SetMatrixTransform_Original(This, pMatrix);
 }
 
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_GetMatrixTransform_Detour(IDXGISwapChain2 *This, DXGI_MATRIX_3X2_F *pMatrix) {
-    g_dxgi_sc2_event_counters[DXGI_SC2_EVENT_GETMATRIXTRANSFORM].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc2_event_counters.Increment(DXGI_SC2_EVENT_GETMATRIXTRANSFORM);
     return IDXGISwapChain_GetMatrixTransform_Original(This, pMatrix);
 }
 
 // IDXGISwapChain3 detour functions
 UINT STDMETHODCALLTYPE IDXGISwapChain_GetCurrentBackBufferIndex_Detour(IDXGISwapChain3 *This) {
-    g_dxgi_sc3_event_counters[DXGI_SC3_EVENT_GETCURRENTBACKBUFFERINDEX].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc3_event_counters.Increment(DXGI_SC3_EVENT_GETCURRENTBACKBUFFERINDEX);
     return IDXGISwapChain_GetCurrentBackBufferIndex_Original(This);
 }
 
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_SetColorSpace1_Detour(IDXGISwapChain3 *This, DXGI_COLOR_SPACE_TYPE ColorSpace) {
-    g_dxgi_sc3_event_counters[DXGI_SC3_EVENT_SETCOLORSPACE1].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc3_event_counters.Increment(DXGI_SC3_EVENT_SETCOLORSPACE1);
     return IDXGISwapChain_SetColorSpace1_Original(This, ColorSpace);
 }
 
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_ResizeBuffers1_Detour(IDXGISwapChain3 *This, UINT BufferCount, UINT Width, UINT Height, DXGI_FORMAT Format, UINT SwapChainFlags, const UINT *pCreationNodeMask, IUnknown *const *ppPresentQueue) {
-    g_dxgi_sc3_event_counters[DXGI_SC3_EVENT_RESIZEBUFFERS1].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc3_event_counters.Increment(DXGI_SC3_EVENT_RESIZEBUFFERS1);
     return IDXGISwapChain_ResizeBuffers1_Original(This, BufferCount, Width, Height, Format, SwapChainFlags, pCreationNodeMask, ppPresentQueue);
 }
 
 // IDXGISwapChain4 detour functions
 HRESULT STDMETHODCALLTYPE IDXGISwapChain_SetHDRMetaData_Detour(IDXGISwapChain4 *This, DXGI_HDR_METADATA_TYPE Type, UINT Size, void *pMetaData) {
     // Increment DXGI SetHDRMetaData counter
-    g_dxgi_sc4_event_counters[DXGI_SC4_EVENT_SETHDRMETADATA].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_sc4_event_counters.Increment(DXGI_SC4_EVENT_SETHDRMETADATA);
 
     // Log the HDR metadata call (only on first few calls to avoid spam)
     static int sethdrmetadata_log_count = 0;
@@ -1036,8 +1014,7 @@ HRESULT STDMETHODCALLTYPE IDXGISwapChain_SetHDRMetaData_Detour(IDXGISwapChain4 *
 // Hooked IDXGIOutput functions
 HRESULT STDMETHODCALLTYPE IDXGIOutput_SetGammaControl_Detour(IDXGIOutput *This, const DXGI_GAMMA_CONTROL *pArray) {
     // Increment DXGI Output SetGammaControl counter
-    g_dxgi_output_event_counters[DXGI_OUTPUT_EVENT_SETGAMMACONTROL].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_output_event_counters.Increment(DXGI_OUTPUT_EVENT_SETGAMMACONTROL);
 
     // Log the SetGammaControl call (only on first few calls to avoid spam)
     static int setgammacontrol_log_count = 0;
@@ -1057,8 +1034,7 @@ HRESULT STDMETHODCALLTYPE IDXGIOutput_SetGammaControl_Detour(IDXGIOutput *This,
 
 HRESULT STDMETHODCALLTYPE IDXGIOutput_GetGammaControl_Detour(IDXGIOutput *This, DXGI_GAMMA_CONTROL *pArray) {
     // Increment DXGI Output GetGammaControl counter
-    g_dxgi_output_event_counters[DXGI_OUTPUT_EVENT_GETGAMMACONTROL].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_output_event_counters.Increment(DXGI_OUTPUT_EVENT_GETGAMMACONTROL);
 
     // Log the GetGammaControl call (only on first few calls to avoid spam)
     static int getgammacontrol_log_count = 0;
@@ -1078,8 +1054,7 @@ HRESULT STDMETHODCALLTYPE IDXGIOutput_GetGammaControl_Detour(IDXGIOutput *This,
 
 HRESULT STDMETHODCALLTYPE IDXGIOutput_GetDesc_Detour(IDXGIOutput *This, DXGI_OUTPUT_DESC *pDesc) {
     // Increment DXGI Output GetDesc counter
-    g_dxgi_output_event_counters[DXGI_OUTPUT_EVENT_GETDESC].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_dxgi_output_event_counters.Increment(DXGI_OUTPUT_EVENT_GETDESC);
 
     // Log the GetDesc call (only on first few calls to avoid spam)
     static int getdesc_log_count = 0;
@@ -4,6 +4,10 @@
 #include <wrl/client.h>
 #include <atomic>
 
+namespace utils {
+class SwapchainFrameStats;
+} // namespace utils
+
 namespace display_commanderhooks {
 
 /**
@@ -25,10 +29,11 @@ private:
     Microsoft::WRL::ComPtr<IDXGISwapChain4> m_originalSwapChain;
     volatile LONG m_refCount;
     SwapChainHook m_swapChainHookType;
+    utils::SwapchainFrameStats* m_frameStats;  // per-swapchain pool entry, nullptr if the pool was full
 
 public:
     explicit DXGISwapChain4Wrapper(IDXGISwapChain4* originalSwapChain, SwapChainHook hookType);
-    virtual ~DXGISwapChain4Wrapper() = default;
+    virtual ~DXGISwapChain4Wrapper();
 
     // IUnknown methods
     STDMETHOD(QueryInterface)(REFIID riid, void **ppvObject) override;
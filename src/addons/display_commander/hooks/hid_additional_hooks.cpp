@@ -29,8 +29,7 @@ static std::atomic<bool> g_additional_hid_hooks_installed{false};
 // Hooked WriteFile function
 BOOL WINAPI WriteFile_Detour(HANDLE hFile, LPCVOID lpBuffer, DWORD nNumberOfBytesToWrite, LPDWORD lpNumberOfBytesWritten, LPOVERLAPPED lpOverlapped) {
     // Increment HID statistics
-    auto& stats = g_hid_api_stats[HID_WRITEFILE];
-    stats.increment_total();
+    g_hid_api_stats.Increment(HID_WRITEFILE, HID_CALLS_TOTAL);
 
     // Call original function
     BOOL result = WriteFile_Original ?
@@ -39,9 +38,9 @@ BOOL WINAPI WriteFile_Detour(HANDLE hFile, LPCVOID lpBuffer, DWORD nNumberOfByte
 
     // Update statistics based on result
     if (result) {
-        stats.increment_successful();
+        g_hid_api_stats.Increment(HID_WRITEFILE, HID_CALLS_SUCCESSFUL);
     } else {
-        stats.increment_failed();
+        g_hid_api_stats.Increment(HID_WRITEFILE, HID_CALLS_FAILED);
     }
 
     return result;
@@ -50,8 +49,7 @@ BOOL WINAPI WriteFile_Detour(HANDLE hFile, LPCVOID lpBuffer, DWORD nNumberOfByte
 // Hooked DeviceIoControl function
 BOOL WINAPI DeviceIoControl_Detour(HANDLE hDevice, DWORD dwIoControlCode, LPVOID lpInBuffer, DWORD nInBufferSize, LPVOID lpOutBuffer, DWORD nOutBufferSize, LPDWORD lpBytesReturned, LPOVERLAPPED lpOverlapped) {
     // Increment HID statistics
-    auto& stats = g_hid_api_stats[HID_DEVICEIOCONTROL];
-    stats.increment_total();
+    g_hid_api_stats.Increment(HID_DEVICEIOCONTROL, HID_CALLS_TOTAL);
 
     // Call original function
     BOOL result = DeviceIoControl_Original ?
@@ -60,9 +58,9 @@ BOOL WINAPI DeviceIoControl_Detour(HANDLE hDevice, DWORD dwIoControlCode, LPVOID
 
     // Update statistics based on result
     if (result) {
-        stats.increment_successful();
+        g_hid_api_stats.Increment(HID_DEVICEIOCONTROL, HID_CALLS_SUCCESSFUL);
     } else {
-        stats.increment_failed();
+        g_hid_api_stats.Increment(HID_DEVICEIOCONTROL, HID_CALLS_FAILED);
     }
 
     return result;
@@ -71,8 +69,7 @@ BOOL WINAPI DeviceIoControl_Detour(HANDLE hDevice, DWORD dwIoControlCode, LPVOID
 // Hooked HidD_GetPreparsedData function
 BOOLEAN __stdcall HidD_GetPreparsedData_Detour(HANDLE HidDeviceObject, PHIDP_PREPARSED_DATA* PreparsedData) {
     // Increment HID statistics
-    auto& stats = g_hid_api_stats[HID_HIDD_GETPREPARSEDDATA];
-    stats.increment_total();
+    g_hid_api_stats.Increment(HID_HIDD_GETPREPARSEDDATA, HID_CALLS_TOTAL);
 
     // Call original function
     BOOLEAN result = HidD_GetPreparsedData_Original ?
@@ -81,9 +78,9 @@ BOOLEAN __stdcall HidD_GetPreparsedData_Detour(HANDLE HidDeviceObject, PHIDP_PRE
 
     // Update statistics based on result
     if (result) {
-        stats.increment_successful();
+        g_hid_api_stats.Increment(HID_HIDD_GETPREPARSEDDATA, HID_CALLS_SUCCESSFUL);
     } else {
-        stats.increment_failed();
+        g_hid_api_stats.Increment(HID_HIDD_GETPREPARSEDDATA, HID_CALLS_FAILED);
     }
 
     return result;
@@ -92,8 +89,7 @@ BOOLEAN __stdcall HidD_GetPreparsedData_Detour(HANDLE HidDeviceObject, PHIDP_PRE
 // Hooked HidD_FreePreparsedData function
 BOOLEAN __stdcall HidD_FreePreparsedData_Detour(PHIDP_PREPARSED_DATA PreparsedData) {
     // Increment HID statistics
-    auto& stats = g_hid_api_stats[HID_HIDD_FREEPREPARSEDDATA];
-    stats.increment_total();
+    g_hid_api_stats.Increment(HID_HIDD_FREEPREPARSEDDATA, HID_CALLS_TOTAL);
 
     // Call original function
     BOOLEAN result = HidD_FreePreparsedData_Original ?
@@ -102,9 +98,9 @@ BOOLEAN __stdcall HidD_FreePreparsedData_Detour(PHIDP_PREPARSED_DATA PreparsedDa
 
     // Update statistics based on result
     if (result) {
-        stats.increment_successful();
+        g_hid_api_stats.Increment(HID_HIDD_FREEPREPARSEDDATA, HID_CALLS_SUCCESSFUL);
     } else {
-        stats.increment_failed();
+        g_hid_api_stats.Increment(HID_HIDD_FREEPREPARSEDDATA, HID_CALLS_FAILED);
     }
 
     return result;
@@ -113,8 +109,7 @@ BOOLEAN __stdcall HidD_FreePreparsedData_Detour(PHIDP_PREPARSED_DATA PreparsedDa
 // Hooked HidP_GetCaps function
 BOOLEAN __stdcall HidP_GetCaps_Detour(PHIDP_PREPARSED_DATA PreparsedData, PHIDP_CAPS Capabilities) {
     // Increment HID statistics
-    auto& stats = g_hid_api_stats[HID_HIDD_GETCAPS];
-    stats.increment_total();
+    g_hid_api_stats.Increment(HID_HIDD_GETCAPS, HID_CALLS_TOTAL);
 
     // Call original function
     BOOLEAN result = HidP_GetCaps_Original ?
@@ -123,9 +118,9 @@ BOOLEAN __stdcall HidP_GetCaps_Detour(PHIDP_PREPARSED_DATA PreparsedData, PHIDP_
 
     // Update statistics based on result
     if (result) {
-        stats.increment_successful();
+        g_hid_api_stats.Increment(HID_HIDD_GETCAPS, HID_CALLS_SUCCESSFUL);
     } else {
-        stats.increment_failed();
+        g_hid_api_stats.Increment(HID_HIDD_GETCAPS, HID_CALLS_FAILED);
     }
 
     return result;
@@ -134,8 +129,7 @@ BOOLEAN __stdcall HidP_GetCaps_Detour(PHIDP_PREPARSED_DATA PreparsedData, PHIDP_
 // Hooked HidD_GetManufacturerString function
 BOOLEAN __stdcall HidD_GetManufacturerString_Detour(HANDLE HidDeviceObject, PVOID Buffer, ULONG BufferLength) {
     // Increment HID statistics
-    auto& stats = g_hid_api_stats[HID_HIDD_GETMANUFACTURERSTRING];
-    stats.increment_total();
+    g_hid_api_stats.Increment(HID_HIDD_GETMANUFACTURERSTRING, HID_CALLS_TOTAL);
 
     // Call original function
     BOOLEAN result = HidD_GetManufacturerString_Original ?
@@ -144,9 +138,9 @@ BOOLEAN __stdcall HidD_GetManufacturerString_Detour(HANDLE HidDeviceObject, PVOI
 
     // Update statistics based on result
     if (result) {
-        stats.increment_successful();
+        g_hid_api_stats.Increment(HID_HIDD_GETMANUFACTURERSTRING, HID_CALLS_SUCCESSFUL);
     } else {
-        stats.increment_failed();
+        g_hid_api_stats.Increment(HID_HIDD_GETMANUFACTURERSTRING, HID_CALLS_FAILED);
     }
 
     return result;
@@ -155,8 +149,7 @@ BOOLEAN __stdcall HidD_GetManufacturerString_Detour(HANDLE HidDeviceObject, PVOI
 // Hooked HidD_GetProductString function
 BOOLEAN __stdcall HidD_GetProductString_Detour(HANDLE HidDeviceObject, PVOID Buffer, ULONG BufferLength) {
     // Increment HID statistics
-    auto& stats = g_hid_api_stats[HID_HIDD_GETPRODUCTSTRING];
-    stats.increment_total();
+    g_hid_api_stats.Increment(HID_HIDD_GETPRODUCTSTRING, HID_CALLS_TOTAL);
 
     // Call original function
     BOOLEAN result = HidD_GetProductString_Original ?
@@ -165,9 +158,9 @@ BOOLEAN __stdcall HidD_GetProductString_Detour(HANDLE HidDeviceObject, PVOID Buf
 
     // Update statistics based on result
     if (result) {
-        stats.increment_successful();
+        g_hid_api_stats.Increment(HID_HIDD_GETPRODUCTSTRING, HID_CALLS_SUCCESSFUL);
     } else {
-        stats.increment_failed();
+        g_hid_api_stats.Increment(HID_HIDD_GETPRODUCTSTRING, HID_CALLS_FAILED);
     }
 
     return result;
@@ -176,8 +169,7 @@ BOOLEAN __stdcall HidD_GetProductString_Detour(HANDLE HidDeviceObject, PVOID Buf
 // Hooked HidD_GetSerialNumberString function
 BOOLEAN __stdcall HidD_GetSerialNumberString_Detour(HANDLE HidDeviceObject, PVOID Buffer, ULONG BufferLength) {
     // Increment HID statistics
-    auto& stats = g_hid_api_stats[HID_HIDD_GETSERIALNUMBERSTRING];
-    stats.increment_total();
+    g_hid_api_stats.Increment(HID_HIDD_GETSERIALNUMBERSTRING, HID_CALLS_TOTAL);
 
     // Call original function
     BOOLEAN result = HidD_GetSerialNumberString_Original ?
@@ -186,9 +178,9 @@ BOOLEAN __stdcall HidD_GetSerialNumberString_Detour(HANDLE HidDeviceObject, PVOI
 
     // Update statistics based on result
     if (result) {
-        stats.increment_successful();
+        g_hid_api_stats.Increment(HID_HIDD_GETSERIALNUMBERSTRING, HID_CALLS_SUCCESSFUL);
     } else {
-        stats.increment_failed();
+        g_hid_api_stats.Increment(HID_HIDD_GETSERIALNUMBERSTRING, HID_CALLS_FAILED);
     }
 
     return result;
@@ -197,8 +189,7 @@ BOOLEAN __stdcall HidD_GetSerialNumberString_Detour(HANDLE HidDeviceObject, PVOI
 // Hooked HidD_GetNumInputBuffers function
 BOOLEAN __stdcall HidD_GetNumInputBuffers_Detour(HANDLE HidDeviceObject, PULONG NumberBuffers) {
     // Increment HID statistics
-    auto& stats = g_hid_api_stats[HID_HIDD_GETNUMINPUTBUFFERS];
-    stats.increment_total();
+    g_hid_api_stats.Increment(HID_HIDD_GETNUMINPUTBUFFERS, HID_CALLS_TOTAL);
 
     // Call original function
     BOOLEAN result = HidD_GetNumInputBuffers_Original ?
@@ -207,9 +198,9 @@ BOOLEAN __stdcall HidD_GetNumInputBuffers_Detour(HANDLE HidDeviceObject, PULONG
 
     // Update statistics based on result
     if (result) {
-        stats.increment_successful();
+        g_hid_api_stats.Increment(HID_HIDD_GETNUMINPUTBUFFERS, HID_CALLS_SUCCESSFUL);
     } else {
-        stats.increment_failed();
+        g_hid_api_stats.Increment(HID_HIDD_GETNUMINPUTBUFFERS, HID_CALLS_FAILED);
     }
 
     return result;
@@ -218,8 +209,7 @@ BOOLEAN __stdcall HidD_GetNumInputBuffers_Detour(HANDLE HidDeviceObject, PULONG
 // Hooked HidD_SetNumInputBuffers function
 BOOLEAN __stdcall HidD_SetNumInputBuffers_Detour(HANDLE HidDeviceObject, ULONG NumberBuffers) {
     // Increment HID statistics
-    auto& stats = g_hid_api_stats[HID_HIDD_SETNUMINPUTBUFFERS];
-    stats.increment_total();
+    g_hid_api_stats.Increment(HID_HIDD_SETNUMINPUTBUFFERS, HID_CALLS_TOTAL);
 
     // Call original function
     BOOLEAN result = HidD_SetNumInputBuffers_Original ?
@@ -228,9 +218,9 @@ BOOLEAN __stdcall HidD_SetNumInputBuffers_Detour(HANDLE HidDeviceObject, ULONG N
 
     // Update statistics based on result
     if (result) {
-        stats.increment_successful();
+        g_hid_api_stats.Increment(HID_HIDD_SETNUMINPUTBUFFERS, HID_CALLS_SUCCESSFUL);
     } else {
-        stats.increment_failed();
+        g_hid_api_stats.Increment(HID_HIDD_SETNUMINPUTBUFFERS, HID_CALLS_FAILED);
     }
 
     return result;
@@ -239,8 +229,7 @@ BOOLEAN __stdcall HidD_SetNumInputBuffers_Detour(HANDLE HidDeviceObject, ULONG N
 // Hooked HidD_GetFeature function
 BOOLEAN __stdcall HidD_GetFeature_Detour(HANDLE HidDeviceObject, PVOID ReportBuffer, ULONG ReportBufferLength) {
     // Increment HID statistics
-    auto& stats = g_hid_api_stats[HID_HIDD_GETFEATURE];
-    stats.increment_total();
+    g_hid_api_stats.Increment(HID_HIDD_GETFEATURE, HID_CALLS_TOTAL);
 
     // Call original function
     BOOLEAN result = HidD_GetFeature_Original ?
@@ -249,9 +238,9 @@ BOOLEAN __stdcall HidD_GetFeature_Detour(HANDLE HidDeviceObject, PVOID ReportBuf
 
     // Update statistics based on result
     if (result) {
-        stats.increment_successful();
+        g_hid_api_stats.Increment(HID_HIDD_GETFEATURE, HID_CALLS_SUCCESSFUL);
     } else {
-        stats.increment_failed();
+        g_hid_api_stats.Increment(HID_HIDD_GETFEATURE, HID_CALLS_FAILED);
     }
 
     return result;
@@ -260,8 +249,7 @@ BOOLEAN __stdcall HidD_GetFeature_Detour(HANDLE HidDeviceObject, PVOID ReportBuf
 // Hooked HidD_SetFeature function
 BOOLEAN __stdcall HidD_SetFeature_Detour(HANDLE HidDeviceObject, PVOID ReportBuffer, ULONG ReportBufferLength) {
     // Increment HID statistics
-    auto& stats = g_hid_api_stats[HID_HIDD_SETFEATURE];
-    stats.increment_total();
+    g_hid_api_stats.Increment(HID_HIDD_SETFEATURE, HID_CALLS_TOTAL);
 
     // Call original function
     BOOLEAN result = HidD_SetFeature_Original ?
@@ -270,9 +258,9 @@ BOOLEAN __stdcall HidD_SetFeature_Detour(HANDLE HidDeviceObject, PVOID ReportBuf
 
     // Update statistics based on result
     if (result) {
-        stats.increment_successful();
+        g_hid_api_stats.Increment(HID_HIDD_SETFEATURE, HID_CALLS_SUCCESSFUL);
     } else {
-        stats.increment_failed();
+        g_hid_api_stats.Increment(HID_HIDD_SETFEATURE, HID_CALLS_FAILED);
     }
 
     return result;
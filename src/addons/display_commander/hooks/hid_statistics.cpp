@@ -6,7 +6,7 @@
 namespace display_commanderhooks {
 
 // Global HID statistics
-std::array<HIDCallStats, HID_COUNT> g_hid_api_stats;
+utils::CounterRegistry<uint64_t, HID_COUNT, HID_CALLS_COUNTER_COUNT> g_hid_api_stats;
 HIDDeviceStats g_hid_device_stats;
 
 // HID API names
@@ -30,8 +30,13 @@ const char* HID_API_NAMES[HID_COUNT] = {
     "HidD_SetFeature"
 };
 
-const HIDCallStats& GetHIDAPIStats(HIDAPIType api_type) {
-    return g_hid_api_stats[api_type];
+HIDCallStats GetHIDAPIStats(HIDAPIType api_type) {
+    HIDCallStats stats;
+    stats.total_calls = g_hid_api_stats.Load(api_type, HID_CALLS_TOTAL);
+    stats.successful_calls = g_hid_api_stats.Load(api_type, HID_CALLS_SUCCESSFUL);
+    stats.failed_calls = g_hid_api_stats.Load(api_type, HID_CALLS_FAILED);
+    stats.blocked_calls = g_hid_api_stats.Load(api_type, HID_CALLS_BLOCKED);
+    return stats;
 }
 
 const HIDDeviceStats& GetHIDDeviceStats() {
@@ -39,9 +44,7 @@ const HIDDeviceStats& GetHIDDeviceStats() {
 }
 
 void ResetAllHIDStats() {
-    for (auto& stats : g_hid_api_stats) {
-        stats.reset();
-    }
+    g_hid_api_stats.ResetAll();
     g_hid_device_stats.reset();
 }
 
@@ -3,26 +3,25 @@
 #include <atomic>
 #include <array>
 #include <string>
+#include "../utils/counter_registry.hpp"
 
 namespace display_commanderhooks {
 
-// HID API call statistics structure
-struct HIDCallStats {
-    std::atomic<uint64_t> total_calls{0};
-    std::atomic<uint64_t> successful_calls{0};
-    std::atomic<uint64_t> failed_calls{0};
-    std::atomic<uint64_t> blocked_calls{0};
+// HID API call counters (columns of g_hid_api_stats)
+enum HIDCallCounter {
+    HID_CALLS_TOTAL = 0,
+    HID_CALLS_SUCCESSFUL,
+    HID_CALLS_FAILED,
+    HID_CALLS_BLOCKED,
+    HID_CALLS_COUNTER_COUNT
+};
 
-    void increment_total() { total_calls.fetch_add(1); }
-    void increment_successful() { successful_calls.fetch_add(1); }
-    void increment_failed() { failed_calls.fetch_add(1); }
-    void increment_blocked() { blocked_calls.fetch_add(1); }
-    void reset() {
-        total_calls.store(0);
-        successful_calls.store(0);
-        failed_calls.store(0);
-        blocked_calls.store(0);
-    }
+// Snapshot of one HID API's call counters
+struct HIDCallStats {
+    uint64_t total_calls = 0;
+    uint64_t successful_calls = 0;
+    uint64_t failed_calls = 0;
+    uint64_t blocked_calls = 0;
 };
 
 // HID API types
@@ -70,11 +69,11 @@ struct HIDDeviceStats {
 };
 
 // Global HID statistics
-extern std::array<HIDCallStats, HID_COUNT> g_hid_api_stats;
+extern utils::CounterRegistry<uint64_t, HID_COUNT, HID_CALLS_COUNTER_COUNT> g_hid_api_stats;
 extern HIDDeviceStats g_hid_device_stats;
 
 // HID statistics access functions
-const HIDCallStats& GetHIDAPIStats(HIDAPIType api_type);
+HIDCallStats GetHIDAPIStats(HIDAPIType api_type);
 const HIDDeviceStats& GetHIDDeviceStats();
 void ResetAllHIDStats();
 int GetHIDAPICount();
@@ -61,8 +61,7 @@ BOOL WINAPI ReadFile_Direct(HANDLE hFile, LPVOID lpBuffer, DWORD nNumberOfBytesT
 // Hooked ReadFile function - suppresses HID input reading for games
 BOOL WINAPI ReadFile_Detour(HANDLE hFile, LPVOID lpBuffer, DWORD nNumberOfBytesToRead, LPDWORD lpNumberOfBytesRead, LPOVERLAPPED lpOverlapped) {
     // Increment HID statistics
-    auto& stats = display_commanderhooks::g_hid_api_stats[display_commanderhooks::HID_READFILE];
-    stats.increment_total();
+    display_commanderhooks::g_hid_api_stats.Increment(display_commanderhooks::HID_READFILE, display_commanderhooks::HID_CALLS_TOTAL);
 
     // Check if HID suppression is enabled and ReadFile blocking is enabled
     if (ShouldSuppressHIDInput() && settings::g_experimentalTabSettings.hid_suppression_block_readfile.GetValue()) {
@@ -77,7 +76,7 @@ BOOL WINAPI ReadFile_Detour(HANDLE hFile, LPVOID lpBuffer, DWORD nNumberOfBytesT
                     *lpNumberOfBytesRead = 0;
                 }
                 SetLastError(ERROR_DEVICE_NOT_CONNECTED);
-                stats.increment_blocked();
+                display_commanderhooks::g_hid_api_stats.Increment(display_commanderhooks::HID_READFILE, display_commanderhooks::HID_CALLS_BLOCKED);
                 LogInfo("HID suppression: Blocked ReadFile operation on potential HID device");
                 return FALSE;
             }
@@ -91,9 +90,9 @@ BOOL WINAPI ReadFile_Detour(HANDLE hFile, LPVOID lpBuffer, DWORD nNumberOfBytesT
 
     // Update statistics based on result
     if (result) {
-        stats.increment_successful();
+        display_commanderhooks::g_hid_api_stats.Increment(display_commanderhooks::HID_READFILE, display_commanderhooks::HID_CALLS_SUCCESSFUL);
     } else {
-        stats.increment_failed();
+        display_commanderhooks::g_hid_api_stats.Increment(display_commanderhooks::HID_READFILE, display_commanderhooks::HID_CALLS_FAILED);
     }
 
     return result;
@@ -215,8 +214,7 @@ HANDLE WINAPI CreateFileA_Direct(LPCSTR lpFileName, DWORD dwDesiredAccess, DWORD
 // Hooked CreateFileA function - blocks HID device access
 HANDLE WINAPI CreateFileA_Detour(LPCSTR lpFileName, DWORD dwDesiredAccess, DWORD dwShareMode, LPSECURITY_ATTRIBUTES lpSecurityAttributes, DWORD dwCreationDisposition, DWORD dwFlagsAndAttributes, HANDLE hTemplateFile) {
     // Increment HID statistics
-    auto& stats = display_commanderhooks::g_hid_api_stats[display_commanderhooks::HID_CREATEFILE_A];
-    stats.increment_total();
+    display_commanderhooks::g_hid_api_stats.Increment(display_commanderhooks::HID_CREATEFILE_A, display_commanderhooks::HID_CALLS_TOTAL);
 
     // Check if this is a HID device access and increment counters
     if (lpFileName && IsHIDDevicePath(std::string(lpFileName))) {
@@ -251,7 +249,7 @@ HANDLE WINAPI CreateFileA_Detour(LPCSTR lpFileName, DWORD dwDesiredAccess, DWORD
     if (ShouldSuppressHIDInput() && settings::g_experimentalTabSettings.hid_suppression_block_createfile.GetValue()) {
         if (lpFileName && IsHIDDevicePath(std::string(lpFileName))) {
             LogInfo("HID suppression: Blocked CreateFileA access to HID device: %s", lpFileName);
-            stats.increment_blocked();
+            display_commanderhooks::g_hid_api_stats.Increment(display_commanderhooks::HID_CREATEFILE_A, display_commanderhooks::HID_CALLS_BLOCKED);
             SetLastError(ERROR_ACCESS_DENIED);
             return INVALID_HANDLE_VALUE;
         }
@@ -264,9 +262,9 @@ HANDLE WINAPI CreateFileA_Detour(LPCSTR lpFileName, DWORD dwDesiredAccess, DWORD
 
     // Update statistics based on result
     if (result != INVALID_HANDLE_VALUE) {
-        stats.increment_successful();
+        display_commanderhooks::g_hid_api_stats.Increment(display_commanderhooks::HID_CREATEFILE_A, display_commanderhooks::HID_CALLS_SUCCESSFUL);
     } else {
-        stats.increment_failed();
+        display_commanderhooks::g_hid_api_stats.Increment(display_commanderhooks::HID_CREATEFILE_A, display_commanderhooks::HID_CALLS_FAILED);
     }
 
     return result;
@@ -282,8 +280,7 @@ HANDLE WINAPI CreateFileW_Direct(LPCWSTR lpFileName, DWORD dwDesiredAccess, DWOR
 // Hooked CreateFileW function - blocks HID device access
 HANDLE WINAPI CreateFileW_Detour(LPCWSTR lpFileName, DWORD dwDesiredAccess, DWORD dwShareMode, LPSECURITY_ATTRIBUTES lpSecurityAttributes, DWORD dwCreationDisposition, DWORD dwFlagsAndAttributes, HANDLE hTemplateFile) {
     // Increment HID statistics
-    auto& stats = display_commanderhooks::g_hid_api_stats[display_commanderhooks::HID_CREATEFILE_W];
-    stats.increment_total();
+    display_commanderhooks::g_hid_api_stats.Increment(display_commanderhooks::HID_CREATEFILE_W, display_commanderhooks::HID_CALLS_TOTAL);
 
     // Check if this is a HID device access and increment counters
     if (lpFileName && IsHIDDevicePath(std::wstring(lpFileName))) {
@@ -318,7 +315,7 @@ HANDLE WINAPI CreateFileW_Detour(LPCWSTR lpFileName, DWORD dwDesiredAccess, DWOR
     if (ShouldSuppressHIDInput() && settings::g_experimentalTabSettings.hid_suppression_block_createfile.GetValue()) {
         if (lpFileName && IsHIDDevicePath(std::wstring(lpFileName))) {
             LogInfo("HID suppression: Blocked CreateFileW access to HID device: %ls", lpFileName);
-            stats.increment_blocked();
+            display_commanderhooks::g_hid_api_stats.Increment(display_commanderhooks::HID_CREATEFILE_W, display_commanderhooks::HID_CALLS_BLOCKED);
             SetLastError(ERROR_ACCESS_DENIED);
             return INVALID_HANDLE_VALUE;
         }
@@ -331,9 +328,9 @@ HANDLE WINAPI CreateFileW_Detour(LPCWSTR lpFileName, DWORD dwDesiredAccess, DWOR
 
     // Update statistics based on result
     if (result != INVALID_HANDLE_VALUE) {
-        stats.increment_successful();
+        display_commanderhooks::g_hid_api_stats.Increment(display_commanderhooks::HID_CREATEFILE_W, display_commanderhooks::HID_CALLS_SUCCESSFUL);
     } else {
-        stats.increment_failed();
+        display_commanderhooks::g_hid_api_stats.Increment(display_commanderhooks::HID_CREATEFILE_W, display_commanderhooks::HID_CALLS_FAILED);
     }
 
     return result;
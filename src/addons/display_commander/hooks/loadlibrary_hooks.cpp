@@ -164,7 +164,7 @@ HMODULE WINAPI LoadLibraryA_Detour(LPCSTR lpLibFileName) {
     std::string timestamp = GetCurrentTimestamp();
     std::string dll_name = lpLibFileName ? lpLibFileName : "NULL";
 
-    LogInfo("[%s] LoadLibraryA called: %s", timestamp.c_str(), dll_name.c_str());
+    LogInfoDeferred("[%s] LoadLibraryA called: %s", timestamp.c_str(), dll_name.c_str());
 
     // Check for Ansel blocking
     if (lpLibFileName) {
@@ -198,7 +198,7 @@ HMODULE WINAPI LoadLibraryA_Detour(LPCSTR lpLibFileName) {
     HMODULE result = LoadLibraryA_Original ? LoadLibraryA_Original(actual_lib_file_name) : LoadLibraryA(actual_lib_file_name);
 
     if (result) {
-        LogInfo("[%s] LoadLibraryA success: %s -> HMODULE: 0x%p", timestamp.c_str(), dll_name.c_str(), result);
+        LogInfoDeferred("[%s] LoadLibraryA success: %s -> HMODULE: 0x%p", timestamp.c_str(), dll_name.c_str(), result);
 
         // Track the newly loaded module
         {
@@ -234,7 +234,7 @@ HMODULE WINAPI LoadLibraryA_Detour(LPCSTR lpLibFileName) {
         }
     } else {
         DWORD error = GetLastError();
-        LogInfo("[%s] LoadLibraryA failed: %s -> Error: %lu", timestamp.c_str(), dll_name.c_str(), error);
+        LogInfoDeferred("[%s] LoadLibraryA failed: %s -> Error: %lu", timestamp.c_str(), dll_name.c_str(), error);
     }
 
     return result;
@@ -245,7 +245,7 @@ HMODULE WINAPI LoadLibraryW_Detour(LPCWSTR lpLibFileName) {
     std::string timestamp = GetCurrentTimestamp();
     std::string dll_name = lpLibFileName ? WideToNarrow(lpLibFileName) : "NULL";
 
-    LogInfo("[%s] LoadLibraryW called: %s", timestamp.c_str(), dll_name.c_str());
+    LogInfoDeferred("[%s] LoadLibraryW called: %s", timestamp.c_str(), dll_name.c_str());
 
     // Check for Ansel blocking
     if (lpLibFileName) {
@@ -279,7 +279,7 @@ HMODULE WINAPI LoadLibraryW_Detour(LPCWSTR lpLibFileName) {
     HMODULE result = LoadLibraryW_Original ? LoadLibraryW_Original(actual_lib_file_name) : LoadLibraryW(actual_lib_file_name);
 
     if (result) {
-        LogInfo("[%s] LoadLibraryW success: %s -> HMODULE: 0x%p", timestamp.c_str(), dll_name.c_str(), result);
+        LogInfoDeferred("[%s] LoadLibraryW success: %s -> HMODULE: 0x%p", timestamp.c_str(), dll_name.c_str(), result);
 
         // Track the newly loaded module
         {
@@ -315,7 +315,7 @@ HMODULE WINAPI LoadLibraryW_Detour(LPCWSTR lpLibFileName) {
         }
     } else {
         DWORD error = GetLastError();
-        LogInfo("[%s] LoadLibraryW failed: %s -> Error: %lu", timestamp.c_str(), dll_name.c_str(), error);
+        LogInfoDeferred("[%s] LoadLibraryW failed: %s -> Error: %lu", timestamp.c_str(), dll_name.c_str(), error);
     }
 
     return result;
@@ -326,7 +326,7 @@ HMODULE WINAPI LoadLibraryExA_Detour(LPCSTR lpLibFileName, HANDLE hFile, DWORD d
     std::string timestamp = GetCurrentTimestamp();
     std::string dll_name = lpLibFileName ? lpLibFileName : "NULL";
 
-    LogInfo("[%s] LoadLibraryExA called: %s, hFile: 0x%p, dwFlags: 0x%08X",
+    LogInfoDeferred("[%s] LoadLibraryExA called: %s, hFile: 0x%p, dwFlags: 0x%08X",
             timestamp.c_str(), dll_name.c_str(), hFile, dwFlags);
 
     // Check for Ansel blocking
@@ -363,7 +363,7 @@ HMODULE WINAPI LoadLibraryExA_Detour(LPCSTR lpLibFileName, HANDLE hFile, DWORD d
         LoadLibraryExA(actual_lib_file_name, hFile, dwFlags);
 
     if (result) {
-        LogInfo("[%s] LoadLibraryExA success: %s -> HMODULE: 0x%p", timestamp.c_str(), dll_name.c_str(), result);
+        LogInfoDeferred("[%s] LoadLibraryExA success: %s -> HMODULE: 0x%p", timestamp.c_str(), dll_name.c_str(), result);
 
         // Track the module if it's not already tracked
         {
@@ -410,7 +410,7 @@ HMODULE WINAPI LoadLibraryExA_Detour(LPCSTR lpLibFileName, HANDLE hFile, DWORD d
         }
     } else {
         DWORD error = GetLastError();
-        LogInfo("[%s] LoadLibraryExA failed: %s -> Error: %lu", timestamp.c_str(), dll_name.c_str(), error);
+        LogInfoDeferred("[%s] LoadLibraryExA failed: %s -> Error: %lu", timestamp.c_str(), dll_name.c_str(), error);
     }
 
     return result;
@@ -421,7 +421,7 @@ HMODULE WINAPI LoadLibraryExW_Detour(LPCWSTR lpLibFileName, HANDLE hFile, DWORD
     std::string timestamp = GetCurrentTimestamp();
     std::string dll_name = lpLibFileName ? WideToNarrow(lpLibFileName) : "NULL";
 
-    LogInfo("[%s] LoadLibraryExW called: %s, hFile: 0x%p, dwFlags: 0x%08X",
+    LogInfoDeferred("[%s] LoadLibraryExW called: %s, hFile: 0x%p, dwFlags: 0x%08X",
             timestamp.c_str(), dll_name.c_str(), hFile, dwFlags);
 
     // Check for Ansel blocking
@@ -458,7 +458,7 @@ HMODULE WINAPI LoadLibraryExW_Detour(LPCWSTR lpLibFileName, HANDLE hFile, DWORD
         LoadLibraryExW(actual_lib_file_name, hFile, dwFlags);
 
     if (result) {
-        LogInfo("[%s] LoadLibraryExW success: %s -> HMODULE: 0x%p", timestamp.c_str(), dll_name.c_str(), result);
+        LogInfoDeferred("[%s] LoadLibraryExW success: %s -> HMODULE: 0x%p", timestamp.c_str(), dll_name.c_str(), result);
 
         // Track the module if it's not already tracked
         {
@@ -495,7 +495,7 @@ HMODULE WINAPI LoadLibraryExW_Detour(LPCWSTR lpLibFileName, HANDLE hFile, DWORD
         }
     } else {
         DWORD error = GetLastError();
-        LogInfo("[%s] LoadLibraryExW failed: %s -> Error: %lu", timestamp.c_str(), dll_name.c_str(), error);
+        LogInfoDeferred("[%s] LoadLibraryExW failed: %s -> Error: %lu", timestamp.c_str(), dll_name.c_str(), error);
     }
 
     return result;
@@ -1,6 +1,8 @@
 #include "ngx_hooks.hpp"
 #include <MinHook.h>
 #include <algorithm>
+#include <array>
+#include <cstring>
 #include <map>
 #include <string>
 #include <vector>
@@ -269,19 +271,24 @@ NVSDK_NGX_UpdateFeature_pfn NVSDK_NGX_UpdateFeature_Original = nullptr;
 static bool g_ngx_vtable_hooks_installed = false;
 
 // DLSS preset parameter names arrays
-static const std::vector<std::string> g_dlss_sr_preset_params = {
+static constexpr std::array<const char*, 6> g_dlss_sr_preset_params = {
     "DLSS.Hint.Render.Preset.Quality",      "DLSS.Hint.Render.Preset.Balanced",
     "DLSS.Hint.Render.Preset.Performance",  "DLSS.Hint.Render.Preset.UltraPerformance",
     "DLSS.Hint.Render.Preset.UltraQuality", "DLSS.Hint.Render.Preset.DLAA"};
 
-static const std::vector<std::string> g_dlss_rr_preset_params = {
+static constexpr std::array<const char*, 6> g_dlss_rr_preset_params = {
     "RayReconstruction.Hint.Render.Preset.Quality",      "RayReconstruction.Hint.Render.Preset.Balanced",
     "RayReconstruction.Hint.Render.Preset.Performance",  "RayReconstruction.Hint.Render.Preset.UltraPerformance",
     "RayReconstruction.Hint.Render.Preset.UltraQuality", "RayReconstruction.Hint.Render.Preset.DLAA"};
 
 // Helper function to check if a parameter name is in the DLSS preset array
-static bool IsDLSSPresetParameter(const std::string& param_name, const std::vector<std::string>& preset_params) {
-    return std::find(preset_params.begin(), preset_params.end(), param_name) != preset_params.end();
+static bool IsDLSSPresetParameter(const char* param_name, const std::array<const char*, 6>& preset_params) {
+    for (const char* preset_param : preset_params) {
+        if (strcmp(param_name, preset_param) == 0) {
+            return true;
+        }
+    }
+    return false;
 }
 
 // Function to automatically set DLSS preset parameters during initialization
@@ -308,14 +315,14 @@ static void ApplyDLSSPresetParameters(NVSDK_NGX_Parameter* InParameters) {
 
     // Apply DLSS Super Resolution preset parameters
     if (sr_preset >= 0) {  // -1 = Game Default (no override), 0 = DLSS Default, 1+ = Preset A+
-        for (const auto& param_name : g_dlss_sr_preset_params) {
+        for (const char* param_name : g_dlss_sr_preset_params) {
             if (NVSDK_NGX_Parameter_SetI_Original != nullptr) {
-                NVSDK_NGX_Parameter_SetI_Original(InParameters, param_name.c_str(), sr_preset);
-                g_ngx_parameters.update_int(param_name, sr_preset);
+                NVSDK_NGX_Parameter_SetI_Original(InParameters, param_name, sr_preset);
+                g_ngx_parameters.SetInt(param_name, sr_preset);
                 if (sr_preset == 0) {
-                    LogInfo("Applied DLSS SR preset: %s -> %d (DLSS Default)", param_name.c_str(), sr_preset);
+                    LogInfo("Applied DLSS SR preset: %s -> %d (DLSS Default)", param_name, sr_preset);
                 } else {
-                    LogInfo("Applied DLSS SR preset: %s -> %d (Preset %c)", param_name.c_str(), sr_preset,
+                    LogInfo("Applied DLSS SR preset: %s -> %d (Preset %c)", param_name, sr_preset,
                             'A' + sr_preset - 1);
                 }
             }
@@ -324,14 +331,14 @@ static void ApplyDLSSPresetParameters(NVSDK_NGX_Parameter* InParameters) {
 
     // Apply DLSS Ray Reconstruction preset parameters
     if (rr_preset >= 0) {  // -1 = Game Default (no override), 0 = DLSS Default, 1+ = Preset A+
-        for (const auto& param_name : g_dlss_rr_preset_params) {
+        for (const char* param_name : g_dlss_rr_preset_params) {
             if (NVSDK_NGX_Parameter_SetI_Original != nullptr) {
-                NVSDK_NGX_Parameter_SetI_Original(InParameters, param_name.c_str(), rr_preset);
-                g_ngx_parameters.update_int(param_name, rr_preset);
+                NVSDK_NGX_Parameter_SetI_Original(InParameters, param_name, rr_preset);
+                g_ngx_parameters.SetInt(param_name, rr_preset);
                 if (rr_preset == 0) {
-                    LogInfo("Applied DLSS RR preset: %s -> %d (DLSS Default)", param_name.c_str(), rr_preset);
+                    LogInfo("Applied DLSS RR preset: %s -> %d (DLSS Default)", param_name, rr_preset);
                 } else {
-                    LogInfo("Applied DLSS RR preset: %s -> %d (Preset %c)", param_name.c_str(), rr_preset,
+                    LogInfo("Applied DLSS RR preset: %s -> %d (Preset %c)", param_name, rr_preset,
                             'A' + rr_preset - 1);
                 }
             }
@@ -357,7 +364,7 @@ void NVSDK_CONV NVSDK_NGX_Parameter_SetF_Detour(NVSDK_NGX_Parameter* InParameter
 
     // Store parameter in thread-safe storage
     if (InName != nullptr) {
-        g_ngx_parameters.update_float(std::string(InName), InValue);
+        g_ngx_parameters.SetFloat(InName, InValue);
     }
 
     // Log the call (first few times only)
@@ -381,7 +388,7 @@ void NVSDK_CONV NVSDK_NGX_Parameter_SetD_Detour(NVSDK_NGX_Parameter* InParameter
 
     // Store parameter in thread-safe storage
     if (InName != nullptr) {
-        g_ngx_parameters.update_double(std::string(InName), InValue);
+        g_ngx_parameters.SetDouble(InName, InValue);
     }
 
     // Log the call (first few times only)
@@ -405,7 +412,7 @@ void NVSDK_CONV NVSDK_NGX_Parameter_SetI_Detour(NVSDK_NGX_Parameter* InParameter
 
     // DLSS preset override logic
     if (InName != nullptr && settings::g_swapchainTabSettings.dlss_preset_override_enabled.GetValue()) {
-        std::string param_name = std::string(InName);
+        const char* param_name = InName;
 
         // Check for DLSS Super Resolution preset parameters
         if (IsDLSSPresetParameter(param_name, g_dlss_sr_preset_params)) {
@@ -413,9 +420,9 @@ void NVSDK_CONV NVSDK_NGX_Parameter_SetI_Detour(NVSDK_NGX_Parameter* InParameter
             if (sr_preset >= 0) {  // -1 = Game Default (no override), 0 = DLSS Default, 1+ = Preset A+
                 InValue = sr_preset;
                 if (sr_preset == 0) {
-                    LogInfo("DLSS SR preset override: %s -> %d (DLSS Default)", param_name.c_str(), InValue);
+                    LogInfo("DLSS SR preset override: %s -> %d (DLSS Default)", param_name, InValue);
                 } else {
-                    LogInfo("DLSS SR preset override: %s -> %d (Preset %c)", param_name.c_str(), InValue,
+                    LogInfo("DLSS SR preset override: %s -> %d (Preset %c)", param_name, InValue,
                             'A' + sr_preset - 1);
                 }
             }
@@ -427,9 +434,9 @@ void NVSDK_CONV NVSDK_NGX_Parameter_SetI_Detour(NVSDK_NGX_Parameter* InParameter
             if (rr_preset >= 0) {  // -1 = Game Default (no override), 0 = DLSS Default, 1+ = Preset A+
                 InValue = rr_preset;
                 if (rr_preset == 0) {
-                    LogInfo("DLSS RR preset override: %s -> %d (DLSS Default)", param_name.c_str(), InValue);
+                    LogInfo("DLSS RR preset override: %s -> %d (DLSS Default)", param_name, InValue);
                 } else {
-                    LogInfo("DLSS RR preset override: %s -> %d (Preset %c)", param_name.c_str(), InValue,
+                    LogInfo("DLSS RR preset override: %s -> %d (Preset %c)", param_name, InValue,
                             'A' + rr_preset - 1);
                 }
             }
@@ -438,7 +445,7 @@ void NVSDK_CONV NVSDK_NGX_Parameter_SetI_Detour(NVSDK_NGX_Parameter* InParameter
 
     // Store parameter in thread-safe storage
     if (InName != nullptr) {
-        g_ngx_parameters.update_int(std::string(InName), InValue);
+        g_ngx_parameters.SetInt(InName, InValue);
     }
 
     // Log the call (first few times only)
@@ -463,7 +470,7 @@ void NVSDK_CONV NVSDK_NGX_Parameter_SetUI_Detour(NVSDK_NGX_Parameter* InParamete
 
     // DLSS preset override logic
     if (InName != nullptr && settings::g_swapchainTabSettings.dlss_preset_override_enabled.GetValue()) {
-        std::string param_name = std::string(InName);
+        const char* param_name = InName;
 
         // Check for DLSS Super Resolution preset parameters
         if (IsDLSSPresetParameter(param_name, g_dlss_sr_preset_params)) {
@@ -471,9 +478,9 @@ void NVSDK_CONV NVSDK_NGX_Parameter_SetUI_Detour(NVSDK_NGX_Parameter* InParamete
             if (sr_preset >= 0) {  // -1 = Game Default (no override), 0 = DLSS Default, 1+ = Preset A+
                 InValue = static_cast<unsigned int>(sr_preset);
                 if (sr_preset == 0) {
-                    LogInfo("DLSS SR preset override: %s -> %u (DLSS Default)", param_name.c_str(), InValue);
+                    LogInfo("DLSS SR preset override: %s -> %u (DLSS Default)", param_name, InValue);
                 } else {
-                    LogInfo("DLSS SR preset override: %s -> %u (Preset %c)", param_name.c_str(), InValue,
+                    LogInfo("DLSS SR preset override: %s -> %u (Preset %c)", param_name, InValue,
                             'A' + sr_preset - 1);
                 }
             }
@@ -485,9 +492,9 @@ void NVSDK_CONV NVSDK_NGX_Parameter_SetUI_Detour(NVSDK_NGX_Parameter* InParamete
             if (rr_preset >= 0) {  // -1 = Game Default (no override), 0 = DLSS Default, 1+ = Preset A+
                 InValue = static_cast<unsigned int>(rr_preset);
                 if (rr_preset == 0) {
-                    LogInfo("DLSS RR preset override: %s -> %u (DLSS Default)", param_name.c_str(), InValue);
+                    LogInfo("DLSS RR preset override: %s -> %u (DLSS Default)", param_name, InValue);
                 } else {
-                    LogInfo("DLSS RR preset override: %s -> %u (Preset %c)", param_name.c_str(), InValue,
+                    LogInfo("DLSS RR preset override: %s -> %u (Preset %c)", param_name, InValue,
                             'A' + rr_preset - 1);
                 }
             }
@@ -496,7 +503,7 @@ void NVSDK_CONV NVSDK_NGX_Parameter_SetUI_Detour(NVSDK_NGX_Parameter* InParamete
 
     // Store parameter in thread-safe storage
     if (InName != nullptr) {
-        g_ngx_parameters.update_uint(std::string(InName), InValue);
+        g_ngx_parameters.SetUint(InName, InValue);
     }
 
     // Log the call (first few times only)
@@ -521,7 +528,7 @@ void NVSDK_CONV NVSDK_NGX_Parameter_SetULL_Detour(NVSDK_NGX_Parameter* InParamet
 
     // Store parameter in thread-safe storage
     if (InName != nullptr) {
-        g_ngx_parameters.update_ull(std::string(InName), InValue);
+        g_ngx_parameters.SetUll(InName, InValue);
     }
 
     // Log the call (first few times only)
@@ -556,7 +563,7 @@ NVSDK_NGX_Result NVSDK_CONV NVSDK_NGX_Parameter_GetI_Detour(NVSDK_NGX_Parameter*
         auto res = NVSDK_NGX_Parameter_GetI_Original(InParameter, InName, OutValue);
 
         if (res == NVSDK_NGX_Result_Success && OutValue != nullptr) {
-            g_ngx_parameters.update_int(std::string(InName), *OutValue);
+            g_ngx_parameters.SetInt(InName, *OutValue);
         }
 
         return res;
@@ -584,7 +591,7 @@ NVSDK_NGX_Result NVSDK_CONV NVSDK_NGX_Parameter_GetUI_Detour(NVSDK_NGX_Parameter
         auto res = NVSDK_NGX_Parameter_GetUI_Original(InParameter, InName, OutValue);
 
         if (res == NVSDK_NGX_Result_Success && OutValue != nullptr) {
-            g_ngx_parameters.update_uint(std::string(InName), *OutValue);
+            g_ngx_parameters.SetUint(InName, *OutValue);
         }
 
         return res;
@@ -612,7 +619,7 @@ NVSDK_NGX_Result NVSDK_CONV NVSDK_NGX_Parameter_GetULL_Detour(NVSDK_NGX_Paramete
         auto res = NVSDK_NGX_Parameter_GetULL_Original(InParameter, InName, OutValue);
 
         if (res == NVSDK_NGX_Result_Success && OutValue != nullptr) {
-            g_ngx_parameters.update_ull(std::string(InName), *OutValue);
+            g_ngx_parameters.SetUll(InName, *OutValue);
         }
 
         return res;
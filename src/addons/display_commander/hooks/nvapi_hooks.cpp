@@ -2,6 +2,7 @@
 #include "../utils/general_utils.hpp"
 #include "../utils/logging.hpp"
 #include "../utils/timing.hpp"
+#include "../event_timeline.hpp"
 #include "../globals.hpp"
 #include "../../../external/nvapi/nvapi_interface.h"
 #include "../settings/developer_tab_settings.hpp"
@@ -39,8 +40,7 @@ namespace {
 // Hooked NvAPI_Disp_GetHdrCapabilities function
 NvAPI_Status __cdecl NvAPI_Disp_GetHdrCapabilities_Detour(NvU32 displayId, NV_HDR_CAPABILITIES *pHdrCapabilities) {
     // Increment counter
-    g_nvapi_event_counters[NVAPI_EVENT_GET_HDR_CAPABILITIES].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_nvapi_event_counters.Increment(NVAPI_EVENT_GET_HDR_CAPABILITIES);
 
     // Log the call (first few times only)
     static int log_count = 0;
@@ -101,8 +101,11 @@ NvAPI_Status __cdecl NvAPI_Disp_GetHdrCapabilities_Detour(NvU32 displayId, NV_HD
 // Hooked NvAPI_D3D_SetLatencyMarker function
 NvAPI_Status __cdecl NvAPI_D3D_SetLatencyMarker_Detour(IUnknown *pDev, NV_LATENCY_MARKER_PARAMS *pSetLatencyMarkerParams) {
     // Increment counter
-    g_nvapi_event_counters[NVAPI_EVENT_D3D_SET_LATENCY_MARKER].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_nvapi_event_counters.Increment(NVAPI_EVENT_D3D_SET_LATENCY_MARKER);
+    if (pSetLatencyMarkerParams != nullptr && g_event_timeline.IsEnabled()) {
+        g_event_timeline.RecordInstant(utils::TimelineEvent::kReflexMarker, utils::get_now_ns(),
+                                       pSetLatencyMarkerParams->frameID, pSetLatencyMarkerParams->markerType);
+    }
 
     if (settings::g_developerTabSettings.reflex_supress_native.GetValue()) {
         return NVAPI_OK;
@@ -132,8 +135,7 @@ NvAPI_Status __cdecl NvAPI_D3D_SetLatencyMarker_Detour(IUnknown *pDev, NV_LATENC
 // Hooked NvAPI_D3D_SetSleepMode function
 NvAPI_Status __cdecl NvAPI_D3D_SetSleepMode_Detour(IUnknown *pDev, NV_SET_SLEEP_MODE_PARAMS *pSetSleepModeParams) {
     // Increment counter
-    g_nvapi_event_counters[NVAPI_EVENT_D3D_SET_SLEEP_MODE].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_nvapi_event_counters.Increment(NVAPI_EVENT_D3D_SET_SLEEP_MODE);
 
     if (settings::g_developerTabSettings.reflex_supress_native.GetValue()) {
         return NVAPI_OK;
@@ -220,8 +222,7 @@ NvAPI_Status NvAPI_D3D_GetLatency_Direct(IUnknown *pDev, NV_LATENCY_RESULT_PARAM
 // Hooked NvAPI_D3D_Sleep function
 NvAPI_Status __cdecl NvAPI_D3D_Sleep_Detour(IUnknown *pDev) {
     // Increment counter
-    g_nvapi_event_counters[NVAPI_EVENT_D3D_SLEEP].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_nvapi_event_counters.Increment(NVAPI_EVENT_D3D_SLEEP);
     // Record timestamp of this sleep call
     g_nvapi_last_sleep_timestamp_ns.store(utils::get_now_ns());
 
@@ -267,8 +268,7 @@ NvAPI_Status __cdecl NvAPI_D3D_Sleep_Detour(IUnknown *pDev) {
 // Hooked NvAPI_D3D_GetLatency function
 NvAPI_Status __cdecl NvAPI_D3D_GetLatency_Detour(IUnknown *pDev, NV_LATENCY_RESULT_PARAMS *pGetLatencyParams) {
     // Increment counter
-    g_nvapi_event_counters[NVAPI_EVENT_D3D_GET_LATENCY].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_nvapi_event_counters.Increment(NVAPI_EVENT_D3D_GET_LATENCY);
 
     // Log the call (first few times only)
     static int log_count = 0;
@@ -44,8 +44,7 @@ static std::atomic<bool> g_opengl_hooks_installed{false};
 
 // Hook detour functions
 BOOL WINAPI wglSwapBuffers_Detour(HDC hdc) {
-    g_opengl_hook_counters[OPENGL_HOOK_WGL_SWAPBUFFERS].fetch_add(1);
-    g_opengl_hook_total_count.fetch_add(1);
+    g_opengl_hook_counters.Increment(OPENGL_HOOK_WGL_SWAPBUFFERS);
 
     // Call OnPresentFlags2 with flags = 0 (no flags for OpenGL)
     uint32_t present_flags = 0;
@@ -68,86 +67,72 @@ BOOL WINAPI wglSwapBuffers_Detour(HDC hdc) {
 }
 
 BOOL WINAPI wglMakeCurrent_Detour(HDC hdc, HGLRC hglrc) {
-    g_opengl_hook_counters[OPENGL_HOOK_WGL_MAKECURRENT].fetch_add(1);
-    g_opengl_hook_total_count.fetch_add(1);
+    g_opengl_hook_counters.Increment(OPENGL_HOOK_WGL_MAKECURRENT);
     return wglMakeCurrent_Original(hdc, hglrc);
 }
 
 HGLRC WINAPI wglCreateContext_Detour(HDC hdc) {
-    g_opengl_hook_counters[OPENGL_HOOK_WGL_CREATECONTEXT].fetch_add(1);
-    g_opengl_hook_total_count.fetch_add(1);
+    g_opengl_hook_counters.Increment(OPENGL_HOOK_WGL_CREATECONTEXT);
     return wglCreateContext_Original(hdc);
 }
 
 BOOL WINAPI wglDeleteContext_Detour(HGLRC hglrc) {
-    g_opengl_hook_counters[OPENGL_HOOK_WGL_DELETECONTEXT].fetch_add(1);
-    g_opengl_hook_total_count.fetch_add(1);
+    g_opengl_hook_counters.Increment(OPENGL_HOOK_WGL_DELETECONTEXT);
     return wglDeleteContext_Original(hglrc);
 }
 
 int WINAPI wglChoosePixelFormat_Detour(HDC hdc, const PIXELFORMATDESCRIPTOR *ppfd) {
-    g_opengl_hook_counters[OPENGL_HOOK_WGL_CHOOSEPIXELFORMAT].fetch_add(1);
-    g_opengl_hook_total_count.fetch_add(1);
+    g_opengl_hook_counters.Increment(OPENGL_HOOK_WGL_CHOOSEPIXELFORMAT);
     return wglChoosePixelFormat_Original(hdc, ppfd);
 }
 
 BOOL WINAPI wglSetPixelFormat_Detour(HDC hdc, int iPixelFormat, const PIXELFORMATDESCRIPTOR *ppfd) {
-    g_opengl_hook_counters[OPENGL_HOOK_WGL_SETPIXELFORMAT].fetch_add(1);
-    g_opengl_hook_total_count.fetch_add(1);
+    g_opengl_hook_counters.Increment(OPENGL_HOOK_WGL_SETPIXELFORMAT);
     return wglSetPixelFormat_Original(hdc, iPixelFormat, ppfd);
 }
 
 int WINAPI wglGetPixelFormat_Detour(HDC hdc) {
-    g_opengl_hook_counters[OPENGL_HOOK_WGL_GETPIXELFORMAT].fetch_add(1);
-    g_opengl_hook_total_count.fetch_add(1);
+    g_opengl_hook_counters.Increment(OPENGL_HOOK_WGL_GETPIXELFORMAT);
     return wglGetPixelFormat_Original(hdc);
 }
 
 BOOL WINAPI wglDescribePixelFormat_Detour(HDC hdc, int iPixelFormat, UINT nBytes, LPPIXELFORMATDESCRIPTOR ppfd) {
-    g_opengl_hook_counters[OPENGL_HOOK_WGL_DESCRIBEPIXELFORMAT].fetch_add(1);
-    g_opengl_hook_total_count.fetch_add(1);
+    g_opengl_hook_counters.Increment(OPENGL_HOOK_WGL_DESCRIBEPIXELFORMAT);
     return wglDescribePixelFormat_Original(hdc, iPixelFormat, nBytes, ppfd);
 }
 
 HGLRC WINAPI wglCreateContextAttribsARB_Detour(HDC hdc, HGLRC hshareContext, const int *attribList) {
-    g_opengl_hook_counters[OPENGL_HOOK_WGL_CREATECONTEXTATTRIBSARB].fetch_add(1);
-    g_opengl_hook_total_count.fetch_add(1);
+    g_opengl_hook_counters.Increment(OPENGL_HOOK_WGL_CREATECONTEXTATTRIBSARB);
     return wglCreateContextAttribsARB_Original(hdc, hshareContext, attribList);
 }
 
 BOOL WINAPI wglChoosePixelFormatARB_Detour(HDC hdc, const int *piAttribIList, const FLOAT *pfAttribFList, UINT nMaxFormats, int *piFormats, UINT *nNumFormats) {
-    g_opengl_hook_counters[OPENGL_HOOK_WGL_CHOOSEPIXELFORMATARB].fetch_add(1);
-    g_opengl_hook_total_count.fetch_add(1);
+    g_opengl_hook_counters.Increment(OPENGL_HOOK_WGL_CHOOSEPIXELFORMATARB);
     return wglChoosePixelFormatARB_Original(hdc, piAttribIList, pfAttribFList, nMaxFormats, piFormats, nNumFormats);
 }
 
 BOOL WINAPI wglGetPixelFormatAttribivARB_Detour(HDC hdc, int iPixelFormat, int iLayerPlane, UINT nAttributes, const int *piAttributes, int *piValues) {
-    g_opengl_hook_counters[OPENGL_HOOK_WGL_GETPIXELFORMATATTRIBIVARB].fetch_add(1);
-    g_opengl_hook_total_count.fetch_add(1);
+    g_opengl_hook_counters.Increment(OPENGL_HOOK_WGL_GETPIXELFORMATATTRIBIVARB);
     return wglGetPixelFormatAttribivARB_Original(hdc, iPixelFormat, iLayerPlane, nAttributes, piAttributes, piValues);
 }
 
 BOOL WINAPI wglGetPixelFormatAttribfvARB_Detour(HDC hdc, int iPixelFormat, int iLayerPlane, UINT nAttributes, const int *piAttributes, FLOAT *pfValues) {
-    g_opengl_hook_counters[OPENGL_HOOK_WGL_GETPIXELFORMATATTRIBFVARB].fetch_add(1);
-    g_opengl_hook_total_count.fetch_add(1);
+    g_opengl_hook_counters.Increment(OPENGL_HOOK_WGL_GETPIXELFORMATATTRIBFVARB);
     return wglGetPixelFormatAttribfvARB_Original(hdc, iPixelFormat, iLayerPlane, nAttributes, piAttributes, pfValues);
 }
 
 PROC WINAPI wglGetProcAddress_Detour(LPCSTR lpszProc) {
-    g_opengl_hook_counters[OPENGL_HOOK_WGL_GETPROCADDRESS].fetch_add(1);
-    g_opengl_hook_total_count.fetch_add(1);
+    g_opengl_hook_counters.Increment(OPENGL_HOOK_WGL_GETPROCADDRESS);
     return wglGetProcAddress_Original(lpszProc);
 }
 
 BOOL WINAPI wglSwapIntervalEXT_Detour(int interval) {
-    g_opengl_hook_counters[OPENGL_HOOK_WGL_SWAPINTERVALEXT].fetch_add(1);
-    g_opengl_hook_total_count.fetch_add(1);
+    g_opengl_hook_counters.Increment(OPENGL_HOOK_WGL_SWAPINTERVALEXT);
     return wglSwapIntervalEXT_Original(interval);
 }
 
 int WINAPI wglGetSwapIntervalEXT_Detour(void) {
-    g_opengl_hook_counters[OPENGL_HOOK_WGL_GETSWAPINTERVALEXT].fetch_add(1);
-    g_opengl_hook_total_count.fetch_add(1);
+    g_opengl_hook_counters.Increment(OPENGL_HOOK_WGL_GETSWAPINTERVALEXT);
     return wglGetSwapIntervalEXT_Original();
 }
 
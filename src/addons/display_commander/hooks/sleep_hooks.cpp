@@ -21,6 +21,33 @@ const bool DISABLE_SLEEP_HOOKS = false;
 // Global sleep hook statistics
 SleepHookStats g_sleep_hook_stats;
 
+namespace {
+
+// Sleep hook settings as the detours use them
+struct SleepHookConfig {
+    bool enabled = false;
+    float multiplier = 1.0f;
+    DWORD min_duration = 0;
+    DWORD max_duration = 0;
+};
+
+// Per-thread copy, re-read only after a setting changed (one atomic load per call otherwise)
+const SleepHookConfig &GetSleepHookConfig() {
+    thread_local utils::SettingsSnapshot<SleepHookConfig> snapshot;
+    return snapshot.Get(ui::new_ui::g_settings_change_bus, [] {
+        SleepHookConfig config;
+        config.enabled = settings::g_experimental_hot_settings.Get(settings::kSleepHookEnabled);
+        config.multiplier = settings::g_experimental_hot_settings.Get(settings::kSleepMultiplier);
+        config.min_duration =
+            static_cast<DWORD>(settings::g_experimental_hot_settings.Get(settings::kMinSleepDurationMs));
+        config.max_duration =
+            static_cast<DWORD>(settings::g_experimental_hot_settings.Get(settings::kMaxSleepDurationMs));
+        return config;
+    });
+}
+
+}  // namespace
+
 // Original function pointers
 Sleep_pfn Sleep_Original = nullptr;
 SleepEx_pfn SleepEx_Original = nullptr;
@@ -30,23 +57,22 @@ WaitForMultipleObjects_pfn WaitForMultipleObjects_Original = nullptr;
 // Hooked Sleep function
 void WINAPI Sleep_Detour(DWORD dwMilliseconds) {
     // Track total calls
-    g_hook_stats[HOOK_Sleep].increment_total();
+    g_hook_stats.Increment(HOOK_Sleep, HOOK_CALLS_TOTAL);
 
     DWORD modified_duration = dwMilliseconds;
+    const SleepHookConfig &config = GetSleepHookConfig();
 
-    if (settings::g_experimentalTabSettings.sleep_hook_enabled.GetValue() && dwMilliseconds > 0) {
+    if (config.enabled && dwMilliseconds > 0) {
         {
             // Apply sleep multiplier
-            float multiplier = settings::g_experimentalTabSettings.sleep_multiplier.GetValue();
+            const float multiplier = config.multiplier;
             if (multiplier > 0.0f) {
                 modified_duration = static_cast<DWORD>(dwMilliseconds * multiplier);
             }
 
             // Apply min/max constraints
-            DWORD min_duration =
-                static_cast<DWORD>(settings::g_experimentalTabSettings.min_sleep_duration_ms.GetValue());
-            DWORD max_duration =
-                static_cast<DWORD>(settings::g_experimentalTabSettings.max_sleep_duration_ms.GetValue());
+            const DWORD min_duration = config.min_duration;
+            const DWORD max_duration = config.max_duration;
 
             if (min_duration > 0) {
                 modified_duration = (modified_duration > min_duration) ? modified_duration : min_duration;
@@ -56,17 +82,17 @@ void WINAPI Sleep_Detour(DWORD dwMilliseconds) {
             }
 
             // Track modified calls
-            g_hook_stats[HOOK_Sleep].increment_unsuppressed();
+            g_hook_stats.Increment(HOOK_Sleep, HOOK_CALLS_UNSUPPRESSED);
             g_sleep_hook_stats.increment_modified();
             g_sleep_hook_stats.add_original_duration(dwMilliseconds);
             g_sleep_hook_stats.add_modified_duration(modified_duration);
 
-            LogDebug("[TID:%d] Sleep hook: %d ms -> %d ms (multiplier: %f)", GetCurrentThreadId(), dwMilliseconds,
-                     modified_duration, multiplier);
+            LogDebugDeferred("[TID:%d] Sleep hook: %d ms -> %d ms (multiplier: %f)",
+                             GetCurrentThreadId(), dwMilliseconds, modified_duration, multiplier);
         }
     } else {
         // Track unmodified calls
-        g_hook_stats[HOOK_Sleep].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_Sleep, HOOK_CALLS_UNSUPPRESSED);
     }
 
     // Call original function with modified duration
@@ -81,23 +107,22 @@ void WINAPI Sleep_Detour(DWORD dwMilliseconds) {
 // Hooked SleepEx function
 DWORD WINAPI SleepEx_Detour(DWORD dwMilliseconds, BOOL bAlertable) {
     // Track total calls
-    g_hook_stats[HOOK_SleepEx].increment_total();
+    g_hook_stats.Increment(HOOK_SleepEx, HOOK_CALLS_TOTAL);
 
     DWORD modified_duration = dwMilliseconds;
+    const SleepHookConfig &config = GetSleepHookConfig();
 
-    if (settings::g_experimentalTabSettings.sleep_hook_enabled.GetValue() && dwMilliseconds > 0) {
+    if (config.enabled && dwMilliseconds > 0) {
         {
             // Apply sleep multiplier
-            float multiplier = settings::g_experimentalTabSettings.sleep_multiplier.GetValue();
+            const float multiplier = config.multiplier;
             if (multiplier > 0.0f) {
                 modified_duration = static_cast<DWORD>(dwMilliseconds * multiplier);
             }
 
             // Apply min/max constraints
-            DWORD min_duration =
-                static_cast<DWORD>(settings::g_experimentalTabSettings.min_sleep_duration_ms.GetValue());
-            DWORD max_duration =
-                static_cast<DWORD>(settings::g_experimentalTabSettings.max_sleep_duration_ms.GetValue());
+            const DWORD min_duration = config.min_duration;
+            const DWORD max_duration = config.max_duration;
 
             if (min_duration > 0) {
                 modified_duration = (modified_duration > min_duration) ? modified_duration : min_duration;
@@ -107,17 +132,17 @@ DWORD WINAPI SleepEx_Detour(DWORD dwMilliseconds, BOOL bAlertable) {
             }
 
             // Track modified calls
-            g_hook_stats[HOOK_SleepEx].increment_unsuppressed();
+            g_hook_stats.Increment(HOOK_SleepEx, HOOK_CALLS_UNSUPPRESSED);
             g_sleep_hook_stats.increment_modified();
             g_sleep_hook_stats.add_original_duration(dwMilliseconds);
             g_sleep_hook_stats.add_modified_duration(modified_duration);
 
-            LogDebug("[TID:%d] SleepEx hook: %d ms -> %d ms (multiplier: %f)", GetCurrentThreadId(), dwMilliseconds,
-                     modified_duration, multiplier);
+            LogDebugDeferred("[TID:%d] SleepEx hook: %d ms -> %d ms (multiplier: %f)",
+                             GetCurrentThreadId(), dwMilliseconds, modified_duration, multiplier);
         }
     } else {
         // Track unmodified calls
-        g_hook_stats[HOOK_SleepEx].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_SleepEx, HOOK_CALLS_UNSUPPRESSED);
     }
 
     // Call original function with modified duration
@@ -131,24 +156,23 @@ DWORD WINAPI SleepEx_Detour(DWORD dwMilliseconds, BOOL bAlertable) {
 // Hooked WaitForSingleObject function
 DWORD WINAPI WaitForSingleObject_Detour(HANDLE hHandle, DWORD dwMilliseconds) {
     // Track total calls
-    g_hook_stats[HOOK_WaitForSingleObject].increment_total();
+    g_hook_stats.Increment(HOOK_WaitForSingleObject, HOOK_CALLS_TOTAL);
 
     DWORD modified_duration = dwMilliseconds;
+    const SleepHookConfig &config = GetSleepHookConfig();
 
-    if (settings::g_experimentalTabSettings.sleep_hook_enabled.GetValue() && dwMilliseconds > 0 &&
+    if (config.enabled && dwMilliseconds > 0 &&
         dwMilliseconds != INFINITE) {
         {
             // Apply sleep multiplier
-            float multiplier = settings::g_experimentalTabSettings.sleep_multiplier.GetValue();
+            const float multiplier = config.multiplier;
             if (multiplier > 0.0f) {
                 modified_duration = static_cast<DWORD>(dwMilliseconds * multiplier);
             }
 
             // Apply min/max constraints
-            DWORD min_duration =
-                static_cast<DWORD>(settings::g_experimentalTabSettings.min_sleep_duration_ms.GetValue());
-            DWORD max_duration =
-                static_cast<DWORD>(settings::g_experimentalTabSettings.max_sleep_duration_ms.GetValue());
+            const DWORD min_duration = config.min_duration;
+            const DWORD max_duration = config.max_duration;
 
             if (min_duration > 0) {
                 modified_duration = (modified_duration > min_duration) ? modified_duration : min_duration;
@@ -158,17 +182,17 @@ DWORD WINAPI WaitForSingleObject_Detour(HANDLE hHandle, DWORD dwMilliseconds) {
             }
 
             // Track modified calls
-            g_hook_stats[HOOK_WaitForSingleObject].increment_unsuppressed();
+            g_hook_stats.Increment(HOOK_WaitForSingleObject, HOOK_CALLS_UNSUPPRESSED);
             g_sleep_hook_stats.increment_modified();
             g_sleep_hook_stats.add_original_duration(dwMilliseconds);
             g_sleep_hook_stats.add_modified_duration(modified_duration);
 
-            LogDebug("[TID:%d] WaitForSingleObject hook: %d ms -> %d ms (multiplier: %f)", GetCurrentThreadId(),
-                     dwMilliseconds, modified_duration, multiplier);
+            LogDebugDeferred("[TID:%d] WaitForSingleObject hook: %d ms -> %d ms (multiplier: %f)",
+                             GetCurrentThreadId(), dwMilliseconds, modified_duration, multiplier);
         }
     } else {
         // Track unmodified calls
-        g_hook_stats[HOOK_WaitForSingleObject].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_WaitForSingleObject, HOOK_CALLS_UNSUPPRESSED);
     }
 
     // Call original function with modified duration
@@ -182,24 +206,23 @@ DWORD WINAPI WaitForSingleObject_Detour(HANDLE hHandle, DWORD dwMilliseconds) {
 // Hooked WaitForMultipleObjects function
 DWORD WINAPI WaitForMultipleObjects_Detour(DWORD nCount, const HANDLE *lpHandles, BOOL bWaitAll, DWORD dwMilliseconds) {
     // Track total calls
-    g_hook_stats[HOOK_WaitForMultipleObjects].increment_total();
+    g_hook_stats.Increment(HOOK_WaitForMultipleObjects, HOOK_CALLS_TOTAL);
 
     DWORD modified_duration = dwMilliseconds;
+    const SleepHookConfig &config = GetSleepHookConfig();
 
-    if (settings::g_experimentalTabSettings.sleep_hook_enabled.GetValue() && dwMilliseconds > 0 &&
+    if (config.enabled && dwMilliseconds > 0 &&
         dwMilliseconds != INFINITE) {
         {
             // Apply sleep multiplier
-            float multiplier = settings::g_experimentalTabSettings.sleep_multiplier.GetValue();
+            const float multiplier = config.multiplier;
             if (multiplier > 0.0f) {
                 modified_duration = static_cast<DWORD>(dwMilliseconds * multiplier);
             }
 
             // Apply min/max constraints
-            DWORD min_duration =
-                static_cast<DWORD>(settings::g_experimentalTabSettings.min_sleep_duration_ms.GetValue());
-            DWORD max_duration =
-                static_cast<DWORD>(settings::g_experimentalTabSettings.max_sleep_duration_ms.GetValue());
+            const DWORD min_duration = config.min_duration;
+            const DWORD max_duration = config.max_duration;
 
             if (min_duration > 0) {
                 modified_duration = (modified_duration > min_duration) ? modified_duration : min_duration;
@@ -209,17 +232,17 @@ DWORD WINAPI WaitForMultipleObjects_Detour(DWORD nCount, const HANDLE *lpHandles
             }
 
             // Track modified calls
-            g_hook_stats[HOOK_WaitForMultipleObjects].increment_unsuppressed();
+            g_hook_stats.Increment(HOOK_WaitForMultipleObjects, HOOK_CALLS_UNSUPPRESSED);
             g_sleep_hook_stats.increment_modified();
             g_sleep_hook_stats.add_original_duration(dwMilliseconds);
             g_sleep_hook_stats.add_modified_duration(modified_duration);
 
-            LogDebug("[TID:%d] WaitForMultipleObjects hook: %d ms -> %d ms (multiplier: %f)", GetCurrentThreadId(),
-                     dwMilliseconds, modified_duration, multiplier);
+            LogDebugDeferred("[TID:%d] WaitForMultipleObjects hook: %d ms -> %d ms (multiplier: %f)",
+                             GetCurrentThreadId(), dwMilliseconds, modified_duration, multiplier);
         }
     } else {
         // Track unmodified calls
-        g_hook_stats[HOOK_WaitForMultipleObjects].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_WaitForMultipleObjects, HOOK_CALLS_UNSUPPRESSED);
     }
 
     // Call original function with modified duration
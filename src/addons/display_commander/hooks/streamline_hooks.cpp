@@ -32,8 +32,7 @@ static std::atomic<bool> g_prevent_slupgrade_interface{false};
 // Hook functions
 int slInit_Detour(void* pref, uint64_t sdkVersion) {
     // Increment counter
-    g_streamline_event_counters[STREAMLINE_EVENT_SL_INIT].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_streamline_event_counters.Increment(STREAMLINE_EVENT_SL_INIT);
 
     // Store the SDK version
     g_last_sdk_version.store(sdkVersion);
@@ -51,8 +50,7 @@ int slInit_Detour(void* pref, uint64_t sdkVersion) {
 
 int slIsFeatureSupported_Detour(int feature, const void* adapterInfo) {
     // Increment counter
-    g_streamline_event_counters[STREAMLINE_EVENT_SL_IS_FEATURE_SUPPORTED].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_streamline_event_counters.Increment(STREAMLINE_EVENT_SL_IS_FEATURE_SUPPORTED);
 
 
     static int log_count = 0;
@@ -72,8 +70,7 @@ int slIsFeatureSupported_Detour(int feature, const void* adapterInfo) {
 
 int slGetNativeInterface_Detour(void* proxyInterface, void** baseInterface) {
     // Increment counter
-    g_streamline_event_counters[STREAMLINE_EVENT_SL_GET_NATIVE_INTERFACE].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_streamline_event_counters.Increment(STREAMLINE_EVENT_SL_GET_NATIVE_INTERFACE);
 
     // Log the call
     LogInfo("slGetNativeInterface called");
@@ -90,8 +87,7 @@ int slGetNativeInterface_Detour(void* proxyInterface, void** baseInterface) {
 // Reference: https://github.com/NVIDIA-RTX/Streamline/blob/b998246a3d499c08765c5681b229c9e6b4513348/source/core/sl.api/sl.cpp#L625
 int slUpgradeInterface_Detour(void** baseInterface) {
     // Increment counter
-    g_streamline_event_counters[STREAMLINE_EVENT_SL_UPGRADE_INTERFACE].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_streamline_event_counters.Increment(STREAMLINE_EVENT_SL_UPGRADE_INTERFACE);
 
     // Check config-driven flag
     bool prevent_slupgrade_interface = g_prevent_slupgrade_interface.load();
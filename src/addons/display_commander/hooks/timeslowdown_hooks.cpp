@@ -2,12 +2,16 @@
 #include "hook_suppression_manager.hpp"
 #include "../globals.hpp"
 #include "../settings/experimental_tab_settings.hpp"
+#include "../utils/counter_registry.hpp"
 #include "../utils/general_utils.hpp"
 #include "../utils/logging.hpp"
+#include "../utils/seqlock_ring.hpp"
+#include "../utils/srwlock_wrapper.hpp"
+#include "../utils/virtual_clock.hpp"
 #include "../swapchain_events.hpp"
 #include <MinHook.h>
+#include <array>
 #include <atomic>
-#include <memory>
 #include <windows.h>
 
 // NTSTATUS constants
@@ -34,35 +38,11 @@ const char *HOOK_GET_SYSTEM_TIME_PRECISE_AS_FILE_TIME = "GetSystemTimePreciseAsF
 const char *HOOK_GET_LOCAL_TIME = "GetLocalTime";
 const char *HOOK_NT_QUERY_SYSTEM_TIME = "NtQuerySystemTime";
 
-// Helper function to apply timeslowdown with baseline tracking
-template<typename T>
-T ApplyTimeslowdownWithBaseline(T result) {
-    static T start_time = 0;
+// Timeslowdown state: one virtual clock (in real QPC ticks) shared by every timer source, indexed by
+// TimerHookIdentifier. All sources are read at the same epoch and advance by the same virtual time.
+using TimeslowdownState = utils::VirtualClockState<static_cast<size_t>(TimerHookIdentifier::Count)>;
 
-    // Initialize start_time on first call
-    if (start_time == 0) {
-        start_time = result;
-    }
-
-    // Apply timeslowdown if enabled
-    if (settings::g_experimentalTabSettings.timeslowdown_enabled.GetValue()) {
-        float multiplier = settings::g_experimentalTabSettings.timeslowdown_multiplier.GetValue();
-        if (multiplier > 0.0) {
-            result = static_cast<T>(start_time + ((result - start_time) * multiplier));
-        }
-    }
-
-    return result;
-}
-
-// Timeslowdown state structure
-struct TimeslowdownState {
-    LONGLONG original_quad_ts;
-    LONGLONG original_quad_value;
-    long double multiplier;
-
-    TimeslowdownState() : original_quad_ts(0), original_quad_value(0), multiplier(1.0) {}
-};
+constexpr size_t TimerSourceIndex(TimerHookIdentifier id) { return static_cast<size_t>(id); }
 
 // Original function pointers
 QueryPerformanceCounter_pfn QueryPerformanceCounter_Original = nullptr;
@@ -93,20 +73,22 @@ std::atomic<TimerHookType> g_get_system_time_precise_as_file_time_hook_type{Time
 std::atomic<TimerHookType> g_get_local_time_hook_type{TimerHookType::None};
 std::atomic<TimerHookType> g_nt_query_system_time_hook_type{TimerHookType::None};
 
-// Per-hook call counters
-std::atomic<uint64_t> g_qpc_call_count{0};
+// Per-hook call counters (sharded per thread)
+utils::CounterRegistry<uint64_t, static_cast<size_t>(TimerHookIdentifier::Count)> g_timer_hook_call_counts;
 std::atomic<uint64_t> g_qpf_call_count{0};
-std::atomic<uint64_t> g_get_tick_count_call_count{0};
-std::atomic<uint64_t> g_get_tick_count64_call_count{0};
-std::atomic<uint64_t> g_time_get_time_call_count{0};
-std::atomic<uint64_t> g_get_system_time_call_count{0};
-std::atomic<uint64_t> g_get_system_time_as_file_time_call_count{0};
-std::atomic<uint64_t> g_get_system_time_precise_as_file_time_call_count{0};
-std::atomic<uint64_t> g_get_local_time_call_count{0};
-std::atomic<uint64_t> g_nt_query_system_time_call_count{0};
-
-// Atomic shared_ptr for thread-safe state access
-std::atomic<std::shared_ptr<const TimeslowdownState>> g_timeslowdown_state{std::make_shared<TimeslowdownState>()};
+
+// QPC calls are counted per thread and flushed in batches; engines call QPC thousands of times per frame
+constexpr uint32_t kQpcCallCountBatch = 256;
+thread_local uint32_t tls_qpc_pending_calls = 0;
+
+// What each timer detour does, published by RefreshTimeslowdownState(): TimerHookType::None passes the
+// call through, anything else returns virtual time for the threads selected by the type
+std::array<std::atomic<TimerHookType>, static_cast<size_t>(TimerHookIdentifier::Count)> g_timer_scaling_modes{};
+
+// Latest timeslowdown state, read lock-free by the detours (single writer under the publish lock)
+utils::SeqlockRing<TimeslowdownState, 4> g_timeslowdown_state;
+SRWLOCK g_timeslowdown_publish_lock = SRWLOCK_INIT;
+TimeslowdownState g_timeslowdown_published_state;  // writer's copy, guarded by g_timeslowdown_publish_lock
 
 // Render thread tracking
 std::atomic<DWORD> g_render_thread_id{0}; // 0 means not set yet
@@ -196,97 +178,218 @@ bool IsCurrentThreadRenderThread() {
     return tls_thread_id == render_thread_id;
 }
 
+// Helper function to check if a hook type applies to the calling thread
+bool ShouldApplyHookType(TimerHookType type) {
+    switch (type) {
+        case TimerHookType::Enabled:
+            return true;
+        case TimerHookType::EnableRenderThread:
+            return IsCurrentThreadRenderThread();
+        case TimerHookType::EnableNonRenderThread:
+            return !IsCurrentThreadRenderThread();
+        default:
+            return false;
+    }
+}
+
 // Helper function to check if a hook should be applied by identifier (DLL-safe)
-bool ShouldApplyHookById(TimerHookIdentifier id) {
-    TimerHookType type = GetHookTypeById(id);
+bool ShouldApplyHookById(TimerHookIdentifier id) { return ShouldApplyHookType(GetHookTypeById(id)); }
 
-    if (type == TimerHookType::None) {
-        return false;
+// Helper function to check if a hook should be applied (DLL-safe) - kept for backward compatibility
+bool ShouldApplyHook(const char *hook_name) {
+    TimerHookIdentifier id = GetHookIdentifierByName(hook_name);
+    return ShouldApplyHookById(id);
+}
+
+static uint64_t FileTimeToUInt64(const FILETIME &ft) {
+    ULARGE_INTEGER uli;
+    uli.LowPart = ft.dwLowDateTime;
+    uli.HighPart = ft.dwHighDateTime;
+    return uli.QuadPart;
+}
+
+static FILETIME UInt64ToFileTime(uint64_t value) {
+    ULARGE_INTEGER uli;
+    uli.QuadPart = value;
+    return FILETIME{uli.LowPart, uli.HighPart};
+}
+
+// Real (unscaled) QPC value; the detours compute virtual time from it
+static int64_t ReadRealQpc() {
+    LARGE_INTEGER now;
+    if (QueryPerformanceCounter_Original) {
+        QueryPerformanceCounter_Original(&now);
+    } else {
+        QueryPerformanceCounter(&now);
     }
+    return now.QuadPart;
+}
 
-    if (type == TimerHookType::Enabled) {
-        return true;
+// Real value of a timer source in its own units, read at the epoch
+static uint64_t ReadRealTimerSource(TimerHookIdentifier id, int64_t qpc_now) {
+    FILETIME ft = {};
+    switch (id) {
+        case TimerHookIdentifier::QueryPerformanceCounter:
+            return static_cast<uint64_t>(qpc_now);
+        case TimerHookIdentifier::GetTickCount:
+        case TimerHookIdentifier::GetTickCount64:
+            // GetTickCount is the low 32 bits of GetTickCount64
+            return GetTickCount64_Original ? GetTickCount64_Original() : GetTickCount64();
+        case TimerHookIdentifier::TimeGetTime:
+            if (timeGetTime_Original) {
+                return timeGetTime_Original();
+            }
+            return timeGetTime_Direct ? timeGetTime_Direct() : 0;
+        case TimerHookIdentifier::GetSystemTime:
+        case TimerHookIdentifier::GetSystemTimeAsFileTime:
+            if (GetSystemTimeAsFileTime_Original) {
+                GetSystemTimeAsFileTime_Original(&ft);
+            } else {
+                GetSystemTimeAsFileTime(&ft);
+            }
+            return FileTimeToUInt64(ft);
+        case TimerHookIdentifier::GetSystemTimePreciseAsFileTime:
+            if (GetSystemTimePreciseAsFileTime_Original) {
+                GetSystemTimePreciseAsFileTime_Original(&ft);
+            } else {
+                GetSystemTimePreciseAsFileTime(&ft);
+            }
+            return FileTimeToUInt64(ft);
+        case TimerHookIdentifier::GetLocalTime: {
+            SYSTEMTIME st;
+            if (GetLocalTime_Original) {
+                GetLocalTime_Original(&st);
+            } else {
+                GetLocalTime(&st);
+            }
+            SystemTimeToFileTime(&st, &ft);
+            return FileTimeToUInt64(ft);
+        }
+        case TimerHookIdentifier::NtQuerySystemTime:
+            if (NtQuerySystemTime_Original) {
+                LARGE_INTEGER system_time;
+                if (NT_SUCCESS(NtQuerySystemTime_Original(&system_time))) {
+                    return static_cast<uint64_t>(system_time.QuadPart);
+                }
+            }
+            GetSystemTimeAsFileTime(&ft);
+            return FileTimeToUInt64(ft);
+        default:
+            return 0;
+    }
+}
+
+static uint64_t TimerSourceUnitsPerSecond(TimerHookIdentifier id, uint64_t qpc_frequency) {
+    switch (id) {
+        case TimerHookIdentifier::QueryPerformanceCounter:
+            return qpc_frequency;
+        case TimerHookIdentifier::GetTickCount:
+        case TimerHookIdentifier::GetTickCount64:
+        case TimerHookIdentifier::TimeGetTime:
+            return 1000;  // milliseconds
+        default:
+            return 10000000;  // FILETIME / NT system time: 100 ns units
     }
+}
+
+// Publish the timeslowdown state from the current settings. Called whenever settings, hooks or the game
+// window change so the detours never have to read settings or rebase the state themselves.
+void RefreshTimeslowdownState() {
+    utils::SRWLockExclusive lock(g_timeslowdown_publish_lock);
+    TimeslowdownState &state = g_timeslowdown_published_state;
 
-    if (type == TimerHookType::EnableRenderThread) {
-        return IsCurrentThreadRenderThread();
+    const bool enabled = settings::g_experimental_hot_settings.Get(settings::kTimeslowdownEnabled);
+    const bool compatibility_mode = settings::g_experimental_hot_settings.Get(settings::kTimeslowdownCompatibilityMode);
+
+    // Once time was scaled, keep scaling (at 1x) after disabling so game time does not jump forward,
+    // unless compatibility mode asks for the real clock back
+    const bool active = g_timeslowdown_hooks_installed.load() && QueryPerformanceCounter_Original != nullptr
+                        && g_initialized_with_hwnd.load() && (enabled || (state.IsStarted() && !compatibility_mode));
+    if (!active) {
+        for (auto &mode : g_timer_scaling_modes) {
+            mode.store(TimerHookType::None, std::memory_order_release);
+        }
+        return;
     }
 
-    if (type == TimerHookType::EnableNonRenderThread) {
-        return !IsCurrentThreadRenderThread();
+    const uint64_t rate = utils::VirtualClockSegment::RateFromMultiplier(
+        enabled ? settings::g_experimental_hot_settings.Get(settings::kTimeslowdownMultiplier) : 1.0);
+    if (!state.IsStarted()) {
+        LARGE_INTEGER frequency;
+        QueryPerformanceFrequency(&frequency);
+        const int64_t now = ReadRealQpc();
+        state.Start(now, static_cast<uint64_t>(frequency.QuadPart), rate);
+        for (size_t i = 0; i < static_cast<size_t>(TimerHookIdentifier::Count); ++i) {
+            const auto id = static_cast<TimerHookIdentifier>(i);
+            state.SetSourceEpoch(i, ReadRealTimerSource(id, now), TimerSourceUnitsPerSecond(id, state.ticks_per_second));
+        }
+        g_timeslowdown_state.Push(state, static_cast<uint64_t>(now));
+    } else if (state.segment.rate != rate) {
+        // Switch 1 ms from now, so readers still holding the previous state compute the same values
+        const int64_t now = ReadRealQpc();
+        state.SetRate(now, rate, static_cast<int64_t>(state.ticks_per_second / 1000));
+        g_timeslowdown_state.Push(state, static_cast<uint64_t>(now));
     }
 
-    return false;
+    for (size_t i = 0; i < static_cast<size_t>(TimerHookIdentifier::Count); ++i) {
+        g_timer_scaling_modes[i].store(GetHookTypeById(static_cast<TimerHookIdentifier>(i)), std::memory_order_release);
+    }
 }
 
-// Helper function to check if a hook should be applied (DLL-safe) - kept for backward compatibility
-bool ShouldApplyHook(const char *hook_name) {
-    TimerHookIdentifier id = GetHookIdentifierByName(hook_name);
-    return ShouldApplyHookById(id);
+void RefreshTimeslowdownStateOnChange() {
+    // Settings generation plus the non-setting inputs of RefreshTimeslowdownState()
+    static std::atomic<uint64_t> s_last_inputs{UINT64_MAX};
+    const uint64_t inputs = (ui::new_ui::g_settings_change_bus.Generation() << 2)
+                            | (g_timeslowdown_hooks_installed.load() ? 2u : 0u) | (g_initialized_with_hwnd.load() ? 1u : 0u);
+    if (s_last_inputs.exchange(inputs) != inputs) {
+        RefreshTimeslowdownState();
+    }
+}
+
+// Slow path of the timer detours: virtual value of a source at a real QPC time (read before this call),
+// or false if the calling thread is not selected by the hook type
+static __declspec(noinline) bool ReadVirtualTimerSource(TimerHookIdentifier id, TimerHookType mode, int64_t real_qpc,
+                                                        uint64_t &value) {
+    if (!ShouldApplyHookType(mode)) {
+        return false;
+    }
+    utils::SeqlockRing<TimeslowdownState, 4>::Entry entry;
+    if (!g_timeslowdown_state.ReadLatest(entry)) {
+        return false;
+    }
+    value = entry.value.SourceValueAt(TimerSourceIndex(id), real_qpc);
+    return true;
+}
+
+static TimerHookType GetTimerScalingMode(TimerHookIdentifier id) {
+    return g_timer_scaling_modes[TimerSourceIndex(id)].load(std::memory_order_relaxed);
 }
 
 // Hooked QueryPerformanceCounter function
 BOOL WINAPI QueryPerformanceCounter_Detour(LARGE_INTEGER *lpPerformanceCount) {
-    g_qpc_call_count.fetch_add(1, std::memory_order_relaxed);
+    if (++tls_qpc_pending_calls == kQpcCallCountBatch) {
+        g_timer_hook_call_counts.Increment(TimerSourceIndex(TimerHookIdentifier::QueryPerformanceCounter), 0,
+                                           kQpcCallCountBatch);
+        tls_qpc_pending_calls = 0;
+    }
     if (!QueryPerformanceCounter_Original) {
         return QueryPerformanceCounter(lpPerformanceCount);
     }
 
-    // Call original function first
     BOOL result = QueryPerformanceCounter_Original(lpPerformanceCount);
-    if (result == FALSE || lpPerformanceCount == nullptr || !g_initialized_with_hwnd.load()) {
-        return result;
-    }
-    // Check if this hook should be applied (efficient enum-based check)
-    if (!ShouldApplyHookById(TimerHookIdentifier::QueryPerformanceCounter)) {
-        return result;
-    }
-
-    // Get current state atomically
-    auto current_state = g_timeslowdown_state.load();
 
-    if (!settings::g_experimentalTabSettings.timeslowdown_enabled.GetValue()
-       && settings::g_experimentalTabSettings.timeslowdown_compatibility_mode.GetValue()) {
+    // Fast path: timeslowdown inactive
+    const TimerHookType mode = GetTimerScalingMode(TimerHookIdentifier::QueryPerformanceCounter);
+    if (mode == TimerHookType::None || result == FALSE || lpPerformanceCount == nullptr) {
         return result;
     }
 
-    // if time slow down is enabled, or was enabled before, then apply the time slow down
-    if (current_state->original_quad_ts > 0 || settings::g_experimentalTabSettings.timeslowdown_enabled.GetValue()) {
-        LONGLONG now_qpc = lpPerformanceCount->QuadPart;
-        float new_multiplier = settings::g_experimentalTabSettings.timeslowdown_enabled.GetValue()
-                                   ? settings::g_experimentalTabSettings.timeslowdown_multiplier.GetValue()
-                                   : 1.0f;
-
-        // Check if we need to update state
-        bool needs_update = (current_state->original_quad_ts == 0) || (current_state->multiplier != new_multiplier);
-
-        if (needs_update) {
-            // Create new state with updated values
-            auto new_state = std::make_shared<TimeslowdownState>(*current_state);
-
-            if (new_state->original_quad_ts == 0) {
-                new_state->original_quad_ts = now_qpc;
-                new_state->original_quad_value = now_qpc;
-            } else if (current_state->multiplier != new_multiplier) {
-                new_state->original_quad_value =
-                    current_state->original_quad_value +
-                    (now_qpc - current_state->original_quad_ts) * current_state->multiplier;
-                new_state->original_quad_ts = now_qpc;
-            }
-
-            new_state->multiplier = new_multiplier;
-
-            // Atomically update the state
-            g_timeslowdown_state.store(new_state);
-            current_state = new_state;
-        }
-
-        // Apply timeslowdown calculation
-        lpPerformanceCount->QuadPart = current_state->original_quad_value +
-                                        (now_qpc - current_state->original_quad_ts) * current_state->multiplier;
+    uint64_t virtual_qpc = 0;
+    if (ReadVirtualTimerSource(TimerHookIdentifier::QueryPerformanceCounter, mode, lpPerformanceCount->QuadPart,
+                               virtual_qpc)) {
+        lpPerformanceCount->QuadPart = static_cast<LONGLONG>(virtual_qpc);
     }
-
-    return true;
+    return result;
 }
 
 // Hooked QueryPerformanceFrequency function
@@ -304,7 +407,7 @@ BOOL WINAPI QueryPerformanceFrequency_Detour(LARGE_INTEGER *lpFrequency) {
 
 // Hooked GetTickCount function
 DWORD WINAPI GetTickCount_Detour() {
-    g_get_tick_count_call_count.fetch_add(1, std::memory_order_relaxed);
+    g_timer_hook_call_counts.Increment(TimerSourceIndex(TimerHookIdentifier::GetTickCount));
     if (!GetTickCount_Original) {
         return GetTickCount();
     }
@@ -312,18 +415,18 @@ DWORD WINAPI GetTickCount_Detour() {
     // Call original function first
     DWORD result = GetTickCount_Original();
 
-    // Check if this hook should be applied (efficient enum-based check)
-    if (!ShouldApplyHookById(TimerHookIdentifier::GetTickCount)) {
-        return result;
+    const TimerHookType mode = GetTimerScalingMode(TimerHookIdentifier::GetTickCount);
+    uint64_t virtual_ms = 0;
+    if (mode != TimerHookType::None
+        && ReadVirtualTimerSource(TimerHookIdentifier::GetTickCount, mode, ReadRealQpc(), virtual_ms)) {
+        result = static_cast<DWORD>(virtual_ms);  // wraps like the real counter
     }
-
-    // Apply timeslowdown with baseline tracking
-    return ApplyTimeslowdownWithBaseline(result);
+    return result;
 }
 
 // Hooked GetTickCount64 function
 ULONGLONG WINAPI GetTickCount64_Detour() {
-    g_get_tick_count64_call_count.fetch_add(1, std::memory_order_relaxed);
+    g_timer_hook_call_counts.Increment(TimerSourceIndex(TimerHookIdentifier::GetTickCount64));
     if (!GetTickCount64_Original) {
         return GetTickCount64();
     }
@@ -331,13 +434,13 @@ ULONGLONG WINAPI GetTickCount64_Detour() {
     // Call original function first
     ULONGLONG result = GetTickCount64_Original();
 
-    // Check if this hook should be applied (efficient enum-based check)
-    if (!ShouldApplyHookById(TimerHookIdentifier::GetTickCount64)) {
-        return result;
+    const TimerHookType mode = GetTimerScalingMode(TimerHookIdentifier::GetTickCount64);
+    uint64_t virtual_ms = 0;
+    if (mode != TimerHookType::None
+        && ReadVirtualTimerSource(TimerHookIdentifier::GetTickCount64, mode, ReadRealQpc(), virtual_ms)) {
+        result = virtual_ms;
     }
-
-    // Apply timeslowdown with baseline tracking
-    return ApplyTimeslowdownWithBaseline(result);
+    return result;
 }
 
 // Initialize timeGetTime direct function pointer
@@ -361,7 +464,7 @@ static void InitializeTimeGetTimeDirect() {
 
 // Hooked timeGetTime function
 DWORD WINAPI timeGetTime_Detour() {
-    g_time_get_time_call_count.fetch_add(1, std::memory_order_relaxed);
+    g_timer_hook_call_counts.Increment(TimerSourceIndex(TimerHookIdentifier::TimeGetTime));
     if (!timeGetTime_Original) {
         return timeGetTime_Direct ? timeGetTime_Direct() : 0;
     }
@@ -369,25 +472,18 @@ DWORD WINAPI timeGetTime_Detour() {
     // Call original function first
     DWORD result = timeGetTime_Original();
 
-    // Check if this hook should be applied (efficient enum-based check)
-    if (!ShouldApplyHookById(TimerHookIdentifier::TimeGetTime)) {
-        return result;
+    const TimerHookType mode = GetTimerScalingMode(TimerHookIdentifier::TimeGetTime);
+    uint64_t virtual_ms = 0;
+    if (mode != TimerHookType::None
+        && ReadVirtualTimerSource(TimerHookIdentifier::TimeGetTime, mode, ReadRealQpc(), virtual_ms)) {
+        result = static_cast<DWORD>(virtual_ms);  // wraps like the real counter
     }
-
-    // Apply timeslowdown if enabled
-    if (settings::g_experimentalTabSettings.timeslowdown_enabled.GetValue()) {
-        float multiplier = settings::g_experimentalTabSettings.timeslowdown_multiplier.GetValue();
-        if (multiplier > 0.0) {
-            result = static_cast<DWORD>(result * multiplier);
-        }
-    }
-
     return result;
 }
 
 // Hooked GetSystemTime function
 void WINAPI GetSystemTime_Detour(LPSYSTEMTIME lpSystemTime) {
-    g_get_system_time_call_count.fetch_add(1, std::memory_order_relaxed);
+    g_timer_hook_call_counts.Increment(TimerSourceIndex(TimerHookIdentifier::GetSystemTime));
     if (!GetSystemTime_Original) {
         GetSystemTime(lpSystemTime);
         return;
@@ -396,37 +492,18 @@ void WINAPI GetSystemTime_Detour(LPSYSTEMTIME lpSystemTime) {
     // Call original function first
     GetSystemTime_Original(lpSystemTime);
 
-    // Check if this hook should be applied (efficient enum-based check)
-    if (!ShouldApplyHookById(TimerHookIdentifier::GetSystemTime)) {
-        return;
-    }
-
-    // Apply timeslowdown if enabled
-    if (settings::g_experimentalTabSettings.timeslowdown_enabled.GetValue() && lpSystemTime != nullptr) {
-        float multiplier = settings::g_experimentalTabSettings.timeslowdown_multiplier.GetValue();
-        if (multiplier > 0.0) {
-            // Convert SYSTEMTIME to milliseconds since epoch, apply multiplier, then convert back
-            FILETIME ft;
-            SystemTimeToFileTime(lpSystemTime, &ft);
-
-            ULARGE_INTEGER uli;
-            uli.LowPart = ft.dwLowDateTime;
-            uli.HighPart = ft.dwHighDateTime;
-
-            // Apply multiplier to milliseconds since epoch
-            uli.QuadPart = static_cast<ULONGLONG>(uli.QuadPart * multiplier);
-
-            ft.dwLowDateTime = uli.LowPart;
-            ft.dwHighDateTime = uli.HighPart;
-
-            FileTimeToSystemTime(&ft, lpSystemTime);
-        }
+    const TimerHookType mode = GetTimerScalingMode(TimerHookIdentifier::GetSystemTime);
+    uint64_t virtual_time = 0;
+    if (mode != TimerHookType::None && lpSystemTime != nullptr
+        && ReadVirtualTimerSource(TimerHookIdentifier::GetSystemTime, mode, ReadRealQpc(), virtual_time)) {
+        const FILETIME ft = UInt64ToFileTime(virtual_time);
+        FileTimeToSystemTime(&ft, lpSystemTime);
     }
 }
 
 // Hooked GetSystemTimeAsFileTime function
 void WINAPI GetSystemTimeAsFileTime_Detour(LPFILETIME lpSystemTimeAsFileTime) {
-    g_get_system_time_as_file_time_call_count.fetch_add(1, std::memory_order_relaxed);
+    g_timer_hook_call_counts.Increment(TimerSourceIndex(TimerHookIdentifier::GetSystemTimeAsFileTime));
     if (!GetSystemTimeAsFileTime_Original) {
         GetSystemTimeAsFileTime(lpSystemTimeAsFileTime);
         return;
@@ -435,31 +512,17 @@ void WINAPI GetSystemTimeAsFileTime_Detour(LPFILETIME lpSystemTimeAsFileTime) {
     // Call original function first
     GetSystemTimeAsFileTime_Original(lpSystemTimeAsFileTime);
 
-    // Check if this hook should be applied (efficient enum-based check)
-    if (!ShouldApplyHookById(TimerHookIdentifier::GetSystemTimeAsFileTime)) {
-        return;
-    }
-
-    // Apply timeslowdown if enabled
-    if (settings::g_experimentalTabSettings.timeslowdown_enabled.GetValue() && lpSystemTimeAsFileTime != nullptr) {
-        float multiplier = settings::g_experimentalTabSettings.timeslowdown_multiplier.GetValue();
-        if (multiplier > 0.0) {
-            ULARGE_INTEGER uli;
-            uli.LowPart = lpSystemTimeAsFileTime->dwLowDateTime;
-            uli.HighPart = lpSystemTimeAsFileTime->dwHighDateTime;
-
-            // Apply multiplier to file time
-            uli.QuadPart = static_cast<ULONGLONG>(uli.QuadPart * multiplier);
-
-            lpSystemTimeAsFileTime->dwLowDateTime = uli.LowPart;
-            lpSystemTimeAsFileTime->dwHighDateTime = uli.HighPart;
-        }
+    const TimerHookType mode = GetTimerScalingMode(TimerHookIdentifier::GetSystemTimeAsFileTime);
+    uint64_t virtual_time = 0;
+    if (mode != TimerHookType::None && lpSystemTimeAsFileTime != nullptr
+        && ReadVirtualTimerSource(TimerHookIdentifier::GetSystemTimeAsFileTime, mode, ReadRealQpc(), virtual_time)) {
+        *lpSystemTimeAsFileTime = UInt64ToFileTime(virtual_time);
     }
 }
 
 // Hooked GetSystemTimePreciseAsFileTime function
 void WINAPI GetSystemTimePreciseAsFileTime_Detour(LPFILETIME lpSystemTimeAsFileTime) {
-    g_get_system_time_precise_as_file_time_call_count.fetch_add(1, std::memory_order_relaxed);
+    g_timer_hook_call_counts.Increment(TimerSourceIndex(TimerHookIdentifier::GetSystemTimePreciseAsFileTime));
     if (!GetSystemTimePreciseAsFileTime_Original) {
         GetSystemTimePreciseAsFileTime(lpSystemTimeAsFileTime);
         return;
@@ -468,31 +531,18 @@ void WINAPI GetSystemTimePreciseAsFileTime_Detour(LPFILETIME lpSystemTimeAsFileT
     // Call original function first
     GetSystemTimePreciseAsFileTime_Original(lpSystemTimeAsFileTime);
 
-    // Check if this hook should be applied (efficient enum-based check)
-    if (!ShouldApplyHookById(TimerHookIdentifier::GetSystemTimePreciseAsFileTime)) {
-        return;
-    }
-
-    // Apply timeslowdown if enabled
-    if (settings::g_experimentalTabSettings.timeslowdown_enabled.GetValue() && lpSystemTimeAsFileTime != nullptr) {
-        float multiplier = settings::g_experimentalTabSettings.timeslowdown_multiplier.GetValue();
-        if (multiplier > 0.0) {
-            ULARGE_INTEGER uli;
-            uli.LowPart = lpSystemTimeAsFileTime->dwLowDateTime;
-            uli.HighPart = lpSystemTimeAsFileTime->dwHighDateTime;
-
-            // Apply multiplier to file time
-            uli.QuadPart = static_cast<ULONGLONG>(uli.QuadPart * multiplier);
-
-            lpSystemTimeAsFileTime->dwLowDateTime = uli.LowPart;
-            lpSystemTimeAsFileTime->dwHighDateTime = uli.HighPart;
-        }
+    const TimerHookType mode = GetTimerScalingMode(TimerHookIdentifier::GetSystemTimePreciseAsFileTime);
+    uint64_t virtual_time = 0;
+    if (mode != TimerHookType::None && lpSystemTimeAsFileTime != nullptr
+        && ReadVirtualTimerSource(TimerHookIdentifier::GetSystemTimePreciseAsFileTime, mode, ReadRealQpc(),
+                                  virtual_time)) {
+        *lpSystemTimeAsFileTime = UInt64ToFileTime(virtual_time);
     }
 }
 
 // Hooked GetLocalTime function
 void WINAPI GetLocalTime_Detour(LPSYSTEMTIME lpSystemTime) {
-    g_get_local_time_call_count.fetch_add(1, std::memory_order_relaxed);
+    g_timer_hook_call_counts.Increment(TimerSourceIndex(TimerHookIdentifier::GetLocalTime));
     if (!GetLocalTime_Original) {
         GetLocalTime(lpSystemTime);
         return;
@@ -501,37 +551,18 @@ void WINAPI GetLocalTime_Detour(LPSYSTEMTIME lpSystemTime) {
     // Call original function first
     GetLocalTime_Original(lpSystemTime);
 
-    // Check if this hook should be applied (efficient enum-based check)
-    if (!ShouldApplyHookById(TimerHookIdentifier::GetLocalTime)) {
-        return;
-    }
-
-    // Apply timeslowdown if enabled
-    if (settings::g_experimentalTabSettings.timeslowdown_enabled.GetValue() && lpSystemTime != nullptr) {
-        float multiplier = settings::g_experimentalTabSettings.timeslowdown_multiplier.GetValue();
-        if (multiplier > 0.0) {
-            // Convert SYSTEMTIME to milliseconds since epoch, apply multiplier, then convert back
-            FILETIME ft;
-            SystemTimeToFileTime(lpSystemTime, &ft);
-
-            ULARGE_INTEGER uli;
-            uli.LowPart = ft.dwLowDateTime;
-            uli.HighPart = ft.dwHighDateTime;
-
-            // Apply multiplier to milliseconds since epoch
-            uli.QuadPart = static_cast<ULONGLONG>(uli.QuadPart * multiplier);
-
-            ft.dwLowDateTime = uli.LowPart;
-            ft.dwHighDateTime = uli.HighPart;
-
-            FileTimeToSystemTime(&ft, lpSystemTime);
-        }
+    const TimerHookType mode = GetTimerScalingMode(TimerHookIdentifier::GetLocalTime);
+    uint64_t virtual_time = 0;
+    if (mode != TimerHookType::None && lpSystemTime != nullptr
+        && ReadVirtualTimerSource(TimerHookIdentifier::GetLocalTime, mode, ReadRealQpc(), virtual_time)) {
+        const FILETIME ft = UInt64ToFileTime(virtual_time);
+        FileTimeToSystemTime(&ft, lpSystemTime);
     }
 }
 
 // Hooked NtQuerySystemTime function
 NTSTATUS WINAPI NtQuerySystemTime_Detour(PLARGE_INTEGER SystemTime) {
-    g_nt_query_system_time_call_count.fetch_add(1, std::memory_order_relaxed);
+    g_timer_hook_call_counts.Increment(TimerSourceIndex(TimerHookIdentifier::NtQuerySystemTime));
     if (!NtQuerySystemTime_Original) {
         // Load ntdll.dll and get the function
         HMODULE ntdll = GetModuleHandleA("ntdll.dll");
@@ -546,21 +577,12 @@ NTSTATUS WINAPI NtQuerySystemTime_Detour(PLARGE_INTEGER SystemTime) {
     // Call original function first
     NTSTATUS result = NtQuerySystemTime_Original(SystemTime);
 
-    // Check if this hook should be applied (efficient enum-based check)
-    if (!ShouldApplyHookById(TimerHookIdentifier::NtQuerySystemTime)) {
-        return result;
+    const TimerHookType mode = GetTimerScalingMode(TimerHookIdentifier::NtQuerySystemTime);
+    uint64_t virtual_time = 0;
+    if (mode != TimerHookType::None && SystemTime != nullptr && NT_SUCCESS(result)
+        && ReadVirtualTimerSource(TimerHookIdentifier::NtQuerySystemTime, mode, ReadRealQpc(), virtual_time)) {
+        SystemTime->QuadPart = static_cast<LONGLONG>(virtual_time);
     }
-
-    // Apply timeslowdown if enabled
-    if (settings::g_experimentalTabSettings.timeslowdown_enabled.GetValue() && SystemTime != nullptr &&
-        NT_SUCCESS(result)) {
-        float multiplier = settings::g_experimentalTabSettings.timeslowdown_multiplier.GetValue();
-        if (multiplier > 0.0) {
-            // Apply multiplier to system time
-            SystemTime->QuadPart = static_cast<LONGLONG>(SystemTime->QuadPart * multiplier);
-        }
-    }
-
     return result;
 }
 
@@ -729,7 +751,14 @@ void UninstallTimeslowdownHooks() {
     NtQuerySystemTime_Original = nullptr;
 
     // Clean up state
-    g_timeslowdown_state.store(std::make_shared<TimeslowdownState>());
+    {
+        utils::SRWLockExclusive lock(g_timeslowdown_publish_lock);
+        for (auto &mode : g_timer_scaling_modes) {
+            mode.store(TimerHookType::None, std::memory_order_release);
+        }
+        g_timeslowdown_published_state = TimeslowdownState();
+        g_timeslowdown_state.Reset();
+    }
 
     // Reset hook types to None (atomic variables don't need explicit cleanup)
     g_query_performance_counter_hook_type.store(TimerHookType::None);
@@ -755,6 +784,7 @@ void SetTimeslowdownMultiplier(float multiplier) {
     }
 
     settings::g_experimentalTabSettings.timeslowdown_multiplier.SetValue(multiplier);
+    RefreshTimeslowdownState();
     LogInfo("Timeslowdown multiplier set to: %f", multiplier);
 }
 
@@ -764,6 +794,7 @@ bool IsTimeslowdownEnabled() { return settings::g_experimentalTabSettings.timesl
 
 void SetTimeslowdownEnabled(bool enabled) {
     settings::g_experimentalTabSettings.timeslowdown_enabled.SetValue(enabled);
+    RefreshTimeslowdownState();
     LogInfo("Timeslowdown %s", enabled ? "enabled" : "disabled");
 }
 
@@ -800,6 +831,7 @@ void SetTimerHookTypeById(TimerHookIdentifier id, TimerHookType type) {
         default:
             return; // Invalid identifier
     }
+    RefreshTimeslowdownState();
 }
 
 // Individual hook type configuration (DLL-safe) - kept for backward compatibility
@@ -822,28 +854,10 @@ bool IsTimerHookEnabledById(TimerHookIdentifier id) {
 }
 
 uint64_t GetTimerHookCallCountById(TimerHookIdentifier id) {
-    switch (id) {
-        case TimerHookIdentifier::QueryPerformanceCounter:
-            return g_qpc_call_count.load(std::memory_order_relaxed);
-        case TimerHookIdentifier::GetTickCount:
-            return g_get_tick_count_call_count.load(std::memory_order_relaxed);
-        case TimerHookIdentifier::GetTickCount64:
-            return g_get_tick_count64_call_count.load(std::memory_order_relaxed);
-        case TimerHookIdentifier::TimeGetTime:
-            return g_time_get_time_call_count.load(std::memory_order_relaxed);
-        case TimerHookIdentifier::GetSystemTime:
-            return g_get_system_time_call_count.load(std::memory_order_relaxed);
-        case TimerHookIdentifier::GetSystemTimeAsFileTime:
-            return g_get_system_time_as_file_time_call_count.load(std::memory_order_relaxed);
-        case TimerHookIdentifier::GetSystemTimePreciseAsFileTime:
-            return g_get_system_time_precise_as_file_time_call_count.load(std::memory_order_relaxed);
-        case TimerHookIdentifier::GetLocalTime:
-            return g_get_local_time_call_count.load(std::memory_order_relaxed);
-        case TimerHookIdentifier::NtQuerySystemTime:
-            return g_nt_query_system_time_call_count.load(std::memory_order_relaxed);
-        default:
-            return 0;
+    if (id >= TimerHookIdentifier::Count) {
+        return 0;
     }
+    return g_timer_hook_call_counts.Load(static_cast<size_t>(id));
 }
 
 // Backward compatibility functions
@@ -71,6 +71,10 @@ void SetTimeslowdownMultiplier(float multiplier);
 float GetTimeslowdownMultiplier();
 bool IsTimeslowdownEnabled();
 void SetTimeslowdownEnabled(bool enabled);
+// Republish the state used by the QPC detour from the current settings
+void RefreshTimeslowdownState();
+// Per-frame check: RefreshTimeslowdownState() only if settings, hook installation or the game window changed
+void RefreshTimeslowdownStateOnChange();
 
 // Individual hook type configuration
 void SetTimerHookType(const char *hook_name, TimerHookType type);
@@ -146,8 +146,8 @@ static std::atomic<bool> g_message_hooks_installed{false};
 static POINT s_last_cursor_position = {};
 static RECT s_last_clip_cursor = {};
 
-// Hook statistics array
-std::array<HookCallStats, HOOK_COUNT> g_hook_stats;
+// Hook statistics (sharded per thread)
+utils::CounterRegistry<uint64_t, HOOK_COUNT, HOOK_CALLS_COUNTER_COUNT> g_hook_stats;
 
 // Hook information array
 static const std::array<HookInfo, HOOK_COUNT> g_hook_info = {{
@@ -348,7 +348,7 @@ void SuppressMessage(LPMSG lpMsg) {
 // Hooked GetMessageA function
 BOOL WINAPI GetMessageA_Detour(LPMSG lpMsg, HWND hWnd, UINT wMsgFilterMin, UINT wMsgFilterMax) {
     // Track total calls
-    g_hook_stats[HOOK_GetMessageA].increment_total();
+    g_hook_stats.Increment(HOOK_GetMessageA, HOOK_CALLS_TOTAL);
 
     // Call original function first
     BOOL result = GetMessageA_Original ? GetMessageA_Original(lpMsg, hWnd, wMsgFilterMin, wMsgFilterMax)
@@ -364,7 +364,7 @@ BOOL WINAPI GetMessageA_Detour(LPMSG lpMsg, HWND hWnd, UINT wMsgFilterMin, UINT
         }
         // Check if we should intercept it for other purposes
         else {
-            g_hook_stats[HOOK_GetMessageA].increment_unsuppressed();
+            g_hook_stats.Increment(HOOK_GetMessageA, HOOK_CALLS_UNSUPPRESSED);
             // Track unsuppressed message in history
             ui::new_ui::AddMessageToHistoryIfKnown(lpMsg->message, lpMsg->wParam, lpMsg->lParam, false);
         }
@@ -376,7 +376,7 @@ BOOL WINAPI GetMessageA_Detour(LPMSG lpMsg, HWND hWnd, UINT wMsgFilterMin, UINT
 // Hooked GetMessageW function
 BOOL WINAPI GetMessageW_Detour(LPMSG lpMsg, HWND hWnd, UINT wMsgFilterMin, UINT wMsgFilterMax) {
     // Track total calls
-    g_hook_stats[HOOK_GetMessageW].increment_total();
+    g_hook_stats.Increment(HOOK_GetMessageW, HOOK_CALLS_TOTAL);
 
     // Call original function first
     BOOL result = GetMessageW_Original ? GetMessageW_Original(lpMsg, hWnd, wMsgFilterMin, wMsgFilterMax)
@@ -393,7 +393,7 @@ BOOL WINAPI GetMessageW_Detour(LPMSG lpMsg, HWND hWnd, UINT wMsgFilterMin, UINT
         // Check if we should intercept it for other purposes
         else {
             // Track unsuppressed calls
-            g_hook_stats[HOOK_GetMessageW].increment_unsuppressed();
+            g_hook_stats.Increment(HOOK_GetMessageW, HOOK_CALLS_UNSUPPRESSED);
             // Track unsuppressed message in history
             ui::new_ui::AddMessageToHistoryIfKnown(lpMsg->message, lpMsg->wParam, lpMsg->lParam, false);
         }
@@ -405,14 +405,14 @@ BOOL WINAPI GetMessageW_Detour(LPMSG lpMsg, HWND hWnd, UINT wMsgFilterMin, UINT
 // Hooked PeekMessageA function
 BOOL WINAPI PeekMessageA_Detour(LPMSG lpMsg, HWND hWnd, UINT wMsgFilterMin, UINT wMsgFilterMax, UINT wRemoveMsg) {
     // Track total calls
-    g_hook_stats[HOOK_PeekMessageA].increment_total();
+    g_hook_stats.Increment(HOOK_PeekMessageA, HOOK_CALLS_TOTAL);
 
     // Call original function first
     BOOL result = PeekMessageA_Original ? PeekMessageA_Original(lpMsg, hWnd, wMsgFilterMin, wMsgFilterMax, wRemoveMsg)
                                         : PeekMessageA(lpMsg, hWnd, wMsgFilterMin, wMsgFilterMax, wRemoveMsg);
 
     // Track unsuppressed calls (when we call the original function)
-    g_hook_stats[HOOK_PeekMessageA].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_PeekMessageA, HOOK_CALLS_UNSUPPRESSED);
 
     // If we got a message
     if (result && lpMsg != nullptr) {
@@ -433,14 +433,14 @@ BOOL WINAPI PeekMessageA_Detour(LPMSG lpMsg, HWND hWnd, UINT wMsgFilterMin, UINT
 // Hooked PeekMessageW function
 BOOL WINAPI PeekMessageW_Detour(LPMSG lpMsg, HWND hWnd, UINT wMsgFilterMin, UINT wMsgFilterMax, UINT wRemoveMsg) {
     // Track total calls
-    g_hook_stats[HOOK_PeekMessageW].increment_total();
+    g_hook_stats.Increment(HOOK_PeekMessageW, HOOK_CALLS_TOTAL);
 
     // Call original function first
     BOOL result = PeekMessageW_Original ? PeekMessageW_Original(lpMsg, hWnd, wMsgFilterMin, wMsgFilterMax, wRemoveMsg)
                                         : PeekMessageW(lpMsg, hWnd, wMsgFilterMin, wMsgFilterMax, wRemoveMsg);
 
     // Track unsuppressed calls (when we call the original function)
-    g_hook_stats[HOOK_PeekMessageW].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_PeekMessageW, HOOK_CALLS_UNSUPPRESSED);
 
     // If we got a message
     if (result && lpMsg != nullptr) {
@@ -461,7 +461,7 @@ BOOL WINAPI PeekMessageW_Detour(LPMSG lpMsg, HWND hWnd, UINT wMsgFilterMin, UINT
 // Hooked PostMessageA function
 BOOL WINAPI PostMessageA_Detour(HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam) {
     // Track total calls
-    g_hook_stats[HOOK_PostMessageA].increment_total();
+    g_hook_stats.Increment(HOOK_PostMessageA, HOOK_CALLS_TOTAL);
 
     if (ShouldBlockMouseInput() && Msg == WM_MOUSEMOVE) {
         return TRUE;
@@ -487,7 +487,7 @@ BOOL WINAPI PostMessageA_Detour(HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lPara
     }
 
     // Track unsuppressed calls (when we call the original function)
-    g_hook_stats[HOOK_PostMessageA].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_PostMessageA, HOOK_CALLS_UNSUPPRESSED);
 
     // Track unsuppressed message in history
     ui::new_ui::AddMessageToHistoryIfKnown(Msg, wParam, lParam, false);
@@ -500,7 +500,7 @@ BOOL WINAPI PostMessageA_Detour(HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lPara
 // Hooked PostMessageW function
 BOOL WINAPI PostMessageW_Detour(HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lParam) {
     // Track total calls
-    g_hook_stats[HOOK_PostMessageW].increment_total();
+    g_hook_stats.Increment(HOOK_PostMessageW, HOOK_CALLS_TOTAL);
     if (ShouldBlockMouseInput() && Msg == WM_MOUSEMOVE) {
         return TRUE;
     }
@@ -526,7 +526,7 @@ BOOL WINAPI PostMessageW_Detour(HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lPara
     }
 
     // Track unsuppressed calls (when we call the original function)
-    g_hook_stats[HOOK_PostMessageW].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_PostMessageW, HOOK_CALLS_UNSUPPRESSED);
 
     // Track unsuppressed message in history
     ui::new_ui::AddMessageToHistoryIfKnown(Msg, wParam, lParam, false);
@@ -539,13 +539,13 @@ BOOL WINAPI PostMessageW_Detour(HWND hWnd, UINT Msg, WPARAM wParam, LPARAM lPara
 // Hooked GetKeyboardState function
 BOOL WINAPI GetKeyboardState_Detour(PBYTE lpKeyState) {
     // Track total calls
-    g_hook_stats[HOOK_GetKeyboardState].increment_total();
+    g_hook_stats.Increment(HOOK_GetKeyboardState, HOOK_CALLS_TOTAL);
 
     // Call original function first
     BOOL result = GetKeyboardState_Original ? GetKeyboardState_Original(lpKeyState) : GetKeyboardState(lpKeyState);
 
     // Track unsuppressed calls (when we call the original function)
-    g_hook_stats[HOOK_GetKeyboardState].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_GetKeyboardState, HOOK_CALLS_UNSUPPRESSED);
 
     // If keyboard input blocking is enabled and we got valid key state data
     if (result && lpKeyState != nullptr && ShouldBlockKeyboardInput()) {
@@ -583,7 +583,7 @@ void RestoreClipCursor() {
 // Hooked ClipCursor function
 BOOL WINAPI ClipCursor_Detour(const RECT *lpRect) {
     // Track total calls
-    g_hook_stats[HOOK_ClipCursor].increment_total();
+    g_hook_stats.Increment(HOOK_ClipCursor, HOOK_CALLS_TOTAL);
 
     // Store the clip rectangle for reference
     s_last_clip_cursor = (lpRect != nullptr) ? *lpRect : RECT{};
@@ -593,7 +593,7 @@ BOOL WINAPI ClipCursor_Detour(const RECT *lpRect) {
         // Disable cursor clipping when input is blocked
         lpRect = nullptr;
     } else{
-        g_hook_stats[HOOK_ClipCursor].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_ClipCursor, HOOK_CALLS_UNSUPPRESSED);
     }
     // Track unsuppressed calls (when we call the original function)
 
@@ -604,7 +604,7 @@ BOOL WINAPI ClipCursor_Detour(const RECT *lpRect) {
 // Hooked GetCursorPos function
 BOOL WINAPI GetCursorPos_Detour(LPPOINT lpPoint) {
     // Track total calls
-    g_hook_stats[HOOK_GetCursorPos].increment_total();
+    g_hook_stats.Increment(HOOK_GetCursorPos, HOOK_CALLS_TOTAL);
 
     // If mouse position spoofing is enabled AND auto-click is enabled, return spoofed position
     if (settings::g_experimentalTabSettings.mouse_spoofing_enabled.GetValue() && lpPoint != nullptr) {
@@ -623,7 +623,7 @@ BOOL WINAPI GetCursorPos_Detour(LPPOINT lpPoint) {
     }
 
     // Track unsuppressed calls (when we call the original function)
-    g_hook_stats[HOOK_GetCursorPos].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_GetCursorPos, HOOK_CALLS_UNSUPPRESSED);
 
     // Call original function
     BOOL result = GetCursorPos_Original ? GetCursorPos_Original(lpPoint) : GetCursorPos(lpPoint);
@@ -639,7 +639,7 @@ BOOL WINAPI GetCursorPos_Detour(LPPOINT lpPoint) {
 // Hooked SetCursorPos function
 BOOL WINAPI SetCursorPos_Detour(int X, int Y) {
     // Track total calls
-    g_hook_stats[HOOK_SetCursorPos].increment_total();
+    g_hook_stats.Increment(HOOK_SetCursorPos, HOOK_CALLS_TOTAL);
 
     // Update last known cursor position
     s_last_cursor_position.x = X;
@@ -659,7 +659,7 @@ BOOL WINAPI SetCursorPos_Detour(int X, int Y) {
     if (ShouldBlockMouseInput()) {
         return TRUE; // Block the cursor position change
     } else {
-        g_hook_stats[HOOK_SetCursorPos].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_SetCursorPos, HOOK_CALLS_UNSUPPRESSED);
     }
 
     // Call original function
@@ -669,7 +669,7 @@ BOOL WINAPI SetCursorPos_Detour(int X, int Y) {
 // Hooked GetKeyState function
 SHORT WINAPI GetKeyState_Detour(int vKey) {
     // Track total calls
-    g_hook_stats[HOOK_GetKeyState].increment_total();
+    g_hook_stats.Increment(HOOK_GetKeyState, HOOK_CALLS_TOTAL);
 
     // If input blocking is enabled, return 0 for all keys
     if (ShouldBlockKeyboardInput() && (vKey >= 0x08 && vKey <= 0xFF)) {
@@ -680,7 +680,7 @@ SHORT WINAPI GetKeyState_Detour(int vKey) {
     }
 
     // Track unsuppressed calls
-    g_hook_stats[HOOK_GetKeyState].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_GetKeyState, HOOK_CALLS_UNSUPPRESSED);
 
     // Call original function
     return GetKeyState_Original ? GetKeyState_Original(vKey) : GetKeyState(vKey);
@@ -689,7 +689,7 @@ SHORT WINAPI GetKeyState_Detour(int vKey) {
 // Hooked GetAsyncKeyState function
 SHORT WINAPI GetAsyncKeyState_Detour(int vKey) {
     // Track total calls
-    g_hook_stats[HOOK_GetAsyncKeyState].increment_total();
+    g_hook_stats.Increment(HOOK_GetAsyncKeyState, HOOK_CALLS_TOTAL);
 
     // If input blocking is enabled, return 0 for all keys
     if (ShouldBlockKeyboardInput() && (vKey >= 0x08 && vKey <= 0xFF)) {
@@ -700,7 +700,7 @@ SHORT WINAPI GetAsyncKeyState_Detour(int vKey) {
     }
 
     // Track unsuppressed calls
-    g_hook_stats[HOOK_GetAsyncKeyState].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_GetAsyncKeyState, HOOK_CALLS_UNSUPPRESSED);
 
     // Call original function
     return GetAsyncKeyState_Original ? GetAsyncKeyState_Original(vKey) : GetAsyncKeyState(vKey);
@@ -709,14 +709,14 @@ SHORT WINAPI GetAsyncKeyState_Detour(int vKey) {
 // Hooked SetWindowsHookExA function
 HHOOK WINAPI SetWindowsHookExA_Detour(int idHook, HOOKPROC lpfn, HINSTANCE hmod, DWORD dwThreadId) {
     // Track total calls
-    g_hook_stats[HOOK_SetWindowsHookExA].increment_total();
+    g_hook_stats.Increment(HOOK_SetWindowsHookExA, HOOK_CALLS_TOTAL);
 
     // Call original function first
     HHOOK result = SetWindowsHookExA_Original ? SetWindowsHookExA_Original(idHook, lpfn, hmod, dwThreadId)
                                               : SetWindowsHookExA(idHook, lpfn, hmod, dwThreadId);
 
     // Track unsuppressed calls (when we call the original function)
-    g_hook_stats[HOOK_SetWindowsHookExA].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_SetWindowsHookExA, HOOK_CALLS_UNSUPPRESSED);
 
     // Log hook installation for debugging
     if (result != nullptr) {
@@ -729,14 +729,14 @@ HHOOK WINAPI SetWindowsHookExA_Detour(int idHook, HOOKPROC lpfn, HINSTANCE hmod,
 // Hooked SetWindowsHookExW function
 HHOOK WINAPI SetWindowsHookExW_Detour(int idHook, HOOKPROC lpfn, HINSTANCE hmod, DWORD dwThreadId) {
     // Track total calls
-    g_hook_stats[HOOK_SetWindowsHookExW].increment_total();
+    g_hook_stats.Increment(HOOK_SetWindowsHookExW, HOOK_CALLS_TOTAL);
 
     // Call original function first
     HHOOK result = SetWindowsHookExW_Original ? SetWindowsHookExW_Original(idHook, lpfn, hmod, dwThreadId)
                                               : SetWindowsHookExW(idHook, lpfn, hmod, dwThreadId);
 
     // Track unsuppressed calls (when we call the original function)
-    g_hook_stats[HOOK_SetWindowsHookExW].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_SetWindowsHookExW, HOOK_CALLS_UNSUPPRESSED);
 
     // Log hook installation for debugging
     if (result != nullptr) {
@@ -749,13 +749,13 @@ HHOOK WINAPI SetWindowsHookExW_Detour(int idHook, HOOKPROC lpfn, HINSTANCE hmod,
 // Hooked UnhookWindowsHookEx function
 BOOL WINAPI UnhookWindowsHookEx_Detour(HHOOK hhk) {
     // Track total calls
-    g_hook_stats[HOOK_UnhookWindowsHookEx].increment_total();
+    g_hook_stats.Increment(HOOK_UnhookWindowsHookEx, HOOK_CALLS_TOTAL);
 
     // Log hook removal for debugging
     LogInfo("UnhookWindowsHookEx called: hhk=0x%p", hhk);
 
     // Track unsuppressed calls (when we call the original function)
-    g_hook_stats[HOOK_UnhookWindowsHookEx].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_UnhookWindowsHookEx, HOOK_CALLS_UNSUPPRESSED);
 
     // Call original function
     return UnhookWindowsHookEx_Original ? UnhookWindowsHookEx_Original(hhk) : UnhookWindowsHookEx(hhk);
@@ -764,7 +764,7 @@ BOOL WINAPI UnhookWindowsHookEx_Detour(HHOOK hhk) {
 // Hooked GetRawInputBuffer function
 UINT WINAPI GetRawInputBuffer_Detour(PRAWINPUT pData, PUINT pcbSize, UINT cbSizeHeader) {
     // Track total calls
-    g_hook_stats[HOOK_GetRawInputBuffer].increment_total();
+    g_hook_stats.Increment(HOOK_GetRawInputBuffer, HOOK_CALLS_TOTAL);
 
     // Call original function first
     UINT result = GetRawInputBuffer_Original ? GetRawInputBuffer_Original(pData, pcbSize, cbSizeHeader)
@@ -832,7 +832,7 @@ UINT WINAPI GetRawInputBuffer_Detour(PRAWINPUT pData, PUINT pcbSize, UINT cbSize
         }
 
         // Track unsuppressed calls (data was processed/replaced)
-        g_hook_stats[HOOK_GetRawInputBuffer].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_GetRawInputBuffer, HOOK_CALLS_UNSUPPRESSED);
 
         // Log occasionally for debugging
         static std::atomic<int> replace_counter{0};
@@ -848,7 +848,7 @@ UINT WINAPI GetRawInputBuffer_Detour(PRAWINPUT pData, PUINT pcbSize, UINT cbSize
 // Hooked TranslateMessage function
 BOOL WINAPI TranslateMessage_Detour(const MSG *lpMsg) {
     // Track total calls
-    g_hook_stats[HOOK_TranslateMessage].increment_total();
+    g_hook_stats.Increment(HOOK_TranslateMessage, HOOK_CALLS_TOTAL);
 
     // If input blocking is enabled, don't translate messages that should be blocked
     if (lpMsg != nullptr) {
@@ -860,7 +860,7 @@ BOOL WINAPI TranslateMessage_Detour(const MSG *lpMsg) {
     }
 
     // Track unsuppressed calls (when we call the original function)
-    g_hook_stats[HOOK_TranslateMessage].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_TranslateMessage, HOOK_CALLS_UNSUPPRESSED);
 
     // Call original function
     return TranslateMessage_Original ? TranslateMessage_Original(lpMsg) : TranslateMessage(lpMsg);
@@ -869,7 +869,7 @@ BOOL WINAPI TranslateMessage_Detour(const MSG *lpMsg) {
 // Hooked DispatchMessageA function
 LRESULT WINAPI DispatchMessageA_Detour(const MSG *lpMsg) {
     // Track total calls
-    g_hook_stats[HOOK_DispatchMessageA].increment_total();
+    g_hook_stats.Increment(HOOK_DispatchMessageA, HOOK_CALLS_TOTAL);
 
     // If input blocking is enabled, don't dispatch messages that should be blocked
     if (lpMsg != nullptr) {
@@ -886,7 +886,7 @@ LRESULT WINAPI DispatchMessageA_Detour(const MSG *lpMsg) {
     }
 
     // Track unsuppressed calls (when we call the original function)
-    g_hook_stats[HOOK_DispatchMessageA].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_DispatchMessageA, HOOK_CALLS_UNSUPPRESSED);
 
     // Call original function
     return DispatchMessageA_Original ? DispatchMessageA_Original(lpMsg) : DispatchMessageA(lpMsg);
@@ -895,7 +895,7 @@ LRESULT WINAPI DispatchMessageA_Detour(const MSG *lpMsg) {
 // Hooked DispatchMessageW function
 LRESULT WINAPI DispatchMessageW_Detour(const MSG *lpMsg) {
     // Track total calls
-    g_hook_stats[HOOK_DispatchMessageW].increment_total();
+    g_hook_stats.Increment(HOOK_DispatchMessageW, HOOK_CALLS_TOTAL);
 
     // If input blocking is enabled, don't dispatch messages that should be blocked
     if (lpMsg != nullptr) {
@@ -912,7 +912,7 @@ LRESULT WINAPI DispatchMessageW_Detour(const MSG *lpMsg) {
     }
 
     // Track unsuppressed calls (when we call the original function)
-    g_hook_stats[HOOK_DispatchMessageW].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_DispatchMessageW, HOOK_CALLS_UNSUPPRESSED);
 
     // Call original function
     return DispatchMessageW_Original ? DispatchMessageW_Original(lpMsg) : DispatchMessageW(lpMsg);
@@ -922,7 +922,7 @@ LRESULT WINAPI DispatchMessageW_Detour(const MSG *lpMsg) {
 UINT WINAPI GetRawInputData_Detour(HRAWINPUT hRawInput, UINT uiCommand, LPVOID pData, PUINT pcbSize,
                                    UINT cbSizeHeader) {
     // Track total calls
-    g_hook_stats[HOOK_GetRawInputData].increment_total();
+    g_hook_stats.Increment(HOOK_GetRawInputData, HOOK_CALLS_TOTAL);
 
     // Call original function first
     UINT result = GetRawInputData_Original
@@ -970,7 +970,7 @@ UINT WINAPI GetRawInputData_Detour(HRAWINPUT hRawInput, UINT uiCommand, LPVOID p
                     rawInput->data.mouse.ulExtraInformation = 0;
                 }
             } else {
-                g_hook_stats[HOOK_GetRawInputData].increment_unsuppressed();
+                g_hook_stats.Increment(HOOK_GetRawInputData, HOOK_CALLS_UNSUPPRESSED);
             }
 
             // Track unsuppressed calls (data was processed/replaced)
@@ -982,7 +982,7 @@ UINT WINAPI GetRawInputData_Detour(HRAWINPUT hRawInput, UINT uiCommand, LPVOID p
 // Hooked RegisterRawInputDevices function
 BOOL WINAPI RegisterRawInputDevices_Detour(PCRAWINPUTDEVICE pRawInputDevices, UINT uiNumDevices, UINT cbSize) {
     // Track total calls
-    g_hook_stats[HOOK_RegisterRawInputDevices].increment_total();
+    g_hook_stats.Increment(HOOK_RegisterRawInputDevices, HOOK_CALLS_TOTAL);
 
     // Log raw input device registration for debugging
     if (pRawInputDevices != nullptr && uiNumDevices > 0) {
@@ -995,7 +995,7 @@ BOOL WINAPI RegisterRawInputDevices_Detour(PCRAWINPUTDEVICE pRawInputDevices, UI
     }
 
     // Track unsuppressed calls (when we call the original function)
-    g_hook_stats[HOOK_RegisterRawInputDevices].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_RegisterRawInputDevices, HOOK_CALLS_UNSUPPRESSED);
 
     // Call original function
     return RegisterRawInputDevices_Original ? RegisterRawInputDevices_Original(pRawInputDevices, uiNumDevices, cbSize)
@@ -1004,14 +1004,14 @@ BOOL WINAPI RegisterRawInputDevices_Detour(PCRAWINPUTDEVICE pRawInputDevices, UI
 
 // Hooked GetRawInputDeviceList function
 UINT WINAPI GetRawInputDeviceList_Detour(PRAWINPUTDEVICELIST pRawInputDeviceList, PUINT puiNumDevices, UINT cbSize) {
-    g_hook_stats[HOOK_GetRawInputDeviceList].increment_total();
+    g_hook_stats.Increment(HOOK_GetRawInputDeviceList, HOOK_CALLS_TOTAL);
 
     // Call original function
     UINT result = GetRawInputDeviceList_Original ? GetRawInputDeviceList_Original(pRawInputDeviceList, puiNumDevices, cbSize)
                                                   : GetRawInputDeviceList(pRawInputDeviceList, puiNumDevices, cbSize);
 
     if (result != (UINT)-1) {
-        g_hook_stats[HOOK_GetRawInputDeviceList].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_GetRawInputDeviceList, HOOK_CALLS_UNSUPPRESSED);
 
         // Log device list information
         if (pRawInputDeviceList != nullptr && puiNumDevices != nullptr) {
@@ -1027,7 +1027,7 @@ UINT WINAPI GetRawInputDeviceList_Detour(PRAWINPUTDEVICELIST pRawInputDeviceList
 
 // Hooked DefRawInputProc function
 LRESULT WINAPI DefRawInputProc_Detour(PRAWINPUT paRawInput, INT nInput, UINT cbSizeHeader) {
-    g_hook_stats[HOOK_DefRawInputProc].increment_total();
+    g_hook_stats.Increment(HOOK_DefRawInputProc, HOOK_CALLS_TOTAL);
 
     // Check if we should block raw input processing
     bool should_block = false;
@@ -1055,14 +1055,14 @@ LRESULT WINAPI DefRawInputProc_Detour(PRAWINPUT paRawInput, INT nInput, UINT cbS
     LRESULT result = DefRawInputProc_Original ? DefRawInputProc_Original(paRawInput, nInput, cbSizeHeader)
                                               : ::DefRawInputProc(&paRawInput, nInput, cbSizeHeader);
 
-    g_hook_stats[HOOK_DefRawInputProc].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_DefRawInputProc, HOOK_CALLS_UNSUPPRESSED);
     return result;
 }
 
 // Hooked VkKeyScan function
 SHORT WINAPI VkKeyScan_Detour(CHAR ch) {
     // Track total calls
-    g_hook_stats[HOOK_VkKeyScan].increment_total();
+    g_hook_stats.Increment(HOOK_VkKeyScan, HOOK_CALLS_TOTAL);
 
     // If keyboard input blocking is enabled, return -1 to indicate no virtual key found
     if (ShouldBlockKeyboardInput()) {
@@ -1070,7 +1070,7 @@ SHORT WINAPI VkKeyScan_Detour(CHAR ch) {
     }
 
     // Track unsuppressed calls (when we call the original function)
-    g_hook_stats[HOOK_VkKeyScan].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_VkKeyScan, HOOK_CALLS_UNSUPPRESSED);
 
     // Call original function
     return VkKeyScan_Original ? VkKeyScan_Original(ch) : VkKeyScan(ch);
@@ -1079,13 +1079,13 @@ SHORT WINAPI VkKeyScan_Detour(CHAR ch) {
 // Hooked VkKeyScanEx function
 SHORT WINAPI VkKeyScanEx_Detour(CHAR ch, HKL dwhkl) {
     // Track total calls
-    g_hook_stats[HOOK_VkKeyScanEx].increment_total();
+    g_hook_stats.Increment(HOOK_VkKeyScanEx, HOOK_CALLS_TOTAL);
 
     // If keyboard input blocking is enabled, return -1 to indicate no virtual key found
     if (ShouldBlockKeyboardInput()) {
         return -1; // No virtual key found
     } else {
-        g_hook_stats[HOOK_VkKeyScanEx].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_VkKeyScanEx, HOOK_CALLS_UNSUPPRESSED);
     }
 
     // Call original function
@@ -1095,7 +1095,7 @@ SHORT WINAPI VkKeyScanEx_Detour(CHAR ch, HKL dwhkl) {
 // Hooked ToAscii function
 int WINAPI ToAscii_Detour(UINT uVirtKey, UINT uScanCode, const BYTE *lpKeyState, LPWORD lpChar, UINT uFlags) {
     // Track total calls
-    g_hook_stats[HOOK_ToAscii].increment_total();
+    g_hook_stats.Increment(HOOK_ToAscii, HOOK_CALLS_TOTAL);
 
     // If keyboard input blocking is enabled, return 0 to indicate no character generated
     if (ShouldBlockKeyboardInput()) {
@@ -1103,7 +1103,7 @@ int WINAPI ToAscii_Detour(UINT uVirtKey, UINT uScanCode, const BYTE *lpKeyState,
     }
 
     // Track unsuppressed calls (when we call the original function)
-    g_hook_stats[HOOK_ToAscii].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_ToAscii, HOOK_CALLS_UNSUPPRESSED);
 
     // Call original function
     return ToAscii_Original ? ToAscii_Original(uVirtKey, uScanCode, lpKeyState, lpChar, uFlags)
@@ -1114,13 +1114,13 @@ int WINAPI ToAscii_Detour(UINT uVirtKey, UINT uScanCode, const BYTE *lpKeyState,
 int WINAPI ToAsciiEx_Detour(UINT uVirtKey, UINT uScanCode, const BYTE *lpKeyState, LPWORD lpChar, UINT uFlags,
                             HKL dwhkl) {
     // Track total calls
-    g_hook_stats[HOOK_ToAsciiEx].increment_total();
+    g_hook_stats.Increment(HOOK_ToAsciiEx, HOOK_CALLS_TOTAL);
 
     // If keyboard input blocking is enabled, return 0 to indicate no character generated
     if (ShouldBlockKeyboardInput()) {
         return 0; // No character generated
     } else {
-        g_hook_stats[HOOK_ToAsciiEx].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_ToAsciiEx, HOOK_CALLS_UNSUPPRESSED);
     }
 
     // Call original function
@@ -1132,13 +1132,13 @@ int WINAPI ToAsciiEx_Detour(UINT uVirtKey, UINT uScanCode, const BYTE *lpKeyStat
 int WINAPI ToUnicode_Detour(UINT wVirtKey, UINT wScanCode, const BYTE *lpKeyState, LPWSTR pwszBuff, int cchBuff,
                             UINT wFlags) {
     // Track total calls
-    g_hook_stats[HOOK_ToUnicode].increment_total();
+    g_hook_stats.Increment(HOOK_ToUnicode, HOOK_CALLS_TOTAL);
 
     // If keyboard input blocking is enabled, return 0 to indicate no character generated
     if (ShouldBlockKeyboardInput()) {
         return 0; // No character generated
     } else {
-        g_hook_stats[HOOK_ToUnicode].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_ToUnicode, HOOK_CALLS_UNSUPPRESSED);
     }
 
     // Call original function
@@ -1150,13 +1150,13 @@ int WINAPI ToUnicode_Detour(UINT wVirtKey, UINT wScanCode, const BYTE *lpKeyStat
 int WINAPI ToUnicodeEx_Detour(UINT wVirtKey, UINT wScanCode, const BYTE *lpKeyState, LPWSTR pwszBuff, int cchBuff,
                               UINT wFlags, HKL dwhkl) {
     // Track total calls
-    g_hook_stats[HOOK_ToUnicodeEx].increment_total();
+    g_hook_stats.Increment(HOOK_ToUnicodeEx, HOOK_CALLS_TOTAL);
 
     // If keyboard input blocking is enabled, return 0 to indicate no character generated
     if (ShouldBlockKeyboardInput()) {
         return 0; // No character generated
     } else {
-        g_hook_stats[HOOK_ToUnicodeEx].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_ToUnicodeEx, HOOK_CALLS_UNSUPPRESSED);
     }
 
     // Call original function
@@ -1168,7 +1168,7 @@ int WINAPI ToUnicodeEx_Detour(UINT wVirtKey, UINT wScanCode, const BYTE *lpKeySt
 // Hooked GetKeyNameTextA function
 int WINAPI GetKeyNameTextA_Detour(LONG lParam, LPSTR lpString, int cchSize) {
     // Track total calls
-    g_hook_stats[HOOK_GetKeyNameTextA].increment_total();
+    g_hook_stats.Increment(HOOK_GetKeyNameTextA, HOOK_CALLS_TOTAL);
 
     // If keyboard input blocking is enabled, return 0 to indicate no key name
     if (ShouldBlockKeyboardInput()) {
@@ -1180,7 +1180,7 @@ int WINAPI GetKeyNameTextA_Detour(LONG lParam, LPSTR lpString, int cchSize) {
             return 0; // No key name
         }
     } else {
-        g_hook_stats[HOOK_GetKeyNameTextA].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_GetKeyNameTextA, HOOK_CALLS_UNSUPPRESSED);
     }
 
     // Call original function
@@ -1191,7 +1191,7 @@ int WINAPI GetKeyNameTextA_Detour(LONG lParam, LPSTR lpString, int cchSize) {
 // Hooked GetKeyNameTextW function
 int WINAPI GetKeyNameTextW_Detour(LONG lParam, LPWSTR lpString, int cchSize) {
     // Track total calls
-    g_hook_stats[HOOK_GetKeyNameTextW].increment_total();
+    g_hook_stats.Increment(HOOK_GetKeyNameTextW, HOOK_CALLS_TOTAL);
 
     // If keyboard input blocking is enabled, return 0 to indicate no key name
     if (ShouldBlockKeyboardInput()) {
@@ -1200,7 +1200,7 @@ int WINAPI GetKeyNameTextW_Detour(LONG lParam, LPWSTR lpString, int cchSize) {
         }
         return 0; // No key name
     } else {
-        g_hook_stats[HOOK_GetKeyNameTextW].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_GetKeyNameTextW, HOOK_CALLS_UNSUPPRESSED);
     }
 
     // Call original function
@@ -1211,7 +1211,7 @@ int WINAPI GetKeyNameTextW_Detour(LONG lParam, LPWSTR lpString, int cchSize) {
 // Hooked SendInput function
 UINT WINAPI SendInput_Detour(UINT nInputs, LPINPUT pInputs, int cbSize) {
     // Track total calls
-    g_hook_stats[HOOK_SendInput].increment_total();
+    g_hook_stats.Increment(HOOK_SendInput, HOOK_CALLS_TOTAL);
 
     // If keyboard input blocking is enabled, selectively block DOWN events
     if (ShouldBlockKeyboardInput() && pInputs != nullptr) {
@@ -1261,7 +1261,7 @@ UINT WINAPI SendInput_Detour(UINT nInputs, LPINPUT pInputs, int cbSize) {
             nInputs = allowed_inputs; // Update count to only process allowed inputs
         }
     } else {
-        g_hook_stats[HOOK_SendInput].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_SendInput, HOOK_CALLS_UNSUPPRESSED);
     }
 
     // Call original function with potentially filtered inputs
@@ -1271,7 +1271,7 @@ UINT WINAPI SendInput_Detour(UINT nInputs, LPINPUT pInputs, int cbSize) {
 // Hooked keybd_event function
 void WINAPI keybd_event_Detour(BYTE bVk, BYTE bScan, DWORD dwFlags, ULONG_PTR dwExtraInfo) {
     // Track total calls
-    g_hook_stats[HOOK_keybd_event].increment_total();
+    g_hook_stats.Increment(HOOK_keybd_event, HOOK_CALLS_TOTAL);
 
     // If keyboard input blocking is enabled, selectively block DOWN events
     if (ShouldBlockKeyboardInput()) {
@@ -1287,7 +1287,7 @@ void WINAPI keybd_event_Detour(BYTE bVk, BYTE bScan, DWORD dwFlags, ULONG_PTR dw
         }
         // This is a key UP event, allow it through to clear stuck keys
     } else {
-        g_hook_stats[HOOK_keybd_event].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_keybd_event, HOOK_CALLS_UNSUPPRESSED);
     }
 
     // Call original function
@@ -1301,7 +1301,7 @@ void WINAPI keybd_event_Detour(BYTE bVk, BYTE bScan, DWORD dwFlags, ULONG_PTR dw
 // Hooked mouse_event function
 void WINAPI mouse_event_Detour(DWORD dwFlags, DWORD dx, DWORD dy, DWORD dwData, ULONG_PTR dwExtraInfo) {
     // Track total calls
-    g_hook_stats[HOOK_mouse_event].increment_total();
+    g_hook_stats.Increment(HOOK_mouse_event, HOOK_CALLS_TOTAL);
 
     // If mouse input blocking is enabled, selectively block DOWN events
     if (ShouldBlockMouseInput()) {
@@ -1317,7 +1317,7 @@ void WINAPI mouse_event_Detour(DWORD dwFlags, DWORD dx, DWORD dy, DWORD dwData,
         }
         // This is a mouse UP event or movement, allow it through to clear stuck buttons
     } else {
-        g_hook_stats[HOOK_mouse_event].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_mouse_event, HOOK_CALLS_UNSUPPRESSED);
     }
 
     // Call original function
@@ -1331,7 +1331,7 @@ void WINAPI mouse_event_Detour(DWORD dwFlags, DWORD dx, DWORD dy, DWORD dwData,
 // Hooked SetCapture function
 HWND WINAPI SetCapture_Detour(HWND hWnd) {
     // Track total calls
-    g_hook_stats[HOOK_SetCapture].increment_total();
+    g_hook_stats.Increment(HOOK_SetCapture, HOOK_CALLS_TOTAL);
 
     if (hWnd != nullptr && ShouldBlockMouseInput()) {
         ReleaseCapture();
@@ -1345,7 +1345,7 @@ HWND WINAPI SetCapture_Detour(HWND hWnd) {
     HWND result = SetCapture_Original ? SetCapture_Original(hWnd) : SetCapture(hWnd);
 
     // Track unsuppressed calls
-    g_hook_stats[HOOK_SetCapture].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_SetCapture, HOOK_CALLS_UNSUPPRESSED);
 
     return result;
 }
@@ -1353,7 +1353,7 @@ HWND WINAPI SetCapture_Detour(HWND hWnd) {
 // Hooked ReleaseCapture function
 BOOL WINAPI ReleaseCapture_Detour() {
     // Track total calls
-    g_hook_stats[HOOK_ReleaseCapture].increment_total();
+    g_hook_stats.Increment(HOOK_ReleaseCapture, HOOK_CALLS_TOTAL);
 
     // Log the release attempt
     LogDebug("ReleaseCapture_Detour: called");
@@ -1362,7 +1362,7 @@ BOOL WINAPI ReleaseCapture_Detour() {
     BOOL result = ReleaseCapture_Original ? ReleaseCapture_Original() : ReleaseCapture();
 
     // Track unsuppressed calls
-    g_hook_stats[HOOK_ReleaseCapture].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_ReleaseCapture, HOOK_CALLS_UNSUPPRESSED);
 
     return result;
 }
@@ -1370,13 +1370,13 @@ BOOL WINAPI ReleaseCapture_Detour() {
 // Hooked MapVirtualKey function
 UINT WINAPI MapVirtualKey_Detour(UINT uCode, UINT uMapType) {
     // Track total calls
-    g_hook_stats[HOOK_MapVirtualKey].increment_total();
+    g_hook_stats.Increment(HOOK_MapVirtualKey, HOOK_CALLS_TOTAL);
 
     // If keyboard input blocking is enabled, return 0 for virtual key mapping
     if (ShouldBlockKeyboardInput()) {
         return 0; // Block virtual key mapping
     } else {
-        g_hook_stats[HOOK_MapVirtualKey].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_MapVirtualKey, HOOK_CALLS_UNSUPPRESSED);
     }
 
     // Call original function
@@ -1386,13 +1386,13 @@ UINT WINAPI MapVirtualKey_Detour(UINT uCode, UINT uMapType) {
 // Hooked MapVirtualKeyEx function
 UINT WINAPI MapVirtualKeyEx_Detour(UINT uCode, UINT uMapType, HKL dwhkl) {
     // Track total calls
-    g_hook_stats[HOOK_MapVirtualKeyEx].increment_total();
+    g_hook_stats.Increment(HOOK_MapVirtualKeyEx, HOOK_CALLS_TOTAL);
 
     // If keyboard input blocking is enabled, return 0 for virtual key mapping
     if (ShouldBlockKeyboardInput()) {
         return 0; // Block virtual key mapping
     } else {
-        g_hook_stats[HOOK_MapVirtualKeyEx].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_MapVirtualKeyEx, HOOK_CALLS_UNSUPPRESSED);
     }
 
     // Call original function
@@ -1403,7 +1403,7 @@ UINT WINAPI MapVirtualKeyEx_Detour(UINT uCode, UINT uMapType, HKL dwhkl) {
 // Hooked DisplayConfigGetDeviceInfo function
 LONG WINAPI DisplayConfigGetDeviceInfo_Detour(DISPLAYCONFIG_DEVICE_INFO_HEADER *requestPacket) {
     // Track total calls
-    g_hook_stats[HOOK_DisplayConfigGetDeviceInfo].increment_total();
+    g_hook_stats.Increment(HOOK_DisplayConfigGetDeviceInfo, HOOK_CALLS_TOTAL);
 
     // Call original function
     LONG result = DisplayConfigGetDeviceInfo_Original ? DisplayConfigGetDeviceInfo_Original(requestPacket)
@@ -1430,7 +1430,7 @@ LONG WINAPI DisplayConfigGetDeviceInfo_Detour(DISPLAYCONFIG_DEVICE_INFO_HEADER *
         }
     }
     if (!supressed_hdr) {
-        g_hook_stats[HOOK_DisplayConfigGetDeviceInfo].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_DisplayConfigGetDeviceInfo, HOOK_CALLS_UNSUPPRESSED);
     }
 
 
@@ -1441,7 +1441,7 @@ LONG WINAPI DisplayConfigGetDeviceInfo_Detour(DISPLAYCONFIG_DEVICE_INFO_HEADER *
 
 LPTOP_LEVEL_EXCEPTION_FILTER WINAPI SetUnhandledExceptionFilter_Detour(LPTOP_LEVEL_EXCEPTION_FILTER lpTopLevelExceptionFilter) {
     // Track total calls
-    g_hook_stats[HOOK_SetUnhandledExceptionFilter].increment_total();
+    g_hook_stats.Increment(HOOK_SetUnhandledExceptionFilter, HOOK_CALLS_TOTAL);
 
     // Spoof: Always install our own exception handler instead of the one passed by the game
     // This is similar to Special-K's approach - we ignore the parameter and force our handler
@@ -1457,7 +1457,7 @@ LPTOP_LEVEL_EXCEPTION_FILTER WINAPI SetUnhandledExceptionFilter_Detour(LPTOP_LEV
 
 BOOL WINAPI IsDebuggerPresent_Detour() {
     // Track total calls
-    g_hook_stats[HOOK_IsDebuggerPresent].increment_total();
+    g_hook_stats.Increment(HOOK_IsDebuggerPresent, HOOK_CALLS_TOTAL);
 
     // Call original function to get actual debugger status
     BOOL result = IsDebuggerPresent_Original ?
@@ -1470,7 +1470,7 @@ BOOL WINAPI IsDebuggerPresent_Detour() {
     }
 
     // All calls are passed through (not suppressed)
-    g_hook_stats[HOOK_IsDebuggerPresent].increment_unsuppressed();
+    g_hook_stats.Increment(HOOK_IsDebuggerPresent, HOOK_CALLS_UNSUPPRESSED);
 
     return result;
 }
@@ -1816,19 +1816,16 @@ void UninstallWindowsMessageHooks() {
 }
 
 // Hook statistics access functions
-const HookCallStats &GetHookStats(int hook_index) {
+HookCallStats GetHookStats(int hook_index) {
+    HookCallStats stats;
     if (hook_index >= 0 && hook_index < HOOK_COUNT) {
-        return g_hook_stats[hook_index];
+        stats.total_calls = g_hook_stats.Load(hook_index, HOOK_CALLS_TOTAL);
+        stats.unsuppressed_calls = g_hook_stats.Load(hook_index, HOOK_CALLS_UNSUPPRESSED);
     }
-    static HookCallStats empty_stats;
-    return empty_stats;
+    return stats;
 }
 
-void ResetAllHookStats() {
-    for (int i = 0; i < HOOK_COUNT; ++i) {
-        g_hook_stats[i].reset();
-    }
-}
+void ResetAllHookStats() { g_hook_stats.ResetAll(); }
 
 int GetHookCount() { return HOOK_COUNT; }
 
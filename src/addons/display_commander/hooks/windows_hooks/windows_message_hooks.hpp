@@ -5,21 +5,22 @@
 #include <windows.h>
 #include <wingdi.h>  // For DISPLAYCONFIG_* structures
 #include "../../globals.hpp"  // For InputBlockingMode enum
+#include "../../utils/counter_registry.hpp"
 
 
 namespace display_commanderhooks {
 
-// Hook call statistics structure
+// Per-hook call counters (columns of g_hook_stats)
+enum HookCallCounter {
+    HOOK_CALLS_TOTAL = 0,
+    HOOK_CALLS_UNSUPPRESSED,
+    HOOK_CALLS_COUNTER_COUNT
+};
+
+// Snapshot of one hook's call counters
 struct HookCallStats {
-    std::atomic<uint64_t> total_calls{0};
-    std::atomic<uint64_t> unsuppressed_calls{0};
-
-    void increment_total() { total_calls.fetch_add(1); }
-    void increment_unsuppressed() { unsuppressed_calls.fetch_add(1); }
-    void reset() {
-        total_calls.store(0);
-        unsuppressed_calls.store(0);
-    }
+    uint64_t total_calls = 0;
+    uint64_t unsuppressed_calls = 0;
 };
 
 // DLL group enumeration
@@ -303,10 +304,10 @@ bool ShouldBlockMouseInput();
 bool ShouldBlockGamepadInput();
 
 // Hook call statistics
-extern std::array<HookCallStats, HOOK_COUNT> g_hook_stats;
+extern utils::CounterRegistry<uint64_t, HOOK_COUNT, HOOK_CALLS_COUNTER_COUNT> g_hook_stats;
 
 // Hook statistics access functions
-const HookCallStats &GetHookStats(int hook_index);
+HookCallStats GetHookStats(int hook_index);
 void ResetAllHookStats();
 int GetHookCount();
 const char *GetHookName(int hook_index);
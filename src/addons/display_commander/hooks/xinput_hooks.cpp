@@ -4,9 +4,13 @@
 #include "dualsense_hooks.hpp"
 #include "../input_remapping/input_remapping.hpp"
 #include "../utils/general_utils.hpp"
+#include "../utils/input_pipeline.hpp"
+#include "../utils/input_sampler.hpp"
+#include "../utils/stick_response.hpp"
 #include "../utils/timing.hpp"
 #include "../widgets/xinput_widget/xinput_widget.hpp"
 #include "../swapchain_events.hpp"
+#include "../ui/new_ui/settings_wrapper.hpp"
 #include "windows_hooks/windows_message_hooks.hpp"
 #include "../globals.hpp"
 #include <MinHook.h>
@@ -14,7 +18,6 @@
 #include <string>
 #include <vector>
 #include <cmath>
-#include <functional>
 
 // Guide button constant (not defined in standard XInput headers)
 #ifndef XINPUT_GAMEPAD_GUIDE
@@ -66,236 +69,317 @@ static void InitializeXInputDirectFunctions() {
 }
 
 
-float recenter(float value, float center) {
-    auto new_value = value - center;
+namespace {
 
-    return new_value / (1 + abs(center));
+using display_commander::widgets::xinput_widget::ControllerState;
+using display_commander::widgets::xinput_widget::XInputSharedState;
+
+// Stages of the XInputGetState pipeline, in the order they run on a successful poll
+enum XInputStage : uint32_t {
+    kXInputStageOverride = 1u << 0,     // auto-click override sticks/buttons
+    kXInputStageSwapAB = 1u << 1,       // A/B button swap
+    kXInputStageThumbsticks = 1u << 2,  // stick response curves
+    kXInputStageRemap = 1u << 3,        // gamepad remapping
+    kXInputStageAutofire = 1u << 4,     // autofire
+    kXInputStageMirror = 1u << 5,       // UI state and battery mirroring
+};
+
+// Settings the stages read, loaded once per frame per polling thread
+struct XInputStageSettings {
+    uint32_t stages = 0;
+    bool dualsense_enabled = false;
+    bool spoof_connection = false;  // auto-click override fakes a connected controller 0
+
+    utils::StickCurve left_stick;
+    utils::StickCurve right_stick;
+};
+
+struct XInputStageContext {
+    DWORD user_index;
+    const XInputStageSettings &settings;
+    XInputSharedState &shared_state;
+    const XINPUT_STATE &original_state;  // as returned by the device, before any stage ran
+};
+
+// Autofire resets its phases whenever it is seen disabled; only do that once per transition now that the stage is
+// skipped while disabled
+std::atomic<bool> g_autofire_was_enabled{false};
+
+XInputStageSettings LoadXInputStageSettings(XInputSharedState &shared_state) {
+    XInputStageSettings settings;
+    settings.dualsense_enabled = shared_state.enable_dualsense_xinput.load(std::memory_order_relaxed);
+    settings.spoof_connection = g_auto_click_enabled.load(std::memory_order_relaxed);
+
+    settings.left_stick = display_commander::widgets::xinput_widget::GetLeftStickCurve(shared_state);
+    settings.right_stick = display_commander::widgets::xinput_widget::GetRightStickCurve(shared_state);
+
+    const bool autofire_enabled = shared_state.autofire_enabled.load(std::memory_order_relaxed);
+    if (g_autofire_was_enabled.exchange(autofire_enabled, std::memory_order_relaxed) && !autofire_enabled) {
+        display_commander::widgets::xinput_widget::ResetAutofireState();
+    }
+
+    // The override can outlive auto-click (it is cleared by the auto-click thread), so it stays on like the
+    // thumbstick and mirror stages
+    settings.stages = kXInputStageOverride | kXInputStageThumbsticks | kXInputStageMirror;
+    if (shared_state.swap_a_b_buttons.load(std::memory_order_relaxed)) {
+        settings.stages |= kXInputStageSwapAB;
+    }
+    if (display_commander::input_remapping::InputRemapper::get_instance().is_remapping_enabled()) {
+        settings.stages |= kXInputStageRemap;
+    }
+    if (autofire_enabled) {
+        settings.stages |= kXInputStageAutofire;
+    }
+    return settings;
 }
 
-// Helper function to apply max input, min output, deadzone, and center calibration to thumbstick values
-void ApplyThumbstickProcessing(XINPUT_STATE *pState, float left_max_input, float right_max_input, float left_min_output,
-                               float right_min_output, float left_deadzone, float right_deadzone,
-                               float left_center_x, float left_center_y, float right_center_x, float right_center_y,
-                               bool left_circular, bool right_circular) {
-    if (!pState)
-        return;
+// Override values are written by the auto-click thread at any time, so they are read live rather than per frame
+struct OverrideStage {
+    static constexpr uint32_t kFlag = kXInputStageOverride;
+    void operator()(XINPUT_STATE &state, XInputStageContext &context) const {
+        const auto &override_state = context.shared_state.override_state;
+        float override_lx = override_state.left_stick_x.load(std::memory_order_relaxed);
+        float override_ly = override_state.left_stick_y.load(std::memory_order_relaxed);
+        float override_rx = override_state.right_stick_x.load(std::memory_order_relaxed);
+        float override_ry = override_state.right_stick_y.load(std::memory_order_relaxed);
+        WORD override_buttons = override_state.buttons_pressed_mask.load(std::memory_order_relaxed);
+
+        // Apply stick overrides (INFINITY means not overridden)
+        if (!std::isinf(override_lx)) {
+            state.Gamepad.sThumbLX = FloatToShort(override_lx);
+        }
+        if (!std::isinf(override_ly)) {
+            state.Gamepad.sThumbLY = FloatToShort(override_ly);
+        }
+        if (!std::isinf(override_rx)) {
+            state.Gamepad.sThumbRX = FloatToShort(override_rx);
+        }
+        if (!std::isinf(override_ry)) {
+            state.Gamepad.sThumbRY = FloatToShort(override_ry);
+        }
 
-    // Process left stick
-    float lx = ShortToFloat(pState->Gamepad.sThumbLX);
-    float ly = ShortToFloat(pState->Gamepad.sThumbLY);
+        // Apply button override (mask 0 means no override)
+        if (override_buttons != 0) {
+            state.Gamepad.wButtons |= override_buttons;
+        }
+    }
+};
 
-    // Apply center calibration (recenter the stick)
-    lx = recenter(lx, left_center_x);
-    ly = recenter(ly, left_center_y);
+struct SwapABStage {
+    static constexpr uint32_t kFlag = kXInputStageSwapAB;
+    void operator()(XINPUT_STATE &state, XInputStageContext &context) const {
+        WORD original_buttons = state.Gamepad.wButtons;
+        WORD swapped_buttons = original_buttons;
+
+        // If A is pressed, set B instead
+        if (original_buttons & XINPUT_GAMEPAD_A) {
+            swapped_buttons |= XINPUT_GAMEPAD_B;
+            swapped_buttons &= ~XINPUT_GAMEPAD_A;
+            LogInfoDeferred("XXX A/B Swap: A pressed -> B set (Controller %lu)", context.user_index);
+        }
+        // If B is pressed, set A instead
+        if (original_buttons & XINPUT_GAMEPAD_B) {
+            swapped_buttons |= XINPUT_GAMEPAD_A;
+            swapped_buttons &= ~XINPUT_GAMEPAD_B;
+            LogInfoDeferred("XXX A/B Swap: B pressed -> A set (Controller %lu)", context.user_index);
+        }
 
-    // Use circular or square processing based on toggle
-    if (left_circular) {
-        ProcessStickInputRadial(lx, ly, left_deadzone, left_max_input, left_min_output);
-    } else {
-        ProcessStickInputSquare(lx, ly, left_deadzone, left_max_input, left_min_output);
+        state.Gamepad.wButtons = swapped_buttons;
     }
+};
 
-    // Convert back to SHORT with correct scaling
-    pState->Gamepad.sThumbLX = FloatToShort(lx);
-    pState->Gamepad.sThumbLY = FloatToShort(ly);
+struct ThumbstickStage {
+    static constexpr uint32_t kFlag = kXInputStageThumbsticks;
+    void operator()(XINPUT_STATE &state, XInputStageContext &context) const {
+        // Curve tables are rebuilt only when the stick settings changed
+        thread_local utils::StickResponseEngine engine;
+        engine.Configure(context.settings.left_stick, context.settings.right_stick);
+
+        utils::GamepadAxes axes;
+        axes.left_x = state.Gamepad.sThumbLX;
+        axes.left_y = state.Gamepad.sThumbLY;
+        axes.right_x = state.Gamepad.sThumbRX;
+        axes.right_y = state.Gamepad.sThumbRY;
+        axes.left_trigger = state.Gamepad.bLeftTrigger;
+        axes.right_trigger = state.Gamepad.bRightTrigger;
+        engine.Apply(axes);
+        state.Gamepad.sThumbLX = axes.left_x;
+        state.Gamepad.sThumbLY = axes.left_y;
+        state.Gamepad.sThumbRX = axes.right_x;
+        state.Gamepad.sThumbRY = axes.right_y;
+        state.Gamepad.bLeftTrigger = axes.left_trigger;
+        state.Gamepad.bRightTrigger = axes.right_trigger;
+    }
+};
 
-    // Process right stick
-    float rx = ShortToFloat(pState->Gamepad.sThumbRX);
-    float ry = ShortToFloat(pState->Gamepad.sThumbRY);
+struct RemapStage {
+    static constexpr uint32_t kFlag = kXInputStageRemap;
+    void operator()(XINPUT_STATE &state, XInputStageContext &context) const {
+        display_commander::input_remapping::process_gamepad_input_for_remapping(context.user_index, &state);
+    }
+};
 
-    // Apply center calibration (recenter the stick)
-    rx = recenter(rx, right_center_x);
-    ry = recenter(ry, right_center_y);
+struct AutofireStage {
+    static constexpr uint32_t kFlag = kXInputStageAutofire;
+    void operator()(XINPUT_STATE &state, XInputStageContext &context) const {
+        display_commander::widgets::xinput_widget::ProcessAutofire(context.user_index, &state);
+    }
+};
 
-    // Use circular or square processing based on toggle
-    if (right_circular) {
-        ProcessStickInputRadial(rx, ry, right_deadzone, right_max_input, right_min_output);
-    } else {
-        ProcessStickInputSquare(rx, ry, right_deadzone, right_max_input, right_min_output);
+// The UI shows the controller as the device reported it, regardless of what the other stages changed
+struct MirrorStage {
+    static constexpr uint32_t kFlag = kXInputStageMirror;
+    void operator()(XINPUT_STATE & /*state*/, XInputStageContext &context) const {
+        display_commander::widgets::xinput_widget::UpdateXInputState(context.user_index, &context.original_state);
+        display_commander::widgets::xinput_widget::UpdateBatteryStatus(context.user_index);
     }
+};
 
-    // Convert back to SHORT with correct scaling
-    pState->Gamepad.sThumbRX = FloatToShort(rx);
-    pState->Gamepad.sThumbRY = FloatToShort(ry);
-}
+using XInputGetStatePipeline =
+    utils::InputPipeline<OverrideStage, SwapABStage, ThumbstickStage, RemapStage, AutofireStage, MirrorStage>;
+
+// Reads controllers for the input sampling thread the same way the detour would without it
+struct XInputSamplerBackend {
+    using State = XINPUT_STATE;
+
+    bool Sample(size_t pad, XINPUT_STATE &state, uint32_t &result) {
+        const DWORD user_index = static_cast<DWORD>(pad);
+        XInputSharedState *shared_state = display_commander::widgets::xinput_widget::XInputWidget::GetSharedStatePtr();
+        if (shared_state != nullptr && shared_state->enable_dualsense_xinput.load(std::memory_order_relaxed)
+            && display_commander::hooks::IsDualSenseAvailable()
+            && display_commander::hooks::ConvertDualSenseToXInput(user_index, &state)) {
+            result = ERROR_SUCCESS;
+            return true;
+        }
+        // GetStateEx also reports the Guide button
+        XInputGetStateEx_pfn get_state = XInputGetStateEx_Direct != nullptr ? XInputGetStateEx_Direct : XInputGetState_Direct;
+        result = get_state != nullptr ? get_state(user_index, &state) : ERROR_DEVICE_NOT_CONNECTED;
+        return result == ERROR_SUCCESS;
+    }
+
+    int64_t NowNs() { return utils::get_now_ns(); }
+    // Plain timer sleep without a spin tail: samples carry their own timestamps, so a late wake-up only delays one
+    // sample, while spinning out the period would keep a core busy at every sampling rate
+    void SleepUntilNs(int64_t target_ns) {
+        const int64_t delta_ns = target_ns - utils::get_now_ns();
+        if (delta_ns <= 0) {
+            return;
+        }
+        LARGE_INTEGER delay{};
+        delay.QuadPart = -(delta_ns / 100); // relative, in 100 ns units
+        if (timer_handle != nullptr && SetWaitableTimer(timer_handle, &delay, 0, nullptr, nullptr, FALSE)) {
+            WaitForSingleObject(timer_handle, INFINITE);
+        } else {
+            Sleep(static_cast<DWORD>((delta_ns + 999'999) / 1'000'000));
+        }
+    }
+
+    HANDLE timer_handle = nullptr; // created by StartXInputSampler, closed by StopXInputSampler
+};
+
+XInputSamplerBackend g_xinput_sampler_backend;
+utils::InputSampler<XInputSamplerBackend> g_xinput_sampler(g_xinput_sampler_backend);
+
+// Timestamp of the newest connected sample the game read since the last present; 0 = none
+std::atomic<int64_t> g_last_consumed_sample_ns{0};
+
+} // namespace
 
 // Helper function containing shared logic for XInputGetState and XInputGetStateEx
+template <typename CallOriginal>
 static DWORD ProcessXInputGetState(DWORD dwUserIndex, XINPUT_STATE *pState, HookIndex hook_index,
-                                    std::atomic<uint64_t> &update_ns_field, const char *error_function_name,
-                                    const std::function<DWORD(DWORD, XINPUT_STATE *)> &call_original_func) {
+                                   XInputSharedState &shared_state, std::atomic<uint64_t> &update_ns_field,
+                                   const char *error_function_name, CallOriginal &&call_original_func) {
     // Track hook call statistics
-    g_hook_stats[hook_index].increment_total();
+    g_hook_stats.Increment(hook_index, HOOK_CALLS_TOTAL);
+
+    const int64_t now_ns = utils::get_now_ns();
 
     // Measure timing for smooth call rate calculation
-    auto shared_state = display_commander::widgets::xinput_widget::XInputWidget::GetSharedState();
-    if (shared_state && dwUserIndex == 0) {
-        uint64_t current_time_ns = utils::get_now_ns();
-        uint64_t last_call_time = shared_state->last_xinput_call_time_ns.load();
+    if (dwUserIndex == 0) {
+        uint64_t current_time_ns = static_cast<uint64_t>(now_ns);
+        uint64_t last_call_time = shared_state.last_xinput_call_time_ns.load(std::memory_order_relaxed);
 
         if (last_call_time > 0) {
             uint64_t time_since_last_call_ns = current_time_ns - last_call_time;
             // Only update if time since last call is reasonable (ignore if > 1000ms)
             if (time_since_last_call_ns < 1 * utils::SEC_TO_NS) { // 1 second in nanoseconds
-                uint64_t old_update_ns = update_ns_field.load();
+                uint64_t old_update_ns = update_ns_field.load(std::memory_order_relaxed);
                 uint64_t new_update_ns = UpdateRollingAverage(time_since_last_call_ns, old_update_ns);
-                update_ns_field.store(new_update_ns);
+                update_ns_field.store(new_update_ns, std::memory_order_relaxed);
             }
         }
-        shared_state->last_xinput_call_time_ns.store(current_time_ns);
+        shared_state.last_xinput_call_time_ns.store(current_time_ns, std::memory_order_relaxed);
     }
 
-    // Check if override state is set - if so, spoof controller connection for controller 0
-    bool should_spoof_connection = g_auto_click_enabled.load() && dwUserIndex == 0;
-
-    // Check if DualSense to XInput conversion is enabled
-    bool dualsense_enabled = shared_state && shared_state->enable_dualsense_xinput.load();
+    const uint64_t current_frame_id = g_global_frame_id.load(std::memory_order_relaxed);
+    thread_local utils::FrameSnapshot<XInputStageSettings> settings_snapshot;
+    const XInputStageSettings &settings =
+        settings_snapshot.Get(current_frame_id, ui::new_ui::g_settings_change_bus.Generation(), now_ns,
+                              [&] { return LoadXInputStageSettings(shared_state); });
 
     DWORD result = ERROR_DEVICE_NOT_CONNECTED;
+    bool sampled = false;
+
+    // Hand out the freshest sample of the input sampling thread instead of reading the device
+    if (g_xinput_sampler.IsRunning() && dwUserIndex < XUSER_MAX_COUNT) {
+        g_xinput_sampler.Request(dwUserIndex, now_ns);
+        utils::InputSample<XINPUT_STATE> sample;
+        if (g_xinput_sampler.Latest(dwUserIndex, now_ns, sample)) {
+            *pState = sample.state;
+            result = sample.result;
+            sampled = true;
+            if (sample.connected) {
+                g_last_consumed_sample_ns.store(sample.timestamp_ns, std::memory_order_relaxed);
+            }
+        }
+    }
 
     // Try DualSense conversion first if enabled
-    if (dualsense_enabled && display_commander::hooks::IsDualSenseAvailable()) {
+    if (!sampled && settings.dualsense_enabled && display_commander::hooks::IsDualSenseAvailable()) {
         if (display_commander::hooks::ConvertDualSenseToXInput(dwUserIndex, pState)) {
             result = ERROR_SUCCESS;
         }
     }
 
-    // Track whether we spoofed the connection
-    bool did_spoof_connection = false;
-
-    // If controller is not connected but we need to spoof for override, create fake state
-    if (should_spoof_connection) {
-        // Initialize fake gamepad state (all zeros)
+    // If the override needs controller 0 connected, spoof it with a fake (all zeros) state
+    if (settings.spoof_connection && dwUserIndex == 0) {
         ZeroMemory(&pState->Gamepad, sizeof(XINPUT_GAMEPAD));
         // Packet number will be set just before return
-        result = ERROR_SUCCESS; // Spoof as connected
-        did_spoof_connection = true;
+        result = ERROR_SUCCESS;
     }
 
     // Fall back to original XInput if DualSense conversion failed or is disabled
-    if (result != ERROR_SUCCESS) {
+    if (!sampled && result != ERROR_SUCCESS) {
         result = call_original_func(dwUserIndex, pState);
     }
 
-
     // Override packet number with our tracked value just before returning
     if (dwUserIndex < 4) {
-        // If we spoofed the connection, increment our tracked packet number
         g_packet_numbers[dwUserIndex]++;
-        // Always override with our tracked packet number
         pState->dwPacketNumber = g_packet_numbers[dwUserIndex];
     }
 
-    // Apply A/B button swapping if enabled
     if (result == ERROR_SUCCESS) {
         // Mark controller as connected in shared state
-        if (shared_state && dwUserIndex < XUSER_MAX_COUNT) {
-            shared_state->controller_connected[dwUserIndex] = display_commander::widgets::xinput_widget::ControllerState::Connected;
+        if (dwUserIndex < XUSER_MAX_COUNT) {
+            shared_state.controller_connected[dwUserIndex] = ControllerState::Connected;
         }
         // Store the frame ID when XInput is successfully detected
-        uint64_t current_frame_id = g_global_frame_id.load();
-        g_last_xinput_detected_frame_id.store(current_frame_id);
-
-        auto shared_state = display_commander::widgets::xinput_widget::XInputWidget::GetSharedState();
+        g_last_xinput_detected_frame_id.store(current_frame_id, std::memory_order_relaxed);
 
         // Store original state for UI tracking (before any modifications)
-        XINPUT_STATE original_state = *pState;
-
-        // Apply override state if set (check before suppression)
-        if (shared_state) {
-            float override_lx = shared_state->override_state.left_stick_x.load();
-            float override_ly = shared_state->override_state.left_stick_y.load();
-            float override_rx = shared_state->override_state.right_stick_x.load();
-            float override_ry = shared_state->override_state.right_stick_y.load();
-            WORD override_buttons = shared_state->override_state.buttons_pressed_mask.load();
-
-            // Apply stick overrides (INFINITY means not overridden)
-            if (!std::isinf(override_lx)) {
-                pState->Gamepad.sThumbLX = FloatToShort(override_lx);
-            }
-            if (!std::isinf(override_ly)) {
-                pState->Gamepad.sThumbLY = FloatToShort(override_ly);
-            }
-            if (!std::isinf(override_rx)) {
-                pState->Gamepad.sThumbRX = FloatToShort(override_rx);
-            }
-            if (!std::isinf(override_ry)) {
-                pState->Gamepad.sThumbRY = FloatToShort(override_ry);
-            }
+        const XINPUT_STATE original_state = *pState;
 
-            // Apply button override (mask 0 means no override)
-            if (override_buttons != 0) {
-                pState->Gamepad.wButtons |= override_buttons;
-            }
-        }
-
-        // Process input normally
-        if (shared_state && shared_state->swap_a_b_buttons.load()) {
-            // Swap A and B buttons
-            WORD original_buttons = pState->Gamepad.wButtons;
-            WORD swapped_buttons = original_buttons;
-
-            // If A is pressed, set B instead
-            if (original_buttons & XINPUT_GAMEPAD_A) {
-                swapped_buttons |= XINPUT_GAMEPAD_B;
-                swapped_buttons &= ~XINPUT_GAMEPAD_A;
-                LogInfo("XXX A/B Swap: A pressed -> B set (Controller %lu)", dwUserIndex);
-            }
-            // If B is pressed, set A instead
-            if (original_buttons & XINPUT_GAMEPAD_B) {
-                swapped_buttons |= XINPUT_GAMEPAD_A;
-                swapped_buttons &= ~XINPUT_GAMEPAD_B;
-                LogInfo("XXX A/B Swap: B pressed -> A set (Controller %lu)", dwUserIndex);
-            }
-
-            pState->Gamepad.wButtons = swapped_buttons;
-        }
-
-        // Apply max input, min output, deadzone, and center calibration processing
-        if (shared_state) {
-            float left_max_input = shared_state->left_stick_max_input.load();
-            float right_max_input = shared_state->right_stick_max_input.load();
-            float left_min_output = shared_state->left_stick_min_output.load();
-            float right_min_output = shared_state->right_stick_min_output.load();
-            float left_deadzone =
-                shared_state->left_stick_deadzone.load() / 100.0f; // Convert percentage to decimal
-            float right_deadzone =
-                shared_state->right_stick_deadzone.load() / 100.0f; // Convert percentage to decimal
-
-            float left_center_x = shared_state->left_stick_center_x.load();
-            float left_center_y = shared_state->left_stick_center_y.load();
-            float right_center_x = shared_state->right_stick_center_x.load();
-            float right_center_y = shared_state->right_stick_center_y.load();
-
-            bool left_circular = shared_state->left_stick_circular.load();
-            bool right_circular = shared_state->right_stick_circular.load();
-
-            ApplyThumbstickProcessing(pState, left_max_input, right_max_input, left_min_output, right_min_output,
-                                      left_deadzone, right_deadzone, left_center_x, left_center_y, right_center_x, right_center_y,
-                                      left_circular, right_circular);
-        }
-
-        // Process input remapping before updating state
-        display_commander::input_remapping::process_gamepad_input_for_remapping(dwUserIndex, pState);
-
-        // Process autofire
-        display_commander::widgets::xinput_widget::ProcessAutofire(dwUserIndex, pState);
+        XInputStageContext context{dwUserIndex, settings, shared_state, original_state};
+        XInputGetStatePipeline::Run(settings.stages, *pState, context);
 
         // Track unsuppressed call (input was processed)
-        g_hook_stats[hook_index].increment_unsuppressed();
-
-        // Always update the UI state with the original state (before suppression/modifications)
-        // This ensures the UI shows the actual controller state regardless of suppression
-        display_commander::widgets::xinput_widget::UpdateXInputState(dwUserIndex, &original_state);
-
-        // Update battery status periodically
-        display_commander::widgets::xinput_widget::UpdateBatteryStatus(dwUserIndex);
+        g_hook_stats.Increment(hook_index, HOOK_CALLS_UNSUPPRESSED);
     } else {
         // Mark controller as disconnected in shared state
         if (dwUserIndex < XUSER_MAX_COUNT) {
-            auto shared_state = display_commander::widgets::xinput_widget::XInputWidget::GetSharedState();
-            if (shared_state) {
-                shared_state->controller_connected[dwUserIndex] = display_commander::widgets::xinput_widget::ControllerState::Unconnected;
-            }
+            shared_state.controller_connected[dwUserIndex] = ControllerState::Unconnected;
         }
         if (dwUserIndex == 0) {
             LogErrorThrottled(10, "XXX XInput Controller %lu: %s failed with error %lu (Perhaps disable steam input?)", dwUserIndex, error_function_name, result);
@@ -318,14 +402,13 @@ DWORD WINAPI XInputGetState_Detour(DWORD dwUserIndex, XINPUT_STATE *pState) {
     static bool tried_get_state_ex = false;
     static bool use_get_state_ex = false;
 
-    // Get shared state for timing field access
-    auto shared_state = display_commander::widgets::xinput_widget::XInputWidget::GetSharedState();
+    XInputSharedState *shared_state = display_commander::widgets::xinput_widget::XInputWidget::GetSharedStatePtr();
     if (!shared_state) {
         return ERROR_DEVICE_NOT_CONNECTED;
     }
 
     // Lambda to call original function with fallback logic
-    auto call_original = [&](DWORD user_index, XINPUT_STATE *state) -> DWORD {
+    auto call_original = [](DWORD user_index, XINPUT_STATE *state) -> DWORD {
         DWORD result = use_get_state_ex ? XInputGetStateEx_Direct(user_index, state) : XInputGetState_Direct(user_index, state);
         if (result == ERROR_SUCCESS) {
             if (!tried_get_state_ex) {
@@ -336,8 +419,8 @@ DWORD WINAPI XInputGetState_Detour(DWORD dwUserIndex, XINPUT_STATE *pState) {
         return result;
     };
 
-    return ProcessXInputGetState(dwUserIndex, pState, HOOK_XInputGetState,
-                                  shared_state->xinput_getstate_update_ns, "GetState", call_original);
+    return ProcessXInputGetState(dwUserIndex, pState, HOOK_XInputGetState, *shared_state,
+                                 shared_state->xinput_getstate_update_ns, "GetState", call_original);
 }
 
 // Hooked XInputGetStateEx function
@@ -346,8 +429,7 @@ DWORD WINAPI XInputGetStateEx_Detour(DWORD dwUserIndex, XINPUT_STATE *pState) {
         return ERROR_INVALID_PARAMETER;
     }
 
-    // Get shared state for timing field access
-    auto shared_state = display_commander::widgets::xinput_widget::XInputWidget::GetSharedState();
+    XInputSharedState *shared_state = display_commander::widgets::xinput_widget::XInputWidget::GetSharedStatePtr();
     if (!shared_state) {
         return ERROR_DEVICE_NOT_CONNECTED;
     }
@@ -357,8 +439,8 @@ DWORD WINAPI XInputGetStateEx_Detour(DWORD dwUserIndex, XINPUT_STATE *pState) {
         return XInputGetStateEx_Direct != nullptr ? XInputGetStateEx_Direct(user_index, state) : ERROR_DEVICE_NOT_CONNECTED;
     };
 
-    return ProcessXInputGetState(dwUserIndex, pState, HOOK_XInputGetStateEx,
-                                  shared_state->xinput_getstateex_update_ns, "GetStateEx", call_original);
+    return ProcessXInputGetState(dwUserIndex, pState, HOOK_XInputGetStateEx, *shared_state,
+                                 shared_state->xinput_getstateex_update_ns, "GetStateEx", call_original);
 }
 
 // Hooked XInputSetState function
@@ -371,7 +453,7 @@ DWORD WINAPI XInputSetState_Detour(DWORD dwUserIndex, XINPUT_VIBRATION *pVibrati
     }
 
     // Track hook call statistics
-    g_hook_stats[HOOK_XInputSetState].increment_total();
+    g_hook_stats.Increment(HOOK_XInputSetState, HOOK_CALLS_TOTAL);
 
     // Get vibration amplification setting
     auto shared_state = display_commander::widgets::xinput_widget::XInputWidget::GetSharedState();
@@ -402,7 +484,7 @@ DWORD WINAPI XInputSetState_Detour(DWORD dwUserIndex, XINPUT_VIBRATION *pVibrati
     DWORD result = XInputSetState_Direct(dwUserIndex, &vibration);
 
     if (result == ERROR_SUCCESS) {
-        g_hook_stats[HOOK_XInputSetState].increment_unsuppressed();
+        g_hook_stats.Increment(HOOK_XInputSetState, HOOK_CALLS_UNSUPPRESSED);
     }
 
     return result;
@@ -540,9 +622,66 @@ bool InstallXInputHooks() {
 
         // Mark XInput hooks as installed
         display_commanderhooks::HookSuppressionManager::GetInstance().MarkHookInstalled(display_commanderhooks::HookType::XINPUT);
+
+        auto *shared_state = display_commander::widgets::xinput_widget::XInputWidget::GetSharedStatePtr();
+        if (shared_state && shared_state->input_sampler_enabled.load()) {
+            StartXInputSampler();
+        }
     }
 
     return any_success;
 }
 
+void StartXInputSampler() {
+    auto *shared_state = display_commander::widgets::xinput_widget::XInputWidget::GetSharedStatePtr();
+    if (!shared_state) {
+        return;
+    }
+    const uint32_t rate_hz = static_cast<uint32_t>(shared_state->input_sampler_rate_hz.load());
+    if (g_xinput_sampler.IsRunning()) {
+        g_xinput_sampler.SetRate(rate_hz);
+        return;
+    }
+    // Needs the originals; InstallXInputHooks starts it once they are resolved
+    if (!g_xinput_hooks_installed.load() || (XInputGetStateEx_Direct == nullptr && XInputGetState_Direct == nullptr)) {
+        return;
+    }
+    if (g_xinput_sampler_backend.timer_handle == nullptr) {
+        g_xinput_sampler_backend.timer_handle =
+            CreateWaitableTimerEx(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+        if (g_xinput_sampler_backend.timer_handle == nullptr) {
+            g_xinput_sampler_backend.timer_handle = CreateWaitableTimer(nullptr, FALSE, nullptr);
+        }
+    }
+    g_xinput_sampler.Start(rate_hz);
+    LogInfo("XInput sampling thread started at %u Hz", rate_hz);
+}
+
+void StopXInputSampler() {
+    if (!g_xinput_sampler.IsRunning()) {
+        return;
+    }
+    g_xinput_sampler.Stop();
+    if (g_xinput_sampler_backend.timer_handle != nullptr) {
+        CloseHandle(g_xinput_sampler_backend.timer_handle);
+        g_xinput_sampler_backend.timer_handle = nullptr;
+    }
+    g_last_consumed_sample_ns.store(0, std::memory_order_relaxed);
+    LogInfo("XInput sampling thread stopped");
+}
+
+void RecordXInputPresent(LONGLONG present_start_ns) {
+    const int64_t sample_ns = g_last_consumed_sample_ns.exchange(0, std::memory_order_relaxed);
+    if (sample_ns == 0 || present_start_ns <= sample_ns) {
+        return;
+    }
+    auto *shared_state = display_commander::widgets::xinput_widget::XInputWidget::GetSharedStatePtr();
+    if (shared_state) {
+        const uint64_t age_ns = static_cast<uint64_t>(present_start_ns - sample_ns);
+        shared_state->input_to_present_ns.store(
+            UpdateRollingAverage(age_ns, shared_state->input_to_present_ns.load(std::memory_order_relaxed)),
+            std::memory_order_relaxed);
+    }
+}
+
 } // namespace display_commanderhooks
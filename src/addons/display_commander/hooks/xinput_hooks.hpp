@@ -27,10 +27,12 @@ DWORD WINAPI XInputSetState_Detour(DWORD dwUserIndex, XINPUT_VIBRATION *pVibrati
 // Hook management
 bool InstallXInputHooks();
 
-// Helper functions for thumbstick processing
-void ApplyThumbstickProcessing(XINPUT_STATE *pState, float left_max_input, float right_max_input, float left_min_output,
-                               float right_min_output, float left_deadzone, float right_deadzone,
-                               float left_center_x, float left_center_y, float right_center_x, float right_center_y,
-                               bool left_circular, bool right_circular);
+// Optional input sampling thread: polls the controllers at a fixed rate so the GetState detours can return the newest
+// sample without blocking in the driver
+void StartXInputSampler();
+void StopXInputSampler();
+
+// Called at present start; tracks how old the input the game read for this frame was
+void RecordXInputPresent(LONGLONG present_start_ns);
 
 } // namespace display_commanderhooks
@@ -15,16 +15,9 @@
 #include "../audio/audio_management.hpp"
 #include <reshade.hpp>
 
-namespace display_commander::input_remapping {
+#include <bit>
 
-// Helper function to get original GetTickCount64 value (unhooked)
-static ULONGLONG GetOriginalTickCount64() {
-    if (enabled_experimental_features && display_commanderhooks::GetTickCount64_Original) {
-        return display_commanderhooks::GetTickCount64_Original();
-    } else {
-        return GetTickCount64();
-    }
-}
+namespace display_commander::input_remapping {
 
 InputRemapper &InputRemapper::get_instance() {
     static InputRemapper instance;
@@ -33,12 +26,7 @@ InputRemapper &InputRemapper::get_instance() {
 
 InputRemapper::InputRemapper() {
     // SRWLOCK is statically initialized, no explicit initialization needed
-
-    // Initialize button state tracking
-    for (int i = 0; i < XUSER_MAX_COUNT; ++i) {
-        _previous_button_states[i].store(0);
-        _current_button_states[i].store(0);
-    }
+    // Controller state machines and the dispatch table publisher both start at generation 0 (no remaps)
 }
 
 InputRemapper::~InputRemapper() {
@@ -85,28 +73,84 @@ void InputRemapper::process_gamepad_input(DWORD user_index, XINPUT_STATE *state)
         return;
     }
 
-    // Update button states
-    update_button_states(user_index, state->Gamepad.wButtons);
+    // Copy of the dispatch table for this thread; re-read only after remaps were edited
+    struct CachedTable {
+        bool valid = false;
+        uint16_t generation = 0;
+        utils::RemapDispatchTable table;
+    };
+    thread_local CachedTable cached;
+    if (!cached.valid || cached.generation != _dispatch_tables.Generation()) {
+        if (!_dispatch_tables.TryRead(cached.table, cached.generation)) {
+            return; // Table is being replaced right now; pick up the change on the next poll
+        }
+        cached.valid = true;
+    }
 
-    // Process button changes
-    WORD previous = _previous_button_states[user_index].load();
-    WORD current = _current_button_states[user_index].load();
-    WORD changed = previous ^ current;
+    // Run the button state machines; events are dispatched only by the poll that advanced the state
+    std::array<utils::RemapEvent, utils::kRemapButtonCount> events;
+    size_t event_count = 0;
+    if (!_controller_states[user_index].Step(cached.table, cached.generation, state->Gamepad.wButtons, events.data(),
+                                             event_count)) {
+        return;
+    }
+    for (size_t i = 0; i < event_count; ++i) {
+        dispatch_remap_event(events[i], user_index);
+    }
 
-    // Check each button for changes
-    for (int i = 0; i < 16; ++i) {
-        WORD button_mask = 1 << i;
-        if ((changed & button_mask) != 0) {
-            if ((current & button_mask) != 0) {
-                handle_button_press(button_mask, user_index, current);
-            } else {
-                handle_button_release(button_mask, user_index, current);
+    // Apply gamepad-to-gamepad remapping (modifies state)
+    state->Gamepad.wButtons = utils::ApplyGamepadRemaps(cached.table, state->Gamepad.wButtons);
+}
+
+void InputRemapper::rebuild_dispatch_table() {
+    std::vector<utils::RemapBinding> bindings;
+    bindings.reserve(_remappings.size());
+    for (const auto &remap : _remappings) {
+        if (!remap.enabled) {
+            continue;
+        }
+        utils::RemapBinding binding;
+        binding.source_button = remap.gamepad_button;
+        binding.hold = remap.hold_mode;
+        binding.chord = remap.chord_mode;
+        switch (remap.remap_type) {
+        case RemapType::Keyboard:
+            binding.output = utils::RemapOutput::kKeyboard;
+            binding.input_method = static_cast<uint8_t>(remap.input_method);
+            binding.payload = static_cast<uint16_t>(remap.keyboard_vk);
+            break;
+        case RemapType::Gamepad:
+            binding.output = utils::RemapOutput::kGamepad;
+            binding.payload = remap.gamepad_target_button;
+            break;
+        case RemapType::Action: {
+            const RemapAction action = get_remap_action_from_name(remap.action_name);
+            if (action == RemapAction::None) {
+                LogError("InputRemapper::rebuild_dispatch_table() - Unknown action: %s", remap.action_name.c_str());
+                continue;
             }
+            binding.output = utils::RemapOutput::kAction;
+            binding.payload = static_cast<uint16_t>(action);
+            break;
         }
+        case RemapType::Count:
+            continue;
+        }
+        bindings.push_back(binding);
     }
 
-    // Apply gamepad-to-gamepad remapping (modifies state)
-    apply_gamepad_remapping(user_index, state);
+    const utils::RemapDispatchTable old_table = _dispatch_table;
+    _dispatch_table = utils::CompileRemapTable(bindings.data(), bindings.size(), XINPUT_GAMEPAD_GUIDE);
+    const uint16_t generation = _dispatch_tables.Publish(_dispatch_table);
+
+    // Release keys held through the old table and move every controller onto the new one
+    std::array<utils::RemapEvent, utils::kRemapButtonCount> events;
+    for (DWORD user_index = 0; user_index < XUSER_MAX_COUNT; ++user_index) {
+        const size_t event_count = _controller_states[user_index].Rebase(old_table, generation, events.data());
+        for (size_t i = 0; i < event_count; ++i) {
+            dispatch_remap_event(events[i], user_index);
+        }
+    }
 }
 
 void InputRemapper::add_default_chord_type(DefaultChordType chord_type) {
@@ -155,6 +199,7 @@ void InputRemapper::add_default_chord_type(DefaultChordType chord_type) {
         remap.is_default_chord = true;
         _remappings.push_back(remap);
         _button_to_remap_index[button] = _remappings.size() - 1;
+        rebuild_dispatch_table();
         save_settings();
         LogInfo("InputRemapper::add_default_chord_type() - Added default chord: %s", log_name);
     } else {
@@ -163,6 +208,7 @@ void InputRemapper::add_default_chord_type(DefaultChordType chord_type) {
         if (idx < _remappings.size() && _remappings[idx].is_default_chord) {
             // Re-enable if it was previously a default chord but disabled
             _remappings[idx].enabled = true;
+            rebuild_dispatch_table();
             save_settings();
             LogInfo("InputRemapper::add_default_chord_type() - Re-enabled default chord: %s", log_name);
         }
@@ -215,6 +261,7 @@ void InputRemapper::remove_default_chord_type(DefaultChordType chord_type) {
                 }
             }
 
+            rebuild_dispatch_table();
             save_settings();
             LogInfo("InputRemapper::remove_default_chord_type() - Removed default chord for button 0x%04X", button);
         }
@@ -252,6 +299,10 @@ void InputRemapper::add_button_remap(const ButtonRemap &remap) {
         _remappings.push_back(remap);
         _button_to_remap_index[remap.gamepad_button] = _remappings.size() - 1;
     }
+    if (std::has_single_bit(remap.gamepad_button)) {
+        _trigger_counts[std::countr_zero(remap.gamepad_button)].store(0);
+    }
+    rebuild_dispatch_table();
 
     // Auto-save settings when remappings change
     save_settings();
@@ -275,6 +326,7 @@ void InputRemapper::remove_button_remap(WORD gamepad_button) {
                 pair.second--;
             }
         }
+        rebuild_dispatch_table();
     }
 
     // Auto-save settings when remappings change
@@ -287,6 +339,7 @@ void InputRemapper::clear_all_remaps() {
     utils::SRWLockExclusive lock(_srwlock);
     _remappings.clear();
     _button_to_remap_index.clear();
+    rebuild_dispatch_table();
 
     // Auto-save settings when remappings change
     save_settings();
@@ -530,7 +583,7 @@ bool InputRemapper::send_keyboard_input_postmessage(int vk_code, bool key_down)
     return result != FALSE;
 }
 
-std::string InputRemapper::get_button_name(WORD button) const {
+const char *InputRemapper::get_button_name(WORD button) const {
     switch (button) {
     case XINPUT_GAMEPAD_DPAD_UP:
         return "D-Pad Up";
@@ -675,148 +728,64 @@ int InputRemapper::get_vk_code_from_name(const std::string &name) const {
 
 HWND InputRemapper::get_active_window() const { return GetForegroundWindow(); }
 
-void InputRemapper::update_button_states(DWORD user_index, WORD button_state) {
-    if (user_index >= XUSER_MAX_COUNT)
-        return;
-
-    _previous_button_states[user_index].store(_current_button_states[user_index].load());
-    _current_button_states[user_index].store(button_state);
-}
-
-void InputRemapper::handle_button_press(WORD gamepad_button, DWORD user_index, WORD current_button_state) {
-    ButtonRemap *remap = const_cast<ButtonRemap *>(get_button_remap(gamepad_button));
-    if (!remap || !remap->enabled)
-        return;
-
-    // Check chord mode: if enabled, guide button must also be pressed
-    if (remap->chord_mode) {
-        if ((current_button_state & XINPUT_GAMEPAD_GUIDE) == 0) {
-            // Guide button not pressed, ignore this remapping
-            return;
-        }
-    }
-
-    remap->is_pressed.store(true);
-    remap->last_press_time.store(GetOriginalTickCount64());
+void InputRemapper::dispatch_remap_event(const utils::RemapEvent &event, DWORD user_index) {
+    const utils::RemapBinding &binding = event.binding;
+    const bool press = event.edge == utils::RemapEdge::kPress;
 
-    bool success = false;
-
-    // Handle different remap types
-    switch (remap->remap_type) {
-    case RemapType::Keyboard: {
-        // Send keyboard input
-        switch (remap->input_method) {
+    switch (binding.output) {
+    case utils::RemapOutput::kKeyboard: {
+        bool success = false;
+        switch (static_cast<KeyboardInputMethod>(binding.input_method)) {
         case KeyboardInputMethod::SendInput:
-            success = send_keyboard_input_sendinput(remap->keyboard_vk, true);
+            success = send_keyboard_input_sendinput(binding.payload, press);
             break;
         case KeyboardInputMethod::KeybdEvent:
-            success = send_keyboard_input_keybdevent(remap->keyboard_vk, true);
+            success = send_keyboard_input_keybdevent(binding.payload, press);
             break;
         case KeyboardInputMethod::SendMessage:
-            success = send_keyboard_input_sendmessage(remap->keyboard_vk, true);
+            success = send_keyboard_input_sendmessage(binding.payload, press);
             break;
         case KeyboardInputMethod::PostMessage:
-            success = send_keyboard_input_postmessage(remap->keyboard_vk, true);
+            success = send_keyboard_input_postmessage(binding.payload, press);
             break;
         case KeyboardInputMethod::Count:
             // Should never happen
             break;
         }
 
-        if (success) {
-            LogInfo("InputRemapper::handle_button_press() - Mapped %s to keyboard %s (Controller %lu)",
-                    get_button_name(gamepad_button).c_str(), remap->keyboard_name.c_str(), user_index);
-        } else {
-            LogError("InputRemapper::handle_button_press() - Failed to send keyboard input for %s",
-                     remap->keyboard_name.c_str());
+        if (!success) {
+            if (press) {
+                LogError("InputRemapper::dispatch_remap_event() - Failed to send keyboard input for VK 0x%02X",
+                         binding.payload);
+            }
+            return;
         }
+        LogInfo("InputRemapper::dispatch_remap_event() - %s %s to keyboard VK 0x%02X (Controller %lu)",
+                press ? "Mapped" : "Released", get_button_name(binding.source_button), binding.payload, user_index);
         break;
     }
-    case RemapType::Gamepad:
-        // Gamepad remapping is handled in apply_gamepad_remapping
-        // Just mark as success for logging
-        success = true;
-        LogInfo("InputRemapper::handle_button_press() - Mapped %s to gamepad %s (Controller %lu)",
-                get_button_name(gamepad_button).c_str(), get_button_name(remap->gamepad_target_button).c_str(), user_index);
+    case utils::RemapOutput::kGamepad:
+        // Gamepad remapping itself is applied to the XINPUT_STATE in process_gamepad_input
+        LogInfo("InputRemapper::dispatch_remap_event() - %s %s to gamepad %s (Controller %lu)",
+                press ? "Mapped" : "Released", get_button_name(binding.source_button),
+                get_button_name(binding.payload), user_index);
         break;
-    case RemapType::Action:
-        // Execute action
-        execute_action(remap->action_name);
-        success = true;
-        LogInfo("InputRemapper::handle_button_press() - Mapped %s to action %s (Controller %lu)",
-                get_button_name(gamepad_button).c_str(), remap->action_name.c_str(), user_index);
-        break;
-    case RemapType::Count:
-        // Should never happen
-        break;
-    }
-
-    if (success) {
-        // Increment trigger counter
-        increment_trigger_count(gamepad_button);
-    }
-}
-
-void InputRemapper::handle_button_release(WORD gamepad_button, DWORD user_index, WORD current_button_state) {
-    ButtonRemap *remap = const_cast<ButtonRemap *>(get_button_remap(gamepad_button));
-    if (!remap || !remap->enabled || !remap->hold_mode)
-        return;
-
-    // Check chord mode: if enabled, guide button must also be pressed (or was pressed when button was released)
-    // For release, we check if guide button is still pressed or if it was pressed when the button was held
-    if (remap->chord_mode) {
-        if ((current_button_state & XINPUT_GAMEPAD_GUIDE) == 0) {
-            // Guide button not pressed, ignore this remapping release
+    case utils::RemapOutput::kAction:
+        // Actions don't need release handling
+        if (!press) {
             return;
         }
-    }
-
-    remap->is_pressed.store(false);
-
-    bool success = false;
-
-    // Handle different remap types
-    switch (remap->remap_type) {
-    case RemapType::Keyboard: {
-        // Send keyboard release
-        switch (remap->input_method) {
-        case KeyboardInputMethod::SendInput:
-            success = send_keyboard_input_sendinput(remap->keyboard_vk, false);
-            break;
-        case KeyboardInputMethod::KeybdEvent:
-            success = send_keyboard_input_keybdevent(remap->keyboard_vk, false);
-            break;
-        case KeyboardInputMethod::SendMessage:
-            success = send_keyboard_input_sendmessage(remap->keyboard_vk, false);
-            break;
-        case KeyboardInputMethod::PostMessage:
-            success = send_keyboard_input_postmessage(remap->keyboard_vk, false);
-            break;
-        case KeyboardInputMethod::Count:
-            // Should never happen
-            break;
-        }
-
-        if (success) {
-            LogInfo("InputRemapper::handle_button_release() - Released keyboard %s (Controller %lu)",
-                    remap->keyboard_name.c_str(), user_index);
-        }
+        execute_action(static_cast<RemapAction>(binding.payload));
+        LogInfo("InputRemapper::dispatch_remap_event() - Mapped %s to action %s (Controller %lu)",
+                get_button_name(binding.source_button), get_remap_action_name(static_cast<RemapAction>(binding.payload)),
+                user_index);
         break;
+    case utils::RemapOutput::kNone:
+        return;
     }
-    case RemapType::Gamepad:
-        // Gamepad remapping release is handled in apply_gamepad_remapping
-        // Just mark as success for logging
-        success = true;
-        LogInfo("InputRemapper::handle_button_release() - Released gamepad %s (Controller %lu)",
-                get_button_name(remap->gamepad_target_button).c_str(), user_index);
-        break;
-    case RemapType::Action:
-        // Actions typically don't need release handling
-        success = true;
-        break;
-    case RemapType::Count:
-        // Should never happen
-        break;
+
+    if (press) {
+        _trigger_counts[std::countr_zero(binding.source_button)].fetch_add(1);
     }
 }
 
@@ -862,58 +831,20 @@ std::vector<std::string> get_available_keyboard_keys() {
             "R",     "S",     "T",      "U",   "V",     "W",    "X",   "Y",   "Z"};
 }
 
-void InputRemapper::increment_trigger_count(WORD gamepad_button) {
-    ButtonRemap *remap = const_cast<ButtonRemap *>(get_button_remap(gamepad_button));
-    if (remap) {
-        remap->trigger_count.fetch_add(1);
-    }
-}
-
 uint64_t InputRemapper::get_trigger_count(WORD gamepad_button) const {
-    const ButtonRemap *remap = get_button_remap(gamepad_button);
-    return remap ? remap->trigger_count.load() : 0;
-}
-
-void InputRemapper::apply_gamepad_remapping(DWORD user_index, XINPUT_STATE *state) {
-    if (!state || user_index >= XUSER_MAX_COUNT) {
-        return;
+    if (!std::has_single_bit(gamepad_button)) {
+        return 0;
     }
+    return _trigger_counts[std::countr_zero(gamepad_button)].load();
+}
 
-    utils::SRWLockShared lock(_srwlock);
-
-    // Apply all gamepad-to-gamepad remappings
-    for (const auto &remap : _remappings) {
-        if (!remap.enabled || remap.remap_type != RemapType::Gamepad) {
-            continue;
-        }
-
-        // Check chord mode: if enabled, guide button must also be pressed
-        if (remap.chord_mode) {
-            if ((state->Gamepad.wButtons & XINPUT_GAMEPAD_GUIDE) == 0) {
-                // Guide button not pressed, skip this remapping
-                continue;
-            }
-        }
-
-        // Check if source button is pressed
-        if ((state->Gamepad.wButtons & remap.gamepad_button) != 0) {
-            // Add target button to state
-            state->Gamepad.wButtons |= remap.gamepad_target_button;
-
-            // If hold_mode is false, remove source button (one-time press)
-            if (!remap.hold_mode) {
-                state->Gamepad.wButtons &= ~remap.gamepad_button;
-            }
-        } else if (remap.hold_mode) {
-            // If hold_mode is true and source button is released, remove target button
-            // (This is handled by button state tracking, but we ensure consistency here)
-            // Note: We can't easily detect release here without state tracking
-            // The release will be handled by handle_button_release
-        }
+void InputRemapper::reset_trigger_counts() {
+    for (auto &count : _trigger_counts) {
+        count.store(0);
     }
 }
 
-void InputRemapper::execute_action(const std::string &action_name) {
+void InputRemapper::execute_action(RemapAction action) {
     // Helper function to trigger generic action notification
     auto trigger_action_notification = [](const std::string &name) {
         ActionNotification notification = {};
@@ -927,7 +858,8 @@ void InputRemapper::execute_action(const std::string &action_name) {
         g_action_notification.store(notification);
     };
 
-    if (action_name == "screenshot") {
+    switch (action) {
+    case RemapAction::Screenshot: {
         // Use ReShade 6.6.2+ runtime screenshot API
         reshade::api::effect_runtime* runtime = GetFirstReShadeRuntime();
         if (runtime != nullptr) {
@@ -946,7 +878,9 @@ void InputRemapper::execute_action(const std::string &action_name) {
                 LogError("InputRemapper::execute_action() - No screenshot mechanism available");
             }
         }
-    } else if (action_name == "time slowdown toggle") {
+        break;
+    }
+    case RemapAction::TimeSlowdownToggle: {
         // Toggle time slowdown enabled state
         if (!enabled_experimental_features) {
             LogWarn("InputRemapper::execute_action() - Time slowdown toggle requires experimental features");
@@ -958,14 +892,18 @@ void InputRemapper::execute_action(const std::string &action_name) {
         display_commanderhooks::SetTimeslowdownEnabled(new_state);
         trigger_action_notification("Time Slowdown " + std::string(new_state ? "On" : "Off"));
         LogInfo("InputRemapper::execute_action() - Time slowdown %s via action", new_state ? "enabled" : "disabled");
-    } else if (action_name == "performance overlay toggle") {
+        break;
+    }
+    case RemapAction::PerformanceOverlayToggle: {
         // Toggle performance overlay
         bool current_state = settings::g_mainTabSettings.show_test_overlay.GetValue();
         bool new_state = !current_state;
         settings::g_mainTabSettings.show_test_overlay.SetValue(new_state);
         trigger_action_notification("Performance Overlay " + std::string(new_state ? "On" : "Off"));
         LogInfo("InputRemapper::execute_action() - Performance overlay %s via action", new_state ? "enabled" : "disabled");
-    } else if (action_name == "mute/unmute audio") {
+        break;
+    }
+    case RemapAction::MuteUnmute: {
         // Toggle audio mute state
         bool current_state = s_audio_mute.load();
         bool new_state = !current_state;
@@ -978,22 +916,30 @@ void InputRemapper::execute_action(const std::string &action_name) {
         } else {
             LogError("InputRemapper::execute_action() - Failed to %s audio", new_state ? "mute" : "unmute");
         }
-    } else if (action_name == "increase volume") {
+        break;
+    }
+    case RemapAction::IncreaseVolume: {
         // Increase volume by 10%
         if (AdjustVolumeForCurrentProcess(10.0f)) {
             LogInfo("InputRemapper::execute_action() - Volume increased by 10%%");
         } else {
             LogError("InputRemapper::execute_action() - Failed to increase volume");
         }
-    } else if (action_name == "decrease volume") {
+        break;
+    }
+    case RemapAction::DecreaseVolume: {
         // Decrease volume by 10%
         if (AdjustVolumeForCurrentProcess(-10.0f)) {
             LogInfo("InputRemapper::execute_action() - Volume decreased by 10%%");
         } else {
             LogError("InputRemapper::execute_action() - Failed to decrease volume");
         }
-    } else {
-        LogError("InputRemapper::execute_action() - Unknown action: %s", action_name.c_str());
+        break;
+    }
+    case RemapAction::None:
+    case RemapAction::Count:
+        LogError("InputRemapper::execute_action() - Unknown action: %u", static_cast<unsigned>(action));
+        break;
     }
 }
 
@@ -1011,7 +957,26 @@ std::string get_remap_type_name(RemapType type) {
     return "Unknown";
 }
 
+// Saved action names, indexed by RemapAction
+static constexpr std::array<const char *, static_cast<size_t>(RemapAction::Count)> kRemapActionNames = {
+    "", "screenshot", "time slowdown toggle", "performance overlay toggle", "mute/unmute audio", "increase volume",
+    "decrease volume"};
+
+RemapAction get_remap_action_from_name(const std::string &action_name) {
+    for (size_t i = 1; i < kRemapActionNames.size(); ++i) {
+        if (action_name == kRemapActionNames[i]) {
+            return static_cast<RemapAction>(i);
+        }
+    }
+    return RemapAction::None;
+}
+
+const char *get_remap_action_name(RemapAction action) {
+    const size_t index = static_cast<size_t>(action);
+    return (index > 0 && index < kRemapActionNames.size()) ? kRemapActionNames[index] : "unknown";
+}
+
 std::vector<std::string> get_available_actions() {
-    return {"screenshot", "time slowdown toggle", "performance overlay toggle", "mute/unmute audio", "increase volume", "decrease volume"};
+    return {kRemapActionNames.begin() + 1, kRemapActionNames.end()};
 }
 } // namespace display_commander::input_remapping
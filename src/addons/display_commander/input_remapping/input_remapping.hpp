@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include "../utils/remap_dispatch.hpp"
+
 #include <Windows.h>
 #include <array>
 #include <atomic>
@@ -38,6 +40,18 @@ enum class RemapType : int {
     Count
 };
 
+// Actions a button can be remapped to; names are resolved to these when the dispatch table is built
+enum class RemapAction : uint16_t {
+    None = 0,
+    Screenshot = 1,
+    TimeSlowdownToggle = 2,
+    PerformanceOverlayToggle = 3,
+    MuteUnmute = 4,
+    IncreaseVolume = 5,
+    DecreaseVolume = 6,
+    Count
+};
+
 // Keyboard input methods
 enum class KeyboardInputMethod : int {
     SendInput = 0,   // Modern SendInput API
@@ -67,9 +81,6 @@ struct ButtonRemap {
     bool hold_mode;                            // If true, holds key/button while button pressed
     bool chord_mode;                           // If true, remapping only works when guide button is also pressed
     bool is_default_chord;                     // If true, this remap was added by default chords feature
-    std::atomic<bool> is_pressed{false};       // Current press state
-    std::atomic<ULONGLONG> last_press_time{0}; // Last press timestamp
-    std::atomic<uint64_t> trigger_count{0};    // Number of times this remapping was triggered
 
     ButtonRemap() = default;
 
@@ -90,37 +101,6 @@ struct ButtonRemap {
         : gamepad_button(btn), remap_type(RemapType::Action), keyboard_vk(0), keyboard_name(""),
           gamepad_target_button(0), action_name(action), enabled(en),
           input_method(KeyboardInputMethod::SendInput), hold_mode(hold), chord_mode(chord), is_default_chord(false) {}
-
-    // Copy constructor
-    ButtonRemap(const ButtonRemap &other)
-        : gamepad_button(other.gamepad_button), remap_type(other.remap_type),
-          keyboard_vk(other.keyboard_vk), keyboard_name(other.keyboard_name),
-          gamepad_target_button(other.gamepad_target_button), action_name(other.action_name),
-          enabled(other.enabled), input_method(other.input_method), hold_mode(other.hold_mode),
-          chord_mode(other.chord_mode), is_default_chord(other.is_default_chord),
-          is_pressed(other.is_pressed.load()), last_press_time(other.last_press_time.load()),
-          trigger_count(other.trigger_count.load()) {}
-
-    // Assignment operator
-    ButtonRemap &operator=(const ButtonRemap &other) {
-        if (this != &other) {
-            gamepad_button = other.gamepad_button;
-            remap_type = other.remap_type;
-            keyboard_vk = other.keyboard_vk;
-            keyboard_name = other.keyboard_name;
-            gamepad_target_button = other.gamepad_target_button;
-            action_name = other.action_name;
-            enabled = other.enabled;
-            input_method = other.input_method;
-            hold_mode = other.hold_mode;
-            chord_mode = other.chord_mode;
-            is_default_chord = other.is_default_chord;
-            is_pressed.store(other.is_pressed.load());
-            last_press_time.store(other.last_press_time.load());
-            trigger_count.store(other.trigger_count.load());
-        }
-        return *this;
-    }
 };
 
 // Main remapping manager class
@@ -171,6 +151,10 @@ class InputRemapper {
     void load_settings();
     void save_settings();
 
+    // Number of times the remap of a button fired since the last reset
+    uint64_t get_trigger_count(WORD gamepad_button) const;
+    void reset_trigger_counts();
+
     // Default chords initialization (generic system)
     void add_default_chords();
     void remove_default_chords();
@@ -188,38 +172,38 @@ class InputRemapper {
     bool send_keyboard_input_postmessage(int vk_code, bool key_down);
 
     // Helper functions
-    std::string get_button_name(WORD button) const;
+    const char *get_button_name(WORD button) const;
     std::string get_keyboard_name(int vk_code) const;
     int get_vk_code_from_name(const std::string &name) const;
     HWND get_active_window() const;
 
-    // Trigger counter functions
-    void increment_trigger_count(WORD gamepad_button);
-    uint64_t get_trigger_count(WORD gamepad_button) const;
-
-    // Button state tracking
-    void update_button_states(DWORD user_index, WORD button_state);
-    void handle_button_press(WORD gamepad_button, DWORD user_index, WORD current_button_state);
-    void handle_button_release(WORD gamepad_button, DWORD user_index, WORD current_button_state);
+    // Compile _remappings into a new dispatch table and publish it (exclusive lock held)
+    void rebuild_dispatch_table();
 
-    // Gamepad remapping - modify XINPUT_STATE
-    void apply_gamepad_remapping(DWORD user_index, XINPUT_STATE *state);
+    // Send the keyboard input / run the action of one remap edge
+    void dispatch_remap_event(const utils::RemapEvent &event, DWORD user_index);
 
     // Action execution
-    void execute_action(const std::string &action_name);
+    void execute_action(RemapAction action);
 
     // Settings
     std::atomic<bool> _remapping_enabled{false};
     std::atomic<bool> _initialized{false};
     KeyboardInputMethod _default_input_method{KeyboardInputMethod::SendInput};
 
-    // Remapping data
+    // Remapping data (edited under _srwlock; the XInput path only reads the published dispatch table)
     std::vector<ButtonRemap> _remappings;
     std::unordered_map<WORD, size_t> _button_to_remap_index;
 
-    // Button state tracking for each controller
-    std::array<std::atomic<WORD>, XUSER_MAX_COUNT> _previous_button_states;
-    std::array<std::atomic<WORD>, XUSER_MAX_COUNT> _current_button_states;
+    // Compiled remaps: writer copy of the last published table, and its lock-free publication
+    utils::RemapDispatchTable _dispatch_table;
+    utils::RemapTablePublisher _dispatch_tables;
+
+    // Button state machines for each controller
+    std::array<utils::RemapControllerSlot, XUSER_MAX_COUNT> _controller_states;
+
+    // Trigger counts by source button bit
+    std::array<std::atomic<uint64_t>, utils::kRemapButtonCount> _trigger_counts{};
 
     // Thread safety
     mutable SRWLOCK _srwlock = SRWLOCK_INIT;
@@ -233,6 +217,8 @@ void process_gamepad_input_for_remapping(DWORD user_index, XINPUT_STATE *state);
 // Utility functions
 std::string get_keyboard_input_method_name(KeyboardInputMethod method);
 std::string get_remap_type_name(RemapType type);
+RemapAction get_remap_action_from_name(const std::string &action_name);
+const char *get_remap_action_name(RemapAction action);
 std::vector<std::string> get_available_keyboard_input_methods();
 std::vector<std::string> get_available_gamepad_buttons();
 std::vector<std::string> get_available_keyboard_keys();
@@ -1,4 +1,5 @@
 #include "latent_sync_limiter.hpp"
+#include "../event_timeline.hpp"
 #include "../globals.hpp"
 #include "../settings/main_tab_settings.hpp"
 #include "../utils/logging.hpp"
@@ -7,11 +8,8 @@
 
 static uint64_t s_last_scan_time = 0;
 
-HANDLE m_timer_handle = nullptr;
-
 namespace dxgi::fps_limiter {
 std::atomic<LONGLONG> ns_per_refresh{0};
-std::atomic<double> correction_lines_delta{0};
 std::atomic<double> m_on_present_ns{0.0};
 
 extern long double expected_current_scanline_uncapped_ns(LONGLONG now_ns, LONGLONG total_height, bool add_correction);
@@ -163,7 +161,12 @@ void LatentSyncLimiter::LimitFrameRate() {
             LogError("LatentSyncLimiter::LimitFrameRate: delta_wait_time_ns > utils::SEC_TO_NS");
             return;
         }
-        utils::wait_until_ns(wait_target_ns, m_timer_handle);
+        const LONGLONG wait_start_ns = g_event_timeline.IsEnabled() ? utils::get_now_ns() : 0;
+        utils::wait_until_ns_precise(wait_target_ns);
+        const LONGLONG wake_ns = utils::get_now_ns();
+        g_frame_trace.Record(utils::FrameTraceEvent::kLimiterWait, g_global_frame_id.load(), wake_ns, wait_target_ns);
+        g_event_timeline.Record(utils::TimelineEvent::kLimiterSleep, wait_start_ns, wake_ns, g_global_frame_id.load(),
+                                wake_ns - wait_target_ns);
     }
     last_wait_target_ns = utils::get_now_ns();
 }
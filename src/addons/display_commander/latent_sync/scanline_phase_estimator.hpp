@@ -0,0 +1,198 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace dxgi::fps_limiter {
+
+// Linear scanline model: scanline(t) = reference_scanline + (t - reference_ns) * lines_per_ns (mod total height).
+// reference_scanline is continuous (counts whole refreshes), so models published at different times agree on
+// the uncapped scanline and can be mixed within one limiter step.
+struct ScanlinePhaseModel {
+    int64_t reference_ns = 0;
+    double reference_scanline = 0.0;
+    double lines_per_ns = 0.0;
+
+    // Continuous (not wrapped) scanline position at time t
+    double UncappedScanlineAt(int64_t t_ns) const {
+        return reference_scanline + static_cast<double>(t_ns - reference_ns) * lines_per_ns;
+    }
+};
+
+/**
+ * Two-state Kalman filter tracking the scanout phase (scanline) and its rate (lines per ns).
+ *
+ * The rate is learned from the samples, so the refresh period reported by the OS (vsync numerator /
+ * denominator) only seeds the filter and real pixel-clock drift is tracked. Each sample carries the
+ * duration of the scanline query: the scanline was read somewhere in that window, so long (preempted)
+ * calls are weighted down instead of being dropped by a fixed threshold. Innovations beyond the gate are
+ * rejected as outliers; a long run of rejections means the display changed and the filter relocks.
+ *
+ * Once the phase uncertainty is below the lock threshold, SuggestedPollIntervalNs() grows so the
+ * monitoring thread can poll an order of magnitude less often.
+ */
+class ScanlinePhaseEstimator {
+  public:
+    struct Config {
+        double phase_noise_lines_per_sqrt_s = 0.2;  // random-walk jitter of the phase
+        double rate_drift_ppm_per_sqrt_s = 1.0;     // random-walk drift of the pixel clock
+        double initial_rate_uncertainty_ppm = 2000; // trust in the OS-reported refresh period
+        double quantization_sigma_lines = 0.5;      // scanline reads are integers
+        double gate_sigma = 5.0;                    // reject innovations beyond this many sigmas
+        uint32_t max_consecutive_rejects = 32;      // relock after this many outliers in a row
+        double lock_phase_sigma_lines = 1.0;
+        uint32_t lock_min_samples = 200;
+        int64_t unlocked_poll_interval_ns = 100'000;  // 0.1 ms while acquiring
+        int64_t locked_poll_interval_ns = 2'000'000;  // 2 ms once locked
+    };
+
+    ScanlinePhaseEstimator() = default;
+    explicit ScanlinePhaseEstimator(const Config &config) : config_(config) {}
+
+    // Start over for a display with the given total height (active + blanking) and nominal refresh period
+    void Reset(int64_t total_height, double nominal_period_ns) {
+        total_height_ = static_cast<double>(total_height);
+        nominal_lines_per_ns_ = (nominal_period_ns > 0.0) ? total_height_ / nominal_period_ns : 0.0;
+        initialized_ = false;
+        locked_ = false;
+        accepted_ = 0;
+        rejected_ = 0;
+        consecutive_rejects_ = 0;
+
+        const double rate_sigma = nominal_lines_per_ns_ * config_.rate_drift_ppm_per_sqrt_s * 1e-6;
+        q_phase_ = config_.phase_noise_lines_per_sqrt_s * config_.phase_noise_lines_per_sqrt_s / 1e9;
+        q_rate_ = rate_sigma * rate_sigma / 1e9;
+    }
+
+    bool IsConfigured() const { return total_height_ > 0.0 && nominal_lines_per_ns_ > 0.0; }
+
+    // Feed one scanline read taken in [timestamp_ns - window_ns / 2, timestamp_ns + window_ns / 2].
+    // Returns false if the sample was rejected as an outlier (or the estimator is not configured).
+    bool Observe(int64_t timestamp_ns, double scanline, int64_t window_ns = 0) {
+        if (!IsConfigured()) {
+            return false;
+        }
+        if (!initialized_) {
+            Initialize(timestamp_ns, scanline, window_ns);
+            return true;
+        }
+
+        Predict(timestamp_ns);
+
+        const double r = MeasurementVariance(window_ns);
+        const double innovation = Wrap(scanline - phase_);
+        const double s = p00_ + r;
+        if (innovation * innovation > config_.gate_sigma * config_.gate_sigma * s) {
+            ++rejected_;
+            if (++consecutive_rejects_ >= config_.max_consecutive_rejects) {
+                Initialize(timestamp_ns, scanline, window_ns);
+            }
+            return false;
+        }
+        consecutive_rejects_ = 0;
+
+        const double k0 = p00_ / s;
+        const double k1 = p01_ / s;
+        phase_ += k0 * innovation;
+        rate_ += k1 * innovation;
+        const double p00 = p00_;
+        const double p01 = p01_;
+        p00_ = (1.0 - k0) * p00;
+        p01_ = (1.0 - k0) * p01;
+        p11_ -= k1 * p01;
+
+        ++accepted_;
+        locked_ = accepted_ >= config_.lock_min_samples && std::sqrt(p00_) <= config_.lock_phase_sigma_lines;
+        return true;
+    }
+
+    // Predicted scanline in [0, total_height) at time t
+    double PredictScanline(int64_t t_ns) const {
+        return WrapPositive(phase_ + static_cast<double>(t_ns - timestamp_ns_) * rate_);
+    }
+
+    ScanlinePhaseModel GetModel() const { return {timestamp_ns_, phase_, rate_}; }
+
+    bool IsLocked() const { return locked_; }
+    double GetPeriodNs() const { return (rate_ > 0.0) ? total_height_ / rate_ : 0.0; }
+    double GetPhaseSigmaLines() const { return std::sqrt((std::max)(p00_, 0.0)); }
+    // Deviation of the measured refresh period from the OS-reported one
+    double GetRateErrorPpm() const {
+        return (nominal_lines_per_ns_ > 0.0 && rate_ > 0.0) ? (nominal_lines_per_ns_ / rate_ - 1.0) * 1e6 : 0.0;
+    }
+    uint64_t GetAcceptedCount() const { return accepted_; }
+    uint64_t GetRejectedCount() const { return rejected_; }
+
+    int64_t SuggestedPollIntervalNs() const {
+        return locked_ ? config_.locked_poll_interval_ns : config_.unlocked_poll_interval_ns;
+    }
+
+  private:
+    void Initialize(int64_t timestamp_ns, double scanline, int64_t window_ns) {
+        const double rate_sigma = nominal_lines_per_ns_ * config_.initial_rate_uncertainty_ppm * 1e-6;
+        if (initialized_) {
+            // Relock: jump to the measured phase but keep counting refreshes from the previous estimate
+            Predict(timestamp_ns);
+            phase_ += Wrap(scanline - phase_);
+        } else {
+            phase_ = WrapPositive(scanline);
+        }
+        timestamp_ns_ = timestamp_ns;
+        rate_ = nominal_lines_per_ns_;
+        p00_ = MeasurementVariance(window_ns);
+        p01_ = 0.0;
+        p11_ = rate_sigma * rate_sigma;
+        initialized_ = true;
+        locked_ = false;
+        accepted_ = 0;
+        consecutive_rejects_ = 0;
+    }
+
+    void Predict(int64_t timestamp_ns) {
+        const double dt = static_cast<double>(timestamp_ns - timestamp_ns_);
+        timestamp_ns_ = timestamp_ns;
+        phase_ += rate_ * dt;
+
+        // P = F P F^T + Q for F = [[1, dt], [0, 1]] with white phase noise and random-walk rate
+        const double adt = std::abs(dt);
+        p00_ += 2.0 * dt * p01_ + dt * dt * p11_ + q_phase_ * adt + q_rate_ * adt * adt * adt / 3.0;
+        p01_ += dt * p11_ + q_rate_ * dt * adt / 2.0;
+        p11_ += q_rate_ * adt;
+    }
+
+    // The read happened uniformly somewhere in the call window
+    double MeasurementVariance(int64_t window_ns) const {
+        const double window_lines = static_cast<double>(window_ns) * nominal_lines_per_ns_;
+        return window_lines * window_lines / 12.0 + config_.quantization_sigma_lines * config_.quantization_sigma_lines;
+    }
+
+    // Map to [-total_height / 2, total_height / 2)
+    double Wrap(double lines) const {
+        return lines - total_height_ * std::floor(lines / total_height_ + 0.5);
+    }
+
+    // Map to [0, total_height)
+    double WrapPositive(double lines) const { return lines - total_height_ * std::floor(lines / total_height_); }
+
+    Config config_;
+    double total_height_ = 0.0;
+    double nominal_lines_per_ns_ = 0.0;
+    double q_phase_ = 0.0;
+    double q_rate_ = 0.0;
+
+    bool initialized_ = false;
+    bool locked_ = false;
+    int64_t timestamp_ns_ = 0;
+    double phase_ = 0.0;  // lines, continuous (not wrapped)
+    double rate_ = 0.0;   // lines per ns
+    double p00_ = 0.0;
+    double p01_ = 0.0;
+    double p11_ = 0.0;
+
+    uint64_t accepted_ = 0;
+    uint64_t rejected_ = 0;
+    uint32_t consecutive_rejects_ = 0;
+};
+
+} // namespace dxgi::fps_limiter
@@ -5,6 +5,7 @@
 #include "../utils/logging.hpp"
 #include "utils/timing.hpp"
 #include <dxgi1_6.h>
+#include <cmath>
 #include <iostream>
 #include <sstream>
 #include <winnt.h>
@@ -15,9 +16,10 @@ extern std::atomic<HWND> g_last_swapchain_hwnd;
 namespace dxgi::fps_limiter {
 std::atomic<LONGLONG> g_latent_sync_total_height{0};
 std::atomic<LONGLONG> g_latent_sync_active_height{0};
+ScanlinePhaseModelCell g_scanline_phase_model;
+std::atomic<bool> g_latent_sync_phase_locked{false};
 
 extern std::atomic<LONGLONG> ns_per_refresh;
-extern std::atomic<double> correction_lines_delta;
 } // namespace dxgi::fps_limiter
 
 // Simple logging wrapper to avoid dependency issues
@@ -27,18 +29,6 @@ void LogMessage(const std::string &msg) { std::cout << "[VBlankMonitor] " << msg
 
 namespace dxgi::fps_limiter {
 
-// Helper function to normalize a value using modulo arithmetic to range [-range/2, range/2]
-long VBlankMonitor::fmod_normalized(long double value, long range) {
-    long result = static_cast<long>(fmod(value, static_cast<long double>(range)));
-    if (result > range / 2) {
-        result -= range;
-    }
-    if (result < -range / 2) {
-        result += range;
-    }
-    return result;
-}
-
 // Helper function to get the correct DisplayTimingInfo for a specific window
 DisplayTimingInfo GetDisplayTimingInfoForWindow(HWND hwnd) {
     if (hwnd == nullptr) {
@@ -351,11 +341,13 @@ bool VBlankMonitor::EnsureAdapterBinding() {
 }
 
 long double expected_current_scanline_uncapped_ns(LONGLONG now_ns, LONGLONG total_height, bool add_correction) {
-    long double cur_scanline = 1.0L * total_height * now_ns / ns_per_refresh.load();
     if (add_correction) {
-        cur_scanline += correction_lines_delta.load();
+        ScanlinePhaseModelCell::Entry entry;
+        if (g_scanline_phase_model.ReadLatest(entry)) {
+            return entry.value.UncappedScanlineAt(now_ns);
+        }
     }
-    return cur_scanline;
+    return 1.0L * total_height * now_ns / ns_per_refresh.load();
 }
 
 void VBlankMonitor::MonitoringThread() {
@@ -420,11 +412,10 @@ void VBlankMonitor::MonitoringThread() {
         }
     }
 
-    LONGLONG min_scanline_duration_ns = 0;
-    LONGLONG correction_ticks_local = 0;
     LONGLONG last_display_timing_refresh_ns = 0;
+    LONGLONG configured_total_height = 0;
+    LONGLONG configured_ns_per_refresh = 0;
 
-    int lastScanLine = 0;
     while (!m_should_stop.load()) {
         // auto switch to the correct monitor
         {
@@ -440,11 +431,20 @@ void VBlankMonitor::MonitoringThread() {
                     LogInfo("Switching monitors, refreshing adapter binding...");
                     UpdateDisplayBindingFromWindow(hwnd);
                 }
-                // Use the current display timing info for calculations
-                ns_per_refresh.store((current_display_timing.vsync_freq_numerator > 0)
-                                         ? (current_display_timing.vsync_freq_denominator * utils::SEC_TO_NS) /
-                                               (current_display_timing.vsync_freq_numerator)
-                                         : 1);
+                // The reported refresh rate only seeds the phase estimator, which measures the real period
+                LONGLONG nominal_ns_per_refresh = (current_display_timing.vsync_freq_numerator > 0)
+                                                      ? (current_display_timing.vsync_freq_denominator * utils::SEC_TO_NS) /
+                                                            (current_display_timing.vsync_freq_numerator)
+                                                      : 1;
+                if (nominal_ns_per_refresh != configured_ns_per_refresh
+                    || current_display_timing.total_height != configured_total_height) {
+                    configured_ns_per_refresh = nominal_ns_per_refresh;
+                    configured_total_height = current_display_timing.total_height;
+                    m_phase_estimator.Reset(configured_total_height, static_cast<double>(nominal_ns_per_refresh));
+                    g_scanline_phase_model.Reset();
+                    g_latent_sync_phase_locked.store(false);
+                    ns_per_refresh.store(nominal_ns_per_refresh);
+                }
 
                 g_latent_sync_total_height.store(current_display_timing.total_height);
                 g_latent_sync_active_height.store(current_display_timing.active_height);
@@ -465,36 +465,21 @@ void VBlankMonitor::MonitoringThread() {
             auto nt_status = reinterpret_cast<NTSTATUS(WINAPI *)(D3DKMT_GETSCANLINE *)>(m_pfnGetScanLine)(&scan);
             LONGLONG end_ns = utils::get_now_ns();
 
-            long double expected_scanline_tmp =
-                expected_current_scanline_uncapped_ns(start_ns, current_display_timing.total_height, true);
             if (nt_status == STATUS_SUCCESS) {
-                LONGLONG duration_ns = end_ns - start_ns;
-                LONGLONG mid_point_ns =
-                    (start_ns + end_ns) / 2; // TODO: all values could be multipled by 2 for better precision
-
-                // shortest encountered duration
-                if (min_scanline_duration_ns == 0 || duration_ns < min_scanline_duration_ns) {
-                    min_scanline_duration_ns = duration_ns;
-                }
-                if (duration_ns < 2 * min_scanline_duration_ns) {
-                    long double expected_scanline =
-                        expected_current_scanline_uncapped_ns(mid_point_ns, current_display_timing.total_height, false);
-                    long double new_correction_lines_delta =
-                        fmod(scan.ScanLine - expected_scanline, (long double)(current_display_timing.total_height));
-                    if (new_correction_lines_delta < 0) {
-                        new_correction_lines_delta += current_display_timing.total_height;
+                // The scanline was read somewhere in [start, end]; the estimator weights the sample by that window
+                LONGLONG mid_point_ns = start_ns + (end_ns - start_ns) / 2;
+                if (m_phase_estimator.Observe(mid_point_ns, static_cast<double>(scan.ScanLine), end_ns - start_ns)) {
+                    g_scanline_phase_model.Push(m_phase_estimator.GetModel(), static_cast<uint64_t>(mid_point_ns));
+                    const bool locked = m_phase_estimator.IsLocked();
+                    if (locked) {
+                        ns_per_refresh.store(std::llround(m_phase_estimator.GetPeriodNs()));
                     }
-                    long dt = fmod_normalized(new_correction_lines_delta - correction_lines_delta.load(),
-                                              current_display_timing.total_height);
-
-                    double alpha = 0.1;
-                    correction_lines_delta.store(correction_lines_delta.load() + dt * alpha);
+                    g_latent_sync_phase_locked.store(locked);
                 }
             }
 
-            std::this_thread::sleep_for(std::chrono::microseconds(100)); // 0.1ms
-
-            lastScanLine = expected_scanline_tmp;
+            // Poll at 0.1 ms while acquiring, much less often once the phase is locked
+            std::this_thread::sleep_for(std::chrono::nanoseconds(m_phase_estimator.SuggestedPollIntervalNs()));
         }
     }
 
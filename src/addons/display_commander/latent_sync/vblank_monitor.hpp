@@ -1,5 +1,8 @@
 #pragma once
 
+#include "../utils/seqlock_ring.hpp"
+#include "scanline_phase_estimator.hpp"
+
 #include <atomic>
 #include <chrono>
 #include <string>
@@ -58,6 +61,11 @@ extern std::atomic<LONGLONG> ns_per_refresh;
 extern std::atomic<LONGLONG> g_latent_sync_total_height;
 extern std::atomic<LONGLONG> g_latent_sync_active_height;
 
+// Latest scanline phase model published by the monitoring thread (single writer, lock-free readers)
+using ScanlinePhaseModelCell = utils::SeqlockRing<ScanlinePhaseModel, 4>;
+extern ScanlinePhaseModelCell g_scanline_phase_model;
+extern std::atomic<bool> g_latent_sync_phase_locked;
+
 // Helper function to get the correct DisplayTimingInfo for a specific window
 DisplayTimingInfo GetDisplayTimingInfoForWindow(HWND hwnd);
 
@@ -100,9 +108,6 @@ class VBlankMonitor {
         return slot;
     }
 
-    // Helper function to normalize a value using modulo arithmetic to range [-range/2, range/2]
-    static long fmod_normalized(long double value, long range);
-
   private:
     // Sentinel for uninitialized/invalid VidPn source id
     static constexpr D3DDDI_VIDEO_PRESENT_SOURCE_ID kInvalidVidPnSource =
@@ -113,6 +118,9 @@ class VBlankMonitor {
     std::atomic<bool> m_monitoring{false};
     std::atomic<bool> m_should_stop{false};
 
+    // Scanline phase / refresh period tracking (monitoring thread only)
+    ScanlinePhaseEstimator m_phase_estimator;
+
     // Display binding
     D3DKMT_HANDLE m_hAdapter = 0;
     D3DDDI_VIDEO_PRESENT_SOURCE_ID m_vidpn_source_id = kInvalidVidPnSource;
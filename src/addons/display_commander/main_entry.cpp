@@ -2,6 +2,7 @@
 #include "autoclick/autoclick_manager.hpp"
 #include "config/display_commander_config.hpp"
 #include "dx11_proxy/dx11_proxy_manager.hpp"
+#include "event_timeline.hpp"
 #include "exit_handler.hpp"
 #include "globals.hpp"
 #include "gpu_completion_monitoring.hpp"
@@ -9,6 +10,7 @@
 #include "hooks/hid_suppression_hooks.hpp"
 #include "hooks/timeslowdown_hooks.hpp"
 #include "hooks/window_proc_hooks.hpp"
+#include "hooks/xinput_hooks.hpp"
 #include "latency/latency_manager.hpp"
 #include "latent_sync/refresh_rate_monitor_integration.hpp"
 #include "nvapi/nvapi_fullscreen_prevention.hpp"
@@ -23,6 +25,7 @@
 #include "ui/new_ui/experimental_tab.hpp"
 #include "ui/new_ui/main_new_tab.hpp"
 #include "ui/new_ui/new_ui_main.hpp"
+#include "utils/display_commander_logger.hpp"
 #include "utils/logging.hpp"
 #include "utils/timing.hpp"
 #include "version.hpp"
@@ -263,23 +266,20 @@ void OnReShadeOverlayTest(reshade::api::effect_runtime* runtime) {
     }
 
     if (show_fps_counter) {
-        const uint32_t head = ::g_perf_ring_head.load(std::memory_order_acquire);
         double total_time = 0.0;
 
         // Iterate through samples from the last second
         uint32_t sample_count = 0;
 
         // Iterate backwards through the ring buffer up to 1 second
-        for (uint32_t i = 0; i < ::kPerfRingCapacity; ++i) {
-            uint32_t idx = (head - 1 - i) & (::kPerfRingCapacity - 1);
-            const ::PerfSample& sample = ::g_perf_ring[idx];
-
+        ::g_perf_ring.ForEachNewestFirst([&](const ::PerfSample& sample, uint64_t /*timestamp_ns*/) {
             // not enough data yet
-            if (sample.dt == 0.0f || total_time >= 1.0) break;
+            if (sample.dt == 0.0f || total_time >= 1.0) return false;
 
             sample_count++;
             total_time += sample.dt;
-        }
+            return true;
+        });
 
         // Calculate average
         if (sample_count > 0 && total_time >= 1.0) {
@@ -334,10 +334,9 @@ void OnReShadeOverlayTest(reshade::api::effect_runtime* runtime) {
     if (show_cpu_usage) {
         // Calculate CPU usage: (sim_duration / frame_time) * 100%
         // Get most recent frame time from performance ring buffer
-        const uint32_t head = ::g_perf_ring_head.load(std::memory_order_acquire);
-        if (head > 0) {
-            const uint32_t last_idx = (head - 1) & (::kPerfRingCapacity - 1);
-            const ::PerfSample& last_sample = ::g_perf_ring[last_idx];
+        ::PerfRing::Entry last_entry;
+        if (::g_perf_ring.ReadLatest(last_entry)) {
+            const ::PerfSample& last_sample = last_entry.value;
 
             if (last_sample.dt > 0.0f) {
                 // Get simulation duration in nanoseconds
@@ -1073,6 +1072,9 @@ BOOL APIENTRY DllMain(HMODULE h_module, DWORD fdw_reason, LPVOID lpv_reserved) {
             LogInfo("Display Commander v%s - ReShade addon registration successful (API version 17 supported)",
                     DISPLAY_COMMANDER_VERSION_STRING);
 
+            // Format deferred (hot path) log records in the background from now on
+            StartDeferredLogWriter();
+
             // Register overlay early so it appears as a tab by default
             reshade::register_overlay("Display Commander", OnRegisterOverlayDisplayCommander);
             LogInfo("Display Commander overlay registered");
@@ -1124,6 +1126,9 @@ BOOL APIENTRY DllMain(HMODULE h_module, DWORD fdw_reason, LPVOID lpv_reserved) {
             // Clean up continuous monitoring if it's running
             StopContinuousMonitoring();
             StopGPUCompletionMonitoring();
+            display_commanderhooks::StopXInputSampler();
+            StopDeferredLogWriter();
+            ShutdownEventTimeline();
 
             // Clean up refresh rate monitoring
             dxgi::fps_limiter::StopRefreshRateMonitoring();
@@ -1166,6 +1171,12 @@ BOOL APIENTRY DllMain(HMODULE h_module, DWORD fdw_reason, LPVOID lpv_reserved) {
                 g_hmodule = nullptr;
             }
 
+            // Write pending settings and join the config saver thread
+            display_commander::config::shutdown_config();
+
+            // Flush the log and join its writer thread last, so the messages above still reach the file
+            display_commander::logger::Shutdown();
+
             reshade::unregister_addon(h_module);
 
             break;
@@ -1,4 +1,5 @@
 #include "reflex_manager.hpp"
+#include "../event_timeline.hpp"
 #include "../globals.hpp"
 #include "../settings/main_tab_settings.hpp"
 #include "../utils.hpp"
@@ -115,6 +116,9 @@ bool ReflexManager::SetMarker(NV_LATENCY_MARKER_TYPE marker) {
     mp.version = NV_LATENCY_MARKER_PARAMS_VER;
     mp.markerType = marker;
     mp.frameID = g_global_frame_id.load(std::memory_order_acquire);
+    if (g_event_timeline.IsEnabled()) {
+        g_event_timeline.RecordInstant(utils::TimelineEvent::kReflexMarker, utils::get_now_ns(), mp.frameID, marker);
+    }
 
     const auto st = NvAPI_D3D_SetLatencyMarker_Direct(d3d_device_, &mp);
     if (st != NVAPI_OK) {
@@ -1,4 +1,5 @@
 #include "developer_tab_settings.hpp"
+#include "../event_timeline.hpp"
 #include "../globals.hpp"
 
 #include <minwindef.h>
@@ -93,7 +94,8 @@ DeveloperTabSettings::DeveloperTabSettings()
       suppress_minhook("SuppressMinhook", false, "DisplayCommander"),
       debug_layer_enabled("DebugLayerEnabled", false, "DisplayCommander"),
       debug_break_on_severity("DebugBreakOnSeverity", false, "DisplayCommander"),
-      auto_hide_discord_overlay("AutoHideDiscordOverlay", true, "DisplayCommander") {}
+      auto_hide_discord_overlay("AutoHideDiscordOverlay", true, "DisplayCommander"),
+      event_timeline("EventTimeline", false, "DisplayCommander") {}
 
 void DeveloperTabSettings::LoadAll() {
     // Get all settings for smart logging
@@ -103,6 +105,7 @@ void DeveloperTabSettings::LoadAll() {
     ui::new_ui::LoadTabSettingsWithSmartLogging(all_settings, "Developer Tab");
 
     // All Ref classes automatically sync with global variables
+    g_event_timeline.SetEnabled(event_timeline.GetValue());
 }
 
 void DeveloperTabSettings::SaveAll() {
@@ -119,6 +122,7 @@ void DeveloperTabSettings::SaveAll() {
     debug_layer_enabled.Save();
     debug_break_on_severity.Save();
     auto_hide_discord_overlay.Save();
+    event_timeline.Save();
 
     // All Ref classes automatically save when values change
 }
@@ -135,7 +139,7 @@ std::vector<ui::new_ui::SettingBase*> DeveloperTabSettings::GetAllSettings() {
             &enable_hotkeys, &enable_mute_unmute_shortcut, &enable_background_toggle_shortcut, &enable_timeslowdown_shortcut,
             &enable_adhd_toggle_shortcut, &enable_autoclick_shortcut, &enable_input_blocking_shortcut, &enable_display_commander_ui_shortcut, &enable_performance_overlay_shortcut, &safemode, &load_from_dll_main, &load_streamline,
             &load_nvngx, &load_nvapi64, &fake_nvapi_enabled, &suppress_minhook, &debug_layer_enabled,
-            &debug_break_on_severity, &auto_hide_discord_overlay};
+            &debug_break_on_severity, &auto_hide_discord_overlay, &event_timeline};
 }
 
 }  // namespace settings
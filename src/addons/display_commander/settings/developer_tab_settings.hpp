@@ -91,6 +91,9 @@ class DeveloperTabSettings {
     // Discord Overlay auto-hide setting
     BoolSetting auto_hide_discord_overlay;
 
+    // Frame event timeline (Chrome trace / Perfetto dumps)
+    BoolSetting event_timeline;
+
     // Get all settings for bulk operations
     std::vector<SettingBase*> GetAllSettings();
 };
@@ -1,5 +1,7 @@
 #include "experimental_tab_settings.hpp"
+#include "../config/display_commander_config.hpp"
 #include "../globals.hpp"
+#include "../utils/logging.hpp"
 
 namespace settings {
 
@@ -28,13 +30,21 @@ ExperimentalTabSettings::ExperimentalTabSettings()
         "Upgrade Custom Resolution"
     }, "DisplayCommander.Experimental")
     , texture_format_upgrade_enabled("TextureFormatUpgradeEnabled", false, "DisplayCommander.Experimental")
-    , sleep_hook_enabled("SleepHookEnabled", false, "DisplayCommander.Experimental")
-    , sleep_multiplier("SleepMultiplier", 1.0f, 0.1f, 10.0f, "DisplayCommander.Experimental")
-    , min_sleep_duration_ms("MinSleepDurationMs", 0, 0, 10000, "DisplayCommander.Experimental")
-    , max_sleep_duration_ms("MaxSleepDurationMs", 0, 0, 10000, "DisplayCommander.Experimental")
-    , timeslowdown_enabled("TimeslowdownEnabled", false, "DisplayCommander.Experimental")
-    , timeslowdown_compatibility_mode("TimeslowdownCompatibilityMode", false, "DisplayCommander.Experimental")
-    , timeslowdown_multiplier("TimeslowdownMultiplier", 1.0f, 0.1f, 10.0f, "DisplayCommander.Experimental")
+    , sleep_hook_enabled("SleepHookEnabled", g_experimental_hot_settings.Atomic(kSleepHookEnabled), false,
+                         "DisplayCommander.Experimental")
+    , sleep_multiplier("SleepMultiplier", g_experimental_hot_settings.Atomic(kSleepMultiplier), 1.0f, 0.1f, 10.0f,
+                       "DisplayCommander.Experimental")
+    , min_sleep_duration_ms("MinSleepDurationMs", g_experimental_hot_settings.Atomic(kMinSleepDurationMs), 0, 0, 10000,
+                            "DisplayCommander.Experimental")
+    , max_sleep_duration_ms("MaxSleepDurationMs", g_experimental_hot_settings.Atomic(kMaxSleepDurationMs), 0, 0, 10000,
+                            "DisplayCommander.Experimental")
+    , timeslowdown_enabled("TimeslowdownEnabled", g_experimental_hot_settings.Atomic(kTimeslowdownEnabled), false,
+                           "DisplayCommander.Experimental")
+    , timeslowdown_compatibility_mode("TimeslowdownCompatibilityMode",
+                                      g_experimental_hot_settings.Atomic(kTimeslowdownCompatibilityMode), false,
+                                      "DisplayCommander.Experimental")
+    , timeslowdown_multiplier("TimeslowdownMultiplier", g_experimental_hot_settings.Atomic(kTimeslowdownMultiplier),
+                              1.0f, 0.1f, 10.0f, "DisplayCommander.Experimental")
     , timeslowdown_max_multiplier("TimeslowdownMaxMultiplier", 10.0f, 1.0f, 1000.0f, "DisplayCommander.Experimental")
     , query_performance_counter_hook("QueryPerformanceCounterHook", 0, {
         "None",
@@ -99,8 +109,7 @@ ExperimentalTabSettings::ExperimentalTabSettings()
         &buffer_resolution_upgrade_enabled, &buffer_resolution_upgrade_width, &buffer_resolution_upgrade_height,
         &buffer_resolution_upgrade_scale_factor, &buffer_resolution_upgrade_mode,
         &texture_format_upgrade_enabled,
-        &sleep_hook_enabled, &sleep_multiplier, &min_sleep_duration_ms, &max_sleep_duration_ms,
-        &timeslowdown_enabled, &timeslowdown_compatibility_mode, &timeslowdown_multiplier, &timeslowdown_max_multiplier,
+        &timeslowdown_max_multiplier,
         &query_performance_counter_hook, &get_tick_count_hook, &get_tick_count64_hook,
         &time_get_time_hook, &get_system_time_hook,
         &get_system_time_as_file_time_hook, &get_system_time_precise_as_file_time_hook,
@@ -120,20 +129,34 @@ ExperimentalTabSettings::ExperimentalTabSettings()
 }
 
 void ExperimentalTabSettings::LoadAll() {
-    // Load max multiplier first to ensure proper range validation for the multiplier
-    timeslowdown_max_multiplier.Load();
+    LoadTabSettingsWithSmartLogging(all_settings_, "Experimental Tab");
 
-    // Set the max range for the multiplier before loading it
-    timeslowdown_multiplier.SetMax(timeslowdown_max_multiplier.GetValue());
-
-    // Load all other settings (excluding max multiplier since we already loaded it)
-    std::vector<SettingBase *> settings_to_load;
-    for (auto *setting : all_settings_) {
-        if (setting != &timeslowdown_max_multiplier) {
-            settings_to_load.push_back(setting);
+    // Hot settings in one pass over the schema
+    const size_t non_default = g_experimental_hot_settings.LoadAll(
+        [](const char *section, const char *key, std::string &text) {
+            return display_commander::config::get_config_value(section, key, text);
+        },
+        [](const char *section, const char *key, const std::string &text) {
+            display_commander::config::set_config_value(section, key, text);
+        });
+    if (non_default > 0) {
+        LogInfo("Experimental Tab hot settings loaded - %zu non-default values:", non_default);
+        for (size_t i = 0; i < ExperimentalHotSettings::kCount; ++i) {
+            if (!g_experimental_hot_settings.IsDefault(i)) {
+                LogInfo("  %s %s", ExperimentalHotSettings::Def(i).key, g_experimental_hot_settings.ValueAsString(i).c_str());
+            }
         }
+    } else {
+        LogInfo("Experimental Tab hot settings loaded - all values at default");
+    }
+
+    // The multiplier range follows the max multiplier
+    timeslowdown_multiplier.SetMax(timeslowdown_max_multiplier.GetValue());
+    if (timeslowdown_multiplier.GetValue() > timeslowdown_multiplier.GetMax()) {
+        g_experimental_hot_settings.Set(kTimeslowdownMultiplier, timeslowdown_multiplier.GetDefaultValue());
+        timeslowdown_multiplier.Save();
     }
-    LoadTabSettingsWithSmartLogging(settings_to_load, "Experimental Tab");
+    ui::new_ui::g_settings_change_bus.Publish("DisplayCommander.Experimental", std::string_view());
 }
 
 std::vector<SettingBase*> ExperimentalTabSettings::GetAllSettings() {
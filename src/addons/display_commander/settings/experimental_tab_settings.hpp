@@ -1,11 +1,39 @@
 #pragma once
 
 #include "../ui/new_ui/settings_wrapper.hpp"
+#include "../utils/settings_registry.hpp"
 
+#include <array>
 #include <vector>
 
 namespace settings {
 
+// Experimental settings read by hooks on every call or frame (Sleep detours, timeslowdown). They live in one
+// flat atomic table with compile-time IDs; the wrappers below bind to its slots for the UI.
+inline constexpr std::array<utils::SettingDef, 7> kExperimentalHotSettingDefs = {{
+    utils::BoolSettingDef("DisplayCommander.Experimental", "SleepHookEnabled", false),
+    utils::FloatSettingDef("DisplayCommander.Experimental", "SleepMultiplier", 1.0f, 0.1f, 10.0f),
+    utils::IntSettingDef("DisplayCommander.Experimental", "MinSleepDurationMs", 0, 0, 10000),
+    utils::IntSettingDef("DisplayCommander.Experimental", "MaxSleepDurationMs", 0, 0, 10000),
+    utils::BoolSettingDef("DisplayCommander.Experimental", "TimeslowdownEnabled", false),
+    utils::BoolSettingDef("DisplayCommander.Experimental", "TimeslowdownCompatibilityMode", false),
+    // Upper bound of TimeslowdownMaxMultiplier; the UI clamps to the current max multiplier
+    utils::FloatSettingDef("DisplayCommander.Experimental", "TimeslowdownMultiplier", 1.0f, 0.1f, 1000.0f),
+}};
+
+inline constexpr auto kSleepHookEnabled = utils::MakeSettingId<bool>(kExperimentalHotSettingDefs, "SleepHookEnabled");
+inline constexpr auto kSleepMultiplier = utils::MakeSettingId<float>(kExperimentalHotSettingDefs, "SleepMultiplier");
+inline constexpr auto kMinSleepDurationMs = utils::MakeSettingId<int>(kExperimentalHotSettingDefs, "MinSleepDurationMs");
+inline constexpr auto kMaxSleepDurationMs = utils::MakeSettingId<int>(kExperimentalHotSettingDefs, "MaxSleepDurationMs");
+inline constexpr auto kTimeslowdownEnabled = utils::MakeSettingId<bool>(kExperimentalHotSettingDefs, "TimeslowdownEnabled");
+inline constexpr auto kTimeslowdownCompatibilityMode =
+    utils::MakeSettingId<bool>(kExperimentalHotSettingDefs, "TimeslowdownCompatibilityMode");
+inline constexpr auto kTimeslowdownMultiplier =
+    utils::MakeSettingId<float>(kExperimentalHotSettingDefs, "TimeslowdownMultiplier");
+
+using ExperimentalHotSettings = utils::SettingsTable<kExperimentalHotSettingDefs>;
+extern ExperimentalHotSettings g_experimental_hot_settings;
+
 // Bring setting types into scope
 using ui::new_ui::BoolSetting;
 using ui::new_ui::BoolSettingRef;
@@ -14,6 +42,7 @@ using ui::new_ui::FixedIntArraySetting;
 using ui::new_ui::FloatSetting;
 using ui::new_ui::FloatSettingRef;
 using ui::new_ui::IntSetting;
+using ui::new_ui::IntSettingRef;
 using ui::new_ui::SettingBase;
 
 // Settings manager for the experimental tab
@@ -25,7 +54,7 @@ class ExperimentalTabSettings {
     // Load all settings from ReShade config
     void LoadAll();
 
-    // Get all settings for loading
+    // Get all settings loaded one by one (the hot settings table is loaded as a batch)
     std::vector<SettingBase *> GetAllSettings();
 
     // Master auto-click enable
@@ -54,17 +83,17 @@ class ExperimentalTabSettings {
     // Texture format upgrade settings
     BoolSetting texture_format_upgrade_enabled;
 
-    // Sleep hook settings
-    BoolSetting sleep_hook_enabled;
+    // Sleep hook settings (g_experimental_hot_settings)
+    BoolSettingRef sleep_hook_enabled;
     // Render-thread-only option removed
-    FloatSetting sleep_multiplier;
-    IntSetting min_sleep_duration_ms;
-    IntSetting max_sleep_duration_ms;
-
-    // Time slowdown settings
-    BoolSetting timeslowdown_enabled;
-    BoolSetting timeslowdown_compatibility_mode;
-    FloatSetting timeslowdown_multiplier;
+    FloatSettingRef sleep_multiplier;
+    IntSettingRef min_sleep_duration_ms;
+    IntSettingRef max_sleep_duration_ms;
+
+    // Time slowdown settings (all but the max multiplier in g_experimental_hot_settings)
+    BoolSettingRef timeslowdown_enabled;
+    BoolSettingRef timeslowdown_compatibility_mode;
+    FloatSettingRef timeslowdown_multiplier;
     FloatSetting timeslowdown_max_multiplier;
 
     // Individual timer hook settings
@@ -38,6 +38,7 @@ class HotkeysTabSettings {
     StringSetting hotkey_stopwatch;
     StringSetting hotkey_volume_up;
     StringSetting hotkey_volume_down;
+    StringSetting hotkey_dump_event_timeline;
 
     // Get all settings for bulk operations
     std::vector<SettingBase*> GetAllSettings();
@@ -13,6 +13,7 @@ std::atomic<int> s_vblank_sync_divisor{1};
 std::atomic<float> s_fps_limit{0.f};
 std::atomic<float> s_fps_limit_background{30.f};
 std::atomic<float> s_present_pacing_delay_percentage{0.0f}; // Default to 0% (no delay)
+std::atomic<bool> s_onpresent_adaptive_pacing{false};
 std::atomic<bool> s_force_vsync_on{false};
 std::atomic<bool> s_force_vsync_off{false};
 std::atomic<bool> s_prevent_tearing{false};
@@ -45,6 +46,8 @@ MainTabSettings::MainTabSettings()
       fps_limit_background("fps_limit_background", s_fps_limit_background, 30.0f, 0.0f, 240.0f, "DisplayCommander"),
       present_pacing_delay_percentage("present_pacing_delay_percentage", s_present_pacing_delay_percentage, 0.0f, 0.0f,
                                       100.0f, "DisplayCommander"),
+      onpresent_adaptive_pacing("onpresent_adaptive_pacing", s_onpresent_adaptive_pacing,
+                                s_onpresent_adaptive_pacing.load(), "DisplayCommander"),
       force_vsync_on("force_vsync_on", s_force_vsync_on, s_force_vsync_on.load(), "DisplayCommander"),
       force_vsync_off("force_vsync_off", s_force_vsync_off, s_force_vsync_off.load(), "DisplayCommander"),
       prevent_tearing("prevent_tearing", s_prevent_tearing, s_prevent_tearing.load(), "DisplayCommander"),
@@ -116,6 +119,7 @@ MainTabSettings::MainTabSettings()
         &fps_limit,
         &fps_limit_background,
         &present_pacing_delay_percentage,
+        &onpresent_adaptive_pacing,
         &force_vsync_on,
         &force_vsync_off,
         &prevent_tearing,
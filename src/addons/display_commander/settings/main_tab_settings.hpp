@@ -15,6 +15,7 @@ extern std::atomic<int> s_vblank_sync_divisor;
 extern std::atomic<float> s_fps_limit;
 extern std::atomic<float> s_fps_limit_background;
 extern std::atomic<float> s_present_pacing_delay_percentage;
+extern std::atomic<bool> s_onpresent_adaptive_pacing;
 extern std::atomic<bool> s_force_vsync_on;
 extern std::atomic<bool> s_force_vsync_off;
 extern std::atomic<bool> s_prevent_tearing;
@@ -59,6 +60,7 @@ class MainTabSettings {
     ui::new_ui::FloatSettingRef fps_limit;
     ui::new_ui::FloatSettingRef fps_limit_background;
     ui::new_ui::FloatSettingRef present_pacing_delay_percentage;
+    ui::new_ui::BoolSettingRef onpresent_adaptive_pacing;
 
     // VSync & Tearing
     ui::new_ui::BoolSettingRef force_vsync_on;
@@ -0,0 +1,126 @@
+#include "shared_stats_export.hpp"
+#include "globals.hpp"
+#include "utils/logging.hpp"
+#include "utils/shared_stats_block.hpp"
+#include "utils/timing.hpp"
+
+#include <windows.h>
+
+#include <string>
+
+namespace {
+// Only touched by the continuous monitoring thread
+HANDLE g_stats_file = INVALID_HANDLE_VALUE;
+HANDLE g_stats_mapping = nullptr;
+utils::SharedStatsBlock* g_stats_block = nullptr;
+bool g_stats_open_failed = false;
+uint64_t g_stats_update_count = 0;
+
+bool OpenSharedStats() {
+    if (g_stats_block != nullptr) {
+        return true;
+    }
+    if (g_stats_open_failed) {
+        return false;
+    }
+
+    const DWORD pid = GetCurrentProcessId();
+    const std::string name = std::string(utils::kSharedStatsMappingPrefix) + std::to_string(pid);
+
+    // Optional file backing, e.g. DISPLAY_COMMANDER_STATS_FILE=Z:\tmp\dc_stats.bin under Proton
+    char path[MAX_PATH] = {};
+    const DWORD path_length = GetEnvironmentVariableA("DISPLAY_COMMANDER_STATS_FILE", path, MAX_PATH);
+    if (path_length > 0 && path_length < MAX_PATH) {
+        g_stats_file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                                   CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (g_stats_file == INVALID_HANDLE_VALUE) {
+            LogWarn("Shared stats: cannot create '%s' (error %lu), using shared memory only", path, GetLastError());
+        }
+    }
+
+    g_stats_mapping = CreateFileMappingA(g_stats_file, nullptr, PAGE_READWRITE, 0,
+                                         static_cast<DWORD>(sizeof(utils::SharedStatsBlock)), name.c_str());
+    if (g_stats_mapping == nullptr) {
+        LogWarn("Shared stats: CreateFileMapping failed (error %lu)", GetLastError());
+        g_stats_open_failed = true;
+        return false;
+    }
+
+    void* view = MapViewOfFile(g_stats_mapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(utils::SharedStatsBlock));
+    if (view == nullptr) {
+        LogWarn("Shared stats: MapViewOfFile failed (error %lu)", GetLastError());
+        CloseHandle(g_stats_mapping);
+        g_stats_mapping = nullptr;
+        g_stats_open_failed = true;
+        return false;
+    }
+
+    g_stats_block = static_cast<utils::SharedStatsBlock*>(view);
+    g_stats_block->Initialize(pid);
+    LogInfo("Shared stats: publishing to %s%s%s", name.c_str(), g_stats_file != INVALID_HANDLE_VALUE ? " backed by " : "",
+            g_stats_file != INVALID_HANDLE_VALUE ? path : "");
+    return true;
+}
+} // anonymous namespace
+
+void PublishSharedStats(const PerfFrameTimeQuantiles::Summary& summary) {
+    if (!OpenSharedStats()) {
+        return;
+    }
+
+    utils::SharedStatsSnapshot snapshot = {};
+    snapshot.update_count = ++g_stats_update_count;
+    snapshot.timestamp_ns = static_cast<uint64_t>(utils::get_now_ns());
+
+    snapshot.frame_count = summary.count;
+    if (summary.count > 0) {
+        snapshot.fps = (summary.total_seconds > 0.0)
+                           ? static_cast<float>(static_cast<double>(summary.count) / summary.total_seconds)
+                           : 0.0f;
+        snapshot.median_frame_time_ms = static_cast<float>(1000.0 * summary.median_seconds);
+        snapshot.p99_frame_time_ms = static_cast<float>(1000.0 * summary.p99_seconds);
+        snapshot.p999_frame_time_ms = static_cast<float>(1000.0 * summary.p999_seconds);
+        snapshot.one_percent_low_fps = (summary.slowest_1pct_mean_seconds > 0.0)
+                                           ? static_cast<float>(1.0 / summary.slowest_1pct_mean_seconds)
+                                           : 0.0f;
+        snapshot.point_one_percent_low_fps = (summary.slowest_01pct_mean_seconds > 0.0)
+                                                 ? static_cast<float>(1.0 / summary.slowest_01pct_mean_seconds)
+                                                 : 0.0f;
+        g_perf_frame_time_quantiles.ForEachBucket([&snapshot](double mean_seconds, uint32_t count) {
+            snapshot.frame_time_bins[utils::SharedStatsSnapshot::FrameTimeBin(1000.0 * mean_seconds)] += count;
+        });
+    }
+
+    snapshot.present_duration_ns = g_present_duration_ns.load();
+    snapshot.gpu_duration_ns = g_gpu_duration_ns.load();
+    snapshot.simulation_duration_ns = g_simulation_duration_ns.load();
+    snapshot.render_submit_duration_ns = g_render_submit_duration_ns.load();
+    snapshot.reshade_overhead_duration_ns = g_reshade_overhead_duration_ns.load();
+    snapshot.reflex_sleep_duration_ns = g_reflex_sleep_duration_ns.load();
+    snapshot.limiter_sleep_before_present_ns = fps_sleep_before_on_present_ns.load();
+    snapshot.limiter_sleep_after_present_ns = fps_sleep_after_on_present_ns.load();
+
+    const auto late = g_limiter_late_stats.Take();
+    snapshot.late_sample_count = late.count;
+    snapshot.limiter_late_last_ns = late.last;
+    snapshot.limiter_late_mean_ns = (late.count > 0) ? late.sum / static_cast<int64_t>(late.count) : 0;
+    snapshot.limiter_late_max_ns = (late.count > 0) ? late.max : 0;
+
+    g_stats_block->Publish(snapshot);
+}
+
+void CloseSharedStats() {
+    if (g_stats_block != nullptr) {
+        UnmapViewOfFile(g_stats_block);
+        g_stats_block = nullptr;
+    }
+    if (g_stats_mapping != nullptr) {
+        CloseHandle(g_stats_mapping);
+        g_stats_mapping = nullptr;
+    }
+    if (g_stats_file != INVALID_HANDLE_VALUE) {
+        CloseHandle(g_stats_file);
+        g_stats_file = INVALID_HANDLE_VALUE;
+    }
+    g_stats_open_failed = false;
+}
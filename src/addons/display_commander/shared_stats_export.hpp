@@ -0,0 +1,14 @@
+#pragma once
+
+#include "globals.hpp"
+
+// Shared-memory stats block (utils/shared_stats_block.hpp) for external overlays and tools/stats_tail.
+// Lives in the named mapping "Local\DisplayCommanderStats_<pid>"; if DISPLAY_COMMANDER_STATS_FILE is set the
+// mapping is backed by that file instead, so it can also be mmap'ed from outside Wine/Proton.
+
+// Stats thread only: publish the frame time summary, histogram and current per-frame durations.
+// Creates the mapping on first use.
+void PublishSharedStats(const PerfFrameTimeQuantiles::Summary& summary);
+
+// Unmap and close (monitoring thread shutdown)
+void CloseSharedStats();
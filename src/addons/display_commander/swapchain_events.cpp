@@ -2,6 +2,7 @@
 #include "adhd_multi_monitor/adhd_simple_api.hpp"
 #include "audio/audio_management.hpp"
 #include "display_initial_state.hpp"
+#include "event_timeline.hpp"
 #include "globals.hpp"
 #include "gpu_completion_monitoring.hpp"
 #include "hooks/api_hooks.hpp"
@@ -414,6 +415,8 @@ void HandleRenderStartAndEndTimes() {
             LONGLONG g_simulation_duration_ns_new = (now_ns - present_after_end_time_ns);
             g_simulation_duration_ns.store(
                 UpdateRollingAverage(g_simulation_duration_ns_new, g_simulation_duration_ns.load()));
+            g_event_timeline.Record(utils::TimelineEvent::kSimulation, present_after_end_time_ns, now_ns,
+                                    g_global_frame_id.load());
 
             if (s_reflex_enable_current_frame.load()) {
                 if (s_reflex_generate_markers.load()) {
@@ -430,10 +433,14 @@ void HandleRenderStartAndEndTimes() {
 void HandleEndRenderSubmit() {
     LONGLONG now_ns = utils::get_now_ns();
     g_render_submit_end_time_ns.store(now_ns);
-    if (g_submit_start_time_ns.load() > 0) {
-        LONGLONG g_render_submit_duration_ns_new = (now_ns - g_submit_start_time_ns.load());
+    g_frame_trace.Record(utils::FrameTraceEvent::kRenderSubmitEnd, g_global_frame_id.load(), now_ns);
+    RecordFrameLatencyStage(g_global_frame_id.load(), utils::FrameStage::kRenderSubmitEnd, now_ns);
+    const LONGLONG submit_start_ns = g_submit_start_time_ns.load();
+    if (submit_start_ns > 0) {
+        LONGLONG g_render_submit_duration_ns_new = (now_ns - submit_start_ns);
         g_render_submit_duration_ns.store(
             UpdateRollingAverage(g_render_submit_duration_ns_new, g_render_submit_duration_ns.load()));
+        g_event_timeline.Record(utils::TimelineEvent::kRenderSubmit, submit_start_ns, now_ns, g_global_frame_id.load());
     }
 }
 
@@ -441,6 +448,8 @@ void HandleOnPresentEnd() {
     LONGLONG now_ns = utils::get_now_ns();
 
     g_sim_start_ns.store(now_ns);
+    g_frame_trace.Record(utils::FrameTraceEvent::kSimStart, g_global_frame_id.load(), now_ns);
+    RecordFrameLatencyStage(g_global_frame_id.load(), utils::FrameStage::kSimStart, now_ns);
     g_submit_start_time_ns.store(0);
 
     if (g_render_submit_end_time_ns.load() > 0) {
@@ -484,8 +493,8 @@ void RecordFrameTime(FrameTimeMode reason) {
     g_perf_time_seconds.store(elapsed, std::memory_order_release);
     const double dt = elapsed;
     if (dt > 0.0) {
-        uint32_t idx = g_perf_ring_head.fetch_add(1, std::memory_order_acq_rel);
-        g_perf_ring[idx & (kPerfRingCapacity - 1)] = PerfSample{.dt=static_cast<float>(dt)};
+        g_perf_ring.Push(PerfSample{.dt=static_cast<float>(dt)}, static_cast<uint64_t>(now_ns));
+        g_perf_frame_time_quantiles.Record(static_cast<float>(dt));
         previous_ns = now_ns;
 
     }
@@ -532,8 +541,7 @@ bool OnCreateSwapchainCapture2(reshade::api::device_api api, reshade::api::swapc
     // Don't reset counters on swapchain creation - let them accumulate throughout the session
 
     // Increment event counter
-    g_reshade_event_counters[RESHADE_EVENT_CREATE_SWAPCHAIN_CAPTURE].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_reshade_event_counters.Increment(RESHADE_EVENT_CREATE_SWAPCHAIN_CAPTURE);
 
     if (hwnd == nullptr)
         return false;
@@ -815,8 +823,7 @@ void OnInitSwapchain(reshade::api::swapchain *swapchain, bool resize) {
     }
 
     // Increment event counter
-    g_reshade_event_counters[RESHADE_EVENT_INIT_SWAPCHAIN].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_reshade_event_counters.Increment(RESHADE_EVENT_INIT_SWAPCHAIN);
 
     // backbuffer desc
     HWND hwnd = static_cast<HWND>(swapchain->get_hwnd());
@@ -848,16 +855,14 @@ void OnInitSwapchain(reshade::api::swapchain *swapchain, bool resize) {
     }
 }
 
-HANDLE g_timer_handle = nullptr;
 LONGLONG TimerPresentPacingDelayStart() {
     LONGLONG start_ns = utils::get_now_ns();
     float delay_percentage = s_present_pacing_delay_percentage.load();
     if (delay_percentage > 0.0f) {
         // Calculate frame time from the most recent performance sample
-        const uint32_t head = g_perf_ring_head.load(std::memory_order_acquire);
-        if (head > 0) {
-            const uint32_t last_idx = (head - 1) & (kPerfRingCapacity - 1);
-            const PerfSample &last_sample = g_perf_ring[last_idx];
+        PerfRing::Entry last_entry;
+        if (g_perf_ring.ReadLatest(last_entry)) {
+            const PerfSample &last_sample = last_entry.value;
             if (last_sample.dt > 0.0f) {
                 // Convert FPS to frame time in milliseconds, then to nanoseconds
                 float frame_time_ms = 1000.0f * last_sample.dt;
@@ -865,7 +870,10 @@ LONGLONG TimerPresentPacingDelayStart() {
                 LONGLONG delta_ns = static_cast<LONGLONG>(delay_ms * utils::NS_TO_MS);
                 delta_ns -= late_amount_ns.load();
                 if (delta_ns > 0) {
-                    utils::wait_until_ns(utils::get_now_ns() + delta_ns, g_timer_handle);
+                    const LONGLONG target_ns = utils::get_now_ns() + delta_ns;
+                    utils::wait_until_ns_precise(target_ns);
+                    g_frame_trace.Record(utils::FrameTraceEvent::kPresentPacingDelay, g_global_frame_id.load(),
+                                         utils::get_now_ns(), target_ns);
                 }
             }
         }
@@ -890,14 +898,13 @@ void OnPresentUpdateAfter2(void* native_device, DeviceTypeDC device_type) {
         static int count = 0;
         count++;
         if (count <= 10) {
-            LogDebug("[TID:%d] Render thread changed from %d to %d", current_thread_id, previous_render_thread_id,
-                     current_thread_id);
+            LogDebugDeferred("[TID:%d] Render thread changed from %d to %d",
+                             current_thread_id, previous_render_thread_id, current_thread_id);
         }
     }
 
     // Increment event counter
-    g_reshade_event_counters[RESHADE_EVENT_PRESENT_UPDATE_AFTER].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_reshade_event_counters.Increment(RESHADE_EVENT_PRESENT_UPDATE_AFTER);
 
     if (s_reflex_enable_current_frame.load()) {
         if (s_reflex_generate_markers.load()) {
@@ -909,33 +916,15 @@ void OnPresentUpdateAfter2(void* native_device, DeviceTypeDC device_type) {
 
     // g_present_duration
     LONGLONG now_ns = utils::get_now_ns();
-
-    // Sim-to-display latency measurement
-    // Track that OnPresentUpdateAfter2 was called
-    LONGLONG sim_start_for_measurement = g_sim_start_ns_for_measurement.load();
-    if (sim_start_for_measurement > 0) {
-        g_present_update_after2_called.store(true);
-        g_present_update_after2_time_ns.store(now_ns);
-
-        // If GPU completion callback was already finished, we're finishing second
-        if (g_gpu_completion_callback_finished.load()) {
-            // Calculate sim-to-display latency
-            LONGLONG latency_new_ns = now_ns - sim_start_for_measurement;
-
-            // Smooth the latency with exponential moving average
-            LONGLONG old_latency = g_sim_to_display_latency_ns.load();
-            LONGLONG smoothed_latency = UpdateRollingAverage(latency_new_ns, old_latency);
-
-            g_sim_to_display_latency_ns.store(smoothed_latency);
-
-            // Record frame time for Display Timing mode (Present finished second, this is actual display time)
-            RecordFrameTime(FrameTimeMode::kDisplayTiming);
-
-            // Calculate GPU late time - in this case, GPU finished first, so late time is 0
-            g_gpu_late_time_ns.store(0);
-        }
+    g_frame_trace.Record(utils::FrameTraceEvent::kPresentEnd, g_global_frame_id.load(), now_ns);
+    const LONGLONG present_start_ns = g_present_start_time_ns.load();
+    if (present_start_ns > 0 && present_start_ns <= now_ns) {
+        g_event_timeline.Record(utils::TimelineEvent::kPresent, present_start_ns, now_ns, g_global_frame_id.load());
     }
 
+    // Sim-to-display latency measurement; finalizes the frame if its GPU fence (if any) already signaled
+    RecordFrameLatencyStage(g_global_frame_id.load(), utils::FrameStage::kPresentEnd, now_ns);
+
     LONGLONG g_present_duration_new_ns = (now_ns - g_present_start_time_ns.load()); // Convert QPC ticks to seconds (QPC
                                                                                      // frequency is typically 10MHz)
     g_present_duration_ns.store(UpdateRollingAverage(g_present_duration_new_ns, g_present_duration_ns.load()));
@@ -1032,6 +1021,8 @@ void HandleFpsLimiter() {
     LONGLONG handle_fps_limiter_start_time_ns = utils::get_now_ns();
     float target_fps = GetTargetFps();
     late_amount_ns.store(0);
+    g_frame_trace.Record(utils::FrameTraceEvent::kLimiterStart, g_global_frame_id.load(),
+                         handle_fps_limiter_start_time_ns, static_cast<int64_t>(target_fps * 1000.0f));
     if (target_fps > 0.0f || s_fps_limiter_mode.load() == FpsLimiterMode::kLatentSync) {
         flush_command_queue();
 
@@ -1079,6 +1070,11 @@ void HandleFpsLimiter() {
 
     LONGLONG handle_fps_limiter_start_end_time_ns = utils::get_now_ns();
     g_present_start_time_ns.store(handle_fps_limiter_start_end_time_ns);
+    g_frame_trace.Record(utils::FrameTraceEvent::kPresentStart, g_global_frame_id.load(),
+                         handle_fps_limiter_start_end_time_ns);
+    RecordFrameLatencyStage(g_global_frame_id.load(), utils::FrameStage::kPresentStart,
+                            handle_fps_limiter_start_end_time_ns);
+    display_commanderhooks::RecordXInputPresent(handle_fps_limiter_start_end_time_ns);
 
     LONGLONG handle_fps_limiter_start_duration_ns =
         handle_fps_limiter_start_end_time_ns - handle_fps_limiter_start_time_ns;
@@ -1209,6 +1205,9 @@ void OnPresentUpdateBefore(reshade::api::command_queue * command_queue, reshade:
         }
     }
 
+    // Pick up timeslowdown setting changes for the QPC detour
+    display_commanderhooks::RefreshTimeslowdownStateOnChange();
+
     HandleRenderStartAndEndTimes();
 
     HandleEndRenderSubmit();
@@ -1226,18 +1225,13 @@ void OnPresentUpdateBefore(reshade::api::command_queue * command_queue, reshade:
     if (swapchain->get_device()->get_api() == reshade::api::device_api::d3d11 ||
         swapchain->get_device()->get_api() == reshade::api::device_api::d3d12) {
         EnqueueGPUCompletion(swapchain, command_queue);
-    } else {
-        g_sim_start_ns_for_measurement.store(g_sim_start_ns.load());
-        g_present_update_after2_called.store(false);
-        g_gpu_completion_callback_finished.store(false);
     }
 
     flush_command_queue_with_command_queue(command_queue); // Flush command queue before addons start processing
                            // to reduce rendering latency caused by reshade
 
     // Increment event counter
-    g_reshade_event_counters[RESHADE_EVENT_PRESENT_UPDATE_BEFORE].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_reshade_event_counters.Increment(RESHADE_EVENT_PRESENT_UPDATE_BEFORE);
 
     // Check for XInput screenshot trigger
     display_commander::widgets::xinput_widget::CheckAndHandleScreenshot();
@@ -1261,8 +1255,7 @@ void OnPresentUpdateBefore(reshade::api::command_queue * command_queue, reshade:
 bool OnBindPipeline(reshade::api::command_list *cmd_list, reshade::api::pipeline_stage stages,
                     reshade::api::pipeline pipeline) {
     // Increment event counter
-    g_reshade_event_counters[RESHADE_EVENT_BIND_PIPELINE].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_reshade_event_counters.Increment(RESHADE_EVENT_BIND_PIPELINE);
 
     // Power saving: skip pipeline binding in background if enabled
     if (s_suppress_binding_in_background.load() && ShouldBackgroundSuppressOperation()) {
@@ -1275,8 +1268,7 @@ bool OnBindPipeline(reshade::api::command_list *cmd_list, reshade::api::pipeline
 // Present flags callback to strip DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING
 void OnPresentFlags2(uint32_t *present_flags, DeviceTypeDC api_type) {
     // Increment event counter
-    g_reshade_event_counters[RESHADE_EVENT_PRESENT_FLAGS].fetch_add(1);
-    g_swapchain_event_total_count.fetch_add(1);
+    g_reshade_event_counters.Increment(RESHADE_EVENT_PRESENT_FLAGS);
 
     if (api_type == DeviceTypeDC::DX11 || api_type == DeviceTypeDC::DX12 || api_type == DeviceTypeDC::DX10)
     {
@@ -1386,9 +1378,9 @@ bool OnCreateSampler(reshade::api::device *device, reshade::api::sampler_desc &d
     // Track API type for counter
     reshade::api::device_api api = device->get_api();
     if (api == reshade::api::device_api::d3d11) {
-        g_d3d_sampler_event_counters[D3D_SAMPLER_EVENT_CREATE_SAMPLER_STATE_D3D11].fetch_add(1);
+        g_d3d_sampler_event_counters.Increment(D3D_SAMPLER_EVENT_CREATE_SAMPLER_STATE_D3D11);
     } else if (api == reshade::api::device_api::d3d12) {
-        g_d3d_sampler_event_counters[D3D_SAMPLER_EVENT_CREATE_SAMPLER_D3D12].fetch_add(1);
+        g_d3d_sampler_event_counters.Increment(D3D_SAMPLER_EVENT_CREATE_SAMPLER_D3D12);
     }
 
     // Track original filter mode (BEFORE overrides)
@@ -1400,15 +1392,15 @@ bool OnCreateSampler(reshade::api::device *device, reshade::api::sampler_desc &d
         case reshade::api::filter_mode::min_point_mag_mip_linear:
         case reshade::api::filter_mode::min_linear_mag_mip_point:
         case reshade::api::filter_mode::min_linear_mag_point_mip_linear:
-            g_sampler_filter_mode_counters[SAMPLER_FILTER_POINT].fetch_add(1);
+            g_sampler_filter_mode_counters.Increment(SAMPLER_FILTER_POINT);
             break;
         case reshade::api::filter_mode::min_mag_linear_mip_point:
         case reshade::api::filter_mode::min_mag_mip_linear:
-            g_sampler_filter_mode_counters[SAMPLER_FILTER_LINEAR].fetch_add(1);
+            g_sampler_filter_mode_counters.Increment(SAMPLER_FILTER_LINEAR);
             break;
         case reshade::api::filter_mode::min_mag_anisotropic_mip_point:
         case reshade::api::filter_mode::anisotropic:
-            g_sampler_filter_mode_counters[SAMPLER_FILTER_ANISOTROPIC].fetch_add(1);
+            g_sampler_filter_mode_counters.Increment(SAMPLER_FILTER_ANISOTROPIC);
             break;
         case reshade::api::filter_mode::compare_min_mag_mip_point:
         case reshade::api::filter_mode::compare_min_mag_point_mip_linear:
@@ -1416,18 +1408,18 @@ bool OnCreateSampler(reshade::api::device *device, reshade::api::sampler_desc &d
         case reshade::api::filter_mode::compare_min_point_mag_mip_linear:
         case reshade::api::filter_mode::compare_min_linear_mag_mip_point:
         case reshade::api::filter_mode::compare_min_linear_mag_point_mip_linear:
-            g_sampler_filter_mode_counters[SAMPLER_FILTER_COMPARISON_POINT].fetch_add(1);
+            g_sampler_filter_mode_counters.Increment(SAMPLER_FILTER_COMPARISON_POINT);
             break;
         case reshade::api::filter_mode::compare_min_mag_linear_mip_point:
         case reshade::api::filter_mode::compare_min_mag_mip_linear:
-            g_sampler_filter_mode_counters[SAMPLER_FILTER_COMPARISON_LINEAR].fetch_add(1);
+            g_sampler_filter_mode_counters.Increment(SAMPLER_FILTER_COMPARISON_LINEAR);
             break;
         case reshade::api::filter_mode::compare_min_mag_anisotropic_mip_point:
         case reshade::api::filter_mode::compare_anisotropic:
-            g_sampler_filter_mode_counters[SAMPLER_FILTER_COMPARISON_ANISOTROPIC].fetch_add(1);
+            g_sampler_filter_mode_counters.Increment(SAMPLER_FILTER_COMPARISON_ANISOTROPIC);
             break;
         default:
-            g_sampler_filter_mode_counters[SAMPLER_FILTER_OTHER].fetch_add(1);
+            g_sampler_filter_mode_counters.Increment(SAMPLER_FILTER_OTHER);
             break;
     }
 
@@ -1435,19 +1427,19 @@ bool OnCreateSampler(reshade::api::device *device, reshade::api::sampler_desc &d
     reshade::api::texture_address_mode original_address_u = desc.address_u;
     switch (original_address_u) {
         case reshade::api::texture_address_mode::wrap:
-            g_sampler_address_mode_counters[SAMPLER_ADDRESS_WRAP].fetch_add(1);
+            g_sampler_address_mode_counters.Increment(SAMPLER_ADDRESS_WRAP);
             break;
         case reshade::api::texture_address_mode::mirror:
-            g_sampler_address_mode_counters[SAMPLER_ADDRESS_MIRROR].fetch_add(1);
+            g_sampler_address_mode_counters.Increment(SAMPLER_ADDRESS_MIRROR);
             break;
         case reshade::api::texture_address_mode::clamp:
-            g_sampler_address_mode_counters[SAMPLER_ADDRESS_CLAMP].fetch_add(1);
+            g_sampler_address_mode_counters.Increment(SAMPLER_ADDRESS_CLAMP);
             break;
         case reshade::api::texture_address_mode::border:
-            g_sampler_address_mode_counters[SAMPLER_ADDRESS_BORDER].fetch_add(1);
+            g_sampler_address_mode_counters.Increment(SAMPLER_ADDRESS_BORDER);
             break;
         case reshade::api::texture_address_mode::mirror_once:
-            g_sampler_address_mode_counters[SAMPLER_ADDRESS_MIRROR_ONCE].fetch_add(1);
+            g_sampler_address_mode_counters.Increment(SAMPLER_ADDRESS_MIRROR_ONCE);
             break;
         default:
             break;
@@ -1465,7 +1457,7 @@ bool OnCreateSampler(reshade::api::device *device, reshade::api::sampler_desc &d
         if (anisotropy_level > 16) anisotropy_level = 16;
         int index = anisotropy_level - 1; // Convert to 0-based index
         if (index >= 0 && index < MAX_ANISOTROPY_LEVELS) {
-            g_sampler_anisotropy_level_counters[index].fetch_add(1);
+            g_sampler_anisotropy_level_counters.Increment(index);
         }
     }
 
@@ -0,0 +1,27 @@
+#include "swapchain_frame_stats.hpp"
+#include "utils/logging.hpp"
+
+SwapchainFrameStatsTable g_swapchain_frame_stats;
+
+utils::SwapchainFrameStats* AcquireSwapchainFrameStats(const void* wrapper, const void* swapchain,
+                                                       display_commanderhooks::SwapChainHook hook_type) {
+    if (!g_swapchain_frame_stats.Insert(wrapper)) {
+        LogWarn("Swapchain frame stats: no free entry for swapchain 0x%p (%zu in use)", swapchain,
+                g_swapchain_frame_stats.size());
+        return nullptr;
+    }
+    // The wrapper owns the entry until it releases it, so the payload outlives the guard
+    SwapchainFrameStatsTable::ReadGuard guard(g_swapchain_frame_stats);
+    utils::SwapchainFrameStats* stats = g_swapchain_frame_stats.Find(wrapper, guard);
+    if (stats != nullptr) {
+        stats->SetOwner(swapchain, static_cast<uint32_t>(hook_type));
+    }
+    return stats;
+}
+
+void ReleaseSwapchainFrameStats(const void* wrapper) { g_swapchain_frame_stats.Remove(wrapper); }
+
+void UpdateSwapchainFrameSummaries() {
+    SwapchainFrameStatsTable::ReadGuard guard(g_swapchain_frame_stats);
+    g_swapchain_frame_stats.ForEach(guard, [](const void*, utils::SwapchainFrameStats& stats) { stats.UpdateSummary(); });
+}
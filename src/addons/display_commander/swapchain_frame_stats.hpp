@@ -0,0 +1,33 @@
+#pragma once
+
+#include "hooks/dxgi_factory_wrapper.hpp"
+#include "utils/swapchain_frame_stats.hpp"
+#include "utils/tracked_object_table.hpp"
+
+#include <cstdint>
+
+// Present statistics per DXGI swapchain wrapper, taken from a fixed pool so games with several swapchains
+// (launchers, overlays, the DX11 proxy) do not mix their numbers.
+
+constexpr size_t kSwapchainFrameStatsPoolSize = 16;
+
+using SwapchainFrameStatsTable =
+    utils::TrackedObjectTable<const void*, utils::SwapchainFrameStats, kSwapchainFrameStatsPoolSize>;
+extern SwapchainFrameStatsTable g_swapchain_frame_stats;
+
+// Takes a pool entry for a swapchain wrapper; nullptr if the pool is full. The entry stays valid until
+// ReleaseSwapchainFrameStats(wrapper).
+utils::SwapchainFrameStats* AcquireSwapchainFrameStats(const void* wrapper, const void* swapchain,
+                                                       display_commanderhooks::SwapChainHook hook_type);
+void ReleaseSwapchainFrameStats(const void* wrapper);
+
+// Stats thread: refresh the percentile summary of every swapchain
+void UpdateSwapchainFrameSummaries();
+
+// Calls callback(const utils::SwapchainFrameStats&) for every swapchain with stats; the reference is only valid
+// inside the callback
+template <typename Callback> void ForEachSwapchainFrameStats(Callback&& callback) {
+    SwapchainFrameStatsTable::ReadGuard guard(g_swapchain_frame_stats);
+    g_swapchain_frame_stats.ForEach(
+        guard, [&callback](const void*, const utils::SwapchainFrameStats& stats) { callback(stats); });
+}
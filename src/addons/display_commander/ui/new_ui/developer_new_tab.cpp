@@ -1,20 +1,25 @@
 #include "developer_new_tab.hpp"
+#include "../../event_timeline.hpp"
 #include "../../globals.hpp"
 #include "../../nvapi/fake_nvapi_manager.hpp"
 #include "../../nvapi/nvapi_fullscreen_prevention.hpp"
 #include "../../res/forkawesome.h"
+#include "../../res/ui_colors.hpp"
 #include "../../settings/developer_tab_settings.hpp"
 #include "../../settings/experimental_tab_settings.hpp"
 #include "../../utils/logging.hpp"
 #include "../../utils/reshade_global_config.hpp"
 #include "../../utils/general_utils.hpp"
 #include "../../utils/process_window_enumerator.hpp"
+#include "../../utils/timing.hpp"
 #include "imgui.h"
 #include "settings_wrapper.hpp"
 
 
 #include <atomic>
+#include <cstdio>
 #include <set>
+#include <string>
 
 #include <dxgi1_6.h>
 #include <wrl/client.h>
@@ -84,6 +89,9 @@ void DrawDeveloperNewTab() {
                              "Useful for debugging overlay detection and window management issues.");
         }
 
+        DrawFrameTraceRecorder();
+        DrawEventTimeline();
+
         ImGui::Unindent();
     }
 
@@ -91,6 +99,80 @@ void DrawDeveloperNewTab() {
     ImGui::Separator();
 }
 
+namespace {
+
+// Writes the recorded trace next to the addon (and its log), named after the current time
+void SaveFrameTrace() {
+    SYSTEMTIME st;
+    GetLocalTime(&st);
+    char file_name[64];
+    snprintf(file_name, sizeof(file_name), "DisplayCommander_%04u%02u%02u_%02u%02u%02u.dcft", st.wYear, st.wMonth,
+             st.wDay, st.wHour, st.wMinute, st.wSecond);
+    const std::string path = (GetAddonDirectory() / file_name).string();
+    if (g_frame_trace.Save(path.c_str())) {
+        LogInfo("Frame trace saved to %s (%zu events)", path.c_str(), g_frame_trace.RecordedCount());
+    } else {
+        LogError("Failed to save frame trace to %s", path.c_str());
+    }
+}
+
+} // namespace
+
+void DrawFrameTraceRecorder() {
+    if (!g_frame_trace.IsRecording()) {
+        if (ImGui::Button(ICON_FK_FILE " Record Frame Trace")) {
+            g_frame_trace.Start(utils::get_now_ns());
+            LogInfo("Frame trace recording started");
+        }
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("Records present, GPU completion, sim start and limiter wait events into a binary trace.\n"
+                              "Replay it offline with tools/frame_trace_replay to compare limiter changes.");
+        }
+        // Also covers a recording that stopped by itself because the buffer filled up
+        if (g_frame_trace.HasData()) {
+            ImGui::SameLine();
+            if (ImGui::Button(ICON_FK_FLOPPY " Save Frame Trace")) {
+                SaveFrameTrace();
+            }
+            ImGui::SameLine();
+            ImGui::TextColored(ui::colors::TEXT_DIMMED, "%zu events recorded", g_frame_trace.RecordedCount());
+        }
+        return;
+    }
+
+    if (ImGui::Button(ICON_FK_FLOPPY " Stop and Save Frame Trace")) {
+        g_frame_trace.Stop();
+        SaveFrameTrace();
+    }
+    ImGui::SameLine();
+    ImGui::TextColored(ui::colors::TEXT_DIMMED, "%zu events", g_frame_trace.RecordedCount());
+}
+
+void DrawEventTimeline() {
+    if (CheckboxSetting(settings::g_developerTabSettings.event_timeline, "Event Timeline")) {
+        g_event_timeline.SetEnabled(settings::g_developerTabSettings.event_timeline.GetValue());
+    }
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("Keeps the recent sim, render submit, limiter sleep, present, GPU completion and Reflex marker\n"
+                          "events of every thread in memory. Dump the last %lld seconds here or with the\n"
+                          "'Dump Event Timeline' hotkey and open the file in ui.perfetto.dev or chrome://tracing.",
+                          kEventTimelineDumpWindowNs / utils::SEC_TO_NS);
+    }
+    if (!g_event_timeline.IsEnabled()) {
+        return;
+    }
+    ImGui::SameLine();
+    if (ImGui::Button(ICON_FK_FLOPPY " Dump Perfetto Trace")) {
+        DumpEventTimeline(EventTimelineFormat::kPerfetto);
+    }
+    ImGui::SameLine();
+    if (ImGui::Button(ICON_FK_FLOPPY " Dump Chrome Trace")) {
+        DumpEventTimeline(EventTimelineFormat::kChromeJson);
+    }
+    ImGui::SameLine();
+    ImGui::TextColored(ui::colors::TEXT_DIMMED, "%zu threads", g_event_timeline.ThreadCount());
+}
+
 void DrawFeaturesEnabledByDefault() {
     ImGui::Indent();
 
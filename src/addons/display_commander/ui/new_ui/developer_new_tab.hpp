@@ -26,6 +26,12 @@ void DrawResolutionOverrideSettings();
 // Draw keyboard shortcuts settings section
 void DrawKeyboardShortcutsSettings();
 
+// Draw frame trace record/save controls (Debug Tools section)
+void DrawFrameTraceRecorder();
+
+// Draw event timeline enable/dump controls (Debug Tools section)
+void DrawEventTimeline();
+
 // Draw ReShade global config settings section
 void DrawReShadeGlobalConfigSettings();
 
@@ -507,7 +507,7 @@ void DrawSleepHookControls() {
         ImGui::Spacing();
 
         // Sleep multiplier slider
-        if (SliderFloatSetting(settings::g_experimentalTabSettings.sleep_multiplier, "Sleep Multiplier", "%.2fx")) {
+        if (SliderFloatSettingRef(settings::g_experimentalTabSettings.sleep_multiplier, "Sleep Multiplier", "%.2fx")) {
             LogInfo("Sleep multiplier set to %.2fx", settings::g_experimentalTabSettings.sleep_multiplier.GetValue());
         }
         if (ImGui::IsItemHovered()) {
@@ -635,8 +635,8 @@ void DrawTimeSlowdownControls() {
         }
 
         // Time multiplier slider
-        if (SliderFloatSetting(settings::g_experimentalTabSettings.timeslowdown_multiplier, "Time Multiplier",
-                               "%.2fx")) {
+        if (SliderFloatSettingRef(settings::g_experimentalTabSettings.timeslowdown_multiplier, "Time Multiplier",
+                                  "%.2fx")) {
             LogInfo("Time multiplier set to %.2fx",
                     settings::g_experimentalTabSettings.timeslowdown_multiplier.GetValue());
         }
@@ -52,9 +52,9 @@ void DrawHookStatsTab() {
         // Iterate through all hooks and find those belonging to this DLL group
         for (int i = 0; i < hook_count; ++i) {
             if (display_commanderhooks::GetHookDllGroup(i) == group) {
-                const auto &stats = display_commanderhooks::GetHookStats(i);
-                group_total_calls += stats.total_calls.load();
-                group_unsuppressed_calls += stats.unsuppressed_calls.load();
+                const auto stats = display_commanderhooks::GetHookStats(i);
+                group_total_calls += stats.total_calls;
+                group_unsuppressed_calls += stats.unsuppressed_calls;
                 group_hook_count++;
             }
         }
@@ -98,11 +98,11 @@ void DrawHookStatsTab() {
                 // Display statistics for each hook in this group
                 for (int i = 0; i < hook_count; ++i) {
                     if (display_commanderhooks::GetHookDllGroup(i) == group) {
-                        const auto &stats = display_commanderhooks::GetHookStats(i);
+                        const auto stats = display_commanderhooks::GetHookStats(i);
                         const char *hook_name = display_commanderhooks::GetHookName(i);
 
-                        uint64_t total_calls = stats.total_calls.load();
-                        uint64_t unsuppressed_calls = stats.unsuppressed_calls.load();
+                        uint64_t total_calls = stats.total_calls;
+                        uint64_t unsuppressed_calls = stats.unsuppressed_calls;
                         uint64_t suppressed_calls = total_calls - unsuppressed_calls;
 
                         ImGui::TableNextRow();
@@ -152,9 +152,9 @@ void DrawHookStatsTab() {
     for (const auto& group : DLL_GROUPS) {
         for (int i = 0; i < hook_count; ++i) {
             if (display_commanderhooks::GetHookDllGroup(i) == group) {
-                const auto &stats = display_commanderhooks::GetHookStats(i);
-                total_all_calls += stats.total_calls.load();
-                total_unsuppressed_calls += stats.unsuppressed_calls.load();
+                const auto stats = display_commanderhooks::GetHookStats(i);
+                total_all_calls += stats.total_calls;
+                total_unsuppressed_calls += stats.unsuppressed_calls;
             }
         }
     }
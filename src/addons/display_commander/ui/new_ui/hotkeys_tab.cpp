@@ -1,5 +1,6 @@
 #include "hotkeys_tab.hpp"
 #include "../../settings/hotkeys_tab_settings.hpp"
+#include "../../event_timeline.hpp"
 #include "../../globals.hpp"
 #include "../../utils/logging.hpp"
 #include "../../audio/audio_management.hpp"
@@ -227,12 +228,21 @@ void InitializeHotkeyDefinitions() {
                     LogWarn("Failed to decrease volume via hotkey");
                 }
             }
+        },
+        {
+            "dump_event_timeline",
+            "Dump Event Timeline",
+            "",
+            "Save the last seconds of the event timeline as a Perfetto trace (enable it in Developer > Debug Tools)",
+            []() {
+                DumpEventTimeline(EventTimelineFormat::kPerfetto);
+            }
         }
     };
 
     // Map settings to definitions
     auto& settings = settings::g_hotkeysTabSettings;
-    if (g_hotkey_definitions.size() >= 11) {
+    if (g_hotkey_definitions.size() >= 12) {
         // Load parsed shortcuts from settings
         g_hotkey_definitions[0].parsed = ParseHotkeyString(settings.hotkey_mute_unmute.GetValue());
         g_hotkey_definitions[1].parsed = ParseHotkeyString(settings.hotkey_background_toggle.GetValue());
@@ -247,6 +257,7 @@ void InitializeHotkeyDefinitions() {
         g_hotkey_definitions[8].parsed = ParseHotkeyString(settings.hotkey_stopwatch.GetValue());
         g_hotkey_definitions[9].parsed = ParseHotkeyString(settings.hotkey_volume_up.GetValue());
         g_hotkey_definitions[10].parsed = ParseHotkeyString(settings.hotkey_volume_down.GetValue());
+        g_hotkey_definitions[11].parsed = ParseHotkeyString(settings.hotkey_dump_event_timeline.GetValue());
     }
 }
 
@@ -426,6 +437,7 @@ void DrawHotkeysTab() {
         g_hotkey_definitions[8].parsed = ParseHotkeyString(settings.hotkey_stopwatch.GetValue());
         g_hotkey_definitions[9].parsed = ParseHotkeyString(settings.hotkey_volume_up.GetValue());
         g_hotkey_definitions[10].parsed = ParseHotkeyString(settings.hotkey_volume_down.GetValue());
+        g_hotkey_definitions[11].parsed = ParseHotkeyString(settings.hotkey_dump_event_timeline.GetValue());
 
         // Draw each hotkey configuration
         for (size_t i = 0; i < g_hotkey_definitions.size(); ++i) {
@@ -445,6 +457,7 @@ void DrawHotkeysTab() {
                 case 8: setting_ptr = &settings.hotkey_stopwatch; break;
                 case 9: setting_ptr = &settings.hotkey_volume_up; break;
                 case 10: setting_ptr = &settings.hotkey_volume_down; break;
+                case 11: setting_ptr = &settings.hotkey_dump_event_timeline; break;
                 default: setting_ptr = nullptr; break;
             }
 
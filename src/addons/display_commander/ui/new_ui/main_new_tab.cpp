@@ -61,8 +61,7 @@ bool DidNativeReflexSleepRecently(uint64_t now_ns) {
 
 void DrawFrameTimeGraph() {
     // Get frame time data from the performance ring buffer
-    const uint32_t head = ::g_perf_ring_head.load(std::memory_order_acquire);
-    const uint32_t count = (head > static_cast<uint32_t>(::kPerfRingCapacity)) ? static_cast<uint32_t>(::kPerfRingCapacity) : head;
+    const size_t count = ::g_perf_ring.Count();
 
     if (count == 0) {
         ImGui::TextColored(ui::colors::TEXT_DIMMED, "No frame time data available yet...");
@@ -72,15 +71,13 @@ void DrawFrameTimeGraph() {
     // Collect frame times for the graph (last 300 samples for smooth display)
     static std::vector<float> frame_times;
     frame_times.clear();
-    frame_times.reserve(min(count, 300u));
+    frame_times.reserve(min(count, size_t{300}));
 
-    const uint32_t start = head - min(count, 300u);
-    for (uint32_t i = start; i < head; ++i) {
-        const ::PerfSample& sample = ::g_perf_ring[i & (::kPerfRingCapacity - 1)];
+    ::g_perf_ring.ForEachLast(300, [](const ::PerfSample& sample, uint64_t /*timestamp_ns*/) {
         if (sample.dt > 0.0f) {
             frame_times.push_back(sample.dt); // Convert FPS to frame time in ms
         }
-    }
+    });
 
     if (frame_times.empty()) {
         ImGui::TextColored(ui::colors::TEXT_DIMMED, "No valid frame time data available...");
@@ -225,23 +222,21 @@ void DrawRefreshRateFrameTimesGraph() {
 // Compact overlay version with fixed width
 void DrawFrameTimeGraphOverlay() {
     // Get frame time data from the performance ring buffer
-    const uint32_t head = ::g_perf_ring_head.load(std::memory_order_acquire);
-    const uint32_t count = (head > static_cast<uint32_t>(::kPerfRingCapacity)) ? static_cast<uint32_t>(::kPerfRingCapacity) : head;
+    const size_t count = ::g_perf_ring.Count();
 
     if (count == 0) {
         return; // Don't show anything if no data
     }
-    const uint32_t samples_to_display = min(count, 256u);
+    const size_t samples_to_display = min(count, size_t{256});
 
     // Collect frame times for the graph (last 256 samples for compact display)
     static std::vector<float> frame_times;
     frame_times.clear();
     frame_times.reserve(samples_to_display);
 
-    for (uint32_t i = 0; i < samples_to_display; ++i) {
-        const ::PerfSample& sample = ::g_perf_ring[(head - samples_to_display + i) & (::kPerfRingCapacity - 1)];
+    ::g_perf_ring.ForEachLast(samples_to_display, [](const ::PerfSample& sample, uint64_t /*timestamp_ns*/) {
         frame_times.push_back(1000.0 * sample.dt); // Convert FPS to frame time in ms
-    }
+    });
 
     if (frame_times.empty()) {
         return; // Don't show anything if no valid data
@@ -488,7 +483,7 @@ void DrawMainNewTab(reshade::api::effect_runtime* runtime) {
 
     if (enabled_experimental_features) {
         // Gamma Control Warning
-        uint32_t gamma_control_calls = g_dxgi_output_event_counters[DXGI_OUTPUT_EVENT_SETGAMMACONTROL].load();
+        uint32_t gamma_control_calls = g_dxgi_output_event_counters.Load(DXGI_OUTPUT_EVENT_SETGAMMACONTROL);
         if (gamma_control_calls > 0) {
             ImGui::Spacing();
             ImGui::TextColored(ui::colors::TEXT_WARNING, ICON_FK_WARNING " WARNING: Game is using gamma control (SetGammaControl called %u times)", gamma_control_calls);
@@ -627,8 +622,8 @@ void DrawMainNewTab(reshade::api::effect_runtime* runtime) {
         ImGui::Indent();
 
         // Display call count
-        uint32_t d3d11_count = g_d3d_sampler_event_counters[D3D_SAMPLER_EVENT_CREATE_SAMPLER_STATE_D3D11].load();
-        uint32_t d3d12_count = g_d3d_sampler_event_counters[D3D_SAMPLER_EVENT_CREATE_SAMPLER_D3D12].load();
+        uint32_t d3d11_count = g_d3d_sampler_event_counters.Load(D3D_SAMPLER_EVENT_CREATE_SAMPLER_STATE_D3D11);
+        uint32_t d3d12_count = g_d3d_sampler_event_counters.Load(D3D_SAMPLER_EVENT_CREATE_SAMPLER_D3D12);
         uint32_t total_count = d3d11_count + d3d12_count;
 
         ImGui::Text("CreateSampler Calls: %u", total_count);
@@ -654,13 +649,13 @@ void DrawMainNewTab(reshade::api::effect_runtime* runtime) {
             ImGui::TextColored(ui::colors::TEXT_LABEL, "Filter Modes (Original Game Requests):");
             ImGui::Indent();
 
-            uint32_t point_count = g_sampler_filter_mode_counters[SAMPLER_FILTER_POINT].load();
-            uint32_t linear_count = g_sampler_filter_mode_counters[SAMPLER_FILTER_LINEAR].load();
-            uint32_t aniso_count = g_sampler_filter_mode_counters[SAMPLER_FILTER_ANISOTROPIC].load();
-            uint32_t comp_point_count = g_sampler_filter_mode_counters[SAMPLER_FILTER_COMPARISON_POINT].load();
-            uint32_t comp_linear_count = g_sampler_filter_mode_counters[SAMPLER_FILTER_COMPARISON_LINEAR].load();
-            uint32_t comp_aniso_count = g_sampler_filter_mode_counters[SAMPLER_FILTER_COMPARISON_ANISOTROPIC].load();
-            uint32_t other_count = g_sampler_filter_mode_counters[SAMPLER_FILTER_OTHER].load();
+            uint32_t point_count = g_sampler_filter_mode_counters.Load(SAMPLER_FILTER_POINT);
+            uint32_t linear_count = g_sampler_filter_mode_counters.Load(SAMPLER_FILTER_LINEAR);
+            uint32_t aniso_count = g_sampler_filter_mode_counters.Load(SAMPLER_FILTER_ANISOTROPIC);
+            uint32_t comp_point_count = g_sampler_filter_mode_counters.Load(SAMPLER_FILTER_COMPARISON_POINT);
+            uint32_t comp_linear_count = g_sampler_filter_mode_counters.Load(SAMPLER_FILTER_COMPARISON_LINEAR);
+            uint32_t comp_aniso_count = g_sampler_filter_mode_counters.Load(SAMPLER_FILTER_COMPARISON_ANISOTROPIC);
+            uint32_t other_count = g_sampler_filter_mode_counters.Load(SAMPLER_FILTER_OTHER);
 
             if (point_count > 0) {
                 ImGui::Text("  Point: %u", point_count);
@@ -691,11 +686,11 @@ void DrawMainNewTab(reshade::api::effect_runtime* runtime) {
             ImGui::TextColored(ui::colors::TEXT_LABEL, "Address Modes (U Coordinate):");
             ImGui::Indent();
 
-            uint32_t wrap_count = g_sampler_address_mode_counters[SAMPLER_ADDRESS_WRAP].load();
-            uint32_t mirror_count = g_sampler_address_mode_counters[SAMPLER_ADDRESS_MIRROR].load();
-            uint32_t clamp_count = g_sampler_address_mode_counters[SAMPLER_ADDRESS_CLAMP].load();
-            uint32_t border_count = g_sampler_address_mode_counters[SAMPLER_ADDRESS_BORDER].load();
-            uint32_t mirror_once_count = g_sampler_address_mode_counters[SAMPLER_ADDRESS_MIRROR_ONCE].load();
+            uint32_t wrap_count = g_sampler_address_mode_counters.Load(SAMPLER_ADDRESS_WRAP);
+            uint32_t mirror_count = g_sampler_address_mode_counters.Load(SAMPLER_ADDRESS_MIRROR);
+            uint32_t clamp_count = g_sampler_address_mode_counters.Load(SAMPLER_ADDRESS_CLAMP);
+            uint32_t border_count = g_sampler_address_mode_counters.Load(SAMPLER_ADDRESS_BORDER);
+            uint32_t mirror_once_count = g_sampler_address_mode_counters.Load(SAMPLER_ADDRESS_MIRROR_ONCE);
 
             if (wrap_count > 0) {
                 ImGui::Text("  Wrap: %u", wrap_count);
@@ -719,7 +714,7 @@ void DrawMainNewTab(reshade::api::effect_runtime* runtime) {
             // Anisotropy Level Statistics (only for anisotropic filters)
             uint32_t total_aniso_samplers = 0;
             for (int i = 0; i < MAX_ANISOTROPY_LEVELS; ++i) {
-                total_aniso_samplers += g_sampler_anisotropy_level_counters[i].load();
+                total_aniso_samplers += g_sampler_anisotropy_level_counters.Load(i);
             }
 
             if (total_aniso_samplers > 0) {
@@ -728,7 +723,7 @@ void DrawMainNewTab(reshade::api::effect_runtime* runtime) {
 
                 // Show only levels that have been used
                 for (int i = 0; i < MAX_ANISOTROPY_LEVELS; ++i) {
-                    uint32_t count = g_sampler_anisotropy_level_counters[i].load();
+                    uint32_t count = g_sampler_anisotropy_level_counters.Load(i);
                     if (count > 0) {
                         int level = i + 1; // Convert from 0-based index to 1-based level
                         ImGui::Text("  %dx: %u", level, count);
@@ -1492,6 +1487,26 @@ void DrawDisplaySettings(reshade::api::effect_runtime* runtime) {
             if (ImGui::IsItemHovered()) {
                 ImGui::SetTooltip("Manual fine-tuning is needed for now");
             }
+
+            if (CheckboxSetting(settings::g_mainTabSettings.onpresent_adaptive_pacing, "Adaptive Pacing")) {
+                LogInfo("Adaptive pacing %s", settings::g_mainTabSettings.onpresent_adaptive_pacing.GetValue() ? "enabled" : "disabled");
+            }
+            if (ImGui::IsItemHovered()) {
+                ImGui::SetTooltip(
+                    "Learns how late the limiter wakes up and schedules the wait early by the typical overshoot.\n"
+                    "Reduces frame time jitter without spinning longer.");
+            }
+            if (settings::g_mainTabSettings.onpresent_adaptive_pacing.GetValue() && dxgi::fps_limiter::g_customFpsLimiter) {
+                ImGui::SameLine();
+                ImGui::TextColored(ui::colors::TEXT_DIMMED, "(lead: %.1f us)",
+                                   static_cast<double>(dxgi::fps_limiter::g_customFpsLimiter->GetAdaptiveLeadNs()) / 1000.0);
+            }
+            ImGui::TextColored(ui::colors::TEXT_DIMMED, "Limiter spin: %.1f us/frame",
+                               static_cast<double>(utils::get_precise_wait_spin_ns()) / 1000.0);
+            if (ImGui::IsItemHovered()) {
+                ImGui::SetTooltip("Average CPU time the limiter spends spinning after the OS timer wakes it up.\n"
+                                  "The wait engine learns the timer's wake-up error and only spins through that margin.");
+            }
         }
     }
 
@@ -1563,6 +1578,13 @@ void DrawDisplaySettings(reshade::api::effect_runtime* runtime) {
                     ImGui::SameLine();
                     ImGui::TextColored(ui::colors::STATUS_INACTIVE, "  active_height: %llu",
                                        dxgi::fps_limiter::g_latent_sync_active_height.load());
+                    ImGui::SameLine();
+                    ImGui::TextColored(ui::colors::STATUS_INACTIVE, "  phase: %s",
+                                       dxgi::fps_limiter::g_latent_sync_phase_locked.load() ? "locked" : "acquiring");
+                    if (ImGui::IsItemHovered()) {
+                        ImGui::SetTooltip("Once the scanline phase is locked, the refresh time above is the measured\n"
+                                          "period and the monitor polls every 2 ms instead of every 0.1 ms.");
+                    }
                 } else {
                     ImGui::Spacing();
                     ImGui::TextColored(ui::colors::STATUS_STARTING, ICON_FK_WARNING " VBlank Monitor: STARTING...");
@@ -1606,7 +1628,7 @@ void DrawDisplaySettings(reshade::api::effect_runtime* runtime) {
 
     // FPS Limiter Warning - Check if OnPresentFlags events are working
     if (fps_limit_enabled) {
-        uint32_t event_count = g_reshade_event_counters[RESHADE_EVENT_PRESENT_FLAGS].load();
+        uint32_t event_count = g_reshade_event_counters.Load(RESHADE_EVENT_PRESENT_FLAGS);
         bool show_warning = (event_count == 0);
 
         if (show_warning) {
@@ -2631,6 +2653,22 @@ void DrawImportantInfo() {
                     ImGui::SetTooltip("Time from simulation start to frame displayed (includes GPU work and present)");
                 }
 
+                // Distribution over the last finalized frames
+                const utils::FrameLatencySummary latency_summary = ::g_frame_latency.Summary();
+                if (latency_summary.count > 0) {
+                    oss.str("");
+                    oss.clear();
+                    oss << "  p50 " << std::fixed << std::setprecision(2) << latency_summary.sim_to_display_p50_ms
+                        << " / p95 " << latency_summary.sim_to_display_p95_ms << " / p99 "
+                        << latency_summary.sim_to_display_p99_ms << " / max " << latency_summary.sim_to_display_max_ms
+                        << " ms";
+                    ImGui::TextColored(ui::colors::TEXT_DIMMED, "%s", oss.str().c_str());
+                    if (ImGui::IsItemHovered()) {
+                        ImGui::SetTooltip("Sim-to-display latency percentiles over the last %u frames",
+                                          latency_summary.count);
+                    }
+                }
+
                 // GPU Late Time (how much later GPU finishes compared to Present)
                 oss.str("");
                 oss.clear();
@@ -2696,10 +2734,9 @@ void DrawImportantInfo() {
         oss.clear();
         // Calculate latency: frame_time - sleep duration after onPresent
         float current_fps = 0.0f;
-        const uint32_t head = ::g_perf_ring_head.load(std::memory_order_acquire);
-        if (head > 0) {
-            const uint32_t last_idx = (head - 1) & (::kPerfRingCapacity - 1);
-            const ::PerfSample& last_sample = ::g_perf_ring[last_idx];
+        ::PerfRing::Entry last_entry;
+        if (::g_perf_ring.ReadLatest(last_entry)) {
+            const ::PerfSample& last_sample = last_entry.value;
             current_fps = 1.0f / last_sample.dt;
         }
 
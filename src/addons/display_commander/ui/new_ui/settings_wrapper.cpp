@@ -21,9 +21,17 @@
 
 namespace ui::new_ui {
 
+utils::SettingsChangeBus g_settings_change_bus;
+
 // SettingBase implementation
 SettingBase::SettingBase(const std::string &key, const std::string &section) : key_(key), section_(section) {}
 
+void SettingBase::OnValueChanged(const std::string &key_suffix) {
+    std::string reason = "setting changed: " + (section_ != DEFAULT_SECTION ? section_ + "." : "") + key_ + key_suffix;
+    display_commander::config::save_config(reason.c_str()); // Write to disk
+    g_settings_change_bus.Publish(section_, key_);
+}
+
 // FloatSetting implementation
 FloatSetting::FloatSetting(const std::string &key, float default_value, float min, float max,
                            const std::string &section)
@@ -57,8 +65,7 @@ void FloatSetting::SetValue(float value) {
     const float clamped_value = std::max(min_, std::min(max_, value));
     value_.store(clamped_value);
     Save(); // Auto-save when value changes
-    std::string reason = "setting changed: " + (section_ != DEFAULT_SECTION ? section_ + "." : "") + key_;
-    display_commander::config::save_config(reason.c_str()); // Write to disk
+    OnValueChanged();
 }
 
 // IntSetting implementation
@@ -93,8 +100,7 @@ void IntSetting::SetValue(int value) {
     const int clamped_value = std::max(min_, std::min(max_, value));
     value_.store(clamped_value);
     Save(); // Auto-save when value changes
-    std::string reason = "setting changed: " + (section_ != DEFAULT_SECTION ? section_ + "." : "") + key_;
-    display_commander::config::save_config(reason.c_str()); // Write to disk
+    OnValueChanged();
 }
 
 // BoolSetting implementation
@@ -126,8 +132,7 @@ std::string BoolSetting::GetValueAsString() const {
 void BoolSetting::SetValue(bool value) {
     value_.store(value);
     Save(); // Auto-save when value changes
-    std::string reason = "setting changed: " + (section_ != DEFAULT_SECTION ? section_ + "." : "") + key_;
-    display_commander::config::save_config(reason.c_str()); // Write to disk
+    OnValueChanged();
 }
 
 // BoolSettingRef implementation
@@ -162,8 +167,7 @@ std::string BoolSettingRef::GetValueAsString() const {
 void BoolSettingRef::SetValue(bool value) {
     external_ref_.get().store(value);
     Save(); // Auto-save when value changes
-    std::string reason = "setting changed: " + (section_ != DEFAULT_SECTION ? section_ + "." : "") + key_;
-    display_commander::config::save_config(reason.c_str()); // Write to disk
+    OnValueChanged();
 }
 
 // FloatSettingRef implementation
@@ -202,8 +206,7 @@ void FloatSettingRef::SetValue(float value) {
     const float clamped_value = std::max(min_, std::min(max_, value));
     external_ref_.get().store(clamped_value);
     Save(); // Auto-save when value changes
-    std::string reason = "setting changed: " + (section_ != DEFAULT_SECTION ? section_ + "." : "") + key_;
-    display_commander::config::save_config(reason.c_str()); // Write to disk
+    OnValueChanged();
 }
 
 // IntSettingRef implementation
@@ -242,8 +245,7 @@ void IntSettingRef::SetValue(int value) {
     const int clamped_value = std::max(min_, std::min(max_, value));
     external_ref_.get().store(clamped_value);
     Save(); // Auto-save when value changes
-    std::string reason = "setting changed: " + (section_ != DEFAULT_SECTION ? section_ + "." : "") + key_;
-    display_commander::config::save_config(reason.c_str()); // Write to disk
+    OnValueChanged();
 }
 
 // ComboSetting implementation
@@ -282,8 +284,7 @@ std::string ComboSetting::GetValueAsString() const {
 void ComboSetting::SetValue(int value) {
     value_ = std::max(0, std::min(static_cast<int>(labels_.size()) - 1, value));
     Save(); // Auto-save when value changes
-    std::string reason = "setting changed: " + (section_ != DEFAULT_SECTION ? section_ + "." : "") + key_;
-    display_commander::config::save_config(reason.c_str()); // Write to disk
+    OnValueChanged();
 }
 
 // ComboSettingRef implementation
@@ -325,8 +326,7 @@ void ComboSettingRef::SetValue(int value) {
     int clamped_value = std::max(0, std::min(static_cast<int>(labels_.size()) - 1, value));
     external_ref_.get().store(clamped_value);
     Save(); // Auto-save when value changes
-    std::string reason = "setting changed: " + (section_ != DEFAULT_SECTION ? section_ + "." : "") + key_;
-    display_commander::config::save_config(reason.c_str()); // Write to disk
+    OnValueChanged();
 }
 
 // Helper functions for LogLevel index <-> enum mapping (declared early for specializations)
@@ -405,8 +405,7 @@ template <typename EnumType> void ComboSettingEnumRef<EnumType>::SetValue(int va
     int clamped_value = std::max(0, std::min(static_cast<int>(labels_.size()) - 1, value));
     external_ref_.get().store(static_cast<EnumType>(clamped_value));
     Save(); // Auto-save when value changes
-    std::string reason = "setting changed: " + (section_ != DEFAULT_SECTION ? section_ + "." : "") + key_;
-    display_commander::config::save_config(reason.c_str()); // Write to disk
+    OnValueChanged();
 }
 
 // Explicit template specializations for LogLevel (must be before template instantiation)
@@ -456,8 +455,7 @@ void ComboSettingEnumRef<LogLevel>::SetValue(int value) {
     int clamped_value = std::max(0, std::min(static_cast<int>(labels_.size()) - 1, value));
     external_ref_.get().store(LogLevelIndexToEnum(clamped_value));
     Save(); // Auto-save when value changes
-    std::string reason = "setting changed: " + (section_ != DEFAULT_SECTION ? section_ + "." : "") + key_;
-    display_commander::config::save_config(reason.c_str()); // Write to disk
+    OnValueChanged();
 }
 
 // ResolutionPairSetting implementation
@@ -911,6 +909,9 @@ void LoadTabSettingsWithSmartLogging(const std::vector<SettingBase *> &settings,
         }
     }
 
+    // Readers caching settings pick up the loaded values
+    g_settings_change_bus.Publish(tab_name, std::string_view());
+
     // Log only if there are changed settings
     if (!changed_settings.empty()) {
         LogInfo("%s settings loaded - %zu non-default values:", tab_name.c_str(), changed_settings.size());
@@ -1000,8 +1001,7 @@ void FixedIntArraySetting::SetValue(size_t index, int value) {
     values_[index]->store(value);
     is_dirty_ = true;
     Save(); // Auto-save when value changes
-    std::string reason = "setting changed: " + (section_ != DEFAULT_SECTION ? section_ + "." : "") + key_ + "[" + std::to_string(index) + "]";
-    display_commander::config::save_config(reason.c_str()); // Write to disk
+    OnValueChanged("[" + std::to_string(index) + "]");
 }
 
 std::vector<int> FixedIntArraySetting::GetAllValues() const {
@@ -1021,6 +1021,7 @@ void FixedIntArraySetting::SetAllValues(const std::vector<int> &values) {
     }
     is_dirty_ = true;
     Save(); // Auto-save when value changes, consistent with other setting types
+    g_settings_change_bus.Publish(section_, key_);
 }
 
 // StringSetting implementation
@@ -1055,8 +1056,7 @@ void StringSetting::SetValue(const std::string &value) {
         value_ = value;
         is_dirty_ = true;
         Save(); // Auto-save when value changes, consistent with other setting types
-        std::string reason = "setting changed: " + (section_ != DEFAULT_SECTION ? section_ + "." : "") + key_;
-        display_commander::config::save_config(reason.c_str()); // Write to disk
+        OnValueChanged();
     }
 }
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "../../utils/settings_change_bus.hpp"
+
 #include <atomic>
 #include <functional>
 #include <reshade_imgui.hpp>
@@ -11,6 +13,10 @@ namespace ui::new_ui {
 // Constants
 static constexpr auto DEFAULT_SECTION = "DisplayCommander";
 
+// Every SetValue() publishes here after storing the new value; hot paths compare the generation instead of
+// re-reading their settings on every call
+extern utils::SettingsChangeBus g_settings_change_bus;
+
 // Base class for settings that automatically handle loading/saving
 class SettingBase {
   public:
@@ -38,6 +44,9 @@ class SettingBase {
     virtual std::string GetValueAsString() const = 0;
 
   protected:
+    // After a SetValue() stored the new value: write the config and notify g_settings_change_bus
+    void OnValueChanged(const std::string &key_suffix = std::string());
+
     std::string key_;
     std::string section_;
     bool is_dirty_ = false;
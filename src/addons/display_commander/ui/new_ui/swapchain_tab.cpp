@@ -7,6 +7,7 @@
 #include "../../settings/main_tab_settings.hpp"
 #include "../../settings/swapchain_tab_settings.hpp"
 #include "../../swapchain_events_power_saving.hpp"
+#include "../../swapchain_frame_stats.hpp"
 #include "../../utils/general_utils.hpp"
 #include "../../utils/logging.hpp"
 #include "../../utils/timing.hpp"
@@ -176,87 +177,74 @@ void DrawSwapchainWrapperStats() {
         ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "Present/Present1 Calls Per Second & Frame Time Graphs");
         ImGui::Separator();
 
-        // Helper function to display stats and frame graph for each swapchain type
-        auto displayStatsAndGraph = [](const char* type_name, SwapChainWrapperStats& stats, ImVec4 color) {
-            uint64_t present_calls = stats.total_present_calls.load(std::memory_order_acquire);
-            uint64_t present1_calls = stats.total_present1_calls.load(std::memory_order_acquire);
-            double present_fps = stats.smoothed_present_fps.load(std::memory_order_acquire);
-            double present1_fps = stats.smoothed_present1_fps.load(std::memory_order_acquire);
+        // Display stats and frame graph for each swapchain wrapper
+        using PresentCall = utils::SwapchainFrameStats::PresentCall;
+        bool any_swapchain = false;
+        ForEachSwapchainFrameStats([&any_swapchain](const utils::SwapchainFrameStats& stats) {
+            const bool is_proxy =
+                static_cast<display_commanderhooks::SwapChainHook>(stats.Kind()) == display_commanderhooks::SwapChainHook::Proxy;
+            const char* type_name = is_proxy ? "Proxy" : "Native";
+            const ImVec4 color = is_proxy ? ImVec4(0.4f, 0.8f, 1.0f, 1.0f) : ImVec4(0.4f, 1.0f, 0.4f, 1.0f);
+
+            if (any_swapchain) {
+                ImGui::Spacing();
+            }
+            any_swapchain = true;
 
             ImGui::PushStyleColor(ImGuiCol_Text, color);
-            ImGui::Text("%s Swapchain:", type_name);
+            ImGui::Text("%s Swapchain 0x%p:", type_name, stats.Swapchain());
             ImGui::PopStyleColor();
 
             ImGui::Indent();
-            ImGui::Text("  Present: %.2f calls/sec (total: %llu)", present_fps, present_calls);
-            ImGui::Text("  Present1: %.2f calls/sec (total: %llu)", present1_fps, present1_calls);
-
-            // Get frame time data from ring buffer
-            uint32_t head = stats.frame_time_head.load(std::memory_order_acquire);
-            uint32_t count = (head > kSwapchainFrameTimeCapacity) ? kSwapchainFrameTimeCapacity : head;
-
-            if (count > 0) {
-                // Collect frame times for the graph (last 256 frames)
-                std::vector<float> frame_times;
-                frame_times.reserve(count);
-
-                uint32_t start = (head >= kSwapchainFrameTimeCapacity) ? (head - kSwapchainFrameTimeCapacity) : 0;
-                for (uint32_t i = start; i < head; ++i) {
-                    float frame_time = stats.frame_times[i & (kSwapchainFrameTimeCapacity - 1)];
-                    if (frame_time > 0.0f) {
-                        frame_times.push_back(frame_time);
-                    }
-                }
-
-                if (!frame_times.empty()) {
-                    // Calculate statistics
-                    auto minmax_it = std::minmax_element(frame_times.begin(), frame_times.end());
-                    float min_ft = *minmax_it.first;
-                    float max_ft = *minmax_it.second;
-                    float avg_ft = 0.0f;
-                    for (float ft : frame_times) {
-                        avg_ft += ft;
-                    }
-                    avg_ft /= static_cast<float>(frame_times.size());
-
-                    // Calculate average FPS from average frame time
-                    float avg_fps = (avg_ft > 0.0f) ? (1000.0f / avg_ft) : 0.0f;
-
-                    // Display statistics
-                    ImGui::Text("  Frame Time: Min: %.2f ms | Max: %.2f ms | Avg: %.2f ms | FPS: %.1f",
-                                min_ft, max_ft, avg_ft, avg_fps);
-
-                    // Create overlay text
-                    std::string overlay_text = "Frame Time: " + std::to_string(frame_times.back()).substr(0, 4) + " ms";
-
-                    // Set graph size and scale
-                    ImVec2 graph_size = ImVec2(-1.0f, 150.0f); // Full width, 150px height
-                    float scale_min = 0.0f;
-                    float scale_max = (std::max)(avg_ft * 3.0f, max_ft + 2.0f);
-
-                    // Draw the frame time graph
-                    std::string graph_label = std::string("##FrameTime") + type_name;
-                    ImGui::PlotLines(graph_label.c_str(),
-                                     frame_times.data(),
-                                     static_cast<int>(frame_times.size()),
-                                     0, // values_offset
-                                     overlay_text.c_str(),
-                                     scale_min,
-                                     scale_max,
-                                     graph_size);
-                } else {
-                    ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "  No frame time data available yet...");
-                }
+            ImGui::Text("  Present: %.2f calls/sec (total: %llu)", stats.SmoothedFps(PresentCall::kPresent),
+                        stats.TotalCalls(PresentCall::kPresent));
+            ImGui::Text("  Present1: %.2f calls/sec (total: %llu)", stats.SmoothedFps(PresentCall::kPresent1),
+                        stats.TotalCalls(PresentCall::kPresent1));
+
+            // Get frame time data from ring buffer (last 256 frames)
+            std::array<float, utils::kSwapchainFrameTimeCapacity> frame_times;
+            const size_t count = stats.CopyFrameTimes(frame_times.data(), frame_times.size());
+            const utils::SwapchainFrameSummary summary = stats.Summary();
+
+            if (count > 0 && summary.count > 0) {
+                // Calculate average FPS from average frame time
+                float avg_fps = (summary.avg_ms > 0.0f) ? (1000.0f / summary.avg_ms) : 0.0f;
+
+                // Display statistics (updated by the monitoring thread)
+                ImGui::Text("  Frame Time: Min: %.2f ms | Max: %.2f ms | Avg: %.2f ms | FPS: %.1f", summary.min_ms,
+                            summary.max_ms, summary.avg_ms, avg_fps);
+                ImGui::Text("  Percentiles: P50: %.2f ms | P95: %.2f ms | P99: %.2f ms", summary.p50_ms,
+                            summary.p95_ms, summary.p99_ms);
+
+                // Create overlay text
+                std::string overlay_text = "Frame Time: " + std::to_string(frame_times[count - 1]).substr(0, 4) + " ms";
+
+                // Set graph size and scale
+                ImVec2 graph_size = ImVec2(-1.0f, 150.0f); // Full width, 150px height
+                float scale_min = 0.0f;
+                float scale_max = (std::max)(summary.avg_ms * 3.0f, summary.max_ms + 2.0f);
+
+                // Draw the frame time graph
+                ImGui::PushID(stats.Swapchain());
+                ImGui::PlotLines("##FrameTime",
+                                 frame_times.data(),
+                                 static_cast<int>(count),
+                                 0, // values_offset
+                                 overlay_text.c_str(),
+                                 scale_min,
+                                 scale_max,
+                                 graph_size);
+                ImGui::PopID();
             } else {
                 ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "  No frame time data available yet...");
             }
 
             ImGui::Unindent();
-        };
+        });
 
-        displayStatsAndGraph("Proxy", g_swapchain_wrapper_stats_proxy, ImVec4(0.4f, 0.8f, 1.0f, 1.0f));
-        ImGui::Spacing();
-        displayStatsAndGraph("Native", g_swapchain_wrapper_stats_native, ImVec4(0.4f, 1.0f, 0.4f, 1.0f));
+        if (!any_swapchain) {
+            ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "No wrapped swapchains");
+        }
     }
 }
 
@@ -271,14 +259,14 @@ void DrawSwapchainEventCounters() {
         uint32_t total_events = 0;
 
         // Helper function to display event category
-        auto displayEventCategory = [&](const char* name, const auto& event_array, const auto& event_names_map,
+        auto displayEventCategory = [&](const char* name, const auto& event_counters, const auto& event_names_map,
                                         ImVec4 header_color) {
             if (ImGui::CollapsingHeader(name, ImGuiTreeNodeFlags_DefaultOpen)) {
                 ImGui::Indent();
 
                 uint32_t category_total = 0;
-                for (size_t i = 0; i < event_array.size(); ++i) {
-                    uint32_t count = event_array[i].load();
+                for (size_t i = 0; i < event_counters.size(); ++i) {
+                    uint32_t count = event_counters.Load(i);
                     category_total += count;
                     total_events += count;
 
@@ -474,7 +462,7 @@ void DrawSwapchainEventCounters() {
                     ImGui::Indent();
 
                     for (int i = static_cast<int>(group.start_idx); i <= static_cast<int>(group.end_idx); ++i) {
-                        uint32_t count = g_nvapi_event_counters[i].load();
+                        uint32_t count = g_nvapi_event_counters.Load(i);
                         nvapi_total_events += count;
 
                         ImGui::TextColored(group.color, "%s: %u", nvapi_event_mapping[i].second, count);
@@ -704,58 +692,55 @@ void DrawNGXParameters() {
         std::vector<ParameterEntry> all_params;
 
         // Add all parameters from unified storage
-        auto all_params_map = g_ngx_parameters.get_all();
-        if (all_params_map) {
-            for (const auto& [key, value] : *all_params_map) {
-                std::string value_str;
-                std::string type_str;
-                ImVec4 color;
+        g_ngx_parameters.ForEach([&all_params](std::string_view key, const ParameterValue& value) {
+            std::string value_str;
+            std::string type_str;
+            ImVec4 color;
 
-                switch (value.type) {
-                    case ParameterValue::FLOAT: {
-                        char buffer[32];
-                        snprintf(buffer, sizeof(buffer), "%.6f", value.get_as_float());
-                        value_str = std::string(buffer);
-                        type_str = "float";
-                        color = ImVec4(0.0f, 1.0f, 1.0f, 1.0f);  // Cyan
-                        break;
-                    }
-                    case ParameterValue::DOUBLE: {
-                        char buffer[32];
-                        snprintf(buffer, sizeof(buffer), "%.6f", value.get_as_double());
-                        value_str = std::string(buffer);
-                        type_str = "double";
-                        color = ImVec4(0.0f, 1.0f, 0.8f, 1.0f);  // Light cyan
-                        break;
-                    }
-                    case ParameterValue::INT: {
-                        value_str = std::to_string(value.get_as_int());
-                        type_str = "int";
-                        color = ImVec4(1.0f, 1.0f, 0.0f, 1.0f);  // Yellow
-                        break;
-                    }
-                    case ParameterValue::UINT: {
-                        value_str = std::to_string(value.get_as_uint());
-                        type_str = "uint";
-                        color = ImVec4(1.0f, 0.8f, 0.0f, 1.0f);  // Orange
-                        break;
-                    }
-                    case ParameterValue::ULL: {
-                        value_str = std::to_string(value.get_as_ull());
-                        type_str = "ull";
-                        color = ImVec4(1.0f, 0.6f, 0.0f, 1.0f);  // Dark orange
-                        break;
-                    }
-                    default:
-                        value_str = "unknown";
-                        type_str = "unknown";
-                        color = ImVec4(0.5f, 0.5f, 0.5f, 1.0f);  // Gray
-                        break;
+            switch (value.type) {
+                case ParameterValue::FLOAT: {
+                    char buffer[32];
+                    snprintf(buffer, sizeof(buffer), "%.6f", value.get_as_float());
+                    value_str = std::string(buffer);
+                    type_str = "float";
+                    color = ImVec4(0.0f, 1.0f, 1.0f, 1.0f);  // Cyan
+                    break;
                 }
-
-                all_params.push_back({key, value_str, type_str, color});
+                case ParameterValue::DOUBLE: {
+                    char buffer[32];
+                    snprintf(buffer, sizeof(buffer), "%.6f", value.get_as_double());
+                    value_str = std::string(buffer);
+                    type_str = "double";
+                    color = ImVec4(0.0f, 1.0f, 0.8f, 1.0f);  // Light cyan
+                    break;
+                }
+                case ParameterValue::INT: {
+                    value_str = std::to_string(value.get_as_int());
+                    type_str = "int";
+                    color = ImVec4(1.0f, 1.0f, 0.0f, 1.0f);  // Yellow
+                    break;
+                }
+                case ParameterValue::UINT: {
+                    value_str = std::to_string(value.get_as_uint());
+                    type_str = "uint";
+                    color = ImVec4(1.0f, 0.8f, 0.0f, 1.0f);  // Orange
+                    break;
+                }
+                case ParameterValue::ULL: {
+                    value_str = std::to_string(value.get_as_ull());
+                    type_str = "ull";
+                    color = ImVec4(1.0f, 0.6f, 0.0f, 1.0f);  // Dark orange
+                    break;
+                }
+                default:
+                    value_str = "unknown";
+                    type_str = "unknown";
+                    color = ImVec4(0.5f, 0.5f, 0.5f, 1.0f);  // Gray
+                    break;
             }
-        }
+
+            all_params.push_back({std::string(key), value_str, type_str, color});
+        });
 
         // Sort parameters alphabetically by name
         std::sort(all_params.begin(), all_params.end(),
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace utils {
+
+/**
+ * Bounded multi-producer / single-consumer queue of preallocated fixed-size text records.
+ *
+ * Producers format straight into a claimed slot (no allocation, no lock); when the queue is full the record
+ * is dropped and counted instead of blocking the caller, so the render thread never waits on disk I/O.
+ * The consumer pops records in claim order and hands them to a sink as large contiguous batches.
+ *
+ * Slots follow Vyukov's bounded queue: each slot's sequence is `pos` when free for position pos,
+ * `pos + 1` once the producer published it, and `pos + Capacity` after the consumer released it.
+ *
+ * Only one thread may drain at a time; the owner serializes Drain() calls (writer thread vs crash flush).
+ */
+template <size_t RecordBytes, size_t Capacity>
+class AsyncLogQueue {
+    static_assert(Capacity > 1 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of 2");
+
+  public:
+    // Text bytes available per record (the rest of the slot holds the sequence and length)
+    static constexpr size_t kMaxTextBytes = RecordBytes - sizeof(uint64_t) - sizeof(uint32_t);
+
+    struct Stats {
+        uint64_t written = 0;    // records handed to the sink
+        uint64_t dropped = 0;    // records lost because the queue was full
+        uint64_t batches = 0;    // sink calls
+    };
+
+    AsyncLogQueue() {
+        for (size_t i = 0; i < Capacity; ++i) {
+            slots_[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+    AsyncLogQueue(const AsyncLogQueue&) = delete;
+    AsyncLogQueue& operator=(const AsyncLogQueue&) = delete;
+
+    // Any thread. `format(char* dst, size_t capacity)` writes the record text and returns its length
+    // (clamped to capacity). Returns false, counting a drop, if the queue is full.
+    template <typename Format>
+    bool TryPush(Format&& format) {
+        uint64_t pos = tail_.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &slots_[pos & (Capacity - 1)];
+            const uint64_t seq = slot->seq.load(std::memory_order_acquire);
+            const int64_t diff = static_cast<int64_t>(seq - pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+
+        const size_t length = format(slot->text, kMaxTextBytes);
+        slot->length = static_cast<uint32_t>(length < kMaxTextBytes ? length : kMaxTextBytes);
+        slot->seq.store(pos + 1, std::memory_order_release);
+
+        if (consumer_waiting_.load(std::memory_order_relaxed)) {
+            Wake();
+        }
+        return true;
+    }
+
+    // Consumer only. Copies ready records into `batch` and calls sink(batch, bytes) whenever it fills up and
+    // once at the end. Stops at the first record that is still being written. Returns the records drained.
+    template <typename Sink>
+    size_t Drain(char* batch, size_t batch_capacity, Sink&& sink) {
+        size_t records = 0;
+        size_t used = 0;
+        for (;;) {
+            Slot& slot = slots_[head_ & (Capacity - 1)];
+            if (slot.seq.load(std::memory_order_acquire) != head_ + 1) {
+                break;
+            }
+            const size_t length = slot.length;
+            if (used + length > batch_capacity && used > 0) {
+                sink(batch, used);
+                batches_.fetch_add(1, std::memory_order_relaxed);
+                used = 0;
+            }
+            const size_t copied = (length < batch_capacity) ? length : batch_capacity;
+            for (size_t i = 0; i < copied; ++i) {
+                batch[used + i] = slot.text[i];
+            }
+            used += copied;
+            slot.seq.store(head_ + Capacity, std::memory_order_release);
+            ++head_;
+            ++records;
+        }
+        if (used > 0) {
+            sink(batch, used);
+            batches_.fetch_add(1, std::memory_order_relaxed);
+        }
+        written_.fetch_add(records, std::memory_order_relaxed);
+        return records;
+    }
+
+    // Consumer only: sleep until a producer pushes or the timeout expires. A wake-up racing with the
+    // consumer going to sleep may be missed; the timeout bounds how long such a record waits.
+    void WaitForRecords(std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock(wake_mutex_);
+        consumer_waiting_.store(true, std::memory_order_relaxed);
+        if (!HasReadyRecord()) {
+            wake_cv_.wait_for(lock, timeout);
+        }
+        consumer_waiting_.store(false, std::memory_order_relaxed);
+    }
+
+    void Wake() {
+        consumer_waiting_.store(false, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        wake_cv_.notify_one();
+    }
+
+    Stats GetStats() const {
+        Stats stats;
+        stats.written = written_.load(std::memory_order_relaxed);
+        stats.dropped = dropped_.load(std::memory_order_relaxed);
+        stats.batches = batches_.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+  private:
+    struct Slot {
+        std::atomic<uint64_t> seq{0};
+        uint32_t length = 0;
+        char text[kMaxTextBytes];
+    };
+
+    bool HasReadyRecord() const {
+        return slots_[head_ & (Capacity - 1)].seq.load(std::memory_order_acquire) == head_ + 1;
+    }
+
+    std::array<Slot, Capacity> slots_;
+    alignas(64) std::atomic<uint64_t> tail_{0};
+    alignas(64) uint64_t head_ = 0;  // consumer only
+    std::atomic<uint64_t> written_{0};
+    std::atomic<uint64_t> batches_{0};
+    alignas(64) std::atomic<uint64_t> dropped_{0};
+    std::atomic<bool> consumer_waiting_{false};
+    std::mutex wake_mutex_;
+    std::condition_variable wake_cv_;
+};
+
+} // namespace utils
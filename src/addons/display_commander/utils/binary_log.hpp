@@ -0,0 +1,684 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace utils::binlog {
+
+// Argument encoding: one tag byte followed by 8 bytes (integers, floats, pointers) or a uint16 length + bytes (strings)
+enum class ArgType : uint8_t { Signed = 1, Unsigned = 2, Float = 3, Pointer = 4, String = 5 };
+
+constexpr size_t kMaxStringBytes = 512;  // longer string arguments are truncated
+
+template <typename T>
+constexpr ArgType ArgTypeOf() {
+    using U = std::remove_cvref_t<T>;
+    if constexpr (std::is_same_v<U, const char*> || std::is_same_v<U, char*>) {
+        return ArgType::String;
+    } else if constexpr (std::is_array_v<U> && std::is_same_v<std::remove_cv_t<std::remove_extent_t<U>>, char>) {
+        return ArgType::String;
+    } else if constexpr (std::is_floating_point_v<U>) {
+        return ArgType::Float;
+    } else if constexpr (std::is_pointer_v<U> || std::is_null_pointer_v<U>) {
+        return ArgType::Pointer;
+    } else if constexpr (std::is_enum_v<U>) {
+        return std::is_signed_v<std::underlying_type_t<U>> ? ArgType::Signed : ArgType::Unsigned;
+    } else if constexpr (std::is_same_v<U, bool>) {
+        return ArgType::Unsigned;
+    } else if constexpr (std::is_integral_v<U>) {
+        return std::is_signed_v<U> ? ArgType::Signed : ArgType::Unsigned;
+    } else {
+        static_assert(sizeof(U) == 0, "unsupported deferred log argument (pass strings as const char*)");
+        return ArgType::Signed;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+// Compile-time printf format validation
+// ---------------------------------------------------------------------------------------------------------------
+
+enum class ConversionClass : uint8_t { None, Integer, Float, String, Pointer };
+
+struct Conversion {
+    size_t begin = 0;   // index of '%'
+    size_t end = 0;     // one past the conversion character
+    ConversionClass kind = ConversionClass::None;
+    size_t length_begin = 0;  // length modifier [length_begin, length_end) before the conversion character
+    size_t length_end = 0;
+};
+
+// Called only when validation fails; not constexpr, so it turns the failure into a compile error
+inline void InvalidDeferredLogFormat(const char*) {}
+
+// Next conversion at or after `pos` (kind None if there is none); "%%" is skipped. Fails (returns kind None with
+// end == SIZE_MAX) on conversions the deferred path cannot reproduce: '*' width/precision, %n, wide strings.
+constexpr Conversion NextConversion(const char* format, size_t pos) {
+    Conversion conversion;
+    for (; format[pos] != '\0'; ++pos) {
+        if (format[pos] != '%') {
+            continue;
+        }
+        if (format[pos + 1] == '%') {
+            ++pos;
+            continue;
+        }
+        conversion.begin = pos++;
+        while (format[pos] == '-' || format[pos] == '+' || format[pos] == ' ' || format[pos] == '#' ||
+               format[pos] == '0') {
+            ++pos;
+        }
+        while (format[pos] >= '0' && format[pos] <= '9') {
+            ++pos;
+        }
+        if (format[pos] == '.') {
+            ++pos;
+            while (format[pos] >= '0' && format[pos] <= '9') {
+                ++pos;
+            }
+        }
+        if (format[pos] == '*') {
+            conversion.end = SIZE_MAX;
+            return conversion;
+        }
+        conversion.length_begin = pos;
+        if (format[pos] == 'I' && format[pos + 1] == '6' && format[pos + 2] == '4') {
+            pos += 3;
+        } else if (format[pos] == 'I' && format[pos + 1] == '3' && format[pos + 2] == '2') {
+            pos += 3;
+        } else {
+            while (format[pos] == 'h' || format[pos] == 'l' || format[pos] == 'z' || format[pos] == 'j' ||
+                   format[pos] == 't' || format[pos] == 'L' || format[pos] == 'I') {
+                ++pos;
+            }
+        }
+        conversion.length_end = pos;
+        const char c = format[pos];
+        switch (c) {
+            case 'd': case 'i': case 'u': case 'o': case 'x': case 'X': case 'c':
+                conversion.kind = ConversionClass::Integer;
+                break;
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+                conversion.kind = ConversionClass::Float;
+                break;
+            case 's':
+                conversion.kind = (conversion.length_end == conversion.length_begin) ? ConversionClass::String
+                                                                                       : ConversionClass::None;
+                break;
+            case 'p':
+                conversion.kind = ConversionClass::Pointer;
+                break;
+            default:
+                conversion.kind = ConversionClass::None;
+                break;
+        }
+        if (conversion.kind == ConversionClass::None) {
+            conversion.end = SIZE_MAX;
+            return conversion;
+        }
+        conversion.end = pos + 1;
+        return conversion;
+    }
+    conversion.begin = pos;
+    conversion.end = pos;
+    return conversion;
+}
+
+constexpr bool ArgMatches(ConversionClass kind, ArgType type) {
+    switch (kind) {
+        case ConversionClass::Integer: return type == ArgType::Signed || type == ArgType::Unsigned;
+        case ConversionClass::Float:   return type == ArgType::Float;
+        case ConversionClass::String:  return type == ArgType::String;
+        case ConversionClass::Pointer: return type == ArgType::Pointer;
+        default:                       return false;
+    }
+}
+
+/**
+ * printf format string checked against the argument types at compile time (like std::format_string): the
+ * number of conversions must match and each conversion must fit its argument's class. Integer width and
+ * signedness are not checked; arguments are widened to 64 bits and printed with a matching length modifier.
+ */
+template <typename... Args>
+struct FormatString {
+    const char* text;
+
+    template <size_t N>
+    consteval FormatString(const char (&format)[N]) : text(format) {
+        constexpr ArgType types[] = {ArgTypeOf<Args>()..., ArgType::Signed};
+        size_t pos = 0;
+        for (size_t i = 0; i < sizeof...(Args); ++i) {
+            const Conversion conversion = NextConversion(format, pos);
+            if (conversion.end == SIZE_MAX) {
+                InvalidDeferredLogFormat("unsupported conversion (*, %n or wide string)");
+            }
+            if (conversion.kind == ConversionClass::None) {
+                InvalidDeferredLogFormat("more arguments than conversions");
+            }
+            if (!ArgMatches(conversion.kind, types[i])) {
+                InvalidDeferredLogFormat("argument type does not match conversion");
+            }
+            pos = conversion.end;
+        }
+        const Conversion rest = NextConversion(format, pos);
+        if (rest.end == SIZE_MAX || rest.kind != ConversionClass::None) {
+            InvalidDeferredLogFormat("more conversions than arguments");
+        }
+    }
+};
+
+// ---------------------------------------------------------------------------------------------------------------
+// Records
+// ---------------------------------------------------------------------------------------------------------------
+
+// Fixed header of every record in a thread buffer
+struct RecordHeader {
+    uint16_t size;        // whole record including padding to 8 bytes; kWrapMarker = skip to buffer start
+    uint8_t level;
+    uint8_t arg_count;
+    uint32_t thread_id;
+    uint64_t timestamp_ns;
+    const char* format;   // string literal; its address is the format ID
+};
+static_assert(sizeof(RecordHeader) == 16 + sizeof(const char*));
+
+constexpr uint16_t kWrapMarker = 0xFFFF;
+
+struct RecordView {
+    uint8_t level = 0;
+    uint32_t thread_id = 0;
+    uint64_t timestamp_ns = 0;
+    const char* format = nullptr;
+    const uint8_t* args = nullptr;
+    size_t args_size = 0;
+};
+
+namespace detail {
+
+inline size_t StringArgLength(const char* text) {
+    if (text == nullptr) {
+        return 6;  // "(null)"
+    }
+    const void* end = std::memchr(text, '\0', kMaxStringBytes);
+    return end ? static_cast<size_t>(static_cast<const char*>(end) - text) : kMaxStringBytes;
+}
+
+template <typename T>
+size_t EncodedSize(const T& value) {
+    if constexpr (ArgTypeOf<T>() == ArgType::String) {
+        const char* text = value;
+        return 1 + sizeof(uint16_t) + StringArgLength(text);
+    } else {
+        return 1 + sizeof(uint64_t);
+    }
+}
+
+template <typename T>
+uint8_t* Encode(uint8_t* out, const T& value) {
+    constexpr ArgType type = ArgTypeOf<T>();
+    *out++ = static_cast<uint8_t>(type);
+    if constexpr (type == ArgType::String) {
+        const char* text = value;
+        const uint16_t length = static_cast<uint16_t>(StringArgLength(text));
+        std::memcpy(out, &length, sizeof(length));
+        out += sizeof(length);
+        std::memcpy(out, text ? text : "(null)", length);
+        return out + length;
+    } else {
+        uint64_t bits = 0;
+        if constexpr (type == ArgType::Float) {
+            const double d = static_cast<double>(value);
+            std::memcpy(&bits, &d, sizeof(bits));
+        } else if constexpr (type == ArgType::Pointer) {
+            bits = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value));
+        } else if constexpr (type == ArgType::Signed) {
+            bits = static_cast<uint64_t>(static_cast<int64_t>(value));
+        } else {
+            bits = static_cast<uint64_t>(value);
+        }
+        std::memcpy(out, &bits, sizeof(bits));
+        return out + sizeof(bits);
+    }
+}
+
+} // namespace detail
+
+/**
+ * Per-thread single-producer / single-consumer byte ring of variable-size records. The owning thread writes
+ * records contiguously (a wrap marker skips the tail end of the buffer); the formatter thread reads them.
+ * A record that does not fit is dropped and counted, never waited for.
+ */
+class ThreadBuffer {
+  public:
+    static constexpr size_t kCapacity = 64 * 1024;
+
+    explicit ThreadBuffer(uint32_t thread_id) : thread_id_(thread_id) {}
+
+    template <typename... Args>
+    bool Write(uint8_t level, uint64_t timestamp_ns, const char* format, const Args&... args) {
+        const size_t payload = (sizeof(RecordHeader) + ... + detail::EncodedSize(args));
+        const size_t size = (payload + 7) & ~size_t{7};
+        const uint64_t tail = tail_.load(std::memory_order_relaxed);
+        const uint64_t head = head_.load(std::memory_order_acquire);
+        const size_t index = static_cast<size_t>(tail & (kCapacity - 1));
+        const size_t contiguous = kCapacity - index;
+        const size_t needed = (size <= contiguous) ? size : contiguous + size;
+        if (size >= kWrapMarker || needed > kCapacity - static_cast<size_t>(tail - head)) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        uint64_t write_pos = tail;
+        if (size > contiguous) {
+            const uint16_t marker = kWrapMarker;
+            std::memcpy(&buffer_[index], &marker, sizeof(marker));
+            write_pos += contiguous;
+        }
+        uint8_t* out = &buffer_[static_cast<size_t>(write_pos & (kCapacity - 1))];
+        RecordHeader header;
+        header.size = static_cast<uint16_t>(size);
+        header.level = level;
+        header.arg_count = static_cast<uint8_t>(sizeof...(Args));
+        header.thread_id = thread_id_;
+        header.timestamp_ns = timestamp_ns;
+        header.format = format;
+        std::memcpy(out, &header, sizeof(header));
+        [[maybe_unused]] uint8_t* arg_out = out + sizeof(header);
+        ((arg_out = detail::Encode(arg_out, args)), ...);
+        tail_.store(write_pos + size, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only
+    template <typename Visitor>
+    size_t Drain(Visitor&& visitor) {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        const uint64_t tail = tail_.load(std::memory_order_acquire);
+        size_t records = 0;
+        while (head < tail) {
+            const size_t index = static_cast<size_t>(head & (kCapacity - 1));
+            RecordHeader header;
+            std::memcpy(&header.size, &buffer_[index], sizeof(header.size));
+            if (header.size == kWrapMarker) {
+                head += kCapacity - index;
+                continue;
+            }
+            std::memcpy(&header, &buffer_[index], sizeof(header));
+            RecordView view;
+            view.level = header.level;
+            view.thread_id = header.thread_id;
+            view.timestamp_ns = header.timestamp_ns;
+            view.format = header.format;
+            view.args = &buffer_[index + sizeof(header)];
+            view.args_size = header.size - sizeof(header);
+            visitor(view);
+            head += header.size;
+            ++records;
+        }
+        head_.store(head, std::memory_order_release);
+        return records;
+    }
+
+    bool IsEmpty() const { return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire); }
+    uint64_t Dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+    std::atomic<bool> retired{false};  // owning thread exited; freed by the consumer once drained
+
+  private:
+    alignas(64) std::atomic<uint64_t> head_{0};
+    alignas(64) std::atomic<uint64_t> tail_{0};
+    std::atomic<uint64_t> dropped_{0};
+    uint32_t thread_id_;
+    alignas(8) std::array<uint8_t, kCapacity> buffer_{};
+};
+
+/**
+ * Process-wide registry of thread buffers. Write() touches only the calling thread's buffer; registration
+ * (first record of a thread) and Drain() take a mutex.
+ */
+class Logger {
+  public:
+    using ThreadIdProvider = uint32_t (*)();
+
+    static Logger& Instance() {
+        static Logger instance;
+        return instance;
+    }
+
+    // Thread ID stored in records (e.g. GetCurrentThreadId); set before the first record
+    void SetThreadIdProvider(ThreadIdProvider provider) { thread_id_provider_ = provider; }
+
+    template <typename... Args>
+    bool Write(uint8_t level, const char* format, const Args&... args) {
+        const uint64_t now_ns = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+        return CurrentBuffer().Write(level, now_ns, format, args...);
+    }
+
+    // Formatter thread: visit every pending record, thread by thread (each thread's records in order)
+    template <typename Visitor>
+    size_t Drain(Visitor&& visitor) {
+        std::lock_guard<std::mutex> lock(buffers_mutex_);
+        size_t records = 0;
+        for (auto it = buffers_.begin(); it != buffers_.end();) {
+            ThreadBuffer* buffer = *it;
+            const bool retired = buffer->retired.load(std::memory_order_acquire);
+            records += buffer->Drain(visitor);
+            if (retired) {
+                retired_dropped_ += buffer->Dropped();
+                delete buffer;
+                it = buffers_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        return records;
+    }
+
+    uint64_t Dropped() {
+        std::lock_guard<std::mutex> lock(buffers_mutex_);
+        uint64_t dropped = retired_dropped_;
+        for (const ThreadBuffer* buffer : buffers_) {
+            dropped += buffer->Dropped();
+        }
+        return dropped;
+    }
+
+  private:
+    struct ThreadSlot {
+        ThreadBuffer* buffer = nullptr;
+        ~ThreadSlot() {
+            if (buffer != nullptr) {
+                buffer->retired.store(true, std::memory_order_release);
+            }
+        }
+    };
+
+    ThreadBuffer& CurrentBuffer() {
+        thread_local ThreadSlot slot;
+        if (slot.buffer == nullptr) {
+            const uint32_t thread_id = thread_id_provider_ ? thread_id_provider_() : 0;
+            auto* buffer = new ThreadBuffer(thread_id);
+            std::lock_guard<std::mutex> lock(buffers_mutex_);
+            buffers_.push_back(buffer);
+            slot.buffer = buffer;
+        }
+        return *slot.buffer;
+    }
+
+    ThreadIdProvider thread_id_provider_ = nullptr;
+    std::mutex buffers_mutex_;
+    std::vector<ThreadBuffer*> buffers_;
+    uint64_t retired_dropped_ = 0;
+};
+
+// ---------------------------------------------------------------------------------------------------------------
+// Formatting (formatter thread and offline decoder)
+// ---------------------------------------------------------------------------------------------------------------
+
+// Length modifiers that make an integer conversion 64-bit with the MSVC runtime
+inline bool IsWideLength(const char* length, size_t size) {
+    if (size == 2 && length[0] == 'l' && length[1] == 'l') {
+        return true;
+    }
+    if (size == 3 && length[0] == 'I' && length[1] == '6' && length[2] == '4') {
+        return true;
+    }
+    return size == 1 && (length[0] == 'z' || length[0] == 'j' || length[0] == 't' || length[0] == 'I');
+}
+
+/**
+ * printf-format a record. Each conversion is re-issued to snprintf with its own flags/width/precision and a
+ * length modifier matching the stored 64-bit argument. Returns the number of characters written (truncated
+ * to capacity - 1, always NUL terminated). Malformed argument data ends formatting early.
+ */
+inline size_t FormatRecord(const char* format, const uint8_t* args, size_t args_size, char* out, size_t capacity) {
+    if (capacity == 0) {
+        return 0;
+    }
+    size_t used = 0;
+    size_t arg_pos = 0;
+    auto append = [&](const char* text, size_t length) {
+        const size_t n = (std::min)(length, capacity - 1 - used);
+        std::memcpy(out + used, text, n);
+        used += n;
+    };
+
+    size_t pos = 0;
+    for (;;) {
+        const Conversion conversion = NextConversion(format, pos);
+        // Literal text up to the conversion, with "%%" collapsed
+        for (size_t i = pos; i < conversion.begin; ++i) {
+            append(&format[i], 1);
+            if (format[i] == '%' && format[i + 1] == '%') {
+                ++i;
+            }
+        }
+        if (conversion.kind == ConversionClass::None || conversion.end == SIZE_MAX || arg_pos >= args_size) {
+            break;
+        }
+
+        // Spec without the original length modifier
+        char spec[32];
+        size_t spec_length = 0;
+        for (size_t i = conversion.begin; i < conversion.length_begin && spec_length < 24; ++i) {
+            spec[spec_length++] = format[i];
+        }
+        const char conversion_char = format[conversion.end - 1];
+
+        const ArgType type = static_cast<ArgType>(args[arg_pos++]);
+        char text[kMaxStringBytes + 64];
+        int written = 0;
+        if (type == ArgType::String) {
+            if (arg_pos + sizeof(uint16_t) > args_size) {
+                break;
+            }
+            uint16_t length = 0;
+            std::memcpy(&length, &args[arg_pos], sizeof(length));
+            arg_pos += sizeof(length);
+            if (arg_pos + length > args_size) {
+                break;
+            }
+            char value[kMaxStringBytes + 1];
+            std::memcpy(value, &args[arg_pos], length);
+            value[length] = '\0';
+            arg_pos += length;
+            spec[spec_length++] = 's';
+            spec[spec_length] = '\0';
+            written = std::snprintf(text, sizeof(text), spec, value);
+        } else {
+            if (arg_pos + sizeof(uint64_t) > args_size) {
+                break;
+            }
+            uint64_t bits = 0;
+            std::memcpy(&bits, &args[arg_pos], sizeof(bits));
+            arg_pos += sizeof(bits);
+            if (conversion.kind == ConversionClass::Float) {
+                double value = 0.0;
+                std::memcpy(&value, &bits, sizeof(value));
+                spec[spec_length++] = conversion_char;
+                spec[spec_length] = '\0';
+                written = std::snprintf(text, sizeof(text), spec, value);
+            } else if (conversion.kind == ConversionClass::Pointer) {
+                spec[spec_length++] = 'p';
+                spec[spec_length] = '\0';
+                written = std::snprintf(text, sizeof(text), spec, reinterpret_cast<void*>(static_cast<uintptr_t>(bits)));
+            } else if (conversion_char == 'c') {
+                spec[spec_length++] = 'c';
+                spec[spec_length] = '\0';
+                written = std::snprintf(text, sizeof(text), spec, static_cast<int>(bits));
+            } else {
+                // Reproduce the original call's integer width (long is 32 bits on Windows), then print as 64-bit
+                const bool wide = IsWideLength(format + conversion.length_begin,
+                                               conversion.length_end - conversion.length_begin);
+                spec[spec_length++] = 'l';
+                spec[spec_length++] = 'l';
+                spec[spec_length++] = conversion_char;
+                spec[spec_length] = '\0';
+                if (conversion_char == 'd' || conversion_char == 'i') {
+                    const long long value = wide ? static_cast<long long>(static_cast<int64_t>(bits))
+                                                 : static_cast<long long>(static_cast<int32_t>(static_cast<uint32_t>(bits)));
+                    written = std::snprintf(text, sizeof(text), spec, value);
+                } else {
+                    const unsigned long long value = wide ? bits : static_cast<uint32_t>(bits);
+                    written = std::snprintf(text, sizeof(text), spec, value);
+                }
+            }
+        }
+        if (written > 0) {
+            append(text, (std::min)(static_cast<size_t>(written), sizeof(text) - 1));
+        }
+        pos = conversion.end;
+    }
+    out[used] = '\0';
+    return used;
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+// Binary log file (.dcbl): header, then format definitions and records in arrival order
+// ---------------------------------------------------------------------------------------------------------------
+
+constexpr uint32_t kFileMagic = 0x4C424344;  // "DCBL"
+constexpr uint32_t kFileVersion = 1;
+constexpr uint8_t kFileEntryFormat = 1;  // uint32 id, uint16 length, text
+constexpr uint8_t kFileEntryRecord = 2;  // uint32 format id, uint8 level, uint32 thread, uint64 ns, uint16 size, args
+
+// Appends drained records to a file; format strings are written once, the first time they are seen
+class FileWriter {
+  public:
+    FileWriter() = default;
+    FileWriter(const FileWriter&) = delete;
+    FileWriter& operator=(const FileWriter&) = delete;
+    ~FileWriter() { Close(); }
+
+    bool Open(const char* path) {
+        Close();
+        file_ = std::fopen(path, "wb");
+        if (file_ == nullptr) {
+            return false;
+        }
+        const uint32_t header[2] = {kFileMagic, kFileVersion};
+        std::fwrite(header, sizeof(header), 1, file_);
+        return true;
+    }
+
+    bool IsOpen() const { return file_ != nullptr; }
+
+    void Write(const RecordView& record) {
+        if (file_ == nullptr) {
+            return;
+        }
+        auto [it, inserted] = format_ids_.try_emplace(record.format, static_cast<uint32_t>(format_ids_.size()));
+        if (inserted) {
+            const size_t length = (std::min)(std::strlen(record.format), size_t{0xFFFF});
+            const uint16_t length16 = static_cast<uint16_t>(length);
+            std::fputc(kFileEntryFormat, file_);
+            std::fwrite(&it->second, sizeof(uint32_t), 1, file_);
+            std::fwrite(&length16, sizeof(length16), 1, file_);
+            std::fwrite(record.format, 1, length, file_);
+        }
+        const uint16_t args_size = static_cast<uint16_t>(record.args_size);
+        std::fputc(kFileEntryRecord, file_);
+        std::fwrite(&it->second, sizeof(uint32_t), 1, file_);
+        std::fputc(record.level, file_);
+        std::fwrite(&record.thread_id, sizeof(record.thread_id), 1, file_);
+        std::fwrite(&record.timestamp_ns, sizeof(record.timestamp_ns), 1, file_);
+        std::fwrite(&args_size, sizeof(args_size), 1, file_);
+        std::fwrite(record.args, 1, record.args_size, file_);
+    }
+
+    void Flush() {
+        if (file_ != nullptr) {
+            std::fflush(file_);
+        }
+    }
+
+    void Close() {
+        if (file_ != nullptr) {
+            std::fclose(file_);
+            file_ = nullptr;
+        }
+        format_ids_.clear();
+    }
+
+  private:
+    std::FILE* file_ = nullptr;
+    std::unordered_map<const char*, uint32_t> format_ids_;
+};
+
+// Reads a .dcbl file, calling visitor(const RecordView&) per record (format points at the decoded text).
+// Returns false if the file cannot be opened or has the wrong header; a truncated tail is ignored.
+template <typename Visitor>
+bool ReadFile(const char* path, Visitor&& visitor) {
+    std::FILE* file = std::fopen(path, "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    uint32_t header[2] = {};
+    if (std::fread(header, sizeof(header), 1, file) != 1 || header[0] != kFileMagic || header[1] != kFileVersion) {
+        std::fclose(file);
+        return false;
+    }
+
+    std::vector<std::string> formats;
+    std::vector<uint8_t> args;
+    for (;;) {
+        const int kind = std::fgetc(file);
+        uint32_t id = 0;
+        if (kind == EOF || std::fread(&id, sizeof(id), 1, file) != 1) {
+            break;
+        }
+        if (kind == kFileEntryFormat) {
+            uint16_t length = 0;
+            if (std::fread(&length, sizeof(length), 1, file) != 1) {
+                break;
+            }
+            std::string text(length, '\0');
+            if (length > 0 && std::fread(text.data(), 1, length, file) != length) {
+                break;
+            }
+            if (formats.size() <= id) {
+                formats.resize(id + 1);
+            }
+            formats[id] = std::move(text);
+        } else if (kind == kFileEntryRecord) {
+            RecordView record;
+            uint16_t args_size = 0;
+            const int level = std::fgetc(file);
+            if (level == EOF || std::fread(&record.thread_id, sizeof(record.thread_id), 1, file) != 1 ||
+                std::fread(&record.timestamp_ns, sizeof(record.timestamp_ns), 1, file) != 1 ||
+                std::fread(&args_size, sizeof(args_size), 1, file) != 1) {
+                break;
+            }
+            args.resize(args_size);
+            if (args_size > 0 && std::fread(args.data(), 1, args_size, file) != args_size) {
+                break;
+            }
+            if (id >= formats.size()) {
+                continue;
+            }
+            record.level = static_cast<uint8_t>(level);
+            record.format = formats[id].c_str();
+            record.args = args.data();
+            record.args_size = args_size;
+            visitor(record);
+        } else {
+            break;
+        }
+    }
+    std::fclose(file);
+    return true;
+}
+
+} // namespace utils::binlog
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace utils {
+
+constexpr size_t kCounterShardCount = 16;
+
+// Shard used by the calling thread; threads are spread round-robin over the shards on first use
+inline size_t CurrentCounterShard() {
+    static std::atomic<size_t> next_shard{0};
+    thread_local const size_t shard = next_shard.fetch_add(1, std::memory_order_relaxed) % kCounterShardCount;
+    return shard;
+}
+
+/**
+ * Table of Rows x Columns event counters, sharded per thread.
+ *
+ * Every thread increments its own cache-line aligned copy of the table with a relaxed fetch_add, so hooks
+ * called from many threads (render, input, audio) never bounce a shared counter line between cores. Reads
+ * sum all shards; they are meant for the UI and are only as exact as a relaxed snapshot can be.
+ *
+ * Columns let one registry hold several counters per row (e.g. total / suppressed calls per hook).
+ */
+template <typename T, size_t Rows, size_t Columns = 1>
+class CounterRegistry {
+  public:
+    static_assert(std::atomic<T>::is_always_lock_free, "counters must be lock-free");
+
+    CounterRegistry() = default;
+    CounterRegistry(const CounterRegistry&) = delete;
+    CounterRegistry& operator=(const CounterRegistry&) = delete;
+
+    static constexpr size_t size() { return Rows; }
+    static constexpr size_t columns() { return Columns; }
+
+    void Increment(size_t row, size_t column = 0, T amount = 1) {
+        shards_[CurrentCounterShard()].values[row * Columns + column].fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    T Load(size_t row, size_t column = 0) const {
+        T sum = 0;
+        for (const Shard& shard : shards_) {
+            sum += shard.values[row * Columns + column].load(std::memory_order_relaxed);
+        }
+        return sum;
+    }
+
+    // Sum of one column over all rows
+    T LoadTotal(size_t column = 0) const {
+        T sum = 0;
+        for (size_t row = 0; row < Rows; ++row) {
+            sum += Load(row, column);
+        }
+        return sum;
+    }
+
+    // Increments racing with a reset may survive it
+    void Reset(size_t row) {
+        for (Shard& shard : shards_) {
+            for (size_t column = 0; column < Columns; ++column) {
+                shard.values[row * Columns + column].store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void ResetAll() {
+        for (Shard& shard : shards_) {
+            for (std::atomic<T>& value : shard.values) {
+                value.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+  private:
+    struct alignas(64) Shard {
+        std::array<std::atomic<T>, Rows * Columns> values{};
+    };
+
+    std::array<Shard, kCounterShardCount> shards_{};
+};
+
+} // namespace utils
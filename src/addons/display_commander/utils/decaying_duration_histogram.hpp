@@ -0,0 +1,92 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace utils {
+
+// Exponentially decaying histogram of durations with 4 buckets per octave (64 ns .. ~67 ms).
+// Counts are halved every kDecayInterval samples so the distribution follows system load changes.
+class DecayingDurationHistogram {
+  public:
+    static constexpr size_t kBucketCount = 80;
+    static constexpr uint32_t kDecayInterval = 256;
+
+    void Add(int64_t duration_ns) {
+        ++counts_[BucketIndex(duration_ns)];
+        ++total_;
+        if (++samples_since_decay_ >= kDecayInterval) {
+            samples_since_decay_ = 0;
+            total_ = 0;
+            for (auto& count : counts_) {
+                count >>= 1;
+                total_ += count;
+            }
+        }
+        ++sample_count_;
+    }
+
+    // Lower bound of the bucket containing quantile q (conservative: never above the true quantile)
+    int64_t Quantile(double q) const {
+        if (total_ == 0) {
+            return 0;
+        }
+        const uint64_t rank = (std::max)(static_cast<uint64_t>(q * static_cast<double>(total_)), uint64_t{1});
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < kBucketCount; ++i) {
+            cumulative += counts_[i];
+            if (cumulative >= rank) {
+                return (i == 0) ? 0 : BucketLowerBound(i);  // bucket 0 also holds everything below 64 ns
+            }
+        }
+        return BucketLowerBound(kBucketCount - 1);
+    }
+
+    // Upper bound of the bucket containing quantile q (conservative: never below the true quantile)
+    int64_t QuantileUpperBound(double q) const {
+        if (total_ == 0) {
+            return 0;
+        }
+        const uint64_t rank = (std::max)(static_cast<uint64_t>(q * static_cast<double>(total_)), uint64_t{1});
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i < kBucketCount; ++i) {
+            cumulative += counts_[i];
+            if (cumulative >= rank) {
+                return BucketLowerBound(i + 1);
+            }
+        }
+        return BucketLowerBound(kBucketCount);
+    }
+
+    // Total samples observed since construction or Reset() (not decayed)
+    uint64_t SampleCount() const { return sample_count_; }
+
+    void Reset() { *this = DecayingDurationHistogram(); }
+
+    static size_t BucketIndex(int64_t duration_ns) {
+        if (duration_ns < 64) {
+            return 0;
+        }
+        const uint64_t v = static_cast<uint64_t>(duration_ns);
+        const int msb = static_cast<int>(std::bit_width(v)) - 1;
+        const size_t sub = static_cast<size_t>((v >> (msb - 2)) & 3);
+        return (std::min)(static_cast<size_t>(msb - 6) * 4 + sub, kBucketCount - 1);
+    }
+
+    static int64_t BucketLowerBound(size_t index) {
+        const int msb = static_cast<int>(index / 4) + 6;
+        const int64_t sub = static_cast<int64_t>(index % 4);
+        return (int64_t{1} << msb) + sub * (int64_t{1} << (msb - 2));
+    }
+
+  private:
+    std::array<uint32_t, kBucketCount> counts_{};
+    uint64_t total_ = 0;
+    uint64_t sample_count_ = 0;
+    uint32_t samples_since_decay_ = 0;
+};
+
+} // namespace utils
@@ -1,8 +1,6 @@
 #include "display_commander_logger.hpp"
-#include <fstream>
-#include <sstream>
-#include <iomanip>
 #include <cstdarg>
+#include <cstdio>
 #include <filesystem>
 
 namespace display_commander::logger {
@@ -12,38 +10,54 @@ DisplayCommanderLogger& DisplayCommanderLogger::GetInstance() {
     return instance;
 }
 
+DisplayCommanderLogger::~DisplayCommanderLogger() {
+    // Static destruction at process exit: the writer thread has already been terminated by the OS
+    if (writer_thread_.joinable()) {
+        writer_thread_.detach();
+    }
+}
+
 void DisplayCommanderLogger::Initialize(const std::string& log_path) {
-    AcquireSRWLockExclusive(&lock_);
+    AcquireSRWLockExclusive(&lifecycle_lock_);
 
-    if (initialized_) {
-        ReleaseSRWLockExclusive(&lock_);
+    if (initialized_.load()) {
+        ReleaseSRWLockExclusive(&lifecycle_lock_);
         return;
     }
 
     log_path_ = log_path;
 
     // Create directory if it doesn't exist
-    std::filesystem::path log_dir = std::filesystem::path(log_path_).parent_path();
-    if (!log_dir.empty() && !std::filesystem::exists(log_dir)) {
-        std::filesystem::create_directories(log_dir);
+    try {
+        std::filesystem::path log_dir = std::filesystem::path(log_path_).parent_path();
+        if (!log_dir.empty() && !std::filesystem::exists(log_dir)) {
+            std::filesystem::create_directories(log_dir);
+        }
+    } catch (...) {
+        // CreateFile below reports the failure by leaving the handle invalid
     }
 
+    // One handle for the whole session; FILE_APPEND_DATA makes every WriteFile an atomic append
+    file_ = CreateFileA(log_path_.c_str(), FILE_APPEND_DATA, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                        nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+    initialized_.store(true);
+    writer_running_.store(true);
+    writer_thread_ = std::thread(&DisplayCommanderLogger::WriterThread, this);
+
     // Write initial log entry
-    WriteToFile(FormatMessage(LogLevel::Info, "DisplayCommander Logger initialized"));
+    Enqueue(LogLevel::Info, "DisplayCommander Logger initialized");
 
-    initialized_ = true;
-    ReleaseSRWLockExclusive(&lock_);
+    ReleaseSRWLockExclusive(&lifecycle_lock_);
 }
 
-void DisplayCommanderLogger::Log(LogLevel level, const std::string& message) {
-    if (!initialized_) {
+void DisplayCommanderLogger::Log(LogLevel level, const std::string& message) { Log(level, message.c_str()); }
+
+void DisplayCommanderLogger::Log(LogLevel level, const char* message) {
+    if (!initialized_.load(std::memory_order_relaxed)) {
         return;
     }
-
-    AcquireSRWLockExclusive(&lock_);
-    std::string formatted_message = FormatMessage(level, message);
-    WriteToFile(formatted_message);
-    ReleaseSRWLockExclusive(&lock_);
+    Enqueue(level, message);
 }
 
 void DisplayCommanderLogger::LogDebug(const std::string& message) {
@@ -62,57 +76,112 @@ void DisplayCommanderLogger::LogError(const std::string& message) {
     Log(LogLevel::Error, message);
 }
 
-void DisplayCommanderLogger::Shutdown() {
-    AcquireSRWLockExclusive(&lock_);
+void DisplayCommanderLogger::Flush() {
+    if (!initialized_.load()) {
+        return;
+    }
+    // The writer thread may be mid-batch, or may have died holding the lock during a crash: wait briefly only
+    for (int attempt = 0; attempt < 50; ++attempt) {
+        if (TryAcquireSRWLockExclusive(&drain_lock_)) {
+            WriteToFile();
+            ReleaseSRWLockExclusive(&drain_lock_);
+            return;
+        }
+        Sleep(1);
+    }
+}
 
-    if (initialized_) {
-        WriteToFile(FormatMessage(LogLevel::Info, "DisplayCommander Logger shutting down"));
-        initialized_ = false;
+LoggerStats DisplayCommanderLogger::GetStats() const {
+    const auto stats = queue_.GetStats();
+    LoggerStats result;
+    result.written_records = stats.written;
+    result.dropped_records = stats.dropped;
+    result.batches = stats.batches;
+    return result;
+}
+
+void DisplayCommanderLogger::Shutdown() {
+    AcquireSRWLockExclusive(&lifecycle_lock_);
+
+    if (initialized_.load()) {
+        Enqueue(LogLevel::Info, "DisplayCommander Logger shutting down");
+        writer_running_.store(false);
+        queue_.Wake();
+        if (writer_thread_.joinable()) {
+            writer_thread_.join();
+        }
+        initialized_.store(false);
+
+        // Records logged while the writer was stopping
+        AcquireSRWLockExclusive(&drain_lock_);
+        WriteToFile();
+        if (file_ != INVALID_HANDLE_VALUE) {
+            CloseHandle(file_);
+            file_ = INVALID_HANDLE_VALUE;
+        }
+        ReleaseSRWLockExclusive(&drain_lock_);
     }
 
-    ReleaseSRWLockExclusive(&lock_);
+    ReleaseSRWLockExclusive(&lifecycle_lock_);
 }
 
-void DisplayCommanderLogger::WriteToFile(const std::string& formatted_message) {
-    try {
-        std::ofstream log_file(log_path_, std::ios::app);
-        if (log_file.is_open()) {
-            log_file << formatted_message;
-            log_file.flush(); // Force flush to ensure data is written
-            log_file.close();
+void DisplayCommanderLogger::Enqueue(LogLevel level, const char* message) {
+    queue_.TryPush(
+        [level, message](char* dst, size_t capacity) { return FormatRecord(dst, capacity, level, message); });
+}
+
+void DisplayCommanderLogger::WriterThread() {
+    while (writer_running_.load()) {
+        queue_.WaitForRecords(std::chrono::milliseconds(100));
+        AcquireSRWLockExclusive(&drain_lock_);
+        WriteToFile();
+        ReleaseSRWLockExclusive(&drain_lock_);
+    }
+}
+
+void DisplayCommanderLogger::WriteToFile() {
+    queue_.Drain(batch_, kBatchBytes, [this](const char* data, size_t size) {
+        if (file_ != INVALID_HANDLE_VALUE) {
+            DWORD written = 0;
+            WriteFile(file_, data, static_cast<DWORD>(size), &written, nullptr);
         }
 
-        // Also output to debug console for development
-        OutputDebugStringA(formatted_message.c_str());
-    } catch (...) {
-        // Ignore any errors during logging to prevent crashes
+        // Also output to debug console for development (data is batch_, which has room for the terminator)
+        batch_[size] = '\0';
+        OutputDebugStringA(data);
+    });
+
+    // Report records lost to a full queue once they are known
+    const uint64_t dropped = queue_.GetStats().dropped;
+    if (dropped != reported_dropped_ && file_ != INVALID_HANDLE_VALUE) {
+        char line[128];
+        const int length = snprintf(line, sizeof(line), "[logger] %llu records dropped (queue full)\r\n",
+                                    static_cast<unsigned long long>(dropped - reported_dropped_));
+        DWORD written = 0;
+        WriteFile(file_, line, static_cast<DWORD>(length), &written, nullptr);
+        reported_dropped_ = dropped;
     }
 }
 
-std::string DisplayCommanderLogger::FormatMessage(LogLevel level, const std::string& message) {
+size_t DisplayCommanderLogger::FormatRecord(char* dst, size_t capacity, LogLevel level, const char* message) {
     // Get current time
     SYSTEMTIME time;
     GetLocalTime(&time);
 
-    // Format timestamp
-    std::ostringstream timestamp;
-    timestamp << std::setfill('0')
-              << std::setw(2) << time.wHour << ":"
-              << std::setw(2) << time.wMinute << ":"
-              << std::setw(2) << time.wSecond << ":"
-              << std::setw(3) << time.wMilliseconds;
-
-    // Format the complete log line
-    std::ostringstream log_line;
-    log_line << timestamp.str()
-             << " [" << std::setw(5) << GetCurrentThreadId() << "] | "
-             << std::setw(7) << GetLogLevelString(level) << " | "
-             << message << "\r\n";
-
-    return log_line.str();
+    // Same layout as before: "HH:MM:SS:mmm [  tid] |   LEVEL | message"
+    int length = snprintf(dst, capacity, "%02u:%02u:%02u:%03u [%5lu] | %7s | %s", time.wHour, time.wMinute,
+                          time.wSecond, time.wMilliseconds, GetCurrentThreadId(), GetLogLevelString(level), message);
+    if (length < 0) {
+        return 0;
+    }
+    // Truncated records still end with a line break
+    size_t size = (static_cast<size_t>(length) < capacity - 2) ? static_cast<size_t>(length) : capacity - 2;
+    dst[size++] = '\r';
+    dst[size++] = '\n';
+    return size;
 }
 
-std::string DisplayCommanderLogger::GetLogLevelString(LogLevel level) {
+const char* DisplayCommanderLogger::GetLogLevelString(LogLevel level) {
     switch (level) {
         case LogLevel::Debug:   return "DEBUG";
         case LogLevel::Info:    return "INFO";
@@ -133,7 +202,7 @@ void LogDebug(const char* msg, ...) {
     char buffer[1024];
     vsnprintf(buffer, sizeof(buffer), msg, args);
     va_end(args);
-    DisplayCommanderLogger::GetInstance().LogDebug(buffer);
+    DisplayCommanderLogger::GetInstance().Log(LogLevel::Debug, buffer);
 }
 
 void LogInfo(const char* msg, ...) {
@@ -142,7 +211,7 @@ void LogInfo(const char* msg, ...) {
     char buffer[1024];
     vsnprintf(buffer, sizeof(buffer), msg, args);
     va_end(args);
-    DisplayCommanderLogger::GetInstance().LogInfo(buffer);
+    DisplayCommanderLogger::GetInstance().Log(LogLevel::Info, buffer);
 }
 
 void LogWarning(const char* msg, ...) {
@@ -151,7 +220,7 @@ void LogWarning(const char* msg, ...) {
     char buffer[1024];
     vsnprintf(buffer, sizeof(buffer), msg, args);
     va_end(args);
-    DisplayCommanderLogger::GetInstance().LogWarning(buffer);
+    DisplayCommanderLogger::GetInstance().Log(LogLevel::Warning, buffer);
 }
 
 void LogError(const char* msg, ...) {
@@ -160,7 +229,11 @@ void LogError(const char* msg, ...) {
     char buffer[1024];
     vsnprintf(buffer, sizeof(buffer), msg, args);
     va_end(args);
-    DisplayCommanderLogger::GetInstance().LogError(buffer);
+    DisplayCommanderLogger::GetInstance().Log(LogLevel::Error, buffer);
+}
+
+void Flush() {
+    DisplayCommanderLogger::GetInstance().Flush();
 }
 
 void Shutdown() {
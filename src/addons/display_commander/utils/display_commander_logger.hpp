@@ -1,7 +1,12 @@
 #pragma once
 
+#include "async_log_queue.hpp"
+
 #include <windows.h>
+#include <atomic>
+#include <cstdint>
 #include <string>
+#include <thread>
 
 namespace display_commander::logger {
 
@@ -13,7 +18,15 @@ enum class LogLevel {
     Error
 };
 
-// Thread-safe logger class using SRWLockExclusive
+// Counters of the async pipeline
+struct LoggerStats {
+    uint64_t written_records = 0;
+    uint64_t dropped_records = 0;  // queue was full
+    uint64_t batches = 0;          // WriteFile calls
+};
+
+// Asynchronous logger: callers format into a lock-free record queue, a writer thread batch-appends the
+// records to DisplayCommander.log through one persistent file handle
 class DisplayCommanderLogger {
 public:
     static DisplayCommanderLogger& GetInstance();
@@ -23,6 +36,7 @@ public:
 
     // Log a message with specified level
     void Log(LogLevel level, const std::string& message);
+    void Log(LogLevel level, const char* message);
 
     // Convenience methods
     void LogDebug(const std::string& message);
@@ -30,22 +44,42 @@ public:
     void LogWarning(const std::string& message);
     void LogError(const std::string& message);
 
+    // Write everything queued so far on the calling thread (crash / exit paths); never blocks for long
+    void Flush();
+
+    LoggerStats GetStats() const;
+
     // Shutdown logger
     void Shutdown();
 
 private:
+    static constexpr size_t kRecordBytes = 1024;
+    static constexpr size_t kQueueCapacity = 1024;
+    static constexpr size_t kBatchBytes = 64 * 1024;
+    using RecordQueue = utils::AsyncLogQueue<kRecordBytes, kQueueCapacity>;
+
     DisplayCommanderLogger() = default;
-    ~DisplayCommanderLogger() = default;
+    ~DisplayCommanderLogger();
     DisplayCommanderLogger(const DisplayCommanderLogger&) = delete;
     DisplayCommanderLogger& operator=(const DisplayCommanderLogger&) = delete;
 
-    void WriteToFile(const std::string& formatted_message);
-    std::string FormatMessage(LogLevel level, const std::string& message);
-    std::string GetLogLevelString(LogLevel level);
+    void Enqueue(LogLevel level, const char* message);
+    void WriterThread();
+    // Drain the queue into the file; the caller holds drain_lock_
+    void WriteToFile();
+    static size_t FormatRecord(char* dst, size_t capacity, LogLevel level, const char* message);
+    static const char* GetLogLevelString(LogLevel level);
 
     std::string log_path_;
-    bool initialized_ = false;
-    SRWLOCK lock_ = SRWLOCK_INIT;
+    std::atomic<bool> initialized_{false};
+    std::atomic<bool> writer_running_{false};
+    SRWLOCK lifecycle_lock_ = SRWLOCK_INIT;  // Initialize / Shutdown
+    SRWLOCK drain_lock_ = SRWLOCK_INIT;      // single consumer: writer thread or Flush()
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    std::thread writer_thread_;
+    uint64_t reported_dropped_ = 0;  // under drain_lock_
+    char batch_[kBatchBytes + 1];    // under drain_lock_ (+1 for the debug output terminator)
+    RecordQueue queue_;
 };
 
 // Global convenience functions
@@ -54,6 +88,7 @@ void LogDebug(const char* msg, ...);
 void LogInfo(const char* msg, ...);
 void LogWarning(const char* msg, ...);
 void LogError(const char* msg, ...);
+void Flush();
 void Shutdown();
 
 } // namespace display_commander::logger
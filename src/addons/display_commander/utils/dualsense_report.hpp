@@ -0,0 +1,307 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+namespace utils {
+
+// CRC32 (IEEE 802.3, reflected 0xEDB88320) lookup tables for slice-by-8: table k advances a byte through k more zeros
+inline constexpr std::array<std::array<uint32_t, 256>, 8> MakeCrc32Tables() {
+    std::array<std::array<uint32_t, 256>, 8> tables{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ ((crc & 1u) != 0 ? 0xEDB88320u : 0u);
+        }
+        tables[0][i] = crc;
+    }
+    for (size_t k = 1; k < 8; ++k) {
+        for (uint32_t i = 0; i < 256; ++i) {
+            const uint32_t previous = tables[k - 1][i];
+            tables[k][i] = (previous >> 8) ^ tables[0][previous & 0xFF];
+        }
+    }
+    return tables;
+}
+
+inline constexpr auto kCrc32Tables = MakeCrc32Tables();
+
+inline constexpr uint32_t LoadLe32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16)
+           | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+inline constexpr uint16_t LoadLe16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+// Standard CRC32 (same as zlib crc32); pass the CRC of the preceding bytes as `crc` to continue a running checksum
+inline constexpr uint32_t Crc32(const uint8_t* data, size_t size, uint32_t crc = 0) {
+    const auto& t = kCrc32Tables;
+    crc = ~crc;
+    while (size >= 8) {
+        const uint32_t lo = LoadLe32(data) ^ crc;
+        const uint32_t hi = LoadLe32(data + 4);
+        crc = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF] ^ t[5][(lo >> 16) & 0xFF] ^ t[4][lo >> 24]
+              ^ t[3][hi & 0xFF] ^ t[2][(hi >> 8) & 0xFF] ^ t[1][(hi >> 16) & 0xFF] ^ t[0][hi >> 24];
+        data += 8;
+        size -= 8;
+    }
+    while (size-- > 0) {
+        crc = (crc >> 8) ^ t[0][(crc ^ *data++) & 0xFF];
+    }
+    return ~crc;
+}
+
+// Normalized buttons. The low 16 bits use the XInput wButtons layout (Cross = A, Circle = B, Square = X,
+// Triangle = Y, Create = Back, Options = Start, PS = Guide), so truncating gives an XInput button word.
+struct DualSenseButtons {
+    static constexpr uint32_t kDpadUp = 0x0001;
+    static constexpr uint32_t kDpadDown = 0x0002;
+    static constexpr uint32_t kDpadLeft = 0x0004;
+    static constexpr uint32_t kDpadRight = 0x0008;
+    static constexpr uint32_t kOptions = 0x0010;
+    static constexpr uint32_t kCreate = 0x0020;
+    static constexpr uint32_t kL3 = 0x0040;
+    static constexpr uint32_t kR3 = 0x0080;
+    static constexpr uint32_t kL1 = 0x0100;
+    static constexpr uint32_t kR1 = 0x0200;
+    static constexpr uint32_t kHome = 0x0400;
+    static constexpr uint32_t kCross = 0x1000;
+    static constexpr uint32_t kCircle = 0x2000;
+    static constexpr uint32_t kSquare = 0x4000;
+    static constexpr uint32_t kTriangle = 0x8000;
+    // DualSense only
+    static constexpr uint32_t kL2 = 0x010000;
+    static constexpr uint32_t kR2 = 0x020000;
+    static constexpr uint32_t kTouchpad = 0x040000;
+    static constexpr uint32_t kMute = 0x080000;
+    static constexpr uint32_t kLeftFunction = 0x100000;  // DualSense Edge
+    static constexpr uint32_t kRightFunction = 0x200000; // DualSense Edge
+    static constexpr uint32_t kLeftPaddle = 0x400000;    // DualSense Edge
+    static constexpr uint32_t kRightPaddle = 0x800000;   // DualSense Edge
+};
+
+// DualSenseState::plugged bits
+struct DualSensePlugged {
+    static constexpr uint8_t kHeadphones = 0x01;
+    static constexpr uint8_t kMic = 0x02;
+    static constexpr uint8_t kMicMuted = 0x04;
+    static constexpr uint8_t kUsbData = 0x08;
+    static constexpr uint8_t kUsbPower = 0x10;
+    static constexpr uint8_t kExternalMic = 0x20;  // external mic active
+};
+
+struct DualSenseTouchPoint {
+    uint16_t x = 0;  // 0-1919
+    uint16_t y = 0;  // 0-1079
+    uint8_t id = 0;  // increments with every new touch
+    bool active = false;
+};
+
+// Everything the addon reads from an input report, independent of the transport
+struct DualSenseState {
+    uint32_t buttons = 0;  // DualSenseButtons bits
+    uint8_t left_x = 128;  // sticks are raw 0-255 with 128 centered and Y growing downwards
+    uint8_t left_y = 128;
+    uint8_t right_x = 128;
+    uint8_t right_y = 128;
+    uint8_t left_trigger = 0;
+    uint8_t right_trigger = 0;
+    uint8_t sequence = 0;       // report counter of the controller
+    uint8_t battery_level = 0;  // 0-10
+    uint8_t power_state = 0;    // high nibble of the battery byte
+    uint8_t plugged = 0;        // DualSensePlugged bits
+    int8_t temperature = 0;
+    bool bluetooth = false;
+    int16_t gyro[3] = {};   // report order
+    int16_t accel[3] = {};  // report order
+    uint32_t sensor_timestamp = 0;
+    DualSenseTouchPoint touch[2] = {};
+};
+
+enum class DualSenseDecodeResult : uint8_t { Ok, TooShort, UnknownReport, BadCrc };
+
+// Transport layouts: both carry the same payload, at a different offset; BT appends a CRC32 over seed 0xA1 + report
+struct DualSenseReportLayout {
+    uint8_t report_id;
+    uint8_t payload_offset;
+    uint8_t size;
+    bool bluetooth;
+};
+
+inline constexpr DualSenseReportLayout kDualSenseUsbLayout{0x01, 1, 64, false};
+inline constexpr DualSenseReportLayout kDualSenseBtLayout{0x31, 2, 78, true};
+inline constexpr size_t kDualSenseMaxReportSize = 78;
+inline constexpr size_t kDualSenseBtCrcOffset = 74;
+inline constexpr uint8_t kDualSenseBtInputCrcSeed = 0xA1;
+// Running CRC after the seed byte, so validation only hashes the report itself
+inline constexpr uint32_t kDualSenseBtInputCrcPrefix = Crc32(&kDualSenseBtInputCrcSeed, 1);
+
+inline bool ValidateDualSenseBtCrc(const uint8_t* report) {
+    return Crc32(report, kDualSenseBtCrcOffset, kDualSenseBtInputCrcPrefix) == LoadLe32(report + kDualSenseBtCrcOffset);
+}
+
+namespace dualsense_detail {
+
+// Payload field offsets (shared by USB and BT)
+inline constexpr size_t kSticks = 0;    // LX, LY, RX, RY, L2, R2, sequence
+inline constexpr size_t kButtons = 7;   // 3 bytes: dpad + face, shoulders + system, PS + pad + mute + Edge
+inline constexpr size_t kGyro = 15;     // 3 x int16
+inline constexpr size_t kAccel = 21;    // 3 x int16
+inline constexpr size_t kSensorTimestamp = 27;
+inline constexpr size_t kTemperature = 31;
+inline constexpr size_t kTouch = 32;    // 2 x 4 bytes
+inline constexpr size_t kBattery = 52;
+inline constexpr size_t kPlugged = 53;  // 2 bytes
+
+struct ButtonBit {
+    uint8_t byte;  // 0-2 within the button bytes
+    uint8_t mask;
+    uint32_t button;
+};
+
+inline constexpr ButtonBit kButtonBits[] = {
+    {0, 0x10, DualSenseButtons::kSquare},       {0, 0x20, DualSenseButtons::kCross},
+    {0, 0x40, DualSenseButtons::kCircle},       {0, 0x80, DualSenseButtons::kTriangle},
+    {1, 0x01, DualSenseButtons::kL1},           {1, 0x02, DualSenseButtons::kR1},
+    {1, 0x04, DualSenseButtons::kL2},           {1, 0x08, DualSenseButtons::kR2},
+    {1, 0x10, DualSenseButtons::kCreate},       {1, 0x20, DualSenseButtons::kOptions},
+    {1, 0x40, DualSenseButtons::kL3},           {1, 0x80, DualSenseButtons::kR3},
+    {2, 0x01, DualSenseButtons::kHome},         {2, 0x02, DualSenseButtons::kTouchpad},
+    {2, 0x04, DualSenseButtons::kMute},         {2, 0x10, DualSenseButtons::kLeftFunction},
+    {2, 0x20, DualSenseButtons::kRightFunction}, {2, 0x40, DualSenseButtons::kLeftPaddle},
+    {2, 0x80, DualSenseButtons::kRightPaddle},
+};
+
+// Hat switch 0-7 clockwise from up; 8-15 = released
+inline constexpr uint32_t kDpad[16] = {
+    DualSenseButtons::kDpadUp,
+    DualSenseButtons::kDpadUp | DualSenseButtons::kDpadRight,
+    DualSenseButtons::kDpadRight,
+    DualSenseButtons::kDpadDown | DualSenseButtons::kDpadRight,
+    DualSenseButtons::kDpadDown,
+    DualSenseButtons::kDpadDown | DualSenseButtons::kDpadLeft,
+    DualSenseButtons::kDpadLeft,
+    DualSenseButtons::kDpadUp | DualSenseButtons::kDpadLeft,
+};
+
+// One table per button byte, so the whole button word is three lookups and two ORs
+inline constexpr std::array<std::array<uint32_t, 256>, 3> MakeButtonTables() {
+    std::array<std::array<uint32_t, 256>, 3> tables{};
+    for (uint32_t value = 0; value < 256; ++value) {
+        tables[0][value] = kDpad[value & 0x0F];
+        for (const ButtonBit& bit : kButtonBits) {
+            if ((value & bit.mask) != 0) {
+                tables[bit.byte][value] |= bit.button;
+            }
+        }
+    }
+    return tables;
+}
+
+inline constexpr auto kButtonTables = MakeButtonTables();
+
+inline DualSenseTouchPoint DecodeTouch(const uint8_t* p) {
+    DualSenseTouchPoint point;
+    point.active = (p[0] & 0x80) == 0;
+    point.id = p[0] & 0x7F;
+    point.x = static_cast<uint16_t>(p[1] | ((p[2] & 0x0F) << 8));
+    point.y = static_cast<uint16_t>((p[2] >> 4) | (p[3] << 4));
+    return point;
+}
+
+} // namespace dualsense_detail
+
+/**
+ * Typed, non-owning view over a raw DualSense input report.
+ *
+ * Construction picks the transport layout from the report ID and checks the size; the accessors then read fields
+ * straight out of the caller's buffer. Byte-wise little-endian loads keep it independent of alignment and host byte
+ * order; compilers fold them into single loads on x86 and ARM.
+ */
+class DualSenseReportView {
+  public:
+    DualSenseReportView(const uint8_t* report, size_t size) : report_(report) {
+        if (size == 0) {
+            status_ = DualSenseDecodeResult::TooShort;
+            return;
+        }
+        for (const DualSenseReportLayout* layout : {&kDualSenseUsbLayout, &kDualSenseBtLayout}) {
+            if (report[0] == layout->report_id) {
+                layout_ = layout;
+                status_ = size < layout->size ? DualSenseDecodeResult::TooShort : DualSenseDecodeResult::Ok;
+                return;
+            }
+        }
+        status_ = DualSenseDecodeResult::UnknownReport;
+    }
+
+    DualSenseDecodeResult Status() const { return status_; }
+    bool Valid() const { return status_ == DualSenseDecodeResult::Ok; }
+    bool IsBluetooth() const { return layout_ != nullptr && layout_->bluetooth; }
+
+    // Start of the transport-independent payload; only meaningful when Valid()
+    const uint8_t* Payload() const { return report_ + layout_->payload_offset; }
+    uint8_t Byte(size_t offset) const { return Payload()[offset]; }
+    int16_t Int16(size_t offset) const { return static_cast<int16_t>(LoadLe16(Payload() + offset)); }
+    uint32_t UInt32(size_t offset) const { return LoadLe32(Payload() + offset); }
+
+    uint32_t Buttons() const {
+        const uint8_t* b = Payload() + dualsense_detail::kButtons;
+        const auto& t = dualsense_detail::kButtonTables;
+        return t[0][b[0]] | t[1][b[1]] | t[2][b[2]];
+    }
+
+    bool CrcValid() const { return !IsBluetooth() || ValidateDualSenseBtCrc(report_); }
+
+  private:
+    const uint8_t* report_;
+    const DualSenseReportLayout* layout_ = nullptr;
+    DualSenseDecodeResult status_ = DualSenseDecodeResult::UnknownReport;
+};
+
+/**
+ * Decodes a USB (0x01, 64 bytes) or Bluetooth (0x31, 78 bytes) input report in one pass.
+ *
+ * BT reports are only accepted with a matching CRC32; pass verify_crc = false if the transport already checked it.
+ * `out` is left untouched unless the result is Ok.
+ */
+inline DualSenseDecodeResult DecodeDualSenseReport(const uint8_t* report, size_t size, DualSenseState& out,
+                                                   bool verify_crc = true) {
+    namespace d = dualsense_detail;
+    const DualSenseReportView view(report, size);
+    if (!view.Valid()) {
+        return view.Status();
+    }
+    if (verify_crc && !view.CrcValid()) {
+        return DualSenseDecodeResult::BadCrc;
+    }
+
+    const uint8_t* p = view.Payload();
+    out.buttons = view.Buttons();
+    out.left_x = p[d::kSticks + 0];
+    out.left_y = p[d::kSticks + 1];
+    out.right_x = p[d::kSticks + 2];
+    out.right_y = p[d::kSticks + 3];
+    out.left_trigger = p[d::kSticks + 4];
+    out.right_trigger = p[d::kSticks + 5];
+    out.sequence = p[d::kSticks + 6];
+    for (size_t axis = 0; axis < 3; ++axis) {
+        out.gyro[axis] = view.Int16(d::kGyro + (2 * axis));
+        out.accel[axis] = view.Int16(d::kAccel + (2 * axis));
+    }
+    out.sensor_timestamp = view.UInt32(d::kSensorTimestamp);
+    out.temperature = static_cast<int8_t>(p[d::kTemperature]);
+    out.touch[0] = d::DecodeTouch(p + d::kTouch);
+    out.touch[1] = d::DecodeTouch(p + d::kTouch + 4);
+    out.battery_level = p[d::kBattery] & 0x0F;
+    out.power_state = p[d::kBattery] >> 4;
+    out.plugged = static_cast<uint8_t>((p[d::kPlugged] & 0x1F) | ((p[d::kPlugged + 1] & 0x01) << 5));
+    out.bluetooth = view.IsBluetooth();
+    return DualSenseDecodeResult::Ok;
+}
+
+} // namespace utils
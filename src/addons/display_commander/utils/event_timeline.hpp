@@ -0,0 +1,292 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace utils {
+
+enum class TimelineEvent : uint32_t {
+    kNone = 0,
+    kSimulation = 1,     // slice: previous present returned -> first render submit; value unused
+    kRenderSubmit = 2,   // slice: first render submit -> OnPresentUpdateBefore
+    kLimiterSleep = 3,   // slice: limiter wait; value = wake - requested target (ns)
+    kPresent = 4,        // slice: limiter done -> Present returned
+    kGpuCompletion = 5,  // instant: GPU finished the frame; value = GPU time since present start (ns)
+    kReflexMarker = 6,   // instant: Reflex latency marker; value = NV_LATENCY_MARKER_TYPE
+    kCount
+};
+
+struct TimelineEventInfo {
+    const char* name;
+    const char* value_name;  // debug annotation name for the value; nullptr = no value
+    bool instant;
+};
+
+inline const TimelineEventInfo& GetTimelineEventInfo(TimelineEvent kind) {
+    static constexpr std::array<TimelineEventInfo, static_cast<size_t>(TimelineEvent::kCount)> kInfos = {{
+        {"Unknown", nullptr, true},
+        {"Simulation", nullptr, false},
+        {"Render Submit", nullptr, false},
+        {"Limiter Sleep", "overshoot_ns", false},
+        {"Present", nullptr, false},
+        {"GPU Completion", "gpu_time_ns", true},
+        {"Reflex Marker", "marker", true},
+    }};
+    const size_t index = static_cast<size_t>(kind);
+    return kInfos[index < kInfos.size() ? index : 0];
+}
+
+// One event as copied out of the timeline; instants have begin_ns == end_ns
+struct TimelineRecord {
+    int64_t begin_ns = 0;
+    int64_t end_ns = 0;
+    uint64_t frame_id = 0;
+    int64_t value = 0;
+    uint32_t thread_index = 0;  // index into TimelineCapture::threads
+    TimelineEvent kind = TimelineEvent::kNone;
+};
+
+struct TimelineThread {
+    uint32_t tid = 0;
+    std::string name;  // empty = unnamed
+};
+
+struct TimelineCapture {
+    int64_t start_ns = 0;  // time base for exporters; every record begins at or after it
+    std::vector<TimelineThread> threads;
+    std::vector<TimelineRecord> records;  // sorted by begin_ns
+};
+
+/**
+ * Flight recorder for frame events, one fixed ring per recording thread.
+ *
+ * Each thread gets its own ring on its first event while enabled (the only allocation; rings live until
+ * ReleaseBuffers() or the timeline's destruction), so Record() is a handful of stores with no shared cache lines
+ * between threads. Nothing is allocated while the timeline stays disabled. Older events are overwritten, which
+ * keeps roughly the last kEventsPerThread events of every thread available for Capture(). A thread that arrives
+ * after kMaxThreads threads have registered is ignored.
+ *
+ * Rings are single-producer sequence-locked: the owner bumps `claimed` before overwriting a slot and `published`
+ * after, and Capture() drops any slot that may have been overwritten while it was copying.
+ */
+class EventTimeline {
+  public:
+    static constexpr size_t kMaxThreads = 16;
+    static constexpr size_t kEventsPerThread = size_t{1} << 14;  // ~40 s of frame events at 60 fps, ~10 s at 240
+    static constexpr size_t kThreadNameSize = 32;
+
+    using ThreadIdFn = uint32_t (*)();
+
+    // thread_id names threads in exports (e.g. the OS thread id); defaults to a process-local counter
+    explicit EventTimeline(ThreadIdFn thread_id = nullptr) : thread_id_(thread_id) {}
+    ~EventTimeline() {
+        for (auto& ring : rings_) {
+            delete ring.load(std::memory_order_relaxed);
+        }
+    }
+    EventTimeline(const EventTimeline&) = delete;
+    EventTimeline& operator=(const EventTimeline&) = delete;
+
+    void SetEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+    bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    // Slices span [begin_ns, end_ns]; instants pass the same timestamp twice
+    void Record(TimelineEvent kind, int64_t begin_ns, int64_t end_ns, uint64_t frame_id, int64_t value = 0) {
+        if (!enabled_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        ThreadRing* ring = CurrentRing();
+        if (ring == nullptr) {
+            return;
+        }
+        // Announce the write before re-checking enabled_: ReleaseBuffers() either waits for it or we see the disable
+        ring->writing.store(true, std::memory_order_seq_cst);
+        if (enabled_.load(std::memory_order_seq_cst)) {
+            Slot* slots = ring->slots.load(std::memory_order_acquire);
+            if (slots == nullptr) {
+                slots = new Slot[kEventsPerThread];
+                ring->slots.store(slots, std::memory_order_release);
+            }
+            const uint64_t index = ring->published.load(std::memory_order_relaxed);
+            ring->claimed.store(index + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            Slot& slot = slots[index & (kEventsPerThread - 1)];
+            slot.begin_ns.store(begin_ns, std::memory_order_relaxed);
+            slot.end_ns.store(end_ns, std::memory_order_relaxed);
+            slot.frame_id.store(frame_id, std::memory_order_relaxed);
+            slot.value.store(value, std::memory_order_relaxed);
+            slot.kind.store(static_cast<uint32_t>(kind), std::memory_order_relaxed);
+            ring->published.store(index + 1, std::memory_order_release);
+        }
+        ring->writing.store(false, std::memory_order_release);
+    }
+
+    void RecordInstant(TimelineEvent kind, int64_t timestamp_ns, uint64_t frame_id, int64_t value = 0) {
+        Record(kind, timestamp_ns, timestamp_ns, frame_id, value);
+    }
+
+    // Names the calling thread in exports; registers it even while the timeline is disabled, but its event buffer is
+    // only allocated by the first recorded event
+    void NameCurrentThread(const char* name) {
+        ThreadRing* ring = CurrentRing();
+        if (ring == nullptr) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(names_mutex_);
+        std::strncpy(ring->name, name, kThreadNameSize - 1);
+        ring->name[kThreadNameSize - 1] = '\0';
+    }
+
+    // Disables the timeline and frees every event buffer once in-flight Record() calls are done (DLL detach).
+    // Must not run concurrently with Capture().
+    void ReleaseBuffers() {
+        enabled_.store(false, std::memory_order_seq_cst);
+        for (auto& ring_ptr : rings_) {
+            ThreadRing* ring = ring_ptr.load(std::memory_order_acquire);
+            if (ring == nullptr) {
+                continue;
+            }
+            while (ring->writing.load(std::memory_order_seq_cst)) {
+                std::this_thread::yield();
+            }
+            delete[] ring->slots.exchange(nullptr, std::memory_order_acq_rel);
+            ring->published.store(0, std::memory_order_relaxed);
+            ring->claimed.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    size_t ThreadCount() const { return (std::min)(next_thread_.load(std::memory_order_acquire), kMaxThreads); }
+
+    // Copies every event that begins at or after since_ns. Allocates; call from the UI or a hotkey, not per frame.
+    TimelineCapture Capture(int64_t since_ns) const {
+        TimelineCapture capture;
+        capture.start_ns = since_ns;
+        for (size_t t = 0; t < kMaxThreads; ++t) {
+            const ThreadRing* ring = rings_[t].load(std::memory_order_acquire);
+            const Slot* slots = (ring != nullptr) ? ring->slots.load(std::memory_order_acquire) : nullptr;
+            if (slots == nullptr) {
+                continue;  // never recorded an event
+            }
+            const uint32_t thread_index = static_cast<uint32_t>(capture.threads.size());
+            {
+                std::lock_guard<std::mutex> lock(names_mutex_);
+                capture.threads.push_back({ring->tid, ring->name});
+            }
+
+            const size_t first_record = capture.records.size();
+            const uint64_t published = ring->published.load(std::memory_order_acquire);
+            const uint64_t oldest = (published > kEventsPerThread) ? published - kEventsPerThread : 0;
+            for (uint64_t index = oldest; index < published; ++index) {
+                const Slot& slot = slots[index & (kEventsPerThread - 1)];
+                TimelineRecord record;
+                record.begin_ns = slot.begin_ns.load(std::memory_order_relaxed);
+                record.end_ns = slot.end_ns.load(std::memory_order_relaxed);
+                record.frame_id = slot.frame_id.load(std::memory_order_relaxed);
+                record.value = slot.value.load(std::memory_order_relaxed);
+                record.kind = static_cast<TimelineEvent>(slot.kind.load(std::memory_order_relaxed));
+                record.thread_index = thread_index;
+                capture.records.push_back(record);
+            }
+            // Slots the owner started to overwrite while we copied are torn; drop them
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const uint64_t claimed = ring->claimed.load(std::memory_order_relaxed);
+            const uint64_t first_intact = (claimed > kEventsPerThread) ? claimed - kEventsPerThread : 0;
+            const size_t torn = static_cast<size_t>((std::min)(published, (std::max)(oldest, first_intact)) - oldest);
+            capture.records.erase(capture.records.begin() + first_record, capture.records.begin() + first_record + torn);
+        }
+
+        capture.records.erase(std::remove_if(capture.records.begin(), capture.records.end(),
+                                             [since_ns](const TimelineRecord& record) {
+                                                 return record.begin_ns < since_ns
+                                                        || record.kind == TimelineEvent::kNone
+                                                        || record.kind >= TimelineEvent::kCount;
+                                             }),
+                              capture.records.end());
+        std::stable_sort(capture.records.begin(), capture.records.end(),
+                         [](const TimelineRecord& a, const TimelineRecord& b) { return a.begin_ns < b.begin_ns; });
+        return capture;
+    }
+
+  private:
+    struct Slot {
+        std::atomic<int64_t> begin_ns{0};
+        std::atomic<int64_t> end_ns{0};
+        std::atomic<uint64_t> frame_id{0};
+        std::atomic<int64_t> value{0};
+        std::atomic<uint32_t> kind{0};
+    };
+
+    struct ThreadRing {
+        ~ThreadRing() { delete[] slots.load(std::memory_order_relaxed); }
+
+        alignas(64) std::atomic<uint64_t> claimed{0};
+        std::atomic<uint64_t> published{0};
+        std::atomic<bool> writing{false};
+        uint32_t tid = 0;
+        uint64_t token = 0;
+        char name[kThreadNameSize] = {};  // under names_mutex_
+        std::atomic<Slot*> slots{nullptr};  // allocated by the owner on its first enabled event
+    };
+
+    static uint64_t CurrentThreadToken() {
+        static std::atomic<uint64_t> next_token{1};
+        thread_local const uint64_t token = next_token.fetch_add(1, std::memory_order_relaxed);
+        return token;
+    }
+
+    // The calling thread's ring, registering the thread on first use; nullptr once every ring is taken
+    ThreadRing* CurrentRing() {
+        struct Cache {
+            uint64_t owner = 0;
+            ThreadRing* ring = nullptr;
+        };
+        thread_local Cache cache;
+        if (cache.owner == instance_id_) {
+            return cache.ring;
+        }
+        const uint64_t token = CurrentThreadToken();
+        ThreadRing* ring = nullptr;
+        for (size_t t = 0; t < ThreadCount() && ring == nullptr; ++t) {
+            ThreadRing* candidate = rings_[t].load(std::memory_order_acquire);
+            if (candidate != nullptr && candidate->token == token) {
+                ring = candidate;
+            }
+        }
+        if (ring == nullptr) {
+            const size_t t = next_thread_.fetch_add(1, std::memory_order_acq_rel);
+            if (t < kMaxThreads) {
+                auto owned = std::make_unique<ThreadRing>();
+                owned->token = token;
+                owned->tid = (thread_id_ != nullptr) ? thread_id_() : static_cast<uint32_t>(token);
+                ring = owned.release();
+                rings_[t].store(ring, std::memory_order_release);
+            }
+        }
+        cache.owner = instance_id_;
+        cache.ring = ring;
+        return ring;
+    }
+
+    static uint64_t NextInstanceId() {
+        static std::atomic<uint64_t> next_id{1};
+        return next_id.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    ThreadIdFn thread_id_;
+    const uint64_t instance_id_ = NextInstanceId();  // keys the per-thread ring cache
+    std::atomic<bool> enabled_{false};
+    std::atomic<size_t> next_thread_{0};
+    std::array<std::atomic<ThreadRing*>, kMaxThreads> rings_{};
+    mutable std::mutex names_mutex_;
+};
+
+} // namespace utils
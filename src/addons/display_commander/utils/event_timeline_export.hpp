@@ -0,0 +1,286 @@
+#pragma once
+
+#include "event_timeline.hpp"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace utils {
+
+struct TimelineProcess {
+    uint32_t pid = 0;
+    std::string name;
+};
+
+namespace timeline_export_detail {
+
+inline void AppendJsonString(std::string& out, std::string_view text) {
+    out += '"';
+    for (const char c : text) {
+        switch (c) {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+                    out += escaped;
+                } else {
+                    out += c;
+                }
+                break;
+        }
+    }
+    out += '"';
+}
+
+// Chrome trace timestamps are microseconds; keep full ns precision without going through floating point
+inline void AppendMicroseconds(std::string& out, int64_t ns) {
+    char buffer[32];
+    const char* sign = (ns < 0) ? "-" : "";
+    const uint64_t magnitude = (ns < 0) ? 0 - static_cast<uint64_t>(ns) : static_cast<uint64_t>(ns);
+    std::snprintf(buffer, sizeof(buffer), "%s%" PRIu64 ".%03" PRIu64, sign, magnitude / 1000, magnitude % 1000);
+    out += buffer;
+}
+
+inline std::string ThreadName(const TimelineThread& thread) {
+    return thread.name.empty() ? "Thread " + std::to_string(thread.tid) : thread.name;
+}
+
+// Minimal protobuf encoder: just the wire types the Perfetto trace needs
+class ProtoWriter {
+  public:
+    void Varint(uint32_t field, uint64_t value) {
+        Key(field, 0);
+        Raw(value);
+    }
+    void Int(uint32_t field, int64_t value) { Varint(field, static_cast<uint64_t>(value)); }
+    void Bytes(uint32_t field, std::string_view bytes) {
+        Key(field, 2);
+        Raw(bytes.size());
+        data_.append(bytes.data(), bytes.size());
+    }
+    void Message(uint32_t field, const ProtoWriter& message) { Bytes(field, message.data_); }
+
+    const std::string& data() const { return data_; }
+
+  private:
+    void Key(uint32_t field, uint32_t wire_type) { Raw((static_cast<uint64_t>(field) << 3) | wire_type); }
+    void Raw(uint64_t value) {
+        while (value >= 0x80) {
+            data_ += static_cast<char>(static_cast<uint8_t>(value) | 0x80);
+            value >>= 7;
+        }
+        data_ += static_cast<char>(value);
+    }
+
+    std::string data_;
+};
+
+// Field numbers from perfetto/protos/perfetto/trace/*.proto
+namespace perfetto_field {
+constexpr uint32_t kTracePacket = 1;                   // Trace.packet
+constexpr uint32_t kPacketTimestamp = 8;               // TracePacket.timestamp
+constexpr uint32_t kPacketSequenceId = 10;             // TracePacket.trusted_packet_sequence_id
+constexpr uint32_t kPacketTrackEvent = 11;             // TracePacket.track_event
+constexpr uint32_t kPacketSequenceFlags = 13;          // TracePacket.sequence_flags
+constexpr uint32_t kPacketTrackDescriptor = 60;        // TracePacket.track_descriptor
+constexpr uint32_t kTrackUuid = 1;                     // TrackDescriptor.uuid
+constexpr uint32_t kTrackName = 2;                     // TrackDescriptor.name
+constexpr uint32_t kTrackProcess = 3;                  // TrackDescriptor.process
+constexpr uint32_t kTrackThread = 4;                   // TrackDescriptor.thread
+constexpr uint32_t kTrackParentUuid = 5;               // TrackDescriptor.parent_uuid
+constexpr uint32_t kProcessPid = 1;                    // ProcessDescriptor.pid
+constexpr uint32_t kProcessName = 6;                   // ProcessDescriptor.process_name
+constexpr uint32_t kThreadPid = 1;                     // ThreadDescriptor.pid
+constexpr uint32_t kThreadTid = 2;                     // ThreadDescriptor.tid
+constexpr uint32_t kThreadName = 5;                    // ThreadDescriptor.thread_name
+constexpr uint32_t kEventDebugAnnotations = 4;         // TrackEvent.debug_annotations
+constexpr uint32_t kEventType = 9;                     // TrackEvent.type
+constexpr uint32_t kEventTrackUuid = 11;               // TrackEvent.track_uuid
+constexpr uint32_t kEventCategories = 22;              // TrackEvent.categories
+constexpr uint32_t kEventName = 23;                    // TrackEvent.name
+constexpr uint32_t kAnnotationUint = 3;                // DebugAnnotation.uint_value
+constexpr uint32_t kAnnotationInt = 4;                 // DebugAnnotation.int_value
+constexpr uint32_t kAnnotationName = 10;               // DebugAnnotation.name
+constexpr uint64_t kTypeSliceBegin = 1;                // TrackEvent.Type
+constexpr uint64_t kTypeSliceEnd = 2;
+constexpr uint64_t kTypeInstant = 3;
+constexpr uint64_t kSequenceIncrementalStateCleared = 1;  // TracePacket.SequenceFlags
+}  // namespace perfetto_field
+
+constexpr uint32_t kPerfettoSequenceId = 1;
+constexpr uint64_t kPerfettoProcessTrackUuid = 1;
+
+// Thread tracks are (index + 1) << 8; every event kind gets its own child track so slices of different kinds never
+// have to nest
+inline uint64_t PerfettoThreadTrackUuid(uint32_t thread_index) { return (static_cast<uint64_t>(thread_index) + 1) << 8; }
+inline uint64_t PerfettoEventTrackUuid(uint32_t thread_index, TimelineEvent kind) {
+    return PerfettoThreadTrackUuid(thread_index) | static_cast<uint64_t>(kind);
+}
+
+}  // namespace timeline_export_detail
+
+// Chrome trace event format: slices become complete ("X") events, instants thread-scoped "i" events
+inline std::string ExportTimelineChromeJson(const TimelineCapture& capture, const TimelineProcess& process) {
+    using namespace timeline_export_detail;
+    std::string out;
+    out.reserve(256 + capture.records.size() * 160);
+    const std::string pid = std::to_string(process.pid);
+
+    out += "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    out += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" + pid + ",\"tid\":0,\"args\":{\"name\":";
+    AppendJsonString(out, process.name);
+    out += "}}";
+    for (const TimelineThread& thread : capture.threads) {
+        out += ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" + pid + ",\"tid\":" + std::to_string(thread.tid)
+               + ",\"args\":{\"name\":";
+        AppendJsonString(out, ThreadName(thread));
+        out += "}}";
+    }
+
+    for (const TimelineRecord& record : capture.records) {
+        const TimelineEventInfo& info = GetTimelineEventInfo(record.kind);
+        out += ",\n{\"name\":";
+        AppendJsonString(out, info.name);
+        out += ",\"cat\":\"frame\",\"ph\":";
+        out += info.instant ? "\"i\",\"s\":\"t\"" : "\"X\"";
+        out += ",\"ts\":";
+        AppendMicroseconds(out, record.begin_ns - capture.start_ns);
+        if (!info.instant) {
+            out += ",\"dur\":";
+            AppendMicroseconds(out, (std::max)(record.end_ns - record.begin_ns, int64_t{0}));
+        }
+        out += ",\"pid\":" + pid + ",\"tid\":" + std::to_string(capture.threads[record.thread_index].tid);
+        out += ",\"args\":{\"frame\":" + std::to_string(record.frame_id);
+        if (info.value_name != nullptr) {
+            out += ",\"";
+            out += info.value_name;
+            out += "\":" + std::to_string(record.value);
+        }
+        out += "}}";
+    }
+    out += "\n]}\n";
+    return out;
+}
+
+// Perfetto TracePacket stream: a process track, one track per thread with a child track per event kind, then
+// SLICE_BEGIN/SLICE_END/INSTANT track events in timestamp order
+inline std::string ExportTimelinePerfetto(const TimelineCapture& capture, const TimelineProcess& process) {
+    using namespace timeline_export_detail;
+    namespace field = perfetto_field;
+    ProtoWriter trace;
+    bool first_packet = true;
+    auto emit_packet = [&](ProtoWriter& packet) {
+        packet.Varint(field::kPacketSequenceId, kPerfettoSequenceId);
+        if (first_packet) {
+            packet.Varint(field::kPacketSequenceFlags, field::kSequenceIncrementalStateCleared);
+            first_packet = false;
+        }
+        trace.Message(field::kTracePacket, packet);
+    };
+
+    {
+        ProtoWriter process_descriptor;
+        process_descriptor.Varint(field::kProcessPid, process.pid);
+        process_descriptor.Bytes(field::kProcessName, process.name);
+        ProtoWriter track;
+        track.Varint(field::kTrackUuid, kPerfettoProcessTrackUuid);
+        track.Message(field::kTrackProcess, process_descriptor);
+        ProtoWriter packet;
+        packet.Message(field::kPacketTrackDescriptor, track);
+        emit_packet(packet);
+    }
+
+    constexpr size_t kKinds = static_cast<size_t>(TimelineEvent::kCount);
+    std::vector<bool> kind_used(capture.threads.size() * kKinds, false);
+    for (const TimelineRecord& record : capture.records) {
+        kind_used[record.thread_index * kKinds + static_cast<size_t>(record.kind)] = true;
+    }
+    for (uint32_t t = 0; t < capture.threads.size(); ++t) {
+        const TimelineThread& thread = capture.threads[t];
+        {
+            ProtoWriter thread_descriptor;
+            thread_descriptor.Varint(field::kThreadPid, process.pid);
+            thread_descriptor.Varint(field::kThreadTid, thread.tid);
+            thread_descriptor.Bytes(field::kThreadName, ThreadName(thread));
+            ProtoWriter track;
+            track.Varint(field::kTrackUuid, PerfettoThreadTrackUuid(t));
+            track.Message(field::kTrackThread, thread_descriptor);
+            ProtoWriter packet;
+            packet.Message(field::kPacketTrackDescriptor, track);
+            emit_packet(packet);
+        }
+        for (size_t k = 1; k < kKinds; ++k) {
+            if (!kind_used[t * kKinds + k]) {
+                continue;
+            }
+            const TimelineEvent kind = static_cast<TimelineEvent>(k);
+            ProtoWriter track;
+            track.Varint(field::kTrackUuid, PerfettoEventTrackUuid(t, kind));
+            track.Bytes(field::kTrackName, GetTimelineEventInfo(kind).name);
+            track.Varint(field::kTrackParentUuid, PerfettoThreadTrackUuid(t));
+            ProtoWriter packet;
+            packet.Message(field::kPacketTrackDescriptor, track);
+            emit_packet(packet);
+        }
+    }
+
+    // Slice ends interleave with later begins, so order begins/ends/instants by time; ties keep record order,
+    // which puts a zero-length slice's begin before its end
+    struct Marker {
+        int64_t timestamp_ns;
+        size_t record;
+        uint64_t type;
+    };
+    std::vector<Marker> markers;
+    markers.reserve(capture.records.size() * 2);
+    for (size_t i = 0; i < capture.records.size(); ++i) {
+        const TimelineRecord& record = capture.records[i];
+        if (GetTimelineEventInfo(record.kind).instant) {
+            markers.push_back({record.begin_ns, i, field::kTypeInstant});
+        } else {
+            markers.push_back({record.begin_ns, i, field::kTypeSliceBegin});
+            markers.push_back({(std::max)(record.end_ns, record.begin_ns), i, field::kTypeSliceEnd});
+        }
+    }
+    std::stable_sort(markers.begin(), markers.end(),
+                     [](const Marker& a, const Marker& b) { return a.timestamp_ns < b.timestamp_ns; });
+
+    for (const Marker& marker : markers) {
+        const TimelineRecord& record = capture.records[marker.record];
+        const TimelineEventInfo& info = GetTimelineEventInfo(record.kind);
+        ProtoWriter event;
+        event.Varint(field::kEventType, marker.type);
+        event.Varint(field::kEventTrackUuid, PerfettoEventTrackUuid(record.thread_index, record.kind));
+        if (marker.type != field::kTypeSliceEnd) {
+            event.Bytes(field::kEventCategories, "frame");
+            event.Bytes(field::kEventName, info.name);
+            ProtoWriter frame;
+            frame.Bytes(field::kAnnotationName, "frame");
+            frame.Varint(field::kAnnotationUint, record.frame_id);
+            event.Message(field::kEventDebugAnnotations, frame);
+            if (info.value_name != nullptr) {
+                ProtoWriter value;
+                value.Bytes(field::kAnnotationName, info.value_name);
+                value.Int(field::kAnnotationInt, record.value);
+                event.Message(field::kEventDebugAnnotations, value);
+            }
+        }
+        ProtoWriter packet;
+        packet.Varint(field::kPacketTimestamp, static_cast<uint64_t>(marker.timestamp_ns - capture.start_ns));
+        packet.Message(field::kPacketTrackEvent, event);
+        emit_packet(packet);
+    }
+    return trace.data();
+}
+
+} // namespace utils
@@ -0,0 +1,307 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace utils {
+
+enum class FrameStage : uint32_t {
+    kSimStart = 0,         // previous present returned; the game starts simulating this frame
+    kRenderSubmitEnd = 1,  // OnPresentUpdateBefore
+    kPresentStart = 2,     // limiter done, the frame is handed to Present
+    kGpuQueued = 3,        // a GPU completion fence was enqueued for this frame
+    kPresentEnd = 4,       // Present returned
+    kGpuDone = 5,          // the GPU completion fence of this frame signaled
+    kCount
+};
+
+constexpr uint32_t FrameStageBit(FrameStage stage) { return 1u << static_cast<uint32_t>(stage); }
+
+// A frame is complete once Present returned and, if a GPU fence was queued for it, the fence signaled
+constexpr bool IsFrameComplete(uint32_t stage_mask) {
+    return (stage_mask & FrameStageBit(FrameStage::kPresentEnd)) != 0
+           && ((stage_mask & FrameStageBit(FrameStage::kGpuQueued)) == 0
+               || (stage_mask & FrameStageBit(FrameStage::kGpuDone)) != 0);
+}
+
+struct FrameLatencyRecord {
+    uint64_t frame_id = 0;
+    uint32_t stage_mask = 0;
+    std::array<int64_t, static_cast<size_t>(FrameStage::kCount)> stage_ns{};
+
+    bool Has(FrameStage stage) const { return (stage_mask & FrameStageBit(stage)) != 0; }
+    int64_t At(FrameStage stage) const { return stage_ns[static_cast<size_t>(stage)]; }
+
+    // When the frame reached the display: the later of Present returning and the GPU finishing
+    int64_t DisplayNs() const {
+        const int64_t present_end = At(FrameStage::kPresentEnd);
+        return Has(FrameStage::kGpuDone) ? (std::max)(present_end, At(FrameStage::kGpuDone)) : present_end;
+    }
+    // 0 for the first frame (no sim start)
+    int64_t SimToDisplayNs() const {
+        return Has(FrameStage::kSimStart) ? (std::max)(DisplayNs() - At(FrameStage::kSimStart), int64_t{0}) : 0;
+    }
+    // How much later than Present the GPU finished; 0 if it finished first or was not measured
+    int64_t GpuLateNs() const {
+        return Has(FrameStage::kGpuDone)
+                   ? (std::max)(At(FrameStage::kGpuDone) - At(FrameStage::kPresentEnd), int64_t{0})
+                   : 0;
+    }
+    int64_t PresentDurationNs() const {
+        return Has(FrameStage::kPresentStart)
+                   ? (std::max)(At(FrameStage::kPresentEnd) - At(FrameStage::kPresentStart), int64_t{0})
+                   : 0;
+    }
+};
+
+struct FrameLatencySummary {
+    uint32_t count = 0;  // finalized frames in the history when the summary was taken
+    float sim_to_display_avg_ms = 0.0f;
+    float sim_to_display_p50_ms = 0.0f;
+    float sim_to_display_p95_ms = 0.0f;
+    float sim_to_display_p99_ms = 0.0f;
+    float sim_to_display_max_ms = 0.0f;
+    float gpu_late_avg_ms = 0.0f;
+    float gpu_late_p95_ms = 0.0f;
+};
+
+/**
+ * Ring of in-flight frames indexed by frame id, plus a history of finalized frames.
+ *
+ * Each slot packs (frame id << 8 | arrived stage bits) into one atomic word. A stage writes its timestamp and then
+ * sets its bit with a CAS; the CAS that makes the frame complete also sets a finalized bit, so exactly one thread
+ * finalizes each frame no matter which stage arrives last. The first stage of a newer frame that maps to the same
+ * slot takes it over; an unfinished frame found there is counted as abandoned, and stages that arrive for a frame
+ * whose slot was already taken over are counted as stale. Nothing blocks or allocates.
+ *
+ * A stage racing with the takeover of its slot by a frame kSlots newer can overwrite that frame's timestamp of the
+ * same stage; that needs a stage to arrive about kSlots frames late, and costs one sample.
+ *
+ * Finalized frames go to a fixed history ring (written by whichever thread finalized, read by the stats thread)
+ * that UpdateSummary() turns into percentiles behind a sequence lock.
+ */
+class FrameLatencyRing {
+  public:
+    static constexpr size_t kSlots = 64;     // frames in flight; power of two
+    static constexpr size_t kHistory = 256;  // finalized frames kept for percentiles; power of two
+
+    // Stamps a stage of a frame. Returns true if this stage completed the frame; the record is then copied to
+    // *finalized (if given) and appended to the history.
+    bool Record(uint64_t frame_id, FrameStage stage, int64_t timestamp_ns, FrameLatencyRecord* finalized = nullptr) {
+        if (frame_id > kMaxFrameId) {
+            return false;
+        }
+        Slot& slot = slots_[frame_id & (kSlots - 1)];
+        const uint64_t bit = FrameStageBit(stage);
+        uint64_t state = slot.state.load(std::memory_order_acquire);
+        for (;;) {
+            const uint64_t slot_frame = state >> kStageBits;
+            if (slot_frame > frame_id) {
+                stale_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            if (slot_frame < frame_id) {
+                const uint64_t claimed = frame_id << kStageBits;
+                if (!slot.state.compare_exchange_weak(state, claimed, std::memory_order_acq_rel,
+                                                      std::memory_order_acquire)) {
+                    continue;
+                }
+                if ((state & kStageMask) != 0 && (state & kFinalizedBit) == 0) {
+                    abandoned_.fetch_add(1, std::memory_order_relaxed);
+                }
+                state = claimed;
+            }
+            if ((state & bit) != 0) {
+                return false;  // stage already stamped for this frame
+            }
+            // Pairs with the acquire fence in Finalize: a reader that sees this timestamp also sees the claim
+            std::atomic_thread_fence(std::memory_order_release);
+            slot.stage_ns[static_cast<size_t>(stage)].store(timestamp_ns, std::memory_order_relaxed);
+            uint64_t updated = state | bit;
+            const uint32_t mask = static_cast<uint32_t>(updated & kStageMask & ~kFinalizedBit);
+            const bool completes = (state & kFinalizedBit) == 0 && IsFrameComplete(mask);
+            if (completes) {
+                updated |= kFinalizedBit;
+            }
+            if (slot.state.compare_exchange_weak(state, updated, std::memory_order_acq_rel,
+                                                 std::memory_order_acquire)) {
+                return completes && Finalize(slot, frame_id, mask, finalized);
+            }
+        }
+    }
+
+    uint64_t CompletedCount() const { return history_head_.load(std::memory_order_relaxed); }
+    uint64_t AbandonedCount() const { return abandoned_.load(std::memory_order_relaxed); }
+    uint64_t StaleCount() const { return stale_.load(std::memory_order_relaxed); }
+
+    // Copies up to `capacity` finalized frames, oldest first. Returns how many were written.
+    size_t CopyHistory(FrameLatencyRecord* out, size_t capacity) const {
+        const uint64_t head = history_head_.load(std::memory_order_acquire);
+        const uint64_t available = (std::min)(head, static_cast<uint64_t>(kHistory));
+        const uint64_t wanted = (std::min)(available, static_cast<uint64_t>(capacity));
+        size_t count = 0;
+        for (uint64_t index = head - wanted; index < head; ++index) {
+            const HistoryEntry& entry = history_[index & (kHistory - 1)];
+            if (entry.sequence.load(std::memory_order_acquire) != index + 1) {
+                continue;  // being rewritten, or not written yet
+            }
+            FrameLatencyRecord record;
+            record.frame_id = entry.frame_id.load(std::memory_order_relaxed);
+            record.stage_mask = entry.stage_mask.load(std::memory_order_relaxed);
+            for (size_t s = 0; s < record.stage_ns.size(); ++s) {
+                record.stage_ns[s] = entry.stage_ns[s].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (entry.sequence.load(std::memory_order_relaxed) == index + 1) {
+                out[count++] = record;
+            }
+        }
+        return count;
+    }
+
+    // Stats thread only: summarize the history
+    void UpdateSummary() {
+        std::array<FrameLatencyRecord, kHistory> records;
+        const size_t count = CopyHistory(records.data(), records.size());
+        FrameLatencySummary summary;
+        summary.count = static_cast<uint32_t>(count);
+        if (count > 0) {
+            std::array<int64_t, kHistory> sim_to_display;
+            std::array<int64_t, kHistory> gpu_late;
+            int64_t sim_to_display_sum = 0;
+            int64_t gpu_late_sum = 0;
+            for (size_t i = 0; i < count; ++i) {
+                sim_to_display[i] = records[i].SimToDisplayNs();
+                gpu_late[i] = records[i].GpuLateNs();
+                sim_to_display_sum += sim_to_display[i];
+                gpu_late_sum += gpu_late[i];
+            }
+            std::sort(sim_to_display.begin(), sim_to_display.begin() + count);
+            std::sort(gpu_late.begin(), gpu_late.begin() + count);
+            summary.sim_to_display_avg_ms = ToMs(sim_to_display_sum / static_cast<int64_t>(count));
+            summary.sim_to_display_p50_ms = ToMs(sim_to_display[NearestRank(count, 50)]);
+            summary.sim_to_display_p95_ms = ToMs(sim_to_display[NearestRank(count, 95)]);
+            summary.sim_to_display_p99_ms = ToMs(sim_to_display[NearestRank(count, 99)]);
+            summary.sim_to_display_max_ms = ToMs(sim_to_display[count - 1]);
+            summary.gpu_late_avg_ms = ToMs(gpu_late_sum / static_cast<int64_t>(count));
+            summary.gpu_late_p95_ms = ToMs(gpu_late[NearestRank(count, 95)]);
+        }
+
+        const uint32_t sequence = summary_sequence_.load(std::memory_order_relaxed);
+        summary_sequence_.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        summary_count_.store(summary.count, std::memory_order_relaxed);
+        const std::array<float, kSummaryFields> fields = FieldsOf(summary);
+        for (size_t i = 0; i < kSummaryFields; ++i) {
+            summary_fields_[i].store(fields[i], std::memory_order_relaxed);
+        }
+        summary_sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+    FrameLatencySummary Summary() const {
+        for (;;) {
+            const uint32_t begin = summary_sequence_.load(std::memory_order_acquire);
+            if ((begin & 1u) != 0) {
+                continue;
+            }
+            FrameLatencySummary summary;
+            summary.count = summary_count_.load(std::memory_order_relaxed);
+            std::array<float, kSummaryFields> fields;
+            for (size_t i = 0; i < kSummaryFields; ++i) {
+                fields[i] = summary_fields_[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (summary_sequence_.load(std::memory_order_relaxed) == begin) {
+                summary.sim_to_display_avg_ms = fields[0];
+                summary.sim_to_display_p50_ms = fields[1];
+                summary.sim_to_display_p95_ms = fields[2];
+                summary.sim_to_display_p99_ms = fields[3];
+                summary.sim_to_display_max_ms = fields[4];
+                summary.gpu_late_avg_ms = fields[5];
+                summary.gpu_late_p95_ms = fields[6];
+                return summary;
+            }
+        }
+    }
+
+  private:
+    static constexpr uint32_t kStageBits = 8;
+    static constexpr uint64_t kStageMask = (uint64_t{1} << kStageBits) - 1;
+    static constexpr uint64_t kFinalizedBit = uint64_t{1} << (kStageBits - 1);
+    static constexpr uint64_t kMaxFrameId = ~uint64_t{0} >> kStageBits;
+    static constexpr size_t kSummaryFields = 7;
+    static_assert(static_cast<uint32_t>(FrameStage::kCount) < kStageBits, "stage bits and the finalized bit must fit");
+
+    struct Slot {
+        std::atomic<uint64_t> state{0};  // frame id << kStageBits | finalized bit | arrived stage bits
+        std::array<std::atomic<int64_t>, static_cast<size_t>(FrameStage::kCount)> stage_ns{};
+    };
+
+    struct HistoryEntry {
+        std::atomic<uint64_t> sequence{0};  // history index + 1 once written; 0 while being written
+        std::atomic<uint64_t> frame_id{0};
+        std::atomic<uint32_t> stage_mask{0};
+        std::array<std::atomic<int64_t>, static_cast<size_t>(FrameStage::kCount)> stage_ns{};
+    };
+
+    bool Finalize(const Slot& slot, uint64_t frame_id, uint32_t mask, FrameLatencyRecord* finalized) {
+        FrameLatencyRecord record;
+        record.frame_id = frame_id;
+        record.stage_mask = mask;
+        for (size_t s = 0; s < record.stage_ns.size(); ++s) {
+            if ((mask & (1u << s)) != 0) {
+                record.stage_ns[s] = slot.stage_ns[s].load(std::memory_order_relaxed);
+            }
+        }
+        // A newer frame may have taken the slot over while we read; its timestamps are not ours
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if ((slot.state.load(std::memory_order_relaxed) >> kStageBits) != frame_id) {
+            stale_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        const uint64_t index = history_head_.fetch_add(1, std::memory_order_acq_rel);
+        HistoryEntry& entry = history_[index & (kHistory - 1)];
+        entry.sequence.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        entry.frame_id.store(record.frame_id, std::memory_order_relaxed);
+        entry.stage_mask.store(record.stage_mask, std::memory_order_relaxed);
+        for (size_t s = 0; s < record.stage_ns.size(); ++s) {
+            entry.stage_ns[s].store(record.stage_ns[s], std::memory_order_relaxed);
+        }
+        entry.sequence.store(index + 1, std::memory_order_release);
+
+        if (finalized != nullptr) {
+            *finalized = record;
+        }
+        return true;
+    }
+
+    static size_t NearestRank(size_t count, size_t percent) {
+        const size_t rank = (count * percent + 99) / 100;
+        return (rank == 0) ? 0 : rank - 1;
+    }
+
+    static float ToMs(int64_t ns) { return static_cast<float>(static_cast<double>(ns) / 1e6); }
+
+    static std::array<float, kSummaryFields> FieldsOf(const FrameLatencySummary& summary) {
+        return {summary.sim_to_display_avg_ms, summary.sim_to_display_p50_ms, summary.sim_to_display_p95_ms,
+                summary.sim_to_display_p99_ms, summary.sim_to_display_max_ms,  summary.gpu_late_avg_ms,
+                summary.gpu_late_p95_ms};
+    }
+
+    std::array<Slot, kSlots> slots_;
+    std::array<HistoryEntry, kHistory> history_;
+    std::atomic<uint64_t> history_head_{0};
+    std::atomic<uint64_t> abandoned_{0};
+    std::atomic<uint64_t> stale_{0};
+
+    std::atomic<uint32_t> summary_sequence_{0};
+    std::atomic<uint32_t> summary_count_{0};
+    std::array<std::atomic<float>, kSummaryFields> summary_fields_{};
+};
+
+} // namespace utils
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace utils {
+
+enum class FrameTraceEvent : uint32_t {
+    kNone = 0,
+    kSimStart = 1,            // game starts simulating the frame (after the previous present returned)
+    kRenderSubmitEnd = 2,     // OnPresentUpdateBefore: the game finished submitting the frame
+    kLimiterStart = 3,        // HandleFpsLimiter entered; value = target fps * 1000 (0 = unlimited)
+    kLimiterWait = 4,         // one limiter wait returned; timestamp = wake, value = requested wake target
+    kPresentStart = 5,        // limiter done, the frame is handed to Present
+    kPresentEnd = 6,          // OnPresentUpdateAfter2: Present returned
+    kGpuCompletion = 7,       // GPU finished the frame's work
+    kPresentPacingDelay = 8,  // present pacing delay after Present returned; timestamp = wake, value = wake target
+};
+
+struct FrameTraceRecord {
+    int64_t timestamp_ns;
+    int64_t value;
+    uint64_t frame_id;
+    uint32_t type;  // FrameTraceEvent
+    uint32_t reserved;
+};
+static_assert(sizeof(FrameTraceRecord) == 32, "FrameTraceRecord is part of the file format");
+
+struct FrameTraceFileHeader {
+    static constexpr char kMagic[4] = {'D', 'C', 'F', 'T'};
+    static constexpr uint32_t kVersion = 2;  // 2: flags (always 0 in version 1, which did not record them)
+    static constexpr uint32_t kMinVersion = 1;
+    static constexpr uint32_t kFlagPresentPacingDelay = 1u << 0;  // the trace holds kPresentPacingDelay events
+
+    char magic[4] = {'D', 'C', 'F', 'T'};
+    uint32_t version = kVersion;
+    uint32_t record_size = sizeof(FrameTraceRecord);
+    uint32_t flags = 0;
+    uint64_t record_count = 0;
+    int64_t start_ns = 0;  // time base of the recording (QPC-derived ns on Windows)
+};
+static_assert(sizeof(FrameTraceFileHeader) == 32, "FrameTraceFileHeader is part of the file format");
+
+inline bool WriteFrameTrace(const char* path, int64_t start_ns, const FrameTraceRecord* records, size_t count) {
+    std::FILE* file = std::fopen(path, "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    FrameTraceFileHeader header;
+    for (size_t i = 0; i < count; ++i) {
+        if (records[i].type == static_cast<uint32_t>(FrameTraceEvent::kPresentPacingDelay)) {
+            header.flags |= FrameTraceFileHeader::kFlagPresentPacingDelay;
+            break;
+        }
+    }
+    header.record_count = count;
+    header.start_ns = start_ns;
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+    if (ok && count > 0) {
+        ok = std::fwrite(records, sizeof(FrameTraceRecord), count, file) == count;
+    }
+    return (std::fclose(file) == 0) && ok;
+}
+
+inline bool ReadFrameTrace(const char* path, FrameTraceFileHeader& header, std::vector<FrameTraceRecord>& records) {
+    std::FILE* file = std::fopen(path, "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    bool ok = std::fread(&header, sizeof(header), 1, file) == 1
+              && std::memcmp(header.magic, FrameTraceFileHeader::kMagic, sizeof(header.magic)) == 0
+              && header.version >= FrameTraceFileHeader::kMinVersion && header.version <= FrameTraceFileHeader::kVersion
+              && header.record_size == sizeof(FrameTraceRecord);
+    if (ok) {
+        records.resize(static_cast<size_t>(header.record_count));
+        ok = std::fread(records.data(), sizeof(FrameTraceRecord), records.size(), file) == records.size();
+    }
+    std::fclose(file);
+    return ok;
+}
+
+/**
+ * Fixed-capacity in-memory recorder for frame trace events.
+ *
+ * Record() is safe from any thread (present thread, GPU completion thread) and costs one relaxed load
+ * while not recording. Slots are claimed with fetch_add and published by storing the event type last,
+ * so Save() skips slots that were still being written when recording stopped. Recording stops by
+ * itself when the buffer is full; the trace stays available to Save() until the next Start(). Every
+ * Start() begins a new session, and a Record() call of an older session neither writes a slot nor
+ * stops the new one. The buffer is allocated on the first Start() and never freed.
+ */
+class FrameTraceRecorder {
+  public:
+    static constexpr size_t kDefaultCapacity = size_t{1} << 20;  // 32 MiB, ~10 minutes at 240 fps
+
+    explicit FrameTraceRecorder(size_t capacity = kDefaultCapacity) : capacity_(capacity) {}
+    FrameTraceRecorder(const FrameTraceRecorder&) = delete;
+    FrameTraceRecorder& operator=(const FrameTraceRecorder&) = delete;
+
+    bool IsRecording() const { return (state_.load(std::memory_order_acquire) & kRecordingBit) != 0; }
+
+    // Stopped (by Stop() or a full buffer) with events that Save() can still write
+    bool HasData() const { return !IsRecording() && RecordedCount() > 0; }
+
+    // Not thread-safe with Save(); call from the UI thread
+    void Start(int64_t start_ns) {
+        const uint64_t state = state_.load();
+        if ((state & kRecordingBit) != 0) {
+            return;
+        }
+        WaitForWriters();
+        if (!slots_) {
+            slots_ = std::make_unique<Slot[]>(capacity_);
+        }
+        for (size_t i = 0; i < capacity_; ++i) {
+            slots_[i].type.store(0, std::memory_order_relaxed);
+        }
+        start_ns_ = start_ns;
+        next_.store(0, std::memory_order_relaxed);
+        // New session number, so late writers of the previous one see a different state
+        state_.store((state + kSessionIncrement) | kRecordingBit, std::memory_order_release);
+    }
+
+    void Stop() { state_.fetch_and(~kRecordingBit); }
+
+    void Record(FrameTraceEvent type, uint64_t frame_id, int64_t timestamp_ns, int64_t value = 0) {
+        if ((state_.load(std::memory_order_relaxed) & kRecordingBit) == 0) {
+            return;
+        }
+        // Announce the write before re-checking the session, so Start() can wait for it to finish. Sequentially
+        // consistent, like the loads in Start(): either Start() sees this writer or this writer sees the stop.
+        writers_.fetch_add(1);
+        uint64_t state = state_.load();
+        if ((state & kRecordingBit) != 0) {
+            const size_t index = next_.fetch_add(1, std::memory_order_relaxed);
+            if (index < capacity_) {
+                Slot& slot = slots_[index];
+                slot.timestamp_ns = timestamp_ns;
+                slot.value = value;
+                slot.frame_id = frame_id;
+                slot.type.store(static_cast<uint32_t>(type), std::memory_order_release);
+            } else {
+                // Full: stop this session only (fails harmlessly if it was already stopped or restarted)
+                state_.compare_exchange_strong(state, state & ~kRecordingBit);
+            }
+        }
+        writers_.fetch_sub(1, std::memory_order_release);
+    }
+
+    // Number of events recorded so far
+    size_t RecordedCount() const {
+        const size_t next = next_.load(std::memory_order_relaxed);
+        return (next < capacity_) ? next : capacity_;
+    }
+
+    // Write all completed records to a file; call after Stop() or once the buffer filled up
+    bool Save(const char* path) const {
+        WaitForWriters();
+        std::vector<FrameTraceRecord> records;
+        records.reserve(RecordedCount());
+        for (size_t i = 0, n = RecordedCount(); i < n && slots_; ++i) {
+            const uint32_t type = slots_[i].type.load(std::memory_order_acquire);
+            if (type == 0) {
+                continue;
+            }
+            records.push_back({slots_[i].timestamp_ns, slots_[i].value, slots_[i].frame_id, type, 0});
+        }
+        return WriteFrameTrace(path, start_ns_, records.data(), records.size());
+    }
+
+  private:
+    struct Slot {
+        int64_t timestamp_ns = 0;
+        int64_t value = 0;
+        uint64_t frame_id = 0;
+        std::atomic<uint32_t> type{0};
+    };
+
+    static constexpr uint64_t kRecordingBit = 1;
+    static constexpr uint64_t kSessionIncrement = 2;
+
+    // Writers that saw the recording state are done with their slot after this
+    void WaitForWriters() const {
+        while (writers_.load() != 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    size_t capacity_;
+    std::unique_ptr<Slot[]> slots_;
+    std::atomic<size_t> next_{0};
+    std::atomic<uint64_t> state_{0};  // session number << 1 | kRecordingBit
+    mutable std::atomic<uint32_t> writers_{0};
+    int64_t start_ns_ = 0;
+};
+
+} // namespace utils
@@ -4,6 +4,7 @@
 #include "settings/developer_tab_settings.hpp"
 #include "../hooks/hook_suppression_manager.hpp"
 #include <algorithm>
+#include <cmath>
 #include <vector>
 #include <cstdio>
 #include <string>
@@ -157,7 +158,8 @@ BOOL CALLBACK MonitorEnumProc(HMONITOR hmon, HDC hdc, LPRECT rect, LPARAM lparam
 
 // XInput processing functions
 // Process stick input with radial deadzone (preserves direction)
-void ProcessStickInputRadial(float &x, float &y, float deadzone, float max_input, float min_output) {
+void ProcessStickInputRadial(float &x, float &y, float deadzone, float max_input, float min_output,
+                             float curve_exponent) {
     // Calculate magnitude (distance from center)
     float magnitude = std::sqrt(x * x + y * y);
 
@@ -181,6 +183,11 @@ void ProcessStickInputRadial(float &x, float &y, float deadzone, float max_input
     // Scale magnitude from [deadzone, max_input] to [0, 1]
     float scaled_magnitude = (std::min)(1.0f, max(0.0f, magnitude - deadzone) / (max_input - deadzone));
 
+    // Step 2b: Apply the response curve (1.0 = linear)
+    if (curve_exponent != 1.0f) {
+        scaled_magnitude = std::pow(scaled_magnitude, curve_exponent);
+    }
+
     // Step 3: Apply min_output mapping (e.g., 0.3 min output maps 0.0-1.0 to 0.3-1.0)
     float output_magnitude = min_output + (scaled_magnitude * (1.0f - min_output));
 
@@ -193,7 +200,8 @@ void ProcessStickInputRadial(float &x, float &y, float deadzone, float max_input
 }
 
 // Process stick input with square deadzone (processes X and Y axes separately)
-void ProcessStickInputSquare(float &x, float &y, float deadzone, float max_input, float min_output) {
+void ProcessStickInputSquare(float &x, float &y, float deadzone, float max_input, float min_output,
+                             float curve_exponent) {
     // Process X axis independently
     float abs_x = std::abs(x);
     float sign_x = (x >= 0.0f) ? 1.0f : -1.0f;
@@ -205,6 +213,9 @@ void ProcessStickInputSquare(float &x, float &y, float deadzone, float max_input
         // Step 2: Apply max_input scaling to X axis
         // Scale from [deadzone, max_input] to [0, 1]
         float scaled_x = (std::min)(1.0f, max(0.0f, (abs_x - deadzone) / (max_input - deadzone)));
+        if (curve_exponent != 1.0f) {
+            scaled_x = std::pow(scaled_x, curve_exponent);
+        }
 
         // Step 3: Apply min_output mapping to X axis
         float output_x = min_output + (scaled_x * (1.0f - min_output));
@@ -225,6 +236,9 @@ void ProcessStickInputSquare(float &x, float &y, float deadzone, float max_input
         // Step 2: Apply max_input scaling to Y axis
         // Scale from [deadzone, max_input] to [0, 1]
         float scaled_y = (std::min)(1.0f, max(0.0f, (abs_y - deadzone) / (max_input - deadzone)));
+        if (curve_exponent != 1.0f) {
+            scaled_y = std::pow(scaled_y, curve_exponent);
+        }
 
         // Step 3: Apply min_output mapping to Y axis
         float output_y = min_output + (scaled_y * (1.0f - min_output));
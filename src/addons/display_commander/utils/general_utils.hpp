@@ -46,8 +46,10 @@ int GetAspectWidthValue(int display_width);
 BOOL CALLBACK MonitorEnumProc(HMONITOR hmon, HDC hdc, LPRECT rect, LPARAM lparam);
 
 // XInput processing functions
-void ProcessStickInputRadial(float &x, float &y, float deadzone, float max_input, float min_output);
-void ProcessStickInputSquare(float &x, float &y, float deadzone, float max_input, float min_output);
+void ProcessStickInputRadial(float &x, float &y, float deadzone, float max_input, float min_output,
+                             float curve_exponent = 1.0f);
+void ProcessStickInputSquare(float &x, float &y, float deadzone, float max_input, float min_output,
+                             float curve_exponent = 1.0f);
 float ProcessStickInput(float value, float deadzone, float max_input, float min_output);
 
 // XInput thumbstick scaling helpers (handles asymmetric SHORT range: -32768 to 32767)
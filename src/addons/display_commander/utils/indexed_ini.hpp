@@ -0,0 +1,292 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace utils {
+
+/**
+ * INI file contents with hashed (section, key) lookups that keep file order.
+ *
+ * Sections and entries get small integer IDs in the order they are first seen. Sections are found through a
+ * hash map keyed by string_views into the stored names, entries through a flat open-addressing table of entry
+ * IDs keyed by (section ID, key), so lookups hash the caller's strings once and never allocate. Serialization
+ * walks sections and entries in ID order, i.e. file order with new keys appended to their section and new
+ * sections appended at the end.
+ *
+ * Every effective change marks its entry dirty; a value set to what it already was is not a change, so
+ * callers can skip saving a clean store entirely.
+ *
+ * Not thread-safe; the owner serializes access.
+ */
+class IndexedIni {
+  public:
+    using EntryId = uint32_t;
+    static constexpr EntryId kInvalidId = UINT32_MAX;
+
+    void Clear() {
+        sections_.clear();
+        entries_.clear();
+        section_index_.clear();
+        entry_slots_.clear();
+        dirty_entries_.clear();
+        structure_dirty_ = false;
+    }
+
+    // Single pass over the whole file text. Lines before the first section are ignored, ';' and '#' start
+    // comment lines, whitespace around names, keys and values is trimmed. A key repeated within a section
+    // keeps its first value. The result is clean.
+    void Parse(std::string_view text) {
+        Clear();
+        // One line per entry at most: size storage and index once instead of growing them while parsing
+        const size_t max_entries = static_cast<size_t>(std::count(text.begin(), text.end(), '\n')) + 1;
+        entries_.reserve(max_entries);
+        ReserveEntrySlots(max_entries);
+        uint32_t section = kNoSection;
+        size_t pos = 0;
+        while (pos < text.size()) {
+            size_t end = text.find('\n', pos);
+            if (end == std::string_view::npos) {
+                end = text.size();
+            }
+            const std::string_view line = Trim(text.substr(pos, end - pos), true);
+            pos = end + 1;
+
+            if (line.empty() || line[0] == ';' || line[0] == '#') {
+                continue;
+            }
+            if (line[0] == '[' && line.back() == ']' && line.size() >= 2) {
+                section = InternSection(line.substr(1, line.size() - 2));
+                continue;
+            }
+            if (section == kNoSection) {
+                continue;
+            }
+            const size_t equal_pos = line.find('=');
+            if (equal_pos == std::string_view::npos) {
+                continue;
+            }
+            const std::string_view key = Trim(line.substr(0, equal_pos), false);
+            const std::string_view value = Trim(line.substr(equal_pos + 1), false);
+            const uint64_t hash = HashEntryKey(section, key);
+            if (FindEntry(section, key, hash) == kInvalidId) {
+                AddEntry(section, key, value, hash);
+            }
+        }
+        dirty_entries_.clear();
+        for (Entry& entry : entries_) {
+            entry.dirty = false;
+        }
+        structure_dirty_ = false;
+    }
+
+    EntryId Find(std::string_view section, std::string_view key) const {
+        const auto it = section_index_.find(section);
+        return (it == section_index_.end()) ? kInvalidId : FindEntry(it->second, key, HashEntryKey(it->second, key));
+    }
+
+    // Value of an entry, or nullptr if the key does not exist
+    const std::string* GetValue(std::string_view section, std::string_view key) const {
+        const EntryId id = Find(section, key);
+        return (id == kInvalidId) ? nullptr : &entries_[id].value;
+    }
+
+    const std::string& GetValue(EntryId id) const { return entries_[id].value; }
+
+    // Creates the section and key if needed. Returns true if the stored value changed.
+    bool SetValue(std::string_view section, std::string_view key, std::string_view value) {
+        const uint32_t section_id = InternSection(section);
+        const uint64_t hash = HashEntryKey(section_id, key);
+        const EntryId id = FindEntry(section_id, key, hash);
+        if (id == kInvalidId) {
+            MarkDirty(AddEntry(section_id, key, value, hash));
+            return true;
+        }
+        return SetValue(id, value);
+    }
+
+    bool SetValue(EntryId id, std::string_view value) {
+        Entry& entry = entries_[id];
+        if (entry.value == value) {
+            return false;
+        }
+        entry.value.assign(value.data(), value.size());
+        MarkDirty(id);
+        return true;
+    }
+
+    bool IsDirty() const { return structure_dirty_ || !dirty_entries_.empty(); }
+    size_t DirtyEntryCount() const { return dirty_entries_.size(); }
+    size_t SectionCount() const { return sections_.size(); }
+    size_t EntryCount() const { return entries_.size(); }
+
+    // Force the next save (e.g. after a failed write)
+    void MarkStructureDirty() { structure_dirty_ = true; }
+
+    void MarkClean() {
+        for (EntryId id : dirty_entries_) {
+            entries_[id].dirty = false;
+        }
+        dirty_entries_.clear();
+        structure_dirty_ = false;
+    }
+
+    // Whole file in order: "[section]", "key=value" lines, a blank line after each section
+    void Serialize(std::string& out, std::string_view line_end = "\n") const {
+        size_t size = 0;
+        for (const Section& section : sections_) {
+            size += section.name.size() + 2 + 2 * line_end.size();
+            for (EntryId id : section.entries) {
+                size += entries_[id].key.size() + entries_[id].value.size() + 1 + line_end.size();
+            }
+        }
+        out.clear();
+        out.reserve(size);
+        for (const Section& section : sections_) {
+            out += '[';
+            out += section.name;
+            out += ']';
+            out += line_end;
+            for (EntryId id : section.entries) {
+                out += entries_[id].key;
+                out += '=';
+                out += entries_[id].value;
+                out += line_end;
+            }
+            out += line_end;
+        }
+    }
+
+  private:
+    static constexpr uint32_t kNoSection = UINT32_MAX;
+
+    struct Section {
+        std::string name;
+        std::vector<EntryId> entries;
+    };
+
+    struct Entry {
+        uint64_t hash;  // HashEntryKey(section, key), kept for probing and growing the index
+        uint32_t section;
+        std::string key;
+        std::string value;
+        bool dirty = false;
+    };
+
+    static uint64_t HashBytes(std::string_view text, uint64_t seed) {
+        uint64_t hash = 14695981039346656037ull ^ seed;  // FNV-1a
+        for (const char c : text) {
+            hash = (hash ^ static_cast<uint8_t>(c)) * 1099511628211ull;
+        }
+        return hash;
+    }
+
+    struct SectionHash {
+        size_t operator()(std::string_view name) const { return static_cast<size_t>(HashBytes(name, 0)); }
+    };
+
+    static uint64_t HashEntryKey(uint32_t section, std::string_view key) {
+        return HashBytes(key, (static_cast<uint64_t>(section) + 1) * 0x9E3779B97F4A7C15ull);
+    }
+
+    // Trims ' ' and '\t', plus '\r' and '\n' for whole lines
+    static std::string_view Trim(std::string_view text, bool line_breaks) {
+        const auto is_space = [line_breaks](char c) {
+            return c == ' ' || c == '\t' || (line_breaks && (c == '\r' || c == '\n'));
+        };
+        size_t first = 0;
+        size_t last = text.size();
+        while (first < last && is_space(text[first])) {
+            ++first;
+        }
+        while (last > first && is_space(text[last - 1])) {
+            --last;
+        }
+        return text.substr(first, last - first);
+    }
+
+    uint32_t InternSection(std::string_view name) {
+        const auto it = section_index_.find(name);
+        if (it != section_index_.end()) {
+            return it->second;
+        }
+        const uint32_t id = static_cast<uint32_t>(sections_.size());
+        sections_.push_back({std::string(name), {}});
+        section_index_.emplace(std::string_view(sections_.back().name), id);
+        structure_dirty_ = true;
+        return id;
+    }
+
+    EntryId FindEntry(uint32_t section, std::string_view key, uint64_t hash) const {
+        if (entry_slots_.empty()) {
+            return kInvalidId;
+        }
+        const size_t mask = entry_slots_.size() - 1;
+        for (size_t slot = static_cast<size_t>(hash) & mask;; slot = (slot + 1) & mask) {
+            const uint32_t stored = entry_slots_[slot];
+            if (stored == 0) {
+                return kInvalidId;
+            }
+            const Entry& entry = entries_[stored - 1];
+            if (entry.hash == hash && entry.section == section && entry.key == key) {
+                return stored - 1;
+            }
+        }
+    }
+
+    EntryId AddEntry(uint32_t section, std::string_view key, std::string_view value, uint64_t hash) {
+        ReserveEntrySlots(entries_.size() + 1);
+        const EntryId id = static_cast<EntryId>(entries_.size());
+        entries_.push_back({hash, section, std::string(key), std::string(value), false});
+        InsertSlot(id);
+        sections_[section].entries.push_back(id);
+        return id;
+    }
+
+    // Open addressing with linear probing; slots hold entry ID + 1, 0 is empty. Kept at most half full.
+    void ReserveEntrySlots(size_t entry_count) {
+        if (entry_count * 2 <= entry_slots_.size()) {
+            return;
+        }
+        size_t capacity = 16;
+        while (capacity < entry_count * 2) {
+            capacity *= 2;
+        }
+        entry_slots_.assign(capacity, 0);
+        for (EntryId id = 0; id < entries_.size(); ++id) {
+            InsertSlot(id);
+        }
+    }
+
+    void InsertSlot(EntryId id) {
+        const size_t mask = entry_slots_.size() - 1;
+        size_t slot = static_cast<size_t>(entries_[id].hash) & mask;
+        while (entry_slots_[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+        entry_slots_[slot] = id + 1;
+    }
+
+    void MarkDirty(EntryId id) {
+        if (!entries_[id].dirty) {
+            entries_[id].dirty = true;
+            dirty_entries_.push_back(id);
+        }
+    }
+
+    // The deque keeps section names in place, so the section index keys can view them
+    std::deque<Section> sections_;
+    std::vector<Entry> entries_;
+    std::unordered_map<std::string_view, uint32_t, SectionHash> section_index_;
+    std::vector<uint32_t> entry_slots_;
+    std::vector<EntryId> dirty_entries_;
+    bool structure_dirty_ = false;
+};
+
+} // namespace utils
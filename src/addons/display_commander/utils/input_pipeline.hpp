@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+
+namespace utils {
+
+/**
+ * Fixed sequence of input processing stages.
+ *
+ * A stage is an empty functor type with `static constexpr uint32_t kFlag` and
+ * `void operator()(State&, Context&) const`. Run() calls the stages in the order they are listed, each only if its
+ * flag is set in `enabled_stages`; everything is inlined, so a disabled stage costs one test and branch.
+ */
+template <typename... Stages> class InputPipeline {
+  public:
+    static constexpr uint32_t kAllStages = (0u | ... | Stages::kFlag);
+
+    template <typename State, typename Context>
+    static void Run(uint32_t enabled_stages, State& state, Context& context) {
+        (RunStage<Stages>(enabled_stages, state, context), ...);
+    }
+
+  private:
+    template <typename Stage, typename State, typename Context>
+    static void RunStage(uint32_t enabled_stages, State& state, Context& context) {
+        if ((enabled_stages & Stage::kFlag) != 0) {
+            Stage{}(state, context);
+        }
+    }
+};
+
+/**
+ * Value derived from settings and rebuilt at most once per frame. Not thread-safe: keep one per polling thread
+ * (thread_local), like SettingsSnapshot.
+ *
+ * The frame id stalls while the game does not present (loading screens, menus that only poll input), so the value
+ * is also rebuilt when the settings bus generation moved or when it is older than kMaxAgeNs. The age bound covers
+ * settings that change without a Publish(), such as the controller widget's atomics.
+ */
+template <typename T> class FrameSnapshot {
+  public:
+    static constexpr int64_t kMaxAgeNs = 100'000'000;  // 100 ms
+
+    // load() builds a fresh T from the current settings
+    template <typename Loader>
+    const T& Get(uint64_t frame_id, uint64_t settings_generation, int64_t now_ns, Loader&& load) {
+        if (!loaded_ || frame_id != frame_id_ || settings_generation != settings_generation_
+            || now_ns - loaded_ns_ >= kMaxAgeNs) {
+            value_ = load();
+            frame_id_ = frame_id;
+            settings_generation_ = settings_generation;
+            loaded_ns_ = now_ns;
+            loaded_ = true;
+        }
+        return value_;
+    }
+
+  private:
+    T value_{};
+    uint64_t frame_id_ = 0;
+    uint64_t settings_generation_ = 0;
+    int64_t loaded_ns_ = 0;
+    bool loaded_ = false;
+};
+
+} // namespace utils
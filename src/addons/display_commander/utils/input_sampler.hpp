@@ -0,0 +1,198 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace utils {
+
+/**
+ * Latest-value handoff between one producer and one consumer.
+ *
+ * The producer fills WriteBuffer() and Publish()es it; the consumer calls Update() and then reads Read(). Neither
+ * side ever waits for the other or sees a half-written value, and the consumer always gets the newest published value
+ * (older unread ones are dropped).
+ */
+template <typename T> class TripleBuffer {
+  public:
+    // Producer side
+    T& WriteBuffer() { return buffers_[write_]; }
+    void Publish() {
+        const uint8_t previous = middle_.exchange(static_cast<uint8_t>(write_ | kFresh), std::memory_order_acq_rel);
+        write_ = previous & kIndexMask;
+    }
+
+    // Consumer side; true if a newer value became readable
+    bool Update() {
+        if ((middle_.load(std::memory_order_relaxed) & kFresh) == 0) {
+            return false;
+        }
+        const uint8_t previous = middle_.exchange(read_, std::memory_order_acq_rel);
+        read_ = previous & kIndexMask;
+        return true;
+    }
+    const T& Read() const { return buffers_[read_]; }
+
+  private:
+    static constexpr uint8_t kIndexMask = 3;
+    static constexpr uint8_t kFresh = 4;  // set in middle_ while it holds a value the consumer has not taken
+
+    std::array<T, 3> buffers_{};
+    std::atomic<uint8_t> middle_{1};
+    uint8_t write_ = 0;  // producer only
+    uint8_t read_ = 2;   // consumer only
+};
+
+template <typename State> struct InputSample {
+    State state{};
+    int64_t timestamp_ns = 0;  // when the backend returned it; 0 = never sampled
+    uint64_t sequence = 0;     // per pad, increments with every sample
+    uint32_t result = 0;       // backend status code, handed back to the caller as is
+    bool connected = false;
+};
+
+/**
+ * Polls up to kMaxPads controllers on its own thread and keeps the newest sample of each.
+ *
+ * Backend provides:
+ *   using State = ...;
+ *   bool Sample(size_t pad, State& state, uint32_t& result);  // true if the pad is connected
+ *   int64_t NowNs();
+ *   void SleepUntilNs(int64_t target_ns);
+ *
+ * Only pads that were Request()ed within the last kDemandWindowNs are polled, so unused slots cost nothing, and
+ * disconnected pads are retried every kDisconnectedRetryNs instead of at the full rate (probing an empty slot is the
+ * expensive case for XInput). Latest() may be called from any number of threads; they are serialized by a spin flag
+ * per pad that is held for one buffer swap and copy.
+ */
+template <typename Backend> class InputSampler {
+  public:
+    using State = typename Backend::State;
+    using Sample = InputSample<State>;
+
+    static constexpr size_t kMaxPads = 4;
+    static constexpr int64_t kDemandWindowNs = 1'000'000'000;
+    static constexpr int64_t kDisconnectedRetryNs = 500'000'000;
+
+    explicit InputSampler(Backend& backend) : backend_(backend) {}
+    ~InputSampler() { Stop(); }
+    InputSampler(const InputSampler&) = delete;
+    InputSampler& operator=(const InputSampler&) = delete;
+
+    // Not thread-safe against concurrent Start/Stop; call from one control thread
+    void Start(uint32_t rate_hz) {
+        SetRate(rate_hz);
+        if (running_.exchange(true, std::memory_order_acq_rel)) {
+            return;
+        }
+        thread_ = std::thread([this] { ThreadMain(); });
+    }
+    void Stop() {
+        if (!running_.exchange(false, std::memory_order_acq_rel)) {
+            return;
+        }
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+    bool IsRunning() const { return running_.load(std::memory_order_relaxed); }
+
+    void SetRate(uint32_t rate_hz) {
+        rate_hz = std::clamp<uint32_t>(rate_hz, 10, 8000);
+        period_ns_.store(1'000'000'000 / static_cast<int64_t>(rate_hz), std::memory_order_relaxed);
+    }
+    int64_t PeriodNs() const { return period_ns_.load(std::memory_order_relaxed); }
+
+    // Marks a pad as wanted by the game; cheap enough to call on every poll
+    void Request(size_t pad, int64_t now_ns) {
+        if (pad < kMaxPads && pads_[pad].requested_ns.load(std::memory_order_relaxed) != now_ns) {
+            pads_[pad].requested_ns.store(now_ns, std::memory_order_relaxed);
+        }
+    }
+
+    // Newest sample of a pad if it is recent enough to stand in for a direct read: a few sampling periods for
+    // connected pads, the retry interval for disconnected ones
+    bool Latest(size_t pad, int64_t now_ns, Sample& out) {
+        if (pad >= kMaxPads) {
+            return false;
+        }
+        PadSlot& slot = pads_[pad];
+        while (slot.reader_lock.test_and_set(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        slot.buffer.Update();
+        out = slot.buffer.Read();
+        slot.reader_lock.clear(std::memory_order_release);
+
+        if (out.timestamp_ns == 0) {
+            return false;
+        }
+        const int64_t max_age_ns =
+            out.connected ? (std::max)(4 * PeriodNs(), int64_t{20'000'000}) : 2 * kDisconnectedRetryNs;
+        return now_ns - out.timestamp_ns <= max_age_ns;
+    }
+
+    // One pass over the requested pads; the thread calls this every period
+    void SampleOnce(int64_t now_ns) {
+        for (size_t pad = 0; pad < kMaxPads; ++pad) {
+            PadSlot& slot = pads_[pad];
+            const int64_t requested_ns = slot.requested_ns.load(std::memory_order_relaxed);
+            if (requested_ns == 0 || now_ns - requested_ns > kDemandWindowNs) {
+                continue;
+            }
+            if (!slot.last_connected && slot.last_sample_ns != 0 && now_ns - slot.last_sample_ns < kDisconnectedRetryNs) {
+                continue;
+            }
+
+            Sample& sample = slot.buffer.WriteBuffer();
+            sample.connected = backend_.Sample(pad, sample.state, sample.result);
+            sample.timestamp_ns = backend_.NowNs();
+            sample.sequence = ++slot.sequence;
+            slot.last_connected = sample.connected;
+            slot.last_sample_ns = sample.timestamp_ns;
+            slot.buffer.Publish();
+        }
+        passes_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint64_t Passes() const { return passes_.load(std::memory_order_relaxed); }
+
+  private:
+    struct PadSlot {
+        TripleBuffer<Sample> buffer;
+        std::atomic<int64_t> requested_ns{0};
+        std::atomic_flag reader_lock = ATOMIC_FLAG_INIT;
+        // Sampler thread only
+        uint64_t sequence = 0;
+        int64_t last_sample_ns = 0;
+        bool last_connected = false;
+    };
+
+    void ThreadMain() {
+        int64_t next_ns = backend_.NowNs();
+        while (running_.load(std::memory_order_acquire)) {
+            SampleOnce(backend_.NowNs());
+
+            // Keep a fixed cadence; after a stall, restart from now instead of sampling in a burst
+            const int64_t period_ns = PeriodNs();
+            const int64_t now_ns = backend_.NowNs();
+            next_ns += period_ns;
+            if (next_ns < now_ns - period_ns) {
+                next_ns = now_ns;
+            }
+            backend_.SleepUntilNs(next_ns);
+        }
+    }
+
+    Backend& backend_;
+    std::array<PadSlot, kMaxPads> pads_{};
+    std::atomic<bool> running_{false};
+    std::atomic<int64_t> period_ns_{1'000'000};
+    std::atomic<uint64_t> passes_{0};
+    std::thread thread_;
+};
+
+} // namespace utils
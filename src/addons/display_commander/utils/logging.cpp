@@ -1,8 +1,112 @@
 #include "logging.hpp"
 #include "../globals.hpp"
 
+#include <chrono>
 #include <cstdio>
 #include <reshade.hpp>
+#include <thread>
+
+namespace {
+// Deferred log thread state
+std::atomic<bool> g_deferred_log_running{false};
+std::thread g_deferred_log_thread;
+SRWLOCK g_deferred_log_drain_lock = SRWLOCK_INIT;  // single consumer: deferred log thread or FlushDeferredLogs()
+utils::binlog::FileWriter g_deferred_log_file;     // open only in binary mode
+uint64_t g_deferred_log_reported_dropped = 0;
+
+uint32_t CurrentThreadIdForLog() { return GetCurrentThreadId(); }
+
+// Records keep the Windows thread ID, also for threads that log before the deferred log thread starts
+const bool g_deferred_log_thread_ids =
+    (utils::binlog::Logger::Instance().SetThreadIdProvider(&CurrentThreadIdForLog), true);
+
+reshade::log::level ToReShadeLevel(uint8_t level) {
+    switch (level) {
+        case 1:  return reshade::log::level::error;
+        case 2:  return reshade::log::level::warning;
+        case 3:  return reshade::log::level::info;
+        default: return reshade::log::level::debug;
+    }
+}
+
+// Caller holds g_deferred_log_drain_lock
+void DrainDeferredLogs() {
+    char buffer[2048];
+    utils::binlog::Logger::Instance().Drain([&buffer](const utils::binlog::RecordView &record) {
+        if (g_deferred_log_file.IsOpen()) {
+            g_deferred_log_file.Write(record);
+            return;
+        }
+        utils::binlog::FormatRecord(record.format, record.args, record.args_size, buffer, sizeof(buffer));
+        reshade::log::message(ToReShadeLevel(record.level), buffer);
+    });
+    g_deferred_log_file.Flush();
+
+    const uint64_t dropped = utils::binlog::Logger::Instance().Dropped();
+    if (dropped != g_deferred_log_reported_dropped) {
+        snprintf(buffer, sizeof(buffer), "Deferred log: %llu records dropped (thread buffer full)",
+                 static_cast<unsigned long long>(dropped - g_deferred_log_reported_dropped));
+        reshade::log::message(reshade::log::level::warning, buffer);
+        g_deferred_log_reported_dropped = dropped;
+    }
+}
+
+void DeferredLogThread() {
+    while (g_deferred_log_running.load()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        utils::SRWLockExclusive lock(g_deferred_log_drain_lock);
+        DrainDeferredLogs();
+    }
+}
+} // anonymous namespace
+
+bool IsLogLevelEnabled(int level) {
+    // Errors are always logged
+    return level <= static_cast<int>(LogLevel::Error) || level <= static_cast<int>(g_min_log_level.load());
+}
+
+void StartDeferredLogWriter() {
+    if (g_deferred_log_running.exchange(true)) {
+        return;
+    }
+
+    char path[MAX_PATH] = {};
+    const DWORD path_length = GetEnvironmentVariableA("DISPLAY_COMMANDER_BINARY_LOG", path, MAX_PATH);
+    if (path_length > 0 && path_length < MAX_PATH) {
+        utils::SRWLockExclusive lock(g_deferred_log_drain_lock);
+        if (g_deferred_log_file.Open(path)) {
+            LogInfo("Deferred log records are written unformatted to %s", path);
+        } else {
+            LogWarn("Deferred log: cannot create %s, formatting into the ReShade log instead", path);
+        }
+    }
+
+    g_deferred_log_thread = std::thread(DeferredLogThread);
+}
+
+void StopDeferredLogWriter() {
+    if (!g_deferred_log_running.exchange(false)) {
+        return;
+    }
+    if (g_deferred_log_thread.joinable()) {
+        g_deferred_log_thread.join();
+    }
+    utils::SRWLockExclusive lock(g_deferred_log_drain_lock);
+    DrainDeferredLogs();
+    g_deferred_log_file.Close();
+}
+
+void FlushDeferredLogs() {
+    // The deferred log thread may be mid-drain, or may have died holding the lock during a crash: wait briefly only
+    for (int attempt = 0; attempt < 50; ++attempt) {
+        if (TryAcquireSRWLockExclusive(&g_deferred_log_drain_lock)) {
+            DrainDeferredLogs();
+            ReleaseSRWLockExclusive(&g_deferred_log_drain_lock);
+            return;
+        }
+        Sleep(1);
+    }
+}
 
 // Logging function implementations
 void LogInfo(const char *msg, ...) {
@@ -1,6 +1,9 @@
 #pragma once
 
+#include "binary_log.hpp"
+
 #include <cstdarg>
+#include <type_traits>
 
 // Logging function declarations
 void LogInfo(const char *msg, ...);
@@ -8,6 +11,32 @@ void LogWarn(const char *msg, ...);
 void LogError(const char *msg, ...);
 void LogDebug(const char *msg, ...);
 
+// True if messages of this level (LogLevel value: 1 = Error ... 4 = Debug) pass the current log level
+bool IsLogLevelEnabled(int level);
+
+// Deferred logging for hot paths (hooks, per-frame code): the call only captures the format string address and
+// the raw arguments into a per-thread buffer; the deferred log thread formats them into the ReShade log later,
+// or writes them unformatted to the file named by DISPLAY_COMMANDER_BINARY_LOG (decode with tools/binary_log_decode).
+// The format is checked against the arguments at compile time; strings must be passed as const char*.
+template <typename... Args>
+void LogInfoDeferred(utils::binlog::FormatString<std::type_identity_t<Args>...> format, const Args &...args) {
+    if (IsLogLevelEnabled(3)) {
+        utils::binlog::Logger::Instance().Write(3, format.text, args...);
+    }
+}
+
+template <typename... Args>
+void LogDebugDeferred(utils::binlog::FormatString<std::type_identity_t<Args>...> format, const Args &...args) {
+    if (IsLogLevelEnabled(4)) {
+        utils::binlog::Logger::Instance().Write(4, format.text, args...);
+    }
+}
+
+// Deferred log thread lifetime; FlushDeferredLogs() formats everything pending on the calling thread (exit paths)
+void StartDeferredLogWriter();
+void StopDeferredLogWriter();
+void FlushDeferredLogs();
+
 // Log current logging level (always logs, even if logging is disabled)
 void LogCurrentLogLevel();
 
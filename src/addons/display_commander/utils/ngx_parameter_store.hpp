@@ -0,0 +1,487 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <thread>
+
+namespace utils {
+
+// Unified parameter value that can hold multiple types
+struct NgxParameterValue {
+    enum Type { INT, UINT, FLOAT, DOUBLE, ULL };
+    Type type;
+    union {
+        int int_val;
+        unsigned int uint_val;
+        float float_val;
+        double double_val;
+        uint64_t ull_val;
+    };
+
+    NgxParameterValue() : type(INT), int_val(0) {}
+    NgxParameterValue(int val) : type(INT), int_val(val) {}
+    NgxParameterValue(unsigned int val) : type(UINT), uint_val(val) {}
+    NgxParameterValue(float val) : type(FLOAT), float_val(val) {}
+    NgxParameterValue(double val) : type(DOUBLE), double_val(val) {}
+    NgxParameterValue(uint64_t val) : type(ULL), ull_val(val) {}
+
+    // Type conversion methods
+    int get_as_int() const {
+        switch (type) {
+            case INT: return int_val;
+            case UINT: return static_cast<int>(uint_val);
+            case FLOAT: return static_cast<int>(float_val);
+            case DOUBLE: return static_cast<int>(double_val);
+            case ULL: return static_cast<int>(ull_val);
+            default: return 0;
+        }
+    }
+
+    unsigned int get_as_uint() const {
+        switch (type) {
+            case INT: return static_cast<unsigned int>(int_val);
+            case UINT: return uint_val;
+            case FLOAT: return static_cast<unsigned int>(float_val);
+            case DOUBLE: return static_cast<unsigned int>(double_val);
+            case ULL: return static_cast<unsigned int>(ull_val);
+            default: return 0;
+        }
+    }
+
+    float get_as_float() const {
+        switch (type) {
+            case INT: return static_cast<float>(int_val);
+            case UINT: return static_cast<float>(uint_val);
+            case FLOAT: return float_val;
+            case DOUBLE: return static_cast<float>(double_val);
+            case ULL: return static_cast<float>(ull_val);
+            default: return 0.0f;
+        }
+    }
+
+    double get_as_double() const {
+        switch (type) {
+            case INT: return static_cast<double>(int_val);
+            case UINT: return static_cast<double>(uint_val);
+            case FLOAT: return static_cast<double>(float_val);
+            case DOUBLE: return double_val;
+            case ULL: return static_cast<double>(ull_val);
+            default: return 0.0;
+        }
+    }
+
+    uint64_t get_as_ull() const {
+        switch (type) {
+            case INT: return static_cast<uint64_t>(int_val);
+            case UINT: return static_cast<uint64_t>(uint_val);
+            case FLOAT: return static_cast<uint64_t>(float_val);
+            case DOUBLE: return static_cast<uint64_t>(double_val);
+            case ULL: return ull_val;
+            default: return 0;
+        }
+    }
+};
+
+// Parameter names DLSS / DLSS-G / Ray Reconstruction use every frame or that Display Commander reads back.
+// They get fixed slots found through a perfect hash; any other name is interned on first use.
+inline constexpr std::array<std::string_view, 59> kKnownNgxParameterNames = {
+    // Feature creation
+    "Width", "Height", "OutWidth", "OutHeight", "PerfQualityValue", "RTXValue", "FreeMemOnReleaseFeature",
+    "CreationNodeMask", "VisibilityNodeMask", "DLSS.Feature.Create.Flags", "DLSS.Enable.Output.Subrects",
+    "SizeInBytes", "SuperSampling.Available", "SuperSampling.NeedsUpdatedDriver",
+    "SuperSampling.FeatureInitResult", "DLSS.Get.Dynamic.Max.Render.Width",
+    "DLSS.Get.Dynamic.Max.Render.Height", "DLSS.Get.Dynamic.Min.Render.Width",
+    "DLSS.Get.Dynamic.Min.Render.Height",
+    // Per-frame evaluation
+    "Reset", "Sharpness", "MV.Scale.X", "MV.Scale.Y", "Jitter.Offset.X", "Jitter.Offset.Y",
+    "FrameTimeDeltaInMsec", "TonemapperType", "DLSS.Pre.Exposure", "DLSS.Exposure.Scale",
+    "DLSS.Render.Subrect.Dimensions.Width", "DLSS.Render.Subrect.Dimensions.Height", "Enable.OFA",
+    // Presets
+    "DLSS.Hint.Render.Preset.Quality", "DLSS.Hint.Render.Preset.Balanced", "DLSS.Hint.Render.Preset.Performance",
+    "DLSS.Hint.Render.Preset.UltraPerformance", "DLSS.Hint.Render.Preset.UltraQuality",
+    "DLSS.Hint.Render.Preset.DLAA", "RayReconstruction.Hint.Render.Preset.Quality",
+    "RayReconstruction.Hint.Render.Preset.Balanced", "RayReconstruction.Hint.Render.Preset.Performance",
+    "RayReconstruction.Hint.Render.Preset.UltraPerformance", "RayReconstruction.Hint.Render.Preset.UltraQuality",
+    "RayReconstruction.Hint.Render.Preset.DLAA",
+    // Frame generation
+    "DLSSG.EnableInterp", "DLSSG.MultiFrameCount", "DLSSG.CameraAspectRatio", "DLSSG.CameraFOV",
+    "DLSSG.JitterOffsetX", "DLSSG.JitterOffsetY", "DLSSG.DepthInverted", "DLSSG.ColorBuffersHDR",
+    "DLSSG.CameraMotionIncluded", "DLSSG.CameraNear", "DLSSG.CameraFar", "DLSSG.Reset", "DLSSG.OrthoProjection",
+    "DLSSG.MvecScaleX", "DLSSG.MvecScaleY"};
+
+namespace ngx_parameter_store_detail {
+
+// FNV-1a over the name, also returning its length so lookups walk the caller's string once
+constexpr uint64_t HashName(const char* name, size_t& length) {
+    uint64_t hash = 14695981039346656037ull;
+    size_t i = 0;
+    for (; name[i] != '\0'; ++i) {
+        hash = (hash ^ static_cast<uint8_t>(name[i])) * 1099511628211ull;
+    }
+    length = i;
+    return hash;
+}
+
+constexpr uint64_t HashName(std::string_view name) {
+    uint64_t hash = 14695981039346656037ull;
+    for (const char c : name) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 1099511628211ull;
+    }
+    return hash;
+}
+
+constexpr uint64_t Mix(uint64_t hash, uint64_t seed) {
+    uint64_t x = hash ^ seed;
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDull;
+    x ^= x >> 29;
+    return x;
+}
+
+constexpr size_t kPerfectHashBits = 9;
+constexpr size_t kPerfectHashBuckets = size_t{1} << kPerfectHashBits;
+
+constexpr size_t PerfectBucket(uint64_t hash, uint64_t seed) {
+    return static_cast<size_t>(Mix(hash, seed) >> (64 - kPerfectHashBits));
+}
+
+// First seed that puts every known name in its own bucket (0 if none was found)
+consteval uint64_t FindPerfectHashSeed() {
+    for (uint64_t seed = 1; seed < 4096; ++seed) {
+        std::array<bool, kPerfectHashBuckets> used{};
+        bool collision = false;
+        for (const std::string_view name : kKnownNgxParameterNames) {
+            const size_t bucket = PerfectBucket(HashName(name), seed * 0x9E3779B97F4A7C15ull);
+            if (used[bucket]) {
+                collision = true;
+                break;
+            }
+            used[bucket] = true;
+        }
+        if (!collision) {
+            return seed * 0x9E3779B97F4A7C15ull;
+        }
+    }
+    return 0;
+}
+
+inline constexpr uint64_t kPerfectHashSeed = FindPerfectHashSeed();
+static_assert(kPerfectHashSeed != 0, "no perfect hash seed for kKnownNgxParameterNames");
+static_assert(kKnownNgxParameterNames.size() < 255, "perfect hash buckets store known indexes as uint8_t");
+
+// Bucket -> known name index + 1, 0 for empty buckets
+consteval std::array<uint8_t, kPerfectHashBuckets> BuildPerfectHashTable() {
+    std::array<uint8_t, kPerfectHashBuckets> table{};
+    for (size_t i = 0; i < kKnownNgxParameterNames.size(); ++i) {
+        table[PerfectBucket(HashName(kKnownNgxParameterNames[i]), kPerfectHashSeed)] = static_cast<uint8_t>(i + 1);
+    }
+    return table;
+}
+
+inline constexpr std::array<uint8_t, kPerfectHashBuckets> kPerfectHashTable = BuildPerfectHashTable();
+
+} // namespace ngx_parameter_store_detail
+
+/**
+ * Concurrent NGX parameter store with interned names.
+ *
+ * Known names (kKnownNgxParameterNames) map to fixed slots through a compile-time perfect hash; any other
+ * name is copied into a fixed-capacity open-addressed table the first time it is set and keeps that slot
+ * forever. A lookup hashes the caller's C string once and compares it against one candidate name, so Set and
+ * Get never allocate and never take a lock. Each value is guarded by a per-slot sequence lock: readers retry
+ * if a writer was mid-update, writers of the same name take turns on the sequence.
+ *
+ * Names longer than kMaxInternedNameLength, or new names once the table is full, are not stored (Set returns
+ * false). NGX uses a few hundred distinct names at most.
+ */
+class NgxParameterStore {
+  public:
+    static constexpr size_t kInternedCapacity = 512;  // power of two, kept at most half full
+    static constexpr size_t kMaxInternedNameLength = 95;
+
+    NgxParameterStore() = default;
+    NgxParameterStore(const NgxParameterStore&) = delete;
+    NgxParameterStore& operator=(const NgxParameterStore&) = delete;
+
+    bool Set(const char* name, const NgxParameterValue& value) {
+        if (name == nullptr) {
+            return false;
+        }
+        size_t length = 0;
+        const uint64_t hash = ngx_parameter_store_detail::HashName(name, length);
+        ValueCell* cell = FindKnown(name, length, hash);
+        if (cell == nullptr) {
+            cell = FindOrInternName(name, length, hash);
+            if (cell == nullptr) {
+                return false;
+            }
+        }
+        cell->Store(value);
+        return true;
+    }
+
+    bool Get(const char* name, NgxParameterValue& value) const {
+        if (name == nullptr) {
+            return false;
+        }
+        size_t length = 0;
+        const uint64_t hash = ngx_parameter_store_detail::HashName(name, length);
+        const ValueCell* cell = FindKnown(name, length, hash);
+        if (cell == nullptr) {
+            cell = FindInterned(name, length, hash);
+            if (cell == nullptr) {
+                return false;
+            }
+        }
+        return cell->Load(value);
+    }
+
+    // Convenience update methods
+    bool SetInt(const char* name, int value) { return Set(name, NgxParameterValue(value)); }
+    bool SetUint(const char* name, unsigned int value) { return Set(name, NgxParameterValue(value)); }
+    bool SetFloat(const char* name, float value) { return Set(name, NgxParameterValue(value)); }
+    bool SetDouble(const char* name, double value) { return Set(name, NgxParameterValue(value)); }
+    bool SetUll(const char* name, uint64_t value) { return Set(name, NgxParameterValue(value)); }
+
+    // Type-specific get methods with conversion
+    bool GetAsInt(const char* name, int& value) const { return GetAs(name, value, &NgxParameterValue::get_as_int); }
+    bool GetAsUint(const char* name, unsigned int& value) const {
+        return GetAs(name, value, &NgxParameterValue::get_as_uint);
+    }
+    bool GetAsFloat(const char* name, float& value) const {
+        return GetAs(name, value, &NgxParameterValue::get_as_float);
+    }
+    bool GetAsDouble(const char* name, double& value) const {
+        return GetAs(name, value, &NgxParameterValue::get_as_double);
+    }
+    bool GetAsUll(const char* name, uint64_t& value) const {
+        return GetAs(name, value, &NgxParameterValue::get_as_ull);
+    }
+
+    // Calls fn(std::string_view name, const NgxParameterValue& value) for every parameter that has a value,
+    // known names first, then interned names in slot order
+    template <typename Fn> void ForEach(Fn&& fn) const {
+        NgxParameterValue value;
+        for (size_t i = 0; i < kKnownNgxParameterNames.size(); ++i) {
+            if (known_[i].Load(value)) {
+                fn(kKnownNgxParameterNames[i], value);
+            }
+        }
+        for (const InternedSlot& slot : interned_) {
+            if (slot.state.load(std::memory_order_acquire) == kSlotReady && slot.value.Load(value)) {
+                fn(std::string_view(slot.name, slot.length), value);
+            }
+        }
+    }
+
+    size_t size() const {
+        size_t count = 0;
+        ForEach([&count](std::string_view, const NgxParameterValue&) { ++count; });
+        return count;
+    }
+
+    // Forget all values; interned names keep their slots
+    void clear() {
+        for (ValueCell& cell : known_) {
+            cell.Reset();
+        }
+        for (InternedSlot& slot : interned_) {
+            slot.value.Reset();
+        }
+    }
+
+  private:
+    static constexpr uint32_t kNoValue = UINT32_MAX;
+
+    // One value behind a sequence lock; the sequence is odd while a writer is inside
+    struct ValueCell {
+        std::atomic<uint32_t> sequence{0};
+        std::atomic<uint32_t> type{kNoValue};
+        std::atomic<uint64_t> bits{0};
+
+        void Store(const NgxParameterValue& value) { Write(static_cast<uint32_t>(value.type), ToBits(value)); }
+        void Reset() { Write(kNoValue, 0); }
+
+        bool Load(NgxParameterValue& value) const {
+            for (;;) {
+                const uint32_t begin = sequence.load(std::memory_order_acquire);
+                if ((begin & 1u) != 0) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                const uint32_t stored_type = type.load(std::memory_order_relaxed);
+                const uint64_t stored_bits = bits.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (sequence.load(std::memory_order_relaxed) != begin) {
+                    continue;
+                }
+                if (stored_type == kNoValue) {
+                    return false;
+                }
+                value = FromBits(static_cast<NgxParameterValue::Type>(stored_type), stored_bits);
+                return true;
+            }
+        }
+
+      private:
+        void Write(uint32_t new_type, uint64_t new_bits) {
+            uint32_t current = sequence.load(std::memory_order_relaxed);
+            for (;;) {
+                if ((current & 1u) != 0) {
+                    std::this_thread::yield();
+                    current = sequence.load(std::memory_order_relaxed);
+                    continue;
+                }
+                if (sequence.compare_exchange_weak(current, current + 1, std::memory_order_acquire,
+                                                   std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            std::atomic_thread_fence(std::memory_order_release);
+            type.store(new_type, std::memory_order_relaxed);
+            bits.store(new_bits, std::memory_order_relaxed);
+            sequence.store(current + 2, std::memory_order_release);
+        }
+    };
+
+    static constexpr uint32_t kSlotEmpty = 0;
+    static constexpr uint32_t kSlotClaimed = 1;  // name being copied in
+    static constexpr uint32_t kSlotReady = 2;
+
+    struct InternedSlot {
+        std::atomic<uint32_t> state{kSlotEmpty};
+        uint32_t length = 0;
+        uint64_t hash = 0;
+        char name[kMaxInternedNameLength + 1] = {};
+        ValueCell value;
+    };
+
+    static uint64_t ToBits(const NgxParameterValue& value) {
+        uint64_t bits = 0;
+        switch (value.type) {
+            case NgxParameterValue::INT:    std::memcpy(&bits, &value.int_val, sizeof(value.int_val)); break;
+            case NgxParameterValue::UINT:   std::memcpy(&bits, &value.uint_val, sizeof(value.uint_val)); break;
+            case NgxParameterValue::FLOAT:  std::memcpy(&bits, &value.float_val, sizeof(value.float_val)); break;
+            case NgxParameterValue::DOUBLE: std::memcpy(&bits, &value.double_val, sizeof(value.double_val)); break;
+            case NgxParameterValue::ULL:    bits = value.ull_val; break;
+        }
+        return bits;
+    }
+
+    static NgxParameterValue FromBits(NgxParameterValue::Type type, uint64_t bits) {
+        NgxParameterValue value;
+        value.type = type;
+        switch (type) {
+            case NgxParameterValue::INT:    std::memcpy(&value.int_val, &bits, sizeof(value.int_val)); break;
+            case NgxParameterValue::UINT:   std::memcpy(&value.uint_val, &bits, sizeof(value.uint_val)); break;
+            case NgxParameterValue::FLOAT:  std::memcpy(&value.float_val, &bits, sizeof(value.float_val)); break;
+            case NgxParameterValue::DOUBLE: std::memcpy(&value.double_val, &bits, sizeof(value.double_val)); break;
+            case NgxParameterValue::ULL:    value.ull_val = bits; break;
+        }
+        return value;
+    }
+
+    template <typename T> bool GetAs(const char* name, T& value, T (NgxParameterValue::*convert)() const) const {
+        NgxParameterValue param;
+        if (!Get(name, param)) {
+            return false;
+        }
+        value = (param.*convert)();
+        return true;
+    }
+
+    static size_t KnownIndex(const char* name, size_t length, uint64_t hash) {
+        using namespace ngx_parameter_store_detail;
+        const uint8_t entry = kPerfectHashTable[PerfectBucket(hash, kPerfectHashSeed)];
+        if (entry == 0) {
+            return SIZE_MAX;
+        }
+        const std::string_view known = kKnownNgxParameterNames[entry - 1];
+        return (known == std::string_view(name, length)) ? entry - 1 : SIZE_MAX;
+    }
+
+    ValueCell* FindKnown(const char* name, size_t length, uint64_t hash) {
+        const size_t index = KnownIndex(name, length, hash);
+        return (index == SIZE_MAX) ? nullptr : &known_[index];
+    }
+
+    const ValueCell* FindKnown(const char* name, size_t length, uint64_t hash) const {
+        const size_t index = KnownIndex(name, length, hash);
+        return (index == SIZE_MAX) ? nullptr : &known_[index];
+    }
+
+    // Waits out a concurrent interning of the slot; returns false for empty slots
+    static bool WaitUntilReady(const InternedSlot& slot) {
+        uint32_t state = slot.state.load(std::memory_order_acquire);
+        while (state == kSlotClaimed) {
+            std::this_thread::yield();
+            state = slot.state.load(std::memory_order_acquire);
+        }
+        return state == kSlotReady;
+    }
+
+    static bool SlotMatches(const InternedSlot& slot, const char* name, size_t length, uint64_t hash) {
+        return slot.hash == hash && slot.length == length && std::memcmp(slot.name, name, length) == 0;
+    }
+
+    const ValueCell* FindInterned(const char* name, size_t length, uint64_t hash) const {
+        if (length > kMaxInternedNameLength) {
+            return nullptr;
+        }
+        const size_t mask = kInternedCapacity - 1;
+        for (size_t probe = 0, slot = static_cast<size_t>(hash) & mask; probe < kInternedCapacity;
+             ++probe, slot = (slot + 1) & mask) {
+            const InternedSlot& candidate = interned_[slot];
+            if (!WaitUntilReady(candidate)) {
+                return nullptr;
+            }
+            if (SlotMatches(candidate, name, length, hash)) {
+                return &candidate.value;
+            }
+        }
+        return nullptr;
+    }
+
+    ValueCell* FindOrInternName(const char* name, size_t length, uint64_t hash) {
+        if (length > kMaxInternedNameLength) {
+            return nullptr;
+        }
+        const size_t mask = kInternedCapacity - 1;
+        for (size_t probe = 0, slot = static_cast<size_t>(hash) & mask; probe < kInternedCapacity;
+             ++probe, slot = (slot + 1) & mask) {
+            InternedSlot& candidate = interned_[slot];
+            if (!WaitUntilReady(candidate)) {
+                // Keep the table at most half full so probes stay short
+                if (interned_count_.load(std::memory_order_relaxed) >= kInternedCapacity / 2) {
+                    return nullptr;
+                }
+                uint32_t expected = kSlotEmpty;
+                if (candidate.state.compare_exchange_strong(expected, kSlotClaimed, std::memory_order_acquire)) {
+                    std::memcpy(candidate.name, name, length);
+                    candidate.name[length] = '\0';
+                    candidate.length = static_cast<uint32_t>(length);
+                    candidate.hash = hash;
+                    interned_count_.fetch_add(1, std::memory_order_relaxed);
+                    candidate.state.store(kSlotReady, std::memory_order_release);
+                    return &candidate.value;
+                }
+                // Another thread claimed this slot first; it may be interning the same name
+                WaitUntilReady(candidate);
+            }
+            if (SlotMatches(candidate, name, length, hash)) {
+                return &candidate.value;
+            }
+        }
+        return nullptr;
+    }
+
+    std::array<ValueCell, kKnownNgxParameterNames.size()> known_;
+    std::array<InternedSlot, kInternedCapacity> interned_;
+    std::atomic<size_t> interned_count_{0};
+};
+
+} // namespace utils
@@ -0,0 +1,280 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace utils {
+
+constexpr size_t kRemapButtonCount = 16;
+
+enum class RemapOutput : uint8_t { kNone = 0, kKeyboard, kGamepad, kAction };
+
+// One remap with everything the hot path needs already resolved (virtual key, target buttons, action id)
+struct RemapBinding {
+    uint16_t source_button = 0;  // single button bit
+    RemapOutput output = RemapOutput::kNone;
+    uint8_t input_method = 0;  // keyboard outputs: how the key is sent
+    uint16_t payload = 0;      // virtual key, target button mask or action id
+    bool hold = false;         // keyboard: send key up on release; gamepad: keep the source button pressed
+    bool chord = false;        // only fires while the modifier button (Guide) is held
+};
+
+enum class RemapEdge : uint8_t { kPress, kRelease };
+
+struct RemapEvent {
+    RemapBinding binding;
+    RemapEdge edge = RemapEdge::kPress;
+};
+
+/**
+ * Per-button state machine: every button is Idle, Fired (its press was dispatched) or Blocked (held down without
+ * having fired, e.g. a chord pressed without the modifier). Inputs are the button's edges; a press edge is split by
+ * whether the modifier is held at that moment.
+ */
+enum class RemapButtonState : uint8_t { kIdle = 0, kFired = 1, kBlocked = 2 };
+enum class RemapInput : uint8_t { kRelease = 0, kPress = 1, kPressWithModifier = 2 };
+
+constexpr size_t kRemapStates = 3;
+constexpr size_t kRemapInputs = 3;
+
+// Transition cell: next state in bits 0-1, emitted edge in bits 2-3 (0 none, 1 press, 2 release). The all-zero cell
+// (stay idle, emit nothing) is what unbound buttons use.
+constexpr uint8_t kRemapEmitPress = 1u << 2;
+constexpr uint8_t kRemapEmitRelease = 2u << 2;
+
+struct RemapDispatchTable {
+    std::array<RemapBinding, kRemapButtonCount> bindings{};  // indexed by source bit; kNone = unbound
+    std::array<std::array<uint8_t, kRemapStates * kRemapInputs>, kRemapButtonCount> transitions{};
+    uint16_t modifier = 0;      // chord modifier button
+    uint16_t bound_mask = 0;    // buttons with any binding
+    uint16_t gamepad_mask = 0;  // buttons with a gamepad output
+};
+static_assert(std::is_trivially_copyable_v<RemapDispatchTable>);
+
+inline uint8_t RemapTransition(RemapButtonState next, uint8_t emit = 0) { return static_cast<uint8_t>(next) | emit; }
+
+// Builds the table; a later binding for the same button replaces an earlier one, bindings that are not a single
+// button bit are ignored. Callers leave out disabled remaps.
+inline RemapDispatchTable CompileRemapTable(const RemapBinding* bindings, size_t count, uint16_t modifier) {
+    RemapDispatchTable table;
+    table.modifier = modifier;
+    for (size_t i = 0; i < count; ++i) {
+        const RemapBinding& binding = bindings[i];
+        if (binding.output == RemapOutput::kNone || !std::has_single_bit(binding.source_button)) {
+            continue;
+        }
+        const size_t bit = static_cast<size_t>(std::countr_zero(binding.source_button));
+        table.bindings[bit] = binding;
+        table.bound_mask |= binding.source_button;
+        if (binding.output == RemapOutput::kGamepad) {
+            table.gamepad_mask |= binding.source_button;
+        } else {
+            table.gamepad_mask &= static_cast<uint16_t>(~binding.source_button);
+        }
+
+        auto cell = [&table, bit](RemapButtonState state, RemapInput input) -> uint8_t& {
+            return table.transitions[bit][static_cast<size_t>(state) * kRemapInputs + static_cast<size_t>(input)];
+        };
+        const uint8_t release_emit = binding.hold ? kRemapEmitRelease : 0;
+        cell(RemapButtonState::kIdle, RemapInput::kPress) =
+            binding.chord ? RemapTransition(RemapButtonState::kBlocked)
+                          : RemapTransition(RemapButtonState::kFired, kRemapEmitPress);
+        cell(RemapButtonState::kIdle, RemapInput::kPressWithModifier) =
+            RemapTransition(RemapButtonState::kFired, kRemapEmitPress);
+        // A fired hold remap always gets its release, even if the modifier was let go first
+        cell(RemapButtonState::kFired, RemapInput::kRelease) = RemapTransition(RemapButtonState::kIdle, release_emit);
+        cell(RemapButtonState::kFired, RemapInput::kPress) = RemapTransition(RemapButtonState::kFired);
+        cell(RemapButtonState::kFired, RemapInput::kPressWithModifier) = RemapTransition(RemapButtonState::kFired);
+    }
+    return table;
+}
+
+// Gamepad-to-gamepad remaps applied to one XInput state: held sources add their target buttons, and non-hold
+// remaps hide the source button from the game
+inline uint16_t ApplyGamepadRemaps(const RemapDispatchTable& table, uint16_t buttons) {
+    const bool modifier_held = (buttons & table.modifier) != 0;
+    uint16_t result = buttons;
+    for (uint32_t active = buttons & table.gamepad_mask; active != 0; active &= active - 1) {
+        const RemapBinding& binding = table.bindings[static_cast<size_t>(std::countr_zero(active))];
+        if (binding.chord && !modifier_held) {
+            continue;
+        }
+        result |= binding.payload;
+        if (!binding.hold) {
+            result &= static_cast<uint16_t>(~binding.source_button);
+        }
+    }
+    return result;
+}
+
+// Buttons seen last, 2-bit state per button and the table generation they belong to
+struct RemapControllerState {
+    uint16_t buttons = 0;
+    uint32_t button_states = 0;
+    uint16_t table_generation = 0;
+
+    RemapButtonState StateOf(size_t bit) const { return static_cast<RemapButtonState>((button_states >> (bit * 2)) & 3u); }
+    void SetState(size_t bit, RemapButtonState state) {
+        button_states = (button_states & ~(3u << (bit * 2))) | (static_cast<uint32_t>(state) << (bit * 2));
+    }
+
+    uint64_t Pack() const {
+        return static_cast<uint64_t>(buttons) | (static_cast<uint64_t>(button_states) << 16)
+               | (static_cast<uint64_t>(table_generation) << 48);
+    }
+    static RemapControllerState Unpack(uint64_t word) {
+        RemapControllerState state;
+        state.buttons = static_cast<uint16_t>(word);
+        state.button_states = static_cast<uint32_t>(word >> 16);
+        state.table_generation = static_cast<uint16_t>(word >> 48);
+        return state;
+    }
+};
+
+// Advances the state machines of every button that changed; writes at most kRemapButtonCount events
+inline size_t StepRemapStates(const RemapDispatchTable& table, RemapControllerState& state, uint16_t buttons,
+                              RemapEvent* events) {
+    const bool modifier_held = (buttons & table.modifier) != 0;
+    size_t count = 0;
+    for (uint32_t changed = static_cast<uint16_t>(state.buttons ^ buttons); changed != 0; changed &= changed - 1) {
+        const size_t bit = static_cast<size_t>(std::countr_zero(changed));
+        const bool pressed = (buttons & (1u << bit)) != 0;
+        const RemapInput input = !pressed        ? RemapInput::kRelease
+                                 : modifier_held ? RemapInput::kPressWithModifier
+                                                 : RemapInput::kPress;
+        const uint8_t cell =
+            table.transitions[bit][static_cast<size_t>(state.StateOf(bit)) * kRemapInputs + static_cast<size_t>(input)];
+        state.SetState(bit, static_cast<RemapButtonState>(cell & 3u));
+        if ((cell & kRemapEmitPress) != 0) {
+            events[count++] = {table.bindings[bit], RemapEdge::kPress};
+        } else if ((cell & kRemapEmitRelease) != 0) {
+            events[count++] = {table.bindings[bit], RemapEdge::kRelease};
+        }
+    }
+    state.buttons = buttons;
+    return count;
+}
+
+// Moves a controller onto a new table: held outputs of the old table are released, and buttons still down are
+// blocked so they only fire under the new table once pressed again
+inline size_t RebaseRemapStates(const RemapDispatchTable& old_table, RemapControllerState& state,
+                                uint16_t new_generation, RemapEvent* events) {
+    size_t count = 0;
+    for (size_t bit = 0; bit < kRemapButtonCount; ++bit) {
+        const RemapButtonState current = state.StateOf(bit);
+        if (current == RemapButtonState::kFired && old_table.bindings[bit].hold) {
+            events[count++] = {old_table.bindings[bit], RemapEdge::kRelease};
+        }
+        const bool down = (state.buttons & (1u << bit)) != 0;
+        state.SetState(bit, down ? RemapButtonState::kBlocked : RemapButtonState::kIdle);
+    }
+    state.table_generation = new_generation;
+    return count;
+}
+
+/**
+ * Remap state of one controller. The game may poll the same controller from several threads, so each poll
+ * advances the packed state with a CAS and only dispatches the events of the transition that won.
+ */
+class RemapControllerSlot {
+  public:
+    // False if the slot is still on another table generation (a swap is being applied); nothing changes then
+    bool Step(const RemapDispatchTable& table, uint16_t generation, uint16_t buttons, RemapEvent* events,
+              size_t& event_count) {
+        uint64_t word = word_.load(std::memory_order_acquire);
+        for (;;) {
+            RemapControllerState state = RemapControllerState::Unpack(word);
+            if (state.table_generation != generation) {
+                return false;
+            }
+            if (state.buttons == buttons) {
+                event_count = 0;
+                return true;
+            }
+            event_count = StepRemapStates(table, state, buttons, events);
+            if (word_.compare_exchange_weak(word, state.Pack(), std::memory_order_acq_rel,
+                                            std::memory_order_acquire)) {
+                return true;
+            }
+        }
+    }
+
+    // Writer only, after publishing the new table
+    size_t Rebase(const RemapDispatchTable& old_table, uint16_t new_generation, RemapEvent* events) {
+        uint64_t word = word_.load(std::memory_order_acquire);
+        for (;;) {
+            RemapControllerState state = RemapControllerState::Unpack(word);
+            const size_t count = RebaseRemapStates(old_table, state, new_generation, events);
+            if (word_.compare_exchange_weak(word, state.Pack(), std::memory_order_acq_rel,
+                                            std::memory_order_acquire)) {
+                return count;
+            }
+        }
+    }
+
+    RemapControllerState Load() const { return RemapControllerState::Unpack(word_.load(std::memory_order_acquire)); }
+
+  private:
+    std::atomic<uint64_t> word_{0};
+};
+
+/**
+ * Current dispatch table behind a sequence lock. Tables are only replaced when remaps are edited; readers keep a
+ * copy and re-read it when Generation() moves. Generation 0 is the empty table, matching fresh controller slots.
+ */
+class RemapTablePublisher {
+  public:
+    RemapTablePublisher() = default;
+    RemapTablePublisher(const RemapTablePublisher&) = delete;
+    RemapTablePublisher& operator=(const RemapTablePublisher&) = delete;
+
+    // Writers must be serialized by the caller. Returns the new generation.
+    uint16_t Publish(const RemapDispatchTable& table) {
+        uint64_t words[kWords] = {};
+        std::memcpy(words, &table, sizeof(table));
+        const uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < kWords; ++i) {
+            words_[i].store(words[i], std::memory_order_relaxed);
+        }
+        sequence_.store(sequence + 2, std::memory_order_release);
+        return GenerationOf(sequence + 2);
+    }
+
+    uint16_t Generation() const { return GenerationOf(sequence_.load(std::memory_order_acquire)); }
+
+    // Copies the current table; false if a Publish is in progress
+    bool TryRead(RemapDispatchTable& out, uint16_t& generation) const {
+        const uint64_t begin = sequence_.load(std::memory_order_acquire);
+        if ((begin & 1) != 0) {
+            return false;
+        }
+        uint64_t words[kWords];
+        for (size_t i = 0; i < kWords; ++i) {
+            words[i] = words_[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence_.load(std::memory_order_relaxed) != begin) {
+            return false;
+        }
+        std::memcpy(&out, words, sizeof(out));
+        generation = GenerationOf(begin);
+        return true;
+    }
+
+  private:
+    static constexpr size_t kWords = (sizeof(RemapDispatchTable) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    static uint16_t GenerationOf(uint64_t sequence) { return static_cast<uint16_t>(sequence / 2); }
+
+    std::atomic<uint64_t> sequence_{0};
+    std::array<std::atomic<uint64_t>, kWords> words_{};
+};
+
+} // namespace utils
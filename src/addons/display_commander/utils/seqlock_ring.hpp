@@ -0,0 +1,188 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace utils {
+
+/**
+ * Single-producer / multi-consumer ring buffer with per-slot seqlocks.
+ *
+ * Every slot carries a 64-bit nanosecond timestamp and a sequence number derived from the logical
+ * position it holds (2 * pos + 1 while being written, 2 * pos + 2 once complete). Readers validate the
+ * sequence before and after copying, so a slot that is torn or has been lapped by the producer is
+ * reported as unavailable instead of returning mixed data.
+ *
+ * Reset() does not touch the producer: it only moves the start position that readers consider,
+ * so it is safe to call from any thread.
+ */
+template <typename T, size_t Capacity>
+class SeqlockRing {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of 2");
+    static_assert(std::is_trivially_copyable_v<T>, "SeqlockRing payload must be trivially copyable");
+
+  public:
+    struct Entry {
+        T value;
+        uint64_t timestamp_ns;
+    };
+
+    SeqlockRing() = default;
+    SeqlockRing(const SeqlockRing&) = delete;
+    SeqlockRing& operator=(const SeqlockRing&) = delete;
+
+    static constexpr size_t capacity() { return Capacity; }
+
+    // Producer only
+    void Push(const T& value, uint64_t timestamp_ns) {
+        const uint64_t pos = head_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[pos & (Capacity - 1)];
+
+        uint64_t words[kWords] = {};
+        std::memcpy(words, &value, sizeof(T));
+
+        slot.seq.store(2 * pos + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.timestamp_ns.store(timestamp_ns, std::memory_order_relaxed);
+        for (size_t i = 0; i < kWords; ++i) {
+            slot.words[i].store(words[i], std::memory_order_relaxed);
+        }
+        slot.seq.store(2 * pos + 2, std::memory_order_release);
+        head_.store(pos + 1, std::memory_order_release);
+    }
+
+    // Total number of samples ever pushed (next position to be written)
+    uint64_t Head() const { return head_.load(std::memory_order_acquire); }
+
+    // Any thread: readers will only see samples pushed after this call
+    void Reset() { reset_pos_.store(head_.load(std::memory_order_acquire), std::memory_order_release); }
+
+    // Oldest position still readable (after the last reset and not yet overwritten)
+    uint64_t OldestPosition(uint64_t head) const {
+        const uint64_t reset_pos = reset_pos_.load(std::memory_order_acquire);
+        const uint64_t lapped_pos = (head > Capacity) ? head - Capacity : 0;
+        return (reset_pos > lapped_pos) ? reset_pos : lapped_pos;
+    }
+
+    // Number of samples currently readable
+    size_t Count() const {
+        const uint64_t head = Head();
+        return static_cast<size_t>(head - OldestPosition(head));
+    }
+
+    // Read the sample at a logical position; false if it was never written, is being written or was overwritten
+    bool TryRead(uint64_t pos, Entry& out) const {
+        const Slot& slot = slots_[pos & (Capacity - 1)];
+        const uint64_t expected = 2 * pos + 2;
+        if (slot.seq.load(std::memory_order_acquire) != expected) {
+            return false;
+        }
+
+        uint64_t words[kWords];
+        const uint64_t timestamp_ns = slot.timestamp_ns.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < kWords; ++i) {
+            words[i] = slot.words[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.seq.load(std::memory_order_relaxed) != expected) {
+            return false;
+        }
+
+        std::memcpy(&out.value, words, sizeof(T));
+        out.timestamp_ns = timestamp_ns;
+        return true;
+    }
+
+    // Most recent consistent sample
+    bool ReadLatest(Entry& out) const {
+        const uint64_t head = Head();
+        const uint64_t oldest = OldestPosition(head);
+        for (uint64_t pos = head; pos > oldest; --pos) {
+            if (TryRead(pos - 1, out)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Visit up to the last `max_count` samples, oldest first. Returns the number of samples visited.
+    template <typename Callback>
+    size_t ForEachLast(size_t max_count, Callback&& callback) const {
+        const uint64_t head = Head();
+        const uint64_t oldest = OldestPosition(head);
+        const uint64_t start = (head - oldest > max_count) ? head - max_count : oldest;
+        size_t visited = 0;
+        Entry entry;
+        for (uint64_t pos = start; pos < head; ++pos) {
+            if (TryRead(pos, entry)) {
+                callback(entry.value, entry.timestamp_ns);
+                ++visited;
+            }
+        }
+        return visited;
+    }
+
+    // Visit samples from newest to oldest until the callback returns false. Returns the number of samples visited.
+    template <typename Callback>
+    size_t ForEachNewestFirst(Callback&& callback) const {
+        const uint64_t head = Head();
+        const uint64_t oldest = OldestPosition(head);
+        size_t visited = 0;
+        Entry entry;
+        for (uint64_t pos = head; pos > oldest; --pos) {
+            if (!TryRead(pos - 1, entry)) {
+                continue;
+            }
+            ++visited;
+            if (!callback(entry.value, entry.timestamp_ns)) {
+                break;
+            }
+        }
+        return visited;
+    }
+
+    // Visit samples with timestamp >= since_ns, oldest first (e.g. "last 60 s"). Returns the number of samples visited.
+    template <typename Callback>
+    size_t ForEachSince(uint64_t since_ns, Callback&& callback) const {
+        const uint64_t head = Head();
+        const uint64_t oldest = OldestPosition(head);
+
+        // Timestamps are monotonic in position, so walk back to the first sample inside the window
+        uint64_t start = head;
+        Entry entry;
+        while (start > oldest) {
+            if (TryRead(start - 1, entry) && entry.timestamp_ns < since_ns) {
+                break;
+            }
+            --start;
+        }
+
+        size_t visited = 0;
+        for (uint64_t pos = start; pos < head; ++pos) {
+            if (TryRead(pos, entry) && entry.timestamp_ns >= since_ns) {
+                callback(entry.value, entry.timestamp_ns);
+                ++visited;
+            }
+        }
+        return visited;
+    }
+
+  private:
+    static constexpr size_t kWords = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    struct Slot {
+        std::atomic<uint64_t> seq{0};
+        std::atomic<uint64_t> timestamp_ns{0};
+        std::array<std::atomic<uint64_t>, kWords> words{};
+    };
+
+    std::array<Slot, Capacity> slots_{};
+    alignas(64) std::atomic<uint64_t> head_{0};
+    alignas(64) std::atomic<uint64_t> reset_pos_{0};
+};
+
+} // namespace utils
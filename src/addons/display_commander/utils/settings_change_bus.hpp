@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace utils {
+
+struct SettingsChange {
+    uint64_t generation;
+    std::string_view section;
+    std::string_view key;  // empty: many settings changed at once (e.g. a tab was loaded)
+};
+
+/**
+ * Publish/subscribe bus for settings changes.
+ *
+ * Writers store the new value first and then call Publish(), which bumps the generation (release) and runs the
+ * subscribers on the writer's thread. A reader that loads Generation() (acquire) and then reads settings sees at
+ * least the values of that generation, so a cache keyed by the generation is never left stale: a change that
+ * races with a refresh bumps the generation again after the refresh read it.
+ */
+class SettingsChangeBus {
+  public:
+    using Callback = std::function<void(const SettingsChange&)>;
+    using SubscriptionId = uint64_t;
+
+    uint64_t Generation() const { return generation_.load(std::memory_order_acquire); }
+
+    void Publish(std::string_view section, std::string_view key) {
+        const uint64_t generation = generation_.fetch_add(1, std::memory_order_acq_rel) + 1;
+
+        // Run callbacks outside the lock so they may read settings, publish or unsubscribe themselves
+        std::vector<std::pair<SubscriptionId, Callback>> subscribers;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (subscribers_.empty()) {
+                return;
+            }
+            subscribers = subscribers_;
+        }
+        const SettingsChange change{generation, section, key};
+        for (const auto& subscriber : subscribers) {
+            subscriber.second(change);
+        }
+    }
+
+    SubscriptionId Subscribe(Callback callback) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const SubscriptionId id = ++last_subscription_id_;
+        subscribers_.emplace_back(id, std::move(callback));
+        return id;
+    }
+
+    void Unsubscribe(SubscriptionId id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto it = subscribers_.begin(); it != subscribers_.end(); ++it) {
+            if (it->first == id) {
+                subscribers_.erase(it);
+                return;
+            }
+        }
+    }
+
+  private:
+    std::atomic<uint64_t> generation_{0};
+    std::mutex mutex_;
+    std::vector<std::pair<SubscriptionId, Callback>> subscribers_;
+    SubscriptionId last_subscription_id_ = 0;
+};
+
+/**
+ * Values derived from settings, rebuilt only when the bus generation moved. Not thread-safe: keep one per
+ * reader thread (thread_local) or guard it.
+ */
+template <typename T> class SettingsSnapshot {
+  public:
+    // load() builds a fresh T from the current settings
+    template <typename Loader> const T& Get(const SettingsChangeBus& bus, Loader&& load) {
+        const uint64_t generation = bus.Generation();
+        if (generation != generation_) {
+            value_ = load();
+            generation_ = generation;
+        }
+        return value_;
+    }
+
+    // Generation the current value was built at
+    uint64_t Version() const { return generation_; }
+
+  private:
+    static constexpr uint64_t kNeverLoaded = UINT64_MAX;
+
+    T value_{};
+    uint64_t generation_ = kNeverLoaded;
+};
+
+} // namespace utils
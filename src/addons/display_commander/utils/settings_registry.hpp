@@ -0,0 +1,267 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace utils {
+
+enum class SettingType : uint8_t { kBool, kInt, kFloat };
+
+// One entry of a settings schema. Values and ranges are stored as double so one type covers all settings.
+struct SettingDef {
+    const char* section;
+    const char* key;
+    SettingType type;
+    double default_value;
+    double min;
+    double max;
+};
+
+constexpr SettingDef BoolSettingDef(const char* section, const char* key, bool default_value) {
+    return {section, key, SettingType::kBool, default_value ? 1.0 : 0.0, 0.0, 1.0};
+}
+
+constexpr SettingDef IntSettingDef(const char* section, const char* key, int default_value, int min, int max) {
+    return {section, key, SettingType::kInt, static_cast<double>(default_value), static_cast<double>(min),
+            static_cast<double>(max)};
+}
+
+constexpr SettingDef FloatSettingDef(const char* section, const char* key, float default_value, float min, float max) {
+    return {section, key, SettingType::kFloat, default_value, min, max};
+}
+
+template <typename T> constexpr SettingType SettingTypeOf();
+template <> constexpr SettingType SettingTypeOf<bool>() { return SettingType::kBool; }
+template <> constexpr SettingType SettingTypeOf<int>() { return SettingType::kInt; }
+template <> constexpr SettingType SettingTypeOf<float>() { return SettingType::kFloat; }
+
+// Index of a setting in its schema, typed with the setting's value type
+template <typename T> struct SettingId {
+    uint32_t index;
+};
+
+namespace settings_registry_detail {
+
+constexpr bool IsEmpty(const char* text) { return text == nullptr || text[0] == '\0'; }
+
+// Not constexpr: reaching a call during constant evaluation turns a bad lookup into a compile error
+inline void UnknownOrMistypedSettingKey() {}
+
+} // namespace settings_registry_detail
+
+// Schema rules: keys are non-empty and unique within the schema, ranges are ordered and contain the default,
+// integer and bool values are whole numbers
+template <size_t N> consteval bool IsValidSchema(const std::array<SettingDef, N>& defs) {
+    for (size_t i = 0; i < N; ++i) {
+        const SettingDef& def = defs[i];
+        if (settings_registry_detail::IsEmpty(def.section) || settings_registry_detail::IsEmpty(def.key)) {
+            return false;
+        }
+        if (!(def.min <= def.default_value && def.default_value <= def.max)) {
+            return false;
+        }
+        if (def.type != SettingType::kFloat &&
+            (def.default_value != static_cast<int64_t>(def.default_value) || def.min != static_cast<int64_t>(def.min) ||
+             def.max != static_cast<int64_t>(def.max))) {
+            return false;
+        }
+        if (def.type == SettingType::kBool && (def.min != 0.0 || def.max != 1.0)) {
+            return false;
+        }
+        for (size_t j = 0; j < i; ++j) {
+            if (std::string_view(defs[j].key) == def.key) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Compile-time ID of the setting with the given key; fails to compile if the key is missing or has another type
+template <typename T, size_t N> consteval SettingId<T> MakeSettingId(const std::array<SettingDef, N>& defs, const char* key) {
+    for (size_t i = 0; i < N; ++i) {
+        if (std::string_view(defs[i].key) == key) {
+            if (defs[i].type != SettingTypeOf<T>()) {
+                break;
+            }
+            return SettingId<T>{static_cast<uint32_t>(i)};
+        }
+    }
+    settings_registry_detail::UnknownOrMistypedSettingKey();
+    return SettingId<T>{0};
+}
+
+/**
+ * Current values of every setting in a schema, as one contiguous, cache-line-aligned array of atomics.
+ *
+ * Reads are a single atomic load at a compile-time offset. Each slot holds the atomic type of its setting, so
+ * UI wrappers (BoolSettingRef and friends) can bind to Atomic(id) directly, and those wrappers save changes as
+ * before. Loading walks the schema in one batch through the config store callbacks; corrected values are written
+ * back in the same text form as the individual setting wrappers use ("0"/"1", std::to_string).
+ */
+template <const auto& Defs> class SettingsTable {
+  public:
+    static constexpr size_t kCount = Defs.size();
+    static_assert(IsValidSchema(Defs), "invalid settings schema");
+
+    SettingsTable() { ResetToDefaults(); }
+    SettingsTable(const SettingsTable&) = delete;
+    SettingsTable& operator=(const SettingsTable&) = delete;
+
+    static constexpr const SettingDef& Def(size_t index) { return Defs[index]; }
+
+    template <typename T> T Get(SettingId<T> id) const { return Atomic(id).load(std::memory_order_acquire); }
+
+    // Clamped to the schema range. Returns true if the value changed.
+    template <typename T> bool Set(SettingId<T> id, T value) {
+        const T clamped = Clamp<T>(Defs[id.index], value);
+        return Atomic(id).exchange(clamped, std::memory_order_acq_rel) != clamped;
+    }
+
+    template <typename T> std::atomic<T>& Atomic(SettingId<T> id) { return SlotAtomic<T>(slots_[id.index]); }
+    template <typename T> const std::atomic<T>& Atomic(SettingId<T> id) const {
+        return SlotAtomic<T>(const_cast<Slot&>(slots_[id.index]));
+    }
+
+    void ResetToDefaults() {
+        for (size_t i = 0; i < kCount; ++i) {
+            Slot& slot = slots_[i];
+            switch (Defs[i].type) {
+                case SettingType::kBool:  std::construct_at(&slot.b, Defs[i].default_value != 0.0); break;
+                case SettingType::kInt:   std::construct_at(&slot.i, static_cast<int>(Defs[i].default_value)); break;
+                case SettingType::kFloat: std::construct_at(&slot.f, static_cast<float>(Defs[i].default_value)); break;
+            }
+        }
+    }
+
+    bool IsDefault(size_t index) const { return ValueAsDouble(index) == DefaultAs(index); }
+
+    std::string ValueAsString(size_t index) const {
+        const Slot& slot = slots_[index];
+        switch (Defs[index].type) {
+            case SettingType::kBool:  return slot.b.load() ? "1" : "0";
+            case SettingType::kInt:   return std::to_string(slot.i.load());
+            case SettingType::kFloat: return std::to_string(slot.f.load());
+        }
+        return {};
+    }
+
+    /**
+     * Loads every setting. get(section, key, std::string& text) returns false for missing keys, which keep their
+     * default. Values that parse but are invalid (bool other than 0/1, out of range, NaN/Inf) fall back to the
+     * default and are written back through set(section, key, const std::string& text), like the individual
+     * setting wrappers do. Returns the number of settings that differ from their default.
+     */
+    template <typename Getter, typename Setter> size_t LoadAll(Getter&& get, Setter&& set) {
+        size_t non_default = 0;
+        std::string text;
+        for (size_t i = 0; i < kCount; ++i) {
+            const SettingDef& def = Defs[i];
+            double value = DefaultAs(i);
+            bool rewrite = false;
+            text.clear();
+            if (get(def.section, def.key, text)) {
+                double parsed = 0.0;
+                if (Parse(def.type, text, parsed)) {
+                    if (IsInRange(def, parsed)) {
+                        value = parsed;
+                    } else {
+                        rewrite = true;
+                    }
+                }
+            }
+            Store(i, value);
+            if (rewrite) {
+                set(def.section, def.key, ValueAsString(i));
+            }
+            if (!IsDefault(i)) {
+                ++non_default;
+            }
+        }
+        return non_default;
+    }
+
+  private:
+    // Only the member matching the setting type is ever constructed and accessed
+    union Slot {
+        Slot() {}
+        std::atomic<bool> b;
+        std::atomic<int> i;
+        std::atomic<float> f;
+    };
+    static_assert(sizeof(Slot) == 4, "settings table slots should stay 4 bytes");
+
+    template <typename T> static std::atomic<T>& SlotAtomic(Slot& slot) {
+        if constexpr (std::is_same_v<T, bool>) {
+            return slot.b;
+        } else if constexpr (std::is_same_v<T, int>) {
+            return slot.i;
+        } else {
+            static_assert(std::is_same_v<T, float>, "settings are bool, int or float");
+            return slot.f;
+        }
+    }
+
+    template <typename T> static T Clamp(const SettingDef& def, T value) {
+        if constexpr (std::is_same_v<T, bool>) {
+            return value;
+        } else {
+            const T min = static_cast<T>(def.min);
+            const T max = static_cast<T>(def.max);
+            return (value < min) ? min : ((value > max) ? max : value);
+        }
+    }
+
+    static bool IsInRange(const SettingDef& def, double value) {
+        return std::isfinite(value) && value >= def.min && value <= def.max;
+    }
+
+    // Same acceptance as the config getters: leading number of the text, fractional part dropped for integers
+    static bool Parse(SettingType type, const std::string& text, double& value) {
+        const char* begin = text.c_str();
+        char* end = nullptr;
+        if (type == SettingType::kFloat) {
+            value = static_cast<double>(std::strtof(begin, &end));
+        } else {
+            value = static_cast<double>(std::strtol(begin, &end, 10));
+        }
+        return end != begin;
+    }
+
+    double DefaultAs(size_t index) const {
+        // Compare in the stored type, e.g. a float default is not exactly representable as its double literal
+        return (Defs[index].type == SettingType::kFloat) ? static_cast<double>(static_cast<float>(Defs[index].default_value))
+                                                         : Defs[index].default_value;
+    }
+
+    double ValueAsDouble(size_t index) const {
+        const Slot& slot = slots_[index];
+        switch (Defs[index].type) {
+            case SettingType::kBool:  return slot.b.load() ? 1.0 : 0.0;
+            case SettingType::kInt:   return static_cast<double>(slot.i.load());
+            case SettingType::kFloat: return static_cast<double>(slot.f.load());
+        }
+        return 0.0;
+    }
+
+    void Store(size_t index, double value) {
+        Slot& slot = slots_[index];
+        switch (Defs[index].type) {
+            case SettingType::kBool:  slot.b.store(value != 0.0, std::memory_order_release); break;
+            case SettingType::kInt:   slot.i.store(static_cast<int>(value), std::memory_order_release); break;
+            case SettingType::kFloat: slot.f.store(static_cast<float>(value), std::memory_order_release); break;
+        }
+    }
+
+    alignas(64) std::array<Slot, kCount> slots_;
+};
+
+} // namespace utils
@@ -0,0 +1,205 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+namespace utils {
+
+/**
+ * One published stats snapshot. The layout is part of the on-disk / shared-memory format: fields may only be
+ * appended (bumping SharedStatsBlock::kVersion), never reordered or resized.
+ */
+struct SharedStatsSnapshot {
+    static constexpr size_t kFrameTimeBinCount = 128;
+    static constexpr float kFrameTimeBinWidthMs = 0.5f;  // bin i covers [i, i + 1) * 0.5 ms; the last bin is open
+
+    uint64_t update_count;   // number of snapshots published so far
+    uint64_t timestamp_ns;   // writer clock (QPC based) when published
+    uint32_t frame_count;    // frames in the percentile window
+    uint32_t late_sample_count;  // limiter frames in the last interval
+
+    // Frame time window (same as the overlay: since reset, capped at the perf ring capacity)
+    float fps;
+    float median_frame_time_ms;
+    float p99_frame_time_ms;
+    float p999_frame_time_ms;
+    float one_percent_low_fps;
+    float point_one_percent_low_fps;
+
+    // Smoothed per-frame durations (ns)
+    int64_t present_duration_ns;
+    int64_t gpu_duration_ns;
+    int64_t simulation_duration_ns;
+    int64_t render_submit_duration_ns;
+    int64_t reshade_overhead_duration_ns;
+    int64_t reflex_sleep_duration_ns;
+    int64_t limiter_sleep_before_present_ns;
+    int64_t limiter_sleep_after_present_ns;
+
+    // FPS limiter lateness over the last interval (ns)
+    int64_t limiter_late_last_ns;
+    int64_t limiter_late_mean_ns;
+    int64_t limiter_late_max_ns;
+
+    // Frame time histogram of the window
+    std::array<uint32_t, kFrameTimeBinCount> frame_time_bins;
+
+    static size_t FrameTimeBin(double frame_time_ms) {
+        if (!(frame_time_ms > 0.0)) {
+            return 0;
+        }
+        const double bin = frame_time_ms / kFrameTimeBinWidthMs;
+        return (bin >= static_cast<double>(kFrameTimeBinCount - 1)) ? kFrameTimeBinCount - 1 : static_cast<size_t>(bin);
+    }
+};
+
+static_assert(std::is_trivially_copyable_v<SharedStatsSnapshot>);
+static_assert(std::is_standard_layout_v<SharedStatsSnapshot>);
+static_assert(offsetof(SharedStatsSnapshot, fps) == 24);
+static_assert(offsetof(SharedStatsSnapshot, present_duration_ns) == 48);
+static_assert(offsetof(SharedStatsSnapshot, limiter_late_last_ns) == 112);
+static_assert(offsetof(SharedStatsSnapshot, frame_time_bins) == 136);
+static_assert(sizeof(SharedStatsSnapshot) == 648);
+
+/**
+ * Versioned block placed at offset 0 of a named file mapping (Windows) or an mmap'ed file (any platform).
+ *
+ * One writer publishes snapshots with a seqlock: the sequence is odd while the payload is being written, and
+ * readers copy the payload and retry if the sequence was odd or changed meanwhile. The payload is stored as
+ * 64-bit relaxed atomics so the copy is race-free in both processes; the writer never blocks on readers.
+ */
+struct SharedStatsBlock {
+    static constexpr uint32_t kMagic = 0x42534344;  // "DCSB"
+    static constexpr uint32_t kVersion = 1;
+    static constexpr size_t kPayloadWords = (sizeof(SharedStatsSnapshot) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    uint32_t magic;
+    uint32_t version;
+    uint32_t block_size;  // sizeof(SharedStatsBlock) of the writer
+    uint32_t writer_pid;
+    std::atomic<uint64_t> sequence;
+    std::array<std::atomic<uint64_t>, kPayloadWords> payload;
+
+    // Writer: stamp the header of a zero-filled mapping
+    void Initialize(uint32_t pid) {
+        sequence.store(0, std::memory_order_relaxed);
+        for (std::atomic<uint64_t>& word : payload) {
+            word.store(0, std::memory_order_relaxed);
+        }
+        version = kVersion;
+        block_size = static_cast<uint32_t>(sizeof(SharedStatsBlock));
+        writer_pid = pid;
+        std::atomic_thread_fence(std::memory_order_release);
+        magic = kMagic;
+    }
+
+    bool IsCompatible() const {
+        return magic == kMagic && version == kVersion && block_size >= sizeof(SharedStatsBlock);
+    }
+
+    // Writer only
+    void Publish(const SharedStatsSnapshot& snapshot) {
+        uint64_t words[kPayloadWords] = {};
+        std::memcpy(words, &snapshot, sizeof(SharedStatsSnapshot));
+
+        const uint64_t seq = sequence.load(std::memory_order_relaxed);
+        sequence.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < kPayloadWords; ++i) {
+            payload[i].store(words[i], std::memory_order_relaxed);
+        }
+        sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    // Reader: false if the writer was mid-update (retry later) or nothing was published yet
+    bool TryRead(SharedStatsSnapshot& out) const {
+        const uint64_t before = sequence.load(std::memory_order_acquire);
+        if (before == 0 || (before & 1) != 0) {
+            return false;
+        }
+        uint64_t words[kPayloadWords];
+        for (size_t i = 0; i < kPayloadWords; ++i) {
+            words[i] = payload[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence.load(std::memory_order_relaxed) != before) {
+            return false;
+        }
+        std::memcpy(&out, words, sizeof(SharedStatsSnapshot));
+        return true;
+    }
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "shared stats must use address-free atomics");
+static_assert(std::is_standard_layout_v<SharedStatsBlock>);
+static_assert(offsetof(SharedStatsBlock, sequence) == 16);
+static_assert(offsetof(SharedStatsBlock, payload) == 24);
+static_assert(sizeof(SharedStatsBlock) == 24 + 8 * SharedStatsBlock::kPayloadWords);
+
+// Name of the Windows file mapping of a process ("Local\\DisplayCommanderStats_<pid>")
+constexpr const char* kSharedStatsMappingPrefix = "Local\\DisplayCommanderStats_";
+
+/**
+ * Per-interval count / sum / max of a value (e.g. limiter lateness per frame), added on the producing thread(s) and
+ * drained by the stats thread with Take().
+ *
+ * Samples go to one of two buckets. Take() switches producers to the other bucket and waits for Add() calls still
+ * writing the old one, so every sample lands with its count, sum and max in exactly one interval and the mean is
+ * exact. An interval without samples reports count 0 and max INT64_MIN. Take() must be called from one thread only.
+ */
+class IntervalAccumulator {
+  public:
+    struct Totals {
+        uint32_t count = 0;
+        int64_t sum = 0;
+        int64_t max = INT64_MIN;
+        int64_t last = 0;
+    };
+
+    void Add(int64_t value) {
+        // seq_cst pairs with Take(): either it waits for this call or this call sees the switched bucket
+        writers_.fetch_add(1, std::memory_order_seq_cst);
+        Bucket& bucket = buckets_[active_.load(std::memory_order_seq_cst)];
+        bucket.count.fetch_add(1, std::memory_order_relaxed);
+        bucket.sum.fetch_add(value, std::memory_order_relaxed);
+        int64_t current = bucket.max.load(std::memory_order_relaxed);
+        while (value > current && !bucket.max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+        last_.store(value, std::memory_order_relaxed);
+        writers_.fetch_sub(1, std::memory_order_release);
+    }
+
+    Totals Take() {
+        const uint32_t taken = active_.load(std::memory_order_relaxed);
+        active_.store(taken ^ 1, std::memory_order_seq_cst);
+        while (writers_.load(std::memory_order_seq_cst) != 0) {
+            std::this_thread::yield();
+        }
+        Bucket& bucket = buckets_[taken];
+        Totals totals;
+        totals.count = bucket.count.exchange(0, std::memory_order_relaxed);
+        totals.sum = bucket.sum.exchange(0, std::memory_order_relaxed);
+        totals.max = bucket.max.exchange(INT64_MIN, std::memory_order_relaxed);
+        totals.last = last_.load(std::memory_order_relaxed);
+        return totals;
+    }
+
+  private:
+    struct Bucket {
+        std::atomic<uint32_t> count{0};
+        std::atomic<int64_t> sum{0};
+        std::atomic<int64_t> max{INT64_MIN};
+    };
+
+    std::array<Bucket, 2> buckets_;
+    std::atomic<uint32_t> active_{0};
+    std::atomic<uint32_t> writers_{0};
+    std::atomic<int64_t> last_{0};
+};
+
+} // namespace utils
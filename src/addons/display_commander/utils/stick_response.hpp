@@ -0,0 +1,320 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define STICK_RESPONSE_HAS_SSE2 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define STICK_RESPONSE_HAS_NEON 1
+#endif
+
+namespace utils {
+
+// Response curve of one stick; deadzone, max input and min output are fractions of full deflection
+struct StickCurve {
+    float deadzone = 0.0f;    // deflection below this reads as centered
+    float max_input = 1.0f;   // deflection that already gives full output
+    float min_output = 0.0f;  // anti-deadzone: output just past the deadzone, to cancel the game's own deadzone
+    float exponent = 1.0f;    // 1 = linear; above 1 gives finer control near the center
+    float center_x = 0.0f;    // center calibration offsets
+    float center_y = 0.0f;
+    bool circular = true;     // radial deadzone that keeps the direction; false = each axis on its own (square)
+
+    bool operator==(const StickCurve&) const = default;
+};
+
+// Response curve of one trigger; the defaults leave the trigger untouched
+struct TriggerCurve {
+    float deadzone = 0.0f;
+    float max_input = 1.0f;
+    float min_output = 0.0f;
+    float exponent = 1.0f;
+
+    bool operator==(const TriggerCurve&) const = default;
+};
+
+// Output fraction for a deflection already scaled from [deadzone, max_input] to [0, 1]
+inline float EvaluateResponseCurve(float scaled, float min_output, float exponent) {
+    if (exponent != 1.0f) {
+        scaled = std::pow(scaled, exponent);
+    }
+    return std::clamp(min_output + (scaled * (1.0f - min_output)), 0.0f, 1.0f);
+}
+
+// Axis values in XInput layout
+struct GamepadAxes {
+    int16_t left_x = 0;
+    int16_t left_y = 0;
+    int16_t right_x = 0;
+    int16_t right_y = 0;
+    uint8_t left_trigger = 0;
+    uint8_t right_trigger = 0;
+};
+
+/**
+ * Both sticks and triggers of one controller mapped through precomputed response curves.
+ *
+ * Configure() rebuilds the tables only when a curve changed, so it can be called on every poll. Apply() runs the
+ * four stick axes as one vector: the conversions, center calibration, magnitude, deadzone and max input math match
+ * ProcessStickInputRadial/Square bit for bit, and the shaped output is read from a kCurveSteps-step table with linear
+ * interpolation (within one SHORT step of evaluating the curve directly). Triggers go through 256-entry byte tables.
+ * The SIMD paths produce exactly what ApplyScalar() does as long as the compiler does not contract to FMA (MSVC
+ * /fp:precise does not). Not thread-safe to reconfigure; keep one per polling thread.
+ */
+class StickResponseEngine {
+  public:
+    static constexpr size_t kCurveSteps = 1024;
+
+    StickResponseEngine() { Build(); }
+
+    // Returns true if the tables were rebuilt
+    bool Configure(const StickCurve& left, const StickCurve& right, const TriggerCurve& left_trigger = {},
+                   const TriggerCurve& right_trigger = {}) {
+        if (left == sticks_[0] && right == sticks_[1] && left_trigger == triggers_[0]
+            && right_trigger == triggers_[1]) {
+            return false;
+        }
+        sticks_[0] = left;
+        sticks_[1] = right;
+        triggers_[0] = left_trigger;
+        triggers_[1] = right_trigger;
+        Build();
+        return true;
+    }
+
+    void Apply(GamepadAxes& axes) const {
+#if defined(STICK_RESPONSE_HAS_SSE2)
+        ApplySse2(axes);
+#elif defined(STICK_RESPONSE_HAS_NEON)
+        ApplyNeon(axes);
+#else
+        ApplyScalar(axes);
+#endif
+        ApplyTriggers(axes);
+    }
+
+    // Portable path, also the reference the SIMD paths are checked against
+    void ApplyScalar(GamepadAxes& axes) const {
+        const float raw[kLanes] = {static_cast<float>(axes.left_x), static_cast<float>(axes.left_y),
+                                   static_cast<float>(axes.right_x), static_cast<float>(axes.right_y)};
+        float value[kLanes];
+        float squared[kLanes];
+        for (size_t lane = 0; lane < kLanes; ++lane) {
+            value[lane] = (raw[lane] + 32768.0f) / 65535.0f * 2.0f - 1.0f;
+            value[lane] = (value[lane] - lanes_.center[lane]) / lanes_.center_scale[lane];
+            squared[lane] = value[lane] * value[lane];
+        }
+
+        float scaled[kLanes];
+        float magnitude[kLanes];
+        bool zero[kLanes];
+        for (size_t lane = 0; lane < kLanes; ++lane) {
+            const float radial_magnitude = std::sqrt(squared[lane] + squared[lane ^ 1]);
+            magnitude[lane] = (lanes_.radial_mask[lane] != 0) ? radial_magnitude : std::abs(value[lane]);
+            zero[lane] = magnitude[lane] < lanes_.zero_threshold[lane];
+            scaled[lane] = (magnitude[lane] - lanes_.deadzone[lane]) / lanes_.range[lane];
+            scaled[lane] = (std::min)(1.0f, (std::max)(0.0f, scaled[lane]));
+        }
+
+        float shaped[kLanes];
+        LookupCurves(scaled, shaped);
+
+        int16_t out[kLanes];
+        for (size_t lane = 0; lane < kLanes; ++lane) {
+            float result;
+            if (zero[lane]) {
+                result = 0.0f;
+            } else if (lanes_.radial_mask[lane] != 0) {
+                result = value[lane] * shaped[lane] / magnitude[lane];
+            } else {
+                result = (value[lane] < 0.0f) ? -shaped[lane] : shaped[lane];
+            }
+            result = (std::max)(-1.0f, (std::min)(1.0f, result));
+            out[lane] = static_cast<int16_t>((result + 1.0f) / 2.0f * 65535.0f + (-32768.0f));
+        }
+        axes.left_x = out[0];
+        axes.left_y = out[1];
+        axes.right_x = out[2];
+        axes.right_y = out[3];
+    }
+
+    const StickCurve& Left() const { return sticks_[0]; }
+    const StickCurve& Right() const { return sticks_[1]; }
+
+  private:
+    static constexpr size_t kLanes = 4;  // left x, left y, right x, right y
+
+    // Per-lane constants derived from the stick curves
+    struct LaneParams {
+        alignas(16) float center[kLanes];
+        alignas(16) float center_scale[kLanes];    // 1 + |center|
+        alignas(16) float deadzone[kLanes];
+        alignas(16) float zero_threshold[kLanes];  // magnitudes below this output 0
+        alignas(16) float range[kLanes];           // max_input - deadzone
+        alignas(16) uint32_t radial_mask[kLanes];  // all ones for circular sticks
+    };
+
+    void Build() {
+        for (size_t stick = 0; stick < 2; ++stick) {
+            const StickCurve& curve = sticks_[stick];
+            for (size_t i = 0; i <= kCurveSteps; ++i) {
+                const float scaled = static_cast<float>(i) / static_cast<float>(kCurveSteps);
+                stick_tables_[stick][i] = EvaluateResponseCurve(scaled, curve.min_output, curve.exponent);
+            }
+            for (size_t axis = 0; axis < 2; ++axis) {
+                const size_t lane = stick * 2 + axis;
+                const float center = (axis == 0) ? curve.center_x : curve.center_y;
+                lanes_.center[lane] = center;
+                lanes_.center_scale[lane] = 1.0f + std::abs(center);
+                lanes_.deadzone[lane] = curve.deadzone;
+                // The radial path also zeroes (near) exact centers, like ProcessStickInputRadial
+                lanes_.zero_threshold[lane] = curve.circular ? (std::max)(0.0001f, curve.deadzone) : curve.deadzone;
+                // max_input at or below the deadzone: anything past the deadzone gets full output
+                const float range = curve.max_input - curve.deadzone;
+                lanes_.range[lane] = (range > 0.0f) ? range : 1e-30f;
+                lanes_.radial_mask[lane] = curve.circular ? 0xFFFFFFFFu : 0u;
+            }
+        }
+
+        for (size_t trigger = 0; trigger < 2; ++trigger) {
+            const TriggerCurve& curve = triggers_[trigger];
+            const float range = curve.max_input - curve.deadzone;
+            for (size_t i = 0; i < 256; ++i) {
+                const float input = static_cast<float>(i) / 255.0f;
+                float output = 0.0f;
+                if (input >= curve.deadzone) {
+                    const float scaled =
+                        (range > 0.0f) ? (std::min)(1.0f, (std::max)(0.0f, (input - curve.deadzone) / range)) : 1.0f;
+                    output = EvaluateResponseCurve(scaled, curve.min_output, curve.exponent);
+                }
+                trigger_tables_[trigger][i] = static_cast<uint8_t>(std::lround(output * 255.0f));
+            }
+        }
+    }
+
+    // Linear interpolation in each lane's table; scaled is in [0, 1]
+    void LookupCurves(const float* scaled, float* shaped) const {
+        for (size_t lane = 0; lane < kLanes; ++lane) {
+            const float* table = stick_tables_[lane >> 1].data();
+            const float position = scaled[lane] * static_cast<float>(kCurveSteps);
+            size_t index = static_cast<size_t>(position);
+            if (index >= kCurveSteps) {
+                index = kCurveSteps - 1;
+            }
+            const float fraction = position - static_cast<float>(index);
+            shaped[lane] = table[index] + (table[index + 1] - table[index]) * fraction;
+        }
+    }
+
+    void ApplyTriggers(GamepadAxes& axes) const {
+        axes.left_trigger = trigger_tables_[0][axes.left_trigger];
+        axes.right_trigger = trigger_tables_[1][axes.right_trigger];
+    }
+
+#if defined(STICK_RESPONSE_HAS_SSE2)
+    void ApplySse2(GamepadAxes& axes) const {
+        const __m128i raw16 = _mm_setr_epi16(axes.left_x, axes.left_y, axes.right_x, axes.right_y, 0, 0, 0, 0);
+        const __m128i raw32 = _mm_srai_epi32(_mm_unpacklo_epi16(raw16, raw16), 16);
+        __m128 value = _mm_cvtepi32_ps(raw32);
+        value = _mm_sub_ps(
+            _mm_mul_ps(_mm_div_ps(_mm_add_ps(value, _mm_set1_ps(32768.0f)), _mm_set1_ps(65535.0f)), _mm_set1_ps(2.0f)),
+            _mm_set1_ps(1.0f));
+        value = _mm_div_ps(_mm_sub_ps(value, _mm_load_ps(lanes_.center)), _mm_load_ps(lanes_.center_scale));
+
+        // Radial lanes use the stick magnitude, square lanes their own |axis|
+        const __m128 squared = _mm_mul_ps(value, value);
+        const __m128 radial_magnitude =
+            _mm_sqrt_ps(_mm_add_ps(squared, _mm_shuffle_ps(squared, squared, _MM_SHUFFLE(2, 3, 0, 1))));
+        const __m128 sign_bit = _mm_set1_ps(-0.0f);
+        const __m128 abs_value = _mm_andnot_ps(sign_bit, value);
+        const __m128 radial = _mm_castsi128_ps(_mm_load_si128(reinterpret_cast<const __m128i*>(lanes_.radial_mask)));
+        const __m128 magnitude = _mm_or_ps(_mm_and_ps(radial, radial_magnitude), _mm_andnot_ps(radial, abs_value));
+        const __m128 zero = _mm_cmplt_ps(magnitude, _mm_load_ps(lanes_.zero_threshold));
+
+        __m128 scaled_v = _mm_div_ps(_mm_sub_ps(magnitude, _mm_load_ps(lanes_.deadzone)), _mm_load_ps(lanes_.range));
+        scaled_v = _mm_min_ps(_mm_set1_ps(1.0f), _mm_max_ps(_mm_setzero_ps(), scaled_v));
+
+        alignas(16) float scaled[kLanes];
+        alignas(16) float shaped[kLanes];
+        _mm_store_ps(scaled, scaled_v);
+        LookupCurves(scaled, shaped);
+        const __m128 shaped_v = _mm_load_ps(shaped);
+
+        const __m128 radial_result = _mm_div_ps(_mm_mul_ps(value, shaped_v), magnitude);
+        const __m128 negative = _mm_cmplt_ps(value, _mm_setzero_ps());
+        const __m128 square_result = _mm_xor_ps(shaped_v, _mm_and_ps(negative, sign_bit));
+        __m128 result = _mm_or_ps(_mm_and_ps(radial, radial_result), _mm_andnot_ps(radial, square_result));
+        result = _mm_andnot_ps(zero, result);
+
+        result = _mm_max_ps(_mm_set1_ps(-1.0f), _mm_min_ps(_mm_set1_ps(1.0f), result));
+        result = _mm_add_ps(_mm_mul_ps(_mm_div_ps(_mm_add_ps(result, _mm_set1_ps(1.0f)), _mm_set1_ps(2.0f)),
+                                       _mm_set1_ps(65535.0f)),
+                            _mm_set1_ps(-32768.0f));
+        const __m128i out = _mm_packs_epi32(_mm_cvttps_epi32(result), _mm_setzero_si128());
+        alignas(16) int16_t out16[8];
+        _mm_store_si128(reinterpret_cast<__m128i*>(out16), out);
+        axes.left_x = out16[0];
+        axes.left_y = out16[1];
+        axes.right_x = out16[2];
+        axes.right_y = out16[3];
+    }
+#endif
+
+#if defined(STICK_RESPONSE_HAS_NEON)
+    void ApplyNeon(GamepadAxes& axes) const {
+        const int16_t raw16[kLanes] = {axes.left_x, axes.left_y, axes.right_x, axes.right_y};
+        float32x4_t value = vcvtq_f32_s32(vmovl_s16(vld1_s16(raw16)));
+        value = vsubq_f32(vmulq_f32(vdivq_f32(vaddq_f32(value, vdupq_n_f32(32768.0f)), vdupq_n_f32(65535.0f)),
+                                    vdupq_n_f32(2.0f)),
+                          vdupq_n_f32(1.0f));
+        value = vdivq_f32(vsubq_f32(value, vld1q_f32(lanes_.center)), vld1q_f32(lanes_.center_scale));
+
+        // Radial lanes use the stick magnitude, square lanes their own |axis|
+        const float32x4_t squared = vmulq_f32(value, value);
+        const float32x4_t radial_magnitude = vsqrtq_f32(vaddq_f32(squared, vrev64q_f32(squared)));
+        const uint32x4_t radial = vld1q_u32(lanes_.radial_mask);
+        const float32x4_t magnitude = vbslq_f32(radial, radial_magnitude, vabsq_f32(value));
+        const uint32x4_t zero = vcltq_f32(magnitude, vld1q_f32(lanes_.zero_threshold));
+
+        float32x4_t scaled_v = vdivq_f32(vsubq_f32(magnitude, vld1q_f32(lanes_.deadzone)), vld1q_f32(lanes_.range));
+        scaled_v = vminq_f32(vdupq_n_f32(1.0f), vmaxq_f32(vdupq_n_f32(0.0f), scaled_v));
+
+        float scaled[kLanes];
+        float shaped[kLanes];
+        vst1q_f32(scaled, scaled_v);
+        LookupCurves(scaled, shaped);
+        const float32x4_t shaped_v = vld1q_f32(shaped);
+
+        const float32x4_t radial_result = vdivq_f32(vmulq_f32(value, shaped_v), magnitude);
+        const uint32x4_t negative = vcltq_f32(value, vdupq_n_f32(0.0f));
+        const float32x4_t square_result = vbslq_f32(negative, vnegq_f32(shaped_v), shaped_v);
+        float32x4_t result = vbslq_f32(radial, radial_result, square_result);
+        result = vbslq_f32(zero, vdupq_n_f32(0.0f), result);
+
+        result = vmaxq_f32(vdupq_n_f32(-1.0f), vminq_f32(vdupq_n_f32(1.0f), result));
+        result = vaddq_f32(vmulq_f32(vdivq_f32(vaddq_f32(result, vdupq_n_f32(1.0f)), vdupq_n_f32(2.0f)),
+                                     vdupq_n_f32(65535.0f)),
+                           vdupq_n_f32(-32768.0f));
+        int16_t out16[kLanes];
+        vst1_s16(out16, vmovn_s32(vcvtq_s32_f32(result)));
+        axes.left_x = out16[0];
+        axes.left_y = out16[1];
+        axes.right_x = out16[2];
+        axes.right_y = out16[3];
+    }
+#endif
+
+    std::array<StickCurve, 2> sticks_{};
+    std::array<TriggerCurve, 2> triggers_{};
+    LaneParams lanes_{};
+    std::array<std::array<float, kCurveSteps + 1>, 2> stick_tables_{};
+    std::array<std::array<uint8_t, 256>, 2> trigger_tables_{};
+};
+
+} // namespace utils
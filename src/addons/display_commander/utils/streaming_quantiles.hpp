@@ -0,0 +1,233 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace utils {
+
+/**
+ * Windowed log-linear histogram of frame times (in seconds).
+ *
+ * The producer (render thread) calls Record() once per frame; it is O(1) and never allocates.
+ * Readers (stats thread, UI) call Summarize() / Quantile() at any time without locking, allocating or sorting.
+ *
+ * Buckets are taken directly from the float bit pattern: 8 exponent bits + kSubBucketBits mantissa bits,
+ * so every bucket spans at most 1/128 (~0.8%) of its value. Each bucket also keeps the exact sum of its
+ * samples (integer nanoseconds), so averages of the slowest N% are exact except for the boundary bucket.
+ *
+ * Only the last WindowCapacity samples are counted; the oldest sample is evicted when the window is full,
+ * matching the semantics of the perf ring (samples since reset, capped at ring capacity).
+ *
+ * Threading: exactly one producer thread. Counters are atomics written with relaxed load/store by that
+ * single writer; RequestReset() may be called from any thread and is applied by the producer on its next Record().
+ */
+template <size_t WindowCapacity>
+class StreamingQuantileHistogram {
+    static_assert(WindowCapacity > 0 && (WindowCapacity & (WindowCapacity - 1)) == 0,
+                  "WindowCapacity must be a power of 2");
+
+  public:
+    static constexpr int kSubBucketBits = 7;
+    static constexpr size_t kBucketCount = 4096;
+
+    // Smallest distinguishable value (smaller values land in bucket 0, values above ~4096 s in the last bucket)
+    static constexpr float kMinValue = 1.0f / (1 << 20);  // ~0.95 us
+
+    struct Summary {
+        uint32_t count = 0;
+        double total_seconds = 0.0;
+        double median_seconds = 0.0;
+        double p99_seconds = 0.0;                // 99th percentile frame time
+        double p999_seconds = 0.0;               // 99.9th percentile frame time
+        double slowest_1pct_mean_seconds = 0.0;  // average of the slowest 1% frame times (1% low)
+        double slowest_01pct_mean_seconds = 0.0; // average of the slowest 0.1% frame times (0.1% low)
+    };
+
+    StreamingQuantileHistogram() = default;
+    StreamingQuantileHistogram(const StreamingQuantileHistogram&) = delete;
+    StreamingQuantileHistogram& operator=(const StreamingQuantileHistogram&) = delete;
+
+    // Producer only. Non-positive and NaN values are ignored.
+    void Record(float seconds) {
+        if (!(seconds > 0.0f)) {
+            return;
+        }
+        if (reset_requested_.load(std::memory_order_relaxed)) {
+            ApplyReset();
+        }
+
+        const uint32_t size = window_size_.load(std::memory_order_relaxed);
+        if (size == WindowCapacity) {
+            RemoveSample(window_[window_head_]);
+        } else {
+            window_size_.store(size + 1, std::memory_order_relaxed);
+        }
+        window_[window_head_] = seconds;
+        window_head_ = (window_head_ + 1) & (WindowCapacity - 1);
+        AddSample(seconds);
+    }
+
+    // Any thread. The histogram is cleared by the producer on its next Record().
+    void RequestReset() { reset_requested_.store(true, std::memory_order_relaxed); }
+
+    // Number of samples currently in the window
+    uint32_t Count() const { return window_size_.load(std::memory_order_relaxed); }
+
+    // Value at quantile q in [0, 1] using nearest-rank; returns the mean of the containing bucket.
+    double Quantile(double q) const {
+        const uint64_t total = CountBuckets();
+        if (total == 0) {
+            return 0.0;
+        }
+        return QuantileFromTotal(q, total);
+    }
+
+    // Average of the slowest `fraction` of samples (at least one sample)
+    double MeanOfSlowest(double fraction) const {
+        const uint64_t total = CountBuckets();
+        if (total == 0) {
+            return 0.0;
+        }
+        return MeanOfSlowestFromTotal(fraction, total);
+    }
+
+    // All frame-time statistics shown in the performance overlay, computed in a few passes over the buckets
+    Summary Summarize() const {
+        Summary summary;
+        uint64_t total = 0;
+        uint64_t total_ns = 0;
+        for (size_t i = 0; i < kBucketCount; ++i) {
+            total += counts_[i].load(std::memory_order_relaxed);
+            total_ns += sums_ns_[i].load(std::memory_order_relaxed);
+        }
+        if (total == 0) {
+            return summary;
+        }
+        summary.count = static_cast<uint32_t>(total);
+        summary.total_seconds = static_cast<double>(total_ns) / 1e9;
+        summary.median_seconds = QuantileFromTotal(0.5, total);
+        summary.p99_seconds = QuantileFromTotal(0.99, total);
+        summary.p999_seconds = QuantileFromTotal(0.999, total);
+        summary.slowest_1pct_mean_seconds = MeanOfSlowestFromTotal(0.01, total);
+        summary.slowest_01pct_mean_seconds = MeanOfSlowestFromTotal(0.001, total);
+        return summary;
+    }
+
+    // Visit every non-empty bucket in ascending order as (mean seconds, sample count), e.g. to export a coarser histogram
+    template <typename Callback>
+    void ForEachBucket(Callback&& callback) const {
+        for (size_t i = 0; i < kBucketCount; ++i) {
+            const uint32_t count = counts_[i].load(std::memory_order_relaxed);
+            if (count != 0) {
+                callback(BucketMean(i), count);
+            }
+        }
+    }
+
+    static size_t BucketIndex(float seconds) {
+        if (!(seconds > kMinValue)) {
+            return 0;
+        }
+        const uint32_t bits = std::bit_cast<uint32_t>(seconds);
+        const uint32_t min_bits = std::bit_cast<uint32_t>(kMinValue);
+        const size_t index = static_cast<size_t>((bits - min_bits) >> (23 - kSubBucketBits));
+        return (std::min)(index, kBucketCount - 1);
+    }
+
+  private:
+    static uint64_t ToNs(float seconds) { return static_cast<uint64_t>(static_cast<double>(seconds) * 1e9 + 0.5); }
+
+    void AddSample(float seconds) {
+        const size_t b = BucketIndex(seconds);
+        counts_[b].store(counts_[b].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        sums_ns_[b].store(sums_ns_[b].load(std::memory_order_relaxed) + ToNs(seconds), std::memory_order_relaxed);
+    }
+
+    void RemoveSample(float seconds) {
+        const size_t b = BucketIndex(seconds);
+        counts_[b].store(counts_[b].load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+        sums_ns_[b].store(sums_ns_[b].load(std::memory_order_relaxed) - ToNs(seconds), std::memory_order_relaxed);
+    }
+
+    void ApplyReset() {
+        reset_requested_.store(false, std::memory_order_relaxed);
+        for (size_t i = 0; i < kBucketCount; ++i) {
+            counts_[i].store(0, std::memory_order_relaxed);
+            sums_ns_[i].store(0, std::memory_order_relaxed);
+        }
+        window_size_.store(0, std::memory_order_relaxed);
+        window_head_ = 0;
+    }
+
+    uint64_t CountBuckets() const {
+        uint64_t total = 0;
+        for (size_t i = 0; i < kBucketCount; ++i) {
+            total += counts_[i].load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    double BucketMean(size_t b) const {
+        const uint32_t count = counts_[b].load(std::memory_order_relaxed);
+        if (count == 0) {
+            return 0.0;
+        }
+        return static_cast<double>(sums_ns_[b].load(std::memory_order_relaxed)) / 1e9 / static_cast<double>(count);
+    }
+
+    double QuantileFromTotal(double q, uint64_t total) const {
+        const double clamped_q = (std::clamp)(q, 0.0, 1.0);
+        const uint64_t rank =
+            (std::max)(static_cast<uint64_t>(std::ceil(clamped_q * static_cast<double>(total))), uint64_t{1});
+        uint64_t cumulative = 0;
+        size_t last_non_empty = 0;
+        for (size_t i = 0; i < kBucketCount; ++i) {
+            const uint32_t count = counts_[i].load(std::memory_order_relaxed);
+            if (count == 0) {
+                continue;
+            }
+            last_non_empty = i;
+            cumulative += count;
+            if (cumulative >= rank) {
+                return BucketMean(i);
+            }
+        }
+        // Producer raced with us and removed samples; fall back to the slowest bucket seen
+        return BucketMean(last_non_empty);
+    }
+
+    double MeanOfSlowestFromTotal(double fraction, uint64_t total) const {
+        const uint64_t wanted =
+            (std::max)(static_cast<uint64_t>(static_cast<double>(total) * fraction), uint64_t{1});
+        uint64_t taken = 0;
+        double sum_seconds = 0.0;
+        for (size_t i = kBucketCount; i-- > 0 && taken < wanted;) {
+            const uint32_t count = counts_[i].load(std::memory_order_relaxed);
+            if (count == 0) {
+                continue;
+            }
+            const double bucket_sum = static_cast<double>(sums_ns_[i].load(std::memory_order_relaxed)) / 1e9;
+            const uint64_t take = (std::min)(static_cast<uint64_t>(count), wanted - taken);
+            // Whole buckets contribute their exact sum; the boundary bucket contributes its mean per sample
+            sum_seconds += (take == count) ? bucket_sum : bucket_sum * static_cast<double>(take) / count;
+            taken += take;
+        }
+        return (taken > 0) ? sum_seconds / static_cast<double>(taken) : 0.0;
+    }
+
+    std::array<std::atomic<uint32_t>, kBucketCount> counts_{};
+    std::array<std::atomic<uint64_t>, kBucketCount> sums_ns_{};
+    std::atomic<uint32_t> window_size_{0};
+    std::atomic<bool> reset_requested_{false};
+
+    // Producer-private window of recorded samples, used for eviction
+    std::array<float, WindowCapacity> window_{};
+    size_t window_head_ = 0;
+};
+
+} // namespace utils
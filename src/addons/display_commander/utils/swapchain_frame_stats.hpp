@@ -0,0 +1,182 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace utils {
+
+// Frame time ring buffer capacity (must be power of 2 for efficient modulo)
+constexpr uint32_t kSwapchainFrameTimeCapacity = 256;
+
+struct SwapchainFrameSummary {
+    uint32_t count = 0;  // frame times in the ring when the summary was taken
+    float avg_ms = 0.0f;
+    float min_ms = 0.0f;
+    float max_ms = 0.0f;
+    float p50_ms = 0.0f;
+    float p95_ms = 0.0f;
+    float p99_ms = 0.0f;
+};
+
+/**
+ * Present statistics of one swapchain.
+ *
+ * The presenting thread records calls with relaxed atomics and appends frame times to a lock-free ring; the
+ * stats thread turns the ring into a SwapchainFrameSummary behind a sequence lock, so readers (UI, telemetry)
+ * get a consistent summary without ever blocking the present path.
+ */
+class SwapchainFrameStats {
+  public:
+    enum class PresentCall { kPresent, kPresent1 };
+
+    // Identity of the owner; set once when the entry is taken from the pool
+    void SetOwner(const void* swapchain, uint32_t kind) {
+        swapchain_.store(swapchain, std::memory_order_relaxed);
+        kind_.store(kind, std::memory_order_relaxed);
+    }
+    const void* Swapchain() const { return swapchain_.load(std::memory_order_relaxed); }
+    uint32_t Kind() const { return kind_.load(std::memory_order_relaxed); }
+
+    void RecordPresent(PresentCall call, uint64_t now_ns) {
+        CallStats& stats = calls_[call == PresentCall::kPresent ? 0 : 1];
+        const uint64_t last_time_ns = stats.last_time_ns.exchange(now_ns, std::memory_order_acq_rel);
+        stats.total.fetch_add(1, std::memory_order_relaxed);
+
+        // Smooth the call rate; ignore gaps over a second (pauses, loading screens)
+        if (last_time_ns > 0 && now_ns > last_time_ns && now_ns - last_time_ns < kSecondNs) {
+            const double instant_fps = static_cast<double>(kSecondNs) / static_cast<double>(now_ns - last_time_ns);
+            const double old_fps = stats.smoothed_fps.load(std::memory_order_relaxed);
+            // Same weighting as UpdateRollingAverage
+            stats.smoothed_fps.store((instant_fps + (kSmoothing - 1) * old_fps) / kSmoothing,
+                                     std::memory_order_relaxed);
+        }
+
+        // Either call is a frame submission; skip the second of a Present/Present1 pair for the same frame
+        uint64_t last_combined = last_frame_time_ns_.load(std::memory_order_acquire);
+        if (last_combined != 0 && now_ns - last_combined < kSameFrameNs) {
+            return;
+        }
+        if (!last_frame_time_ns_.compare_exchange_strong(last_combined, now_ns, std::memory_order_acq_rel)) {
+            return;
+        }
+        if (last_combined > 0 && now_ns > last_combined && now_ns - last_combined < kSecondNs) {
+            const float frame_time_ms = static_cast<float>(static_cast<double>(now_ns - last_combined) / 1e6);
+            const uint32_t head = frame_time_head_.fetch_add(1, std::memory_order_acq_rel);
+            frame_times_[head & (kSwapchainFrameTimeCapacity - 1)].store(frame_time_ms, std::memory_order_relaxed);
+        }
+    }
+
+    uint64_t TotalCalls(PresentCall call) const {
+        return calls_[call == PresentCall::kPresent ? 0 : 1].total.load(std::memory_order_relaxed);
+    }
+    double SmoothedFps(PresentCall call) const {
+        return calls_[call == PresentCall::kPresent ? 0 : 1].smoothed_fps.load(std::memory_order_relaxed);
+    }
+
+    // Copies the recorded frame times, oldest first. Returns how many were written.
+    size_t CopyFrameTimes(float* out, size_t capacity) const {
+        const uint32_t head = frame_time_head_.load(std::memory_order_acquire);
+        const uint32_t available = (std::min)(head, kSwapchainFrameTimeCapacity);
+        const size_t count = (std::min)(static_cast<size_t>(available), capacity);
+        for (size_t i = 0; i < count; ++i) {
+            const uint32_t index = head - static_cast<uint32_t>(count) + static_cast<uint32_t>(i);
+            out[i] = frame_times_[index & (kSwapchainFrameTimeCapacity - 1)].load(std::memory_order_relaxed);
+        }
+        return count;
+    }
+
+    // Stats thread only: summarize the frame time ring
+    void UpdateSummary() {
+        std::array<float, kSwapchainFrameTimeCapacity> times;
+        const size_t count = CopyFrameTimes(times.data(), times.size());
+        SwapchainFrameSummary summary;
+        summary.count = static_cast<uint32_t>(count);
+        if (count > 0) {
+            std::sort(times.begin(), times.begin() + count);
+            double sum = 0.0;
+            for (size_t i = 0; i < count; ++i) {
+                sum += times[i];
+            }
+            summary.avg_ms = static_cast<float>(sum / static_cast<double>(count));
+            summary.min_ms = times[0];
+            summary.max_ms = times[count - 1];
+            summary.p50_ms = times[NearestRank(count, 50)];
+            summary.p95_ms = times[NearestRank(count, 95)];
+            summary.p99_ms = times[NearestRank(count, 99)];
+        }
+
+        const uint32_t sequence = summary_sequence_.load(std::memory_order_relaxed);
+        summary_sequence_.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        summary_count_.store(summary.count, std::memory_order_relaxed);
+        const std::array<float, kSummaryFields> fields = FieldsOf(summary);
+        for (size_t i = 0; i < kSummaryFields; ++i) {
+            summary_fields_[i].store(fields[i], std::memory_order_relaxed);
+        }
+        summary_sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+    SwapchainFrameSummary Summary() const {
+        SwapchainFrameSummary summary;
+        for (;;) {
+            const uint32_t begin = summary_sequence_.load(std::memory_order_acquire);
+            if ((begin & 1u) != 0) {
+                continue;
+            }
+            summary.count = summary_count_.load(std::memory_order_relaxed);
+            std::array<float, kSummaryFields> fields;
+            for (size_t i = 0; i < kSummaryFields; ++i) {
+                fields[i] = summary_fields_[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (summary_sequence_.load(std::memory_order_relaxed) == begin) {
+                summary.avg_ms = fields[0];
+                summary.min_ms = fields[1];
+                summary.max_ms = fields[2];
+                summary.p50_ms = fields[3];
+                summary.p95_ms = fields[4];
+                summary.p99_ms = fields[5];
+                return summary;
+            }
+        }
+    }
+
+  private:
+    static constexpr uint64_t kSecondNs = 1000000000ull;
+    static constexpr uint64_t kSameFrameNs = 1000ull;
+    static constexpr double kSmoothing = 64.0;
+    static constexpr size_t kSummaryFields = 6;
+
+    struct CallStats {
+        std::atomic<uint64_t> total{0};
+        std::atomic<uint64_t> last_time_ns{0};
+        std::atomic<double> smoothed_fps{0.0};
+    };
+
+    static size_t NearestRank(size_t count, size_t percent) {
+        const size_t rank = (count * percent + 99) / 100;
+        return (rank == 0) ? 0 : rank - 1;
+    }
+
+    static std::array<float, kSummaryFields> FieldsOf(const SwapchainFrameSummary& summary) {
+        return {summary.avg_ms, summary.min_ms, summary.max_ms, summary.p50_ms, summary.p95_ms, summary.p99_ms};
+    }
+
+    std::atomic<const void*> swapchain_{nullptr};
+    std::atomic<uint32_t> kind_{0};
+    std::array<CallStats, 2> calls_;
+    std::atomic<uint64_t> last_frame_time_ns_{0};
+
+    // Frame time ring (milliseconds)
+    std::atomic<uint32_t> frame_time_head_{0};
+    std::array<std::atomic<float>, kSwapchainFrameTimeCapacity> frame_times_{};
+
+    std::atomic<uint32_t> summary_sequence_{0};
+    std::atomic<uint32_t> summary_count_{0};
+    std::array<std::atomic<float>, kSummaryFields> summary_fields_{};
+};
+
+} // namespace utils
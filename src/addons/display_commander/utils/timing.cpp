@@ -3,11 +3,14 @@
 #include "../hooks/timeslowdown_hooks.hpp"
 #include "../utils.hpp"
 #include "../utils/logging.hpp"
+#include "wait_engine.hpp"
 
 #include <windows.h>
 
+#include <immintrin.h>
 #include <intrin.h>
 
+#include <atomic>
 #include <sstream>
 
 // NTSTATUS constants if not already defined
@@ -223,6 +226,180 @@ void wait_until_ns(LONGLONG target_ns, HANDLE &timer_handle) {
     utils::wait_until_qpc(target_ns / utils::QPC_TO_NS, timer_handle);
 }
 
+namespace {
+
+// WAITPKG (tpause/umwait): CPUID.(EAX=7,ECX=0):ECX[bit 5]
+bool supports_waitpkg() {
+    static const bool supported = [] {
+        int regs[4] = {};
+        __cpuidex(regs, 7, 0);
+        return (regs[2] & (1 << 5)) != 0;
+    }();
+    return supported;
+}
+
+// Cap a single mwaitx/tpause so the clock is re-checked at least every ~50 us
+constexpr int64_t kMaxSpinSliceNs = 50'000;
+
+// TSC ticks per ns in 16.16 fixed point; the mwaitx timeout and the tpause deadline count at TSC rate.
+// 1 tick per ns until calibrate_tsc_rate() has run: slices then wake early, never late.
+std::atomic<uint64_t> tsc_ticks_per_ns_q16{uint64_t{1} << 16};
+
+// TSC ticks in a spin slice of at most kMaxSpinSliceNs (fits easily in 32 bits)
+uint64_t spin_slice_tsc_ticks(int64_t remaining_ns) {
+    const uint64_t slice_ns = static_cast<uint64_t>((std::min)(remaining_ns, kMaxSpinSliceNs));
+    return (slice_ns * tsc_ticks_per_ns_q16.load(std::memory_order_relaxed)) >> 16;
+}
+
+class WaitableTimerBackend final : public WaitBackend {
+  public:
+    ~WaitableTimerBackend() override {
+        if (timer_handle_ != nullptr) {
+            CloseHandle(timer_handle_);
+        }
+    }
+
+    const char *Name() const override { return "waitable timer"; }
+    WaitBackendKind Kind() const override { return WaitBackendKind::kSleep; }
+    double CpuCostPerNs() const override { return 0.0; }
+
+    void WaitUntil(int64_t target_ns, WaitNowNsFn now_ns) override {
+        if (timer_handle_ == nullptr) {
+            timer_handle_ =
+                CreateWaitableTimerEx(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+            if (timer_handle_ == nullptr) {
+                timer_handle_ = CreateWaitableTimer(nullptr, FALSE, nullptr);
+            }
+            if (timer_handle_ == nullptr) {
+                return;
+            }
+        }
+        const int64_t delta_ns = target_ns - now_ns();
+        if (delta_ns <= 0) {
+            return;
+        }
+        LARGE_INTEGER delay{};
+        delay.QuadPart = -(delta_ns / 100); // relative, in 100 ns units
+        if (SetWaitableTimer(timer_handle_, &delay, 0, nullptr, nullptr, FALSE)) {
+            WaitForSingleObject(timer_handle_, INFINITE);
+        }
+    }
+
+  private:
+    HANDLE timer_handle_ = nullptr;
+};
+
+// AMD MONITORX/MWAITX with a TSC-based timeout (EBX), sliced so the clock is re-checked
+class MwaitxSpinBackend final : public WaitBackend {
+  public:
+    const char *Name() const override { return "mwaitx"; }
+    WaitBackendKind Kind() const override { return WaitBackendKind::kSpin; }
+    double CpuCostPerNs() const override { return 0.3; }
+
+    void WaitUntil(int64_t target_ns, WaitNowNsFn now_ns) override {
+        while (true) {
+            const int64_t remaining_ns = target_ns - now_ns();
+            if (remaining_ns <= 0) {
+                break;
+            }
+            _mm_monitorx(&monitor_, 0, 0);
+            // An early wake only costs one extra loop
+            _mm_mwaitx(0x2, 0, static_cast<unsigned>(spin_slice_tsc_ticks(remaining_ns)));
+        }
+    }
+
+  private:
+    alignas(64) uint64_t monitor_ = 0;
+};
+
+// Intel WAITPKG TPAUSE in C0.1 (fast wake-up), bounded by a TSC deadline
+class TpauseSpinBackend final : public WaitBackend {
+  public:
+    const char *Name() const override { return "tpause"; }
+    WaitBackendKind Kind() const override { return WaitBackendKind::kSpin; }
+    double CpuCostPerNs() const override { return 0.2; }
+
+    void WaitUntil(int64_t target_ns, WaitNowNsFn now_ns) override {
+        while (true) {
+            const int64_t remaining_ns = target_ns - now_ns();
+            if (remaining_ns <= 0) {
+                break;
+            }
+            _tpause(1, __rdtsc() + spin_slice_tsc_ticks(remaining_ns));
+        }
+    }
+};
+
+int64_t engine_now_ns() { return get_now_ns(); }
+
+struct ThreadWaitEngine {
+    WaitableTimerBackend timer;
+    MwaitxSpinBackend mwaitx;
+    TpauseSpinBackend tpause;
+    PauseSpinBackend pause;
+    WaitEngine engine{&engine_now_ns};
+
+    ThreadWaitEngine() {
+        engine.AddBackend(&timer);
+        if (supports_waitpkg()) {
+            engine.AddBackend(&tpause);
+        }
+        if (supports_mwaitx()) {
+            engine.AddBackend(&mwaitx);
+        }
+        engine.AddBackend(&pause);
+    }
+};
+
+std::atomic<LONGLONG> precise_wait_spin_ns{0};
+
+} // namespace
+
+void calibrate_tsc_rate() {
+    // Real time only: the timeslowdown detours scale QPC, which would skew every spin slice
+    const auto query_frequency = (display_commanderhooks::QueryPerformanceFrequency_Original != nullptr)
+                                     ? display_commanderhooks::QueryPerformanceFrequency_Original
+                                     : &QueryPerformanceFrequency;
+    const auto query_counter = (display_commanderhooks::QueryPerformanceCounter_Original != nullptr)
+                                   ? display_commanderhooks::QueryPerformanceCounter_Original
+                                   : &QueryPerformanceCounter;
+    LARGE_INTEGER frequency = {};
+    if (!query_frequency(&frequency) || frequency.QuadPart <= 0) {
+        LogWarn("Precise wait: QueryPerformanceFrequency failed, assuming 1 TSC tick/ns");
+        return;
+    }
+    LARGE_INTEGER qpc_start = {};
+    LARGE_INTEGER qpc_now = {};
+    query_counter(&qpc_start);
+    const uint64_t tsc_start = __rdtsc();
+    const LONGLONG qpc_end = qpc_start.QuadPart + (std::max)(frequency.QuadPart / 1000, LONGLONG{1});
+    do {
+        YieldProcessor();
+        query_counter(&qpc_now);
+    } while (qpc_now.QuadPart < qpc_end);
+    const uint64_t tsc_ticks = __rdtsc() - tsc_start;
+
+    const double elapsed_ns =
+        static_cast<double>(qpc_now.QuadPart - qpc_start.QuadPart) * 1e9 / static_cast<double>(frequency.QuadPart);
+    const uint64_t measured_q16 = static_cast<uint64_t>(static_cast<double>(tsc_ticks) * 65536.0 / elapsed_ns);
+    // Anything outside 0.1-10 GHz means the thread migrated or the TSC is unusable
+    if (measured_q16 < (uint64_t{1} << 16) / 10 || measured_q16 > (uint64_t{10} << 16)) {
+        LogWarn("Precise wait: TSC calibration out of range (%.3f ticks/ns), assuming 1 tick/ns",
+                measured_q16 / 65536.0);
+        return;
+    }
+    tsc_ticks_per_ns_q16.store(measured_q16, std::memory_order_relaxed);
+    LogInfo("Precise wait: TSC runs at %.3f ticks/ns", measured_q16 / 65536.0);
+}
+
+void wait_until_ns_precise(LONGLONG target_ns) {
+    thread_local ThreadWaitEngine wait_engine;
+    wait_engine.engine.WaitUntil(target_ns);
+    precise_wait_spin_ns.store(wait_engine.engine.GetStats().avg_spin_ns, std::memory_order_relaxed);
+}
+
+LONGLONG get_precise_wait_spin_ns() { return precise_wait_spin_ns.load(std::memory_order_relaxed); }
+
 LONGLONG get_now_qpc() {
     LARGE_INTEGER now_ticks = {};
     if (enabled_experimental_features && display_commanderhooks::QueryPerformanceCounter_Original) {
@@ -28,6 +28,18 @@ LONGLONG get_now_qpc();
 void wait_until_ns(LONGLONG target_ns, HANDLE &timer_handle);
 LONGLONG get_now_ns();
 
+// Wait until the specified time using the calibrated wait engine (see wait_engine.hpp):
+// waitable timer sleep until a learned margin, then the cheapest precise spin (tpause, mwaitx or pause).
+// Each calling thread gets its own engine and timer.
+void wait_until_ns_precise(LONGLONG target_ns);
+
+// Measures the TSC rate against the real (unhooked) QPC for the mwaitx/tpause spin slices. Busy-waits ~1 ms, so it
+// runs once on the monitoring thread; until then the slices assume 1 tick/ns and wake early.
+void calibrate_tsc_rate();
+
+// Rolling average of CPU time spent spinning per precise wait, i.e. CPU burned per limited frame
+LONGLONG get_precise_wait_spin_ns();
+
 // Get real time bypassing any hooks (for comparison with spoofed time)
 LONGLONG get_real_time_ns();
 
@@ -0,0 +1,243 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+namespace utils {
+
+// Payload for tables that only track membership
+struct NoTrackedPayload {};
+
+/**
+ * RCU-style set of tracked objects with one Payload slot per entry (e.g. per-swapchain stats).
+ *
+ * Entries live in a fixed array with open addressing on the object pointer. Lookups never lock or wait: a probe
+ * reads at most Capacity keys. Inserts and removes are serialized by a mutex and are expected to be rare (object
+ * creation and destruction).
+ *
+ * Removing an entry only marks its slot retired; the slot and its payload are reused once every reader that could
+ * have seen the entry has left its read section. Readers that touch payloads hold a ReadGuard, which counts them in
+ * one of two epochs; a writer flips the epoch whenever the other one has drained, and a slot retired at grace
+ * period N is reusable from grace period N + 2. Retired slots are not reclaimed while readers are active, so a
+ * table full of retired entries rejects inserts instead of blocking.
+ */
+template <typename Key, typename Payload = NoTrackedPayload, size_t Capacity = 64>
+class TrackedObjectTable {
+    static_assert(std::is_pointer_v<Key>, "tracked objects are keyed by pointer");
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+    static_assert(std::is_default_constructible_v<Payload>, "payloads are default-constructed on insert");
+
+  public:
+    TrackedObjectTable() = default;
+    TrackedObjectTable(const TrackedObjectTable&) = delete;
+    TrackedObjectTable& operator=(const TrackedObjectTable&) = delete;
+
+    static constexpr size_t capacity() { return Capacity; }
+
+    // Keeps payloads returned by Find/ForEach alive; cheap enough for every present
+    class ReadGuard {
+      public:
+        explicit ReadGuard(const TrackedObjectTable& table)
+            : table_(table), epoch_(table.epoch_.load(std::memory_order_seq_cst)) {
+            table_.readers_[epoch_].count.fetch_add(1, std::memory_order_seq_cst);
+        }
+        ~ReadGuard() { table_.readers_[epoch_].count.fetch_sub(1, std::memory_order_release); }
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+      private:
+        const TrackedObjectTable& table_;
+        uint32_t epoch_;
+    };
+
+    // Wait-free membership test; does not need a ReadGuard
+    bool Contains(Key key) const { return FindSlot(key) != nullptr; }
+
+    // Payload of a tracked object, valid while the guard lives; nullptr if not tracked
+    Payload* Find(Key key, const ReadGuard&) {
+        Slot* slot = FindSlot(key);
+        return (slot == nullptr) ? nullptr : &slot->payload;
+    }
+    const Payload* Find(Key key, const ReadGuard&) const {
+        const Slot* slot = FindSlot(key);
+        return (slot == nullptr) ? nullptr : &slot->payload;
+    }
+
+    // Returns false if the object was already tracked or no slot is free
+    bool Insert(Key key) {
+        if (key == nullptr) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        TryAdvanceGracePeriod();
+        const size_t mask = Capacity - 1;
+        Slot* free_slot = nullptr;
+        for (size_t probe = 0, index = HashKey(key) & mask; probe < Capacity; ++probe, index = (index + 1) & mask) {
+            Slot& slot = slots_[index];
+            const uintptr_t stored = slot.key.load(std::memory_order_relaxed);
+            if (stored == ToBits(key)) {
+                return false;
+            }
+            if (free_slot == nullptr && (stored == kEmpty || (stored == kRetired && IsReclaimable(slot)))) {
+                free_slot = &slot;
+            }
+            if (stored == kEmpty) {
+                break;
+            }
+        }
+        if (free_slot == nullptr) {
+            return false;
+        }
+        if (free_slot->key.load(std::memory_order_relaxed) == kRetired) {
+            --retired_count_;
+        }
+        std::destroy_at(&free_slot->payload);
+        std::construct_at(&free_slot->payload);
+        free_slot->key.store(ToBits(key), std::memory_order_release);
+        ++live_count_;
+        return true;
+    }
+
+    // Returns false if the object was not tracked
+    bool Remove(Key key) {
+        if (key == nullptr) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        Slot* slot = FindSlot(key);
+        if (slot == nullptr) {
+            return false;
+        }
+        Retire(*slot);
+        TryAdvanceGracePeriod();
+        return true;
+    }
+
+    void Clear() {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        for (Slot& slot : slots_) {
+            if (IsLive(slot.key.load(std::memory_order_relaxed))) {
+                Retire(slot);
+            }
+        }
+        TryAdvanceGracePeriod();
+    }
+
+    size_t size() const { return live_count_.load(std::memory_order_relaxed); }
+    bool empty() const { return size() == 0; }
+
+    // Calls fn(Key, Payload&) for every tracked object; payloads stay valid for the guard's lifetime
+    template <typename Fn> void ForEach(const ReadGuard&, Fn&& fn) {
+        for (Slot& slot : slots_) {
+            const uintptr_t stored = slot.key.load(std::memory_order_seq_cst);
+            if (IsLive(stored)) {
+                fn(FromBits(stored), slot.payload);
+            }
+        }
+    }
+    template <typename Fn> void ForEach(const ReadGuard&, Fn&& fn) const {
+        for (const Slot& slot : slots_) {
+            const uintptr_t stored = slot.key.load(std::memory_order_seq_cst);
+            if (IsLive(stored)) {
+                fn(FromBits(stored), slot.payload);
+            }
+        }
+    }
+
+    // Reclaims retired slots if no reader is left from before their removal; never blocks. Returns the number of
+    // retired slots still waiting.
+    size_t Reclaim() {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        TryAdvanceGracePeriod();
+        TryAdvanceGracePeriod();
+        size_t waiting = 0;
+        for (const Slot& slot : slots_) {
+            if (slot.key.load(std::memory_order_relaxed) == kRetired && !IsReclaimable(slot)) {
+                ++waiting;
+            }
+        }
+        return waiting;
+    }
+
+  private:
+    static constexpr uintptr_t kEmpty = 0;
+    static constexpr uintptr_t kRetired = 1;  // never a valid object pointer
+
+    struct Slot {
+        std::atomic<uintptr_t> key{kEmpty};
+        uint64_t retired_grace_period = 0;  // written under write_mutex_
+        Payload payload{};
+    };
+
+    struct alignas(64) ReaderCount {
+        std::atomic<uint32_t> count{0};
+    };
+
+    static uintptr_t ToBits(Key key) { return reinterpret_cast<uintptr_t>(key); }
+    static Key FromBits(uintptr_t bits) { return reinterpret_cast<Key>(bits); }
+    static bool IsLive(uintptr_t stored) { return stored != kEmpty && stored != kRetired; }
+
+    static size_t HashKey(Key key) {
+        // Objects are at least 16-byte aligned; mix the remaining bits so neighbouring allocations spread out
+        const uint64_t bits = static_cast<uint64_t>(ToBits(key)) >> 4;
+        return static_cast<size_t>((bits * 0x9E3779B97F4A7C15ull) >> 32);
+    }
+
+    Slot* FindSlot(Key key) const {
+        if (key == nullptr) {
+            return nullptr;
+        }
+        const uintptr_t wanted = ToBits(key);
+        const size_t mask = Capacity - 1;
+        for (size_t probe = 0, index = HashKey(key) & mask; probe < Capacity; ++probe, index = (index + 1) & mask) {
+            // seq_cst pairs with the reader count increment, see TryAdvanceGracePeriod
+            const uintptr_t stored = slots_[index].key.load(std::memory_order_seq_cst);
+            if (stored == wanted) {
+                return const_cast<Slot*>(&slots_[index]);
+            }
+            if (stored == kEmpty) {
+                return nullptr;
+            }
+        }
+        return nullptr;
+    }
+
+    // Caller holds write_mutex_
+    void Retire(Slot& slot) {
+        slot.retired_grace_period = grace_period_;
+        slot.key.store(kRetired, std::memory_order_seq_cst);
+        --live_count_;
+        ++retired_count_;
+    }
+
+    bool IsReclaimable(const Slot& slot) const { return grace_period_ >= slot.retired_grace_period + 2; }
+
+    // Caller holds write_mutex_. Flips the reader epoch if the previous one has drained. A reader that registered
+    // in the drained epoch has left; one that registers after a flip sees every retirement that preceded it.
+    void TryAdvanceGracePeriod() {
+        if (retired_count_ == 0) {
+            return;
+        }
+        const uint32_t current = epoch_.load(std::memory_order_relaxed);
+        if (readers_[current ^ 1u].count.load(std::memory_order_seq_cst) != 0) {
+            return;
+        }
+        epoch_.store(current ^ 1u, std::memory_order_seq_cst);
+        ++grace_period_;
+    }
+
+    std::array<Slot, Capacity> slots_;
+    mutable std::array<ReaderCount, 2> readers_;
+    std::atomic<uint32_t> epoch_{0};
+    std::atomic<size_t> live_count_{0};
+    std::mutex write_mutex_;
+    uint64_t grace_period_ = 0;  // under write_mutex_
+    size_t retired_count_ = 0;   // under write_mutex_
+};
+
+} // namespace utils
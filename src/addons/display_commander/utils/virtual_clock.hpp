@@ -0,0 +1,201 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace utils {
+
+struct UInt128 {
+    uint64_t hi = 0;
+    uint64_t lo = 0;
+};
+
+// Full 64 x 64 -> 128 bit product
+inline UInt128 MulU64(uint64_t a, uint64_t b) {
+    const uint64_t a_lo = a & 0xFFFFFFFFull;
+    const uint64_t a_hi = a >> 32;
+    const uint64_t b_lo = b & 0xFFFFFFFFull;
+    const uint64_t b_hi = b >> 32;
+
+    const uint64_t p0 = a_lo * b_lo;
+    const uint64_t p1 = a_lo * b_hi;
+    const uint64_t p2 = a_hi * b_lo;
+    const uint64_t p3 = a_hi * b_hi;
+
+    const uint64_t mid = (p0 >> 32) + (p1 & 0xFFFFFFFFull) + (p2 & 0xFFFFFFFFull);
+    return {p3 + (p1 >> 32) + (p2 >> 32) + (mid >> 32), (mid << 32) | (p0 & 0xFFFFFFFFull)};
+}
+
+// floor((hi:lo) / divisor); saturates to UINT64_MAX if the quotient does not fit in 64 bits.
+// Long division in 32-bit digits (Hacker's Delight, divlu).
+inline uint64_t DivU128ByU64(UInt128 dividend, uint64_t divisor) {
+    constexpr uint64_t kBase = 1ull << 32;
+    if (divisor == 0 || dividend.hi >= divisor) {
+        return UINT64_MAX;
+    }
+
+    const int shift = std::countl_zero(divisor);
+    divisor <<= shift;
+    const uint64_t vn1 = divisor >> 32;
+    const uint64_t vn0 = divisor & 0xFFFFFFFFull;
+
+    const uint64_t un32 = (dividend.hi << shift) | (shift == 0 ? 0 : dividend.lo >> (64 - shift));
+    const uint64_t un10 = dividend.lo << shift;
+    const uint64_t un1 = un10 >> 32;
+    const uint64_t un0 = un10 & 0xFFFFFFFFull;
+
+    uint64_t q1 = un32 / vn1;
+    uint64_t rhat = un32 - q1 * vn1;
+    while (q1 >= kBase || q1 * vn0 > kBase * rhat + un1) {
+        --q1;
+        rhat += vn1;
+        if (rhat >= kBase) {
+            break;
+        }
+    }
+
+    const uint64_t un21 = un32 * kBase + un1 - q1 * divisor;
+    uint64_t q0 = un21 / vn1;
+    rhat = un21 - q0 * vn1;
+    while (q0 >= kBase || q0 * vn0 > kBase * rhat + un0) {
+        --q0;
+        rhat += vn1;
+        if (rhat >= kBase) {
+            break;
+        }
+    }
+    return q1 * kBase + q0;
+}
+
+// floor(a * b / c) with a 128-bit intermediate
+inline uint64_t MulDivU64(uint64_t a, uint64_t b, uint64_t c) { return DivU128ByU64(MulU64(a, b), c); }
+
+/**
+ * Piecewise-linear map from real ticks to virtual ticks, in integers only.
+ *
+ * The rate is Q32.32 fixed point and the virtual position at the segment start keeps 32 fraction
+ * bits, so rebasing at a new rate is exact: any number of multiplier changes accumulate no rounding
+ * drift and the virtual clock is continuous (hence monotonic) across them.
+ *
+ * A rebase takes effect at a real time slightly in the future (the guard) and the segment remembers
+ * the previous rate, so readers that still hold the previous segment, or hold the new one with a real
+ * timestamp taken before the switch, compute exactly the same values.
+ */
+struct VirtualClockSegment {
+    static constexpr int kRateFractionBits = 32;
+    static constexpr uint64_t kRateOne = 1ull << kRateFractionBits;
+
+    int64_t real_start = 0;          // real ticks where this rate takes effect
+    uint64_t virtual_start = 0;      // virtual ticks since the epoch at real_start (whole part)
+    uint64_t virtual_start_frac = 0; // fraction part, < kRateOne
+    uint64_t rate = kRateOne;        // virtual ticks per real tick, Q32.32
+    uint64_t previous_rate = kRateOne;
+
+    static uint64_t RateFromMultiplier(double multiplier) {
+        if (!(multiplier > 0.0)) {
+            return kRateOne;
+        }
+        return static_cast<uint64_t>(std::llround(multiplier * static_cast<double>(kRateOne)));
+    }
+
+    // Virtual ticks since the epoch at a real time (floor)
+    uint64_t VirtualTicksAt(int64_t real_ticks) const {
+        if (real_ticks >= real_start) {
+            UInt128 product = MulU64(static_cast<uint64_t>(real_ticks - real_start), rate);
+            const uint64_t lo = product.lo + virtual_start_frac;
+            product.hi += (lo < product.lo) ? 1 : 0;
+            return virtual_start + ((product.hi << (64 - kRateFractionBits)) | (lo >> kRateFractionBits));
+        }
+
+        // Before the switch: run the previous rate backwards from the start position
+        const UInt128 product = MulU64(static_cast<uint64_t>(real_start - real_ticks), previous_rate);
+        const uint64_t back_whole = (product.hi << (64 - kRateFractionBits)) | (product.lo >> kRateFractionBits);
+        const uint64_t back_frac = product.lo & (kRateOne - 1);
+        const uint64_t borrow = (back_frac > virtual_start_frac) ? 1 : 0;
+        const uint64_t back = back_whole + borrow;
+        return (back <= virtual_start) ? virtual_start - back : 0;
+    }
+
+    // Segment continuing this one at a new rate from real time `switch_ticks` on, decided at real time `now_ticks`
+    VirtualClockSegment Rebased(int64_t now_ticks, int64_t switch_ticks, uint64_t new_rate) const {
+        if (now_ticks < real_start) {
+            // The previous switch has not taken effect yet, so nobody has read the pending rate: replace it in place
+            // and keep the anchor, which readers before real_start still run backwards from
+            VirtualClockSegment next = *this;
+            next.rate = new_rate;
+            return next;
+        }
+
+        VirtualClockSegment next;
+        next.real_start = switch_ticks;
+        next.rate = new_rate;
+        next.previous_rate = rate;
+        UInt128 product = MulU64(static_cast<uint64_t>(switch_ticks - real_start), rate);
+        const uint64_t lo = product.lo + virtual_start_frac;
+        product.hi += (lo < product.lo) ? 1 : 0;
+        next.virtual_start = virtual_start + ((product.hi << (64 - kRateFractionBits)) | (lo >> kRateFractionBits));
+        next.virtual_start_frac = lo & (kRateOne - 1);
+        return next;
+    }
+};
+
+/**
+ * Virtual clock shared by several timer sources with different units (e.g. QPC ticks, milliseconds,
+ * 100 ns FILETIME units). Every source is read once at the common epoch; afterwards its value is
+ * epoch_value + virtual elapsed time converted to its units, so all sources agree with each other and
+ * with the segment's virtual time, whatever their resolution.
+ *
+ * Trivially copyable so it can be published through a seqlock.
+ */
+template <size_t Sources>
+struct VirtualClockState {
+    struct Source {
+        uint64_t epoch_value = 0;       // source reading at the epoch
+        uint64_t units_per_second = 0;  // 0 = source not captured
+    };
+
+    VirtualClockSegment segment;
+    uint64_t ticks_per_second = 0;  // real tick frequency (0 = not started)
+    std::array<Source, Sources> sources{};
+
+    bool IsStarted() const { return ticks_per_second != 0; }
+
+    // Start at real time `epoch_ticks`; virtual time equals real time there
+    void Start(int64_t epoch_ticks, uint64_t tick_frequency, uint64_t rate) {
+        segment = VirtualClockSegment{};
+        segment.real_start = epoch_ticks;
+        segment.rate = rate;
+        segment.previous_rate = rate;
+        ticks_per_second = tick_frequency;
+        sources = {};
+    }
+
+    void SetSourceEpoch(size_t source, uint64_t epoch_value, uint64_t units_per_second) {
+        sources[source] = {epoch_value, units_per_second};
+    }
+
+    // Change the rate from real time now + guard on; see VirtualClockSegment
+    void SetRate(int64_t now_ticks, uint64_t rate, int64_t guard_ticks) {
+        segment = segment.Rebased(now_ticks, now_ticks + guard_ticks, rate);
+    }
+
+    uint64_t VirtualTicksAt(int64_t real_ticks) const { return segment.VirtualTicksAt(real_ticks); }
+
+    // Value of a source at a real time (the epoch value if the source was not captured)
+    uint64_t SourceValueAt(size_t source, int64_t real_ticks) const {
+        const Source& s = sources[source];
+        if (s.units_per_second == 0 || ticks_per_second == 0) {
+            return s.epoch_value;
+        }
+        const uint64_t ticks = VirtualTicksAt(real_ticks);
+        const uint64_t units = (s.units_per_second == ticks_per_second)
+                                   ? ticks
+                                   : MulDivU64(ticks, s.units_per_second, ticks_per_second);
+        return s.epoch_value + units;
+    }
+};
+
+} // namespace utils
@@ -0,0 +1,297 @@
+#pragma once
+
+#include "decaying_duration_histogram.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+#define WAIT_ENGINE_HAS_MM_PAUSE 1
+#endif
+
+#if !defined(_WIN32)
+#include <cerrno>
+#include <time.h>
+#endif
+
+namespace utils {
+
+using WaitNowNsFn = int64_t (*)();
+
+inline void CpuRelax() {
+#ifdef WAIT_ENGINE_HAS_MM_PAUSE
+    _mm_pause();
+#else
+    std::this_thread::yield();
+#endif
+}
+
+enum class WaitBackendKind : uint8_t {
+    kSleep,  // blocks in the OS; wake-up error is learned and compensated by spinning
+    kSpin    // polls the clock until the target; burns CPU for its whole duration
+};
+
+class WaitBackend {
+  public:
+    virtual ~WaitBackend() = default;
+
+    virtual const char* Name() const = 0;
+    virtual WaitBackendKind Kind() const = 0;
+
+    // Relative CPU cost of one nanosecond spent in this backend (1.0 = _mm_pause busy loop, 0 = sleeping)
+    virtual double CpuCostPerNs() const = 0;
+
+    // Sleep backends return around target_ns (early or late); spin backends return once now_ns() >= target_ns
+    virtual void WaitUntil(int64_t target_ns, WaitNowNsFn now_ns) = 0;
+};
+
+// Busy loop with _mm_pause (YieldProcessor); available everywhere
+class PauseSpinBackend final : public WaitBackend {
+  public:
+    const char* Name() const override { return "pause spin"; }
+    WaitBackendKind Kind() const override { return WaitBackendKind::kSpin; }
+    double CpuCostPerNs() const override { return 1.0; }
+    void WaitUntil(int64_t target_ns, WaitNowNsFn now_ns) override {
+        while (now_ns() < target_ns) {
+            CpuRelax();
+        }
+    }
+};
+
+/**
+ * Hybrid wait: sleep with an OS backend until a learned safety margin before the target, then spin.
+ *
+ * For every backend the engine keeps a decaying histogram of its wake-up error (oversleep for sleep
+ * backends, overshoot past the target for spin backends). Each wait picks the cheapest plan whose p99
+ * error meets the target precision: a sleeper alone if it is precise enough, otherwise the sleeper with
+ * the smallest margin followed by the lowest-cost spin backend. Sleepers without enough samples are
+ * explored with a conservative margin, and every kExploreInterval-th wait re-measures the least recently
+ * used sleeper so its estimate stays fresh.
+ *
+ * Not thread-safe: use one engine per waiting thread. Backends are not owned.
+ */
+class WaitEngine {
+  public:
+    static constexpr size_t kMaxBackends = 8;
+    static constexpr uint64_t kMinCalibrationSamples = 16;
+    static constexpr int64_t kUncalibratedMarginNs = 2'000'000;
+    static constexpr uint32_t kExploreInterval = 64;
+
+    struct BackendStats {
+        const char* name = nullptr;
+        WaitBackendKind kind = WaitBackendKind::kSpin;
+        int64_t error_p50_ns = 0;
+        int64_t error_p99_ns = 0;
+        uint64_t samples = 0;
+    };
+
+    struct Stats {
+        int64_t last_spin_ns = 0;      // CPU time burned spinning in the last wait
+        int64_t avg_spin_ns = 0;       // rolling average of CPU time burned per wait
+        int64_t last_error_ns = 0;     // last wake-up error relative to the target
+        const char* last_sleep_backend = nullptr;
+        const char* last_spin_backend = nullptr;
+        uint64_t wait_count = 0;
+    };
+
+    explicit WaitEngine(WaitNowNsFn now_ns, int64_t target_precision_ns = 20'000)
+        : now_ns_(now_ns), target_precision_ns_(target_precision_ns) {}
+
+    WaitEngine(const WaitEngine&) = delete;
+    WaitEngine& operator=(const WaitEngine&) = delete;
+
+    bool AddBackend(WaitBackend* backend) {
+        if (backend == nullptr || backend_count_ >= kMaxBackends) {
+            return false;
+        }
+        backends_[backend_count_++].backend = backend;
+        return true;
+    }
+
+    void SetTargetPrecisionNs(int64_t precision_ns) { target_precision_ns_ = precision_ns; }
+    int64_t GetTargetPrecisionNs() const { return target_precision_ns_; }
+
+    void WaitUntil(int64_t target_ns) {
+        ++stats_.wait_count;
+        int64_t now = now_ns_();
+        if (now >= target_ns) {
+            return;
+        }
+
+        BackendState* spinner = ChooseSpinBackend();
+        BackendState* sleeper = ChooseSleepBackend(target_ns - now, spinner);
+
+        stats_.last_sleep_backend = nullptr;
+        if (sleeper != nullptr) {
+            const int64_t sleep_target_ns = target_ns - SleepMargin(*sleeper, target_ns - now);
+            if (sleep_target_ns > now) {
+                sleeper->backend->WaitUntil(sleep_target_ns, now_ns_);
+                now = now_ns_();
+                sleeper->error.Add(now > sleep_target_ns ? now - sleep_target_ns : 0);
+                sleeper->last_used_wait = stats_.wait_count;
+                stats_.last_sleep_backend = sleeper->backend->Name();
+            }
+        }
+
+        int64_t spin_ns = 0;
+        stats_.last_spin_backend = nullptr;
+        if (spinner != nullptr && now < target_ns) {
+            const int64_t spin_start_ns = now;
+            spinner->backend->WaitUntil(target_ns, now_ns_);
+            now = now_ns_();
+            spinner->error.Add(now - target_ns);
+            spin_ns = now - spin_start_ns;
+            stats_.last_spin_backend = spinner->backend->Name();
+        }
+
+        stats_.last_spin_ns = spin_ns;
+        stats_.avg_spin_ns = (spin_ns + 63 * stats_.avg_spin_ns) / 64;
+        stats_.last_error_ns = now - target_ns;
+    }
+
+    const Stats& GetStats() const { return stats_; }
+
+    size_t GetBackendStats(BackendStats* out, size_t max_count) const {
+        size_t n = 0;
+        for (size_t i = 0; i < backend_count_ && n < max_count; ++i, ++n) {
+            const BackendState& state = backends_[i];
+            out[n].name = state.backend->Name();
+            out[n].kind = state.backend->Kind();
+            out[n].error_p50_ns = state.error.Quantile(0.5);
+            out[n].error_p99_ns = state.error.QuantileUpperBound(0.99);
+            out[n].samples = state.error.SampleCount();
+        }
+        return n;
+    }
+
+  private:
+    struct BackendState {
+        WaitBackend* backend = nullptr;
+        DecayingDurationHistogram error;
+        uint64_t last_used_wait = 0;
+    };
+
+    bool IsCalibrated(const BackendState& state) const {
+        return state.error.SampleCount() >= kMinCalibrationSamples;
+    }
+
+    // Uncalibrated sleepers keep a conservative margin (2 ms, or half of a shorter wait) while they learn
+    int64_t SleepMargin(const BackendState& state, int64_t remaining_ns) const {
+        if (IsCalibrated(state)) {
+            return state.error.QuantileUpperBound(0.99);
+        }
+        return (std::min)(kUncalibratedMarginNs, remaining_ns / 2);
+    }
+
+    // Lowest-cost spinner that meets the precision target, else the most precise one
+    BackendState* ChooseSpinBackend() {
+        BackendState* best_meeting = nullptr;
+        BackendState* most_precise = nullptr;
+        for (size_t i = 0; i < backend_count_; ++i) {
+            BackendState& state = backends_[i];
+            if (state.backend->Kind() != WaitBackendKind::kSpin) {
+                continue;
+            }
+            // Uncalibrated spinners are assumed precise until measured otherwise
+            const int64_t p99 = IsCalibrated(state) ? state.error.QuantileUpperBound(0.99) : 0;
+            if (p99 <= target_precision_ns_
+                && (best_meeting == nullptr
+                    || state.backend->CpuCostPerNs() < best_meeting->backend->CpuCostPerNs())) {
+                best_meeting = &state;
+            }
+            if (most_precise == nullptr || p99 < most_precise->error.QuantileUpperBound(0.99)) {
+                most_precise = &state;
+            }
+        }
+        return (best_meeting != nullptr) ? best_meeting : most_precise;
+    }
+
+    // Sleeper with the lowest expected spin cost; periodically re-explores the least recently used one
+    BackendState* ChooseSleepBackend(int64_t remaining_ns, const BackendState* spinner) {
+        const double spin_cost = (spinner != nullptr) ? spinner->backend->CpuCostPerNs() : 0.0;
+        BackendState* best = nullptr;
+        double best_cost = 0.0;
+        BackendState* stalest = nullptr;
+        for (size_t i = 0; i < backend_count_; ++i) {
+            BackendState& state = backends_[i];
+            if (state.backend->Kind() != WaitBackendKind::kSleep) {
+                continue;
+            }
+            const int64_t margin = SleepMargin(state, remaining_ns);
+            if (margin >= remaining_ns) {
+                continue;  // would not sleep at all
+            }
+            if (!IsCalibrated(state)) {
+                return &state;  // learn its error first
+            }
+            // A precise sleeper needs no spin; otherwise we pay for spinning through the margin
+            const double cost = (margin <= target_precision_ns_) ? 0.0 : static_cast<double>(margin) * spin_cost;
+            if (best == nullptr || cost < best_cost) {
+                best = &state;
+                best_cost = cost;
+            }
+            if (stalest == nullptr || state.last_used_wait < stalest->last_used_wait) {
+                stalest = &state;
+            }
+        }
+        if (stalest != nullptr && stats_.wait_count % kExploreInterval == 0) {
+            return stalest;
+        }
+        return best;
+    }
+
+    WaitNowNsFn now_ns_;
+    int64_t target_precision_ns_;
+    std::array<BackendState, kMaxBackends> backends_{};
+    size_t backend_count_ = 0;
+    Stats stats_;
+};
+
+#if !defined(_WIN32)
+
+inline int64_t PosixMonotonicNowNs() {
+    timespec ts{};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1'000'000'000 + ts.tv_nsec;
+}
+
+// Absolute-deadline sleep; requires the engine to use PosixMonotonicNowNs as its time base
+class ClockNanosleepBackend final : public WaitBackend {
+  public:
+    const char* Name() const override { return "clock_nanosleep"; }
+    WaitBackendKind Kind() const override { return WaitBackendKind::kSleep; }
+    double CpuCostPerNs() const override { return 0.0; }
+    void WaitUntil(int64_t target_ns, WaitNowNsFn /*now_ns*/) override {
+        timespec ts{};
+        ts.tv_sec = static_cast<time_t>(target_ns / 1'000'000'000);
+        ts.tv_nsec = static_cast<long>(target_ns % 1'000'000'000);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {
+        }
+    }
+};
+
+// Relative sleep; works with any time base
+class NanosleepBackend final : public WaitBackend {
+  public:
+    const char* Name() const override { return "nanosleep"; }
+    WaitBackendKind Kind() const override { return WaitBackendKind::kSleep; }
+    double CpuCostPerNs() const override { return 0.0; }
+    void WaitUntil(int64_t target_ns, WaitNowNsFn now_ns) override {
+        const int64_t delta_ns = target_ns - now_ns();
+        if (delta_ns <= 0) {
+            return;
+        }
+        timespec ts{};
+        ts.tv_sec = static_cast<time_t>(delta_ns / 1'000'000'000);
+        ts.tv_nsec = static_cast<long>(delta_ns % 1'000'000'000);
+        nanosleep(&ts, nullptr);
+    }
+};
+
+#endif  // !_WIN32
+
+} // namespace utils
@@ -235,7 +235,7 @@ void RemappingWidget::DrawRemapEntry(const input_remapping::ButtonRemap &remap,
 
     // Trigger Count
     ImGui::TableNextColumn();
-    ImGui::Text("%llu", remap.trigger_count.load());
+    ImGui::Text("%llu", input_remapping::InputRemapper::get_instance().get_trigger_count(remap.gamepad_button));
 
     // Enabled
     ImGui::TableNextColumn();
@@ -772,15 +772,9 @@ void RemappingWidget::SaveSettings() {
 
 void RemappingWidget::ResetTriggerCounters() {
     auto &remapper = input_remapping::InputRemapper::get_instance();
-    const auto &remappings = remapper.get_remappings();
+    remapper.reset_trigger_counts();
 
-    // Reset all trigger counts
-    for (const auto &remap : remappings) {
-        input_remapping::ButtonRemap *mutable_remap = const_cast<input_remapping::ButtonRemap *>(&remap);
-        mutable_remap->trigger_count.store(0);
-    }
-
-    LogInfo("RemappingWidget::ResetTriggerCounters() - Reset %zu trigger counters", remappings.size());
+    LogInfo("RemappingWidget::ResetTriggerCounters() - Reset %zu trigger counters", remapper.get_remappings().size());
 }
 
 // Global functions
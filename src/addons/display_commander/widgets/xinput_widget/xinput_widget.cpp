@@ -157,6 +157,33 @@ void XInputWidget::DrawSettings() {
             ImGui::SetTooltip("Convert DualSense controller input to XInput format");
         }
 
+        // Dedicated input sampling thread
+        bool sampler_enabled = g_shared_state->input_sampler_enabled.load();
+        if (ImGui::Checkbox("Input Sampling Thread", &sampler_enabled)) {
+            g_shared_state->input_sampler_enabled.store(sampler_enabled);
+            if (sampler_enabled) {
+                display_commanderhooks::StartXInputSampler();
+            } else {
+                display_commanderhooks::StopXInputSampler();
+            }
+            SaveSettings();
+        }
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("Poll controllers on a dedicated thread at a fixed rate.\n"
+                              "XInputGetState then returns the newest sample immediately instead of reading the device.");
+        }
+        if (sampler_enabled) {
+            int sampler_rate_hz = g_shared_state->input_sampler_rate_hz.load();
+            if (ImGui::SliderInt("Sampling Rate", &sampler_rate_hz, 125, 2000, "%d Hz")) {
+                g_shared_state->input_sampler_rate_hz.store(sampler_rate_hz);
+                display_commanderhooks::StartXInputSampler();
+                SaveSettings();
+            }
+            if (ImGui::IsItemHovered()) {
+                ImGui::SetTooltip("How often the sampling thread polls each controller the game uses");
+            }
+        }
+
         // HID suppression enable
         bool hid_suppression = settings::g_experimentalTabSettings.hid_suppression_enabled.GetValue();
         if (ImGui::Checkbox("Enable HID Suppression", &hid_suppression)) {
@@ -252,6 +279,28 @@ void XInputWidget::DrawSettings() {
                 "Removes game's deadzone by setting minimum output (30%% = eliminates small movements, 0%% = normal)");
         }
 
+        // Left stick response curve setting
+        float left_curve = g_shared_state->left_stick_curve.load();
+        if (ImGui::SliderFloat("Left Stick Response Curve", &left_curve, 1.0f, 3.0f, "%.2f")) {
+            g_shared_state->left_stick_curve.store(left_curve);
+            SaveSettings();
+        }
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("Shapes output between the dead zone and max input (1.00 = linear, 2.00 = finer control "
+                              "near the center, full speed at the edge)");
+        }
+
+        // Right stick response curve setting
+        float right_curve = g_shared_state->right_stick_curve.load();
+        if (ImGui::SliderFloat("Right Stick Response Curve", &right_curve, 1.0f, 3.0f, "%.2f")) {
+            g_shared_state->right_stick_curve.store(right_curve);
+            SaveSettings();
+        }
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("Shapes output between the dead zone and max input (1.00 = linear, 2.00 = finer control "
+                              "near the center, full speed at the edge)");
+        }
+
         ImGui::Separator();
         ImGui::Text("Stick Processing Mode");
         ImGui::Text("Choose how X/Y axes are processed together (circular) or separately (square):");
@@ -410,6 +459,15 @@ void XInputWidget::DrawEventCounters() {
             ImGui::TextColored(ui::colors::TEXT_DIMMED, "XInputGetStateEx Rate: No data");
         }
 
+        // Input age at present, only known when the sampling thread timestamps the input
+        uint64_t input_to_present_ns = g_shared_state->input_to_present_ns.load();
+        if (g_shared_state->input_sampler_enabled.load() && input_to_present_ns > 0) {
+            ImGui::Text("Input to Present: %.2f ms", input_to_present_ns / 1000000.0);
+            if (ImGui::IsItemHovered()) {
+                ImGui::SetTooltip("Age of the newest controller sample the game read for a frame, measured at present");
+            }
+        }
+
         // Reset button
         if (ImGui::Button("Reset Counters")) {
             g_shared_state->total_events.store(0);
@@ -418,6 +476,7 @@ void XInputWidget::DrawEventCounters() {
             g_shared_state->trigger_events.store(0);
             g_shared_state->xinput_getstate_update_ns.store(0);
             g_shared_state->xinput_getstateex_update_ns.store(0);
+            g_shared_state->input_to_present_ns.store(0);
             g_shared_state->last_xinput_call_time_ns.store(0);
             g_shared_state->hid_createfile_total.store(0);
             g_shared_state->hid_createfile_dualsense.store(0);
@@ -661,6 +720,8 @@ void XInputWidget::DrawStickStates(const XINPUT_GAMEPAD &gamepad) {
         float right_min_output = g_shared_state->right_stick_min_output.load();
         float left_deadzone = g_shared_state->left_stick_deadzone.load() / 100.0f;   // Convert percentage to decimal
         float right_deadzone = g_shared_state->right_stick_deadzone.load() / 100.0f; // Convert percentage to decimal
+        float left_curve = g_shared_state->left_stick_curve.load();
+        float right_curve = g_shared_state->right_stick_curve.load();
 
         // Left stick
         ImGui::Text("Left Stick:");
@@ -678,9 +739,9 @@ void XInputWidget::DrawStickStates(const XINPUT_GAMEPAD &gamepad) {
         float ly_final = ly_recentered;
         bool left_circular = g_shared_state->left_stick_circular.load();
         if (left_circular) {
-            ProcessStickInputRadial(lx_final, ly_final, left_deadzone, left_max_input, left_min_output);
+            ProcessStickInputRadial(lx_final, ly_final, left_deadzone, left_max_input, left_min_output, left_curve);
         } else {
-            ProcessStickInputSquare(lx_final, ly_final, left_deadzone, left_max_input, left_min_output);
+            ProcessStickInputSquare(lx_final, ly_final, left_deadzone, left_max_input, left_min_output, left_curve);
         }
 
         ImGui::Text("X: %.3f (Raw) -> %.3f (Recentered) -> %.3f (Final) [Raw: %d]", lx, lx_recentered, lx_final, gamepad.sThumbLX);
@@ -725,9 +786,9 @@ void XInputWidget::DrawStickStates(const XINPUT_GAMEPAD &gamepad) {
         float ry_final = ry_recentered;
         bool right_circular = g_shared_state->right_stick_circular.load();
         if (right_circular) {
-            ProcessStickInputRadial(rx_final, ry_final, right_deadzone, right_max_input, right_min_output);
+            ProcessStickInputRadial(rx_final, ry_final, right_deadzone, right_max_input, right_min_output, right_curve);
         } else {
-            ProcessStickInputSquare(rx_final, ry_final, right_deadzone, right_max_input, right_min_output);
+            ProcessStickInputSquare(rx_final, ry_final, right_deadzone, right_max_input, right_min_output, right_curve);
         }
 
         ImGui::Text("X: %.3f (Raw) -> %.3f (Recentered) -> %.3f (Final) [Raw: %d]", rx, rx_recentered, rx_final, gamepad.sThumbRX);
@@ -755,13 +816,14 @@ void XInputWidget::DrawStickStates(const XINPUT_GAMEPAD &gamepad) {
         ImGui::Dummy(canvas_size);
 
         // Draw extended visualization with input/output curves
-        DrawStickStatesExtended(left_deadzone, left_max_input, left_min_output, right_deadzone, right_max_input,
-                                right_min_output);
+        DrawStickStatesExtended(left_deadzone, left_max_input, left_min_output, left_curve, right_deadzone,
+                                right_max_input, right_min_output, right_curve);
     }
 }
 
 void XInputWidget::DrawStickStatesExtended(float left_deadzone, float left_max_input, float left_min_output,
-                                           float right_deadzone, float right_max_input, float right_min_output) {
+                                           float left_curve, float right_deadzone, float right_max_input,
+                                           float right_min_output, float right_curve) {
     if (ImGui::CollapsingHeader("Input/Output Curves", ImGuiTreeNodeFlags_DefaultOpen)) {
         ImGui::TextColored(ui::colors::TEXT_DEFAULT, "Visual representation of how stick input is processed");
         ImGui::Spacing();
@@ -788,9 +850,9 @@ void XInputWidget::DrawStickStatesExtended(float left_deadzone, float left_max_i
             float ly_test = y;
             bool left_circular = g_shared_state->left_stick_circular.load();
             if (left_circular) {
-                ProcessStickInputRadial(lx_test, ly_test, left_deadzone, left_max_input, left_min_output);
+                ProcessStickInputRadial(lx_test, ly_test, left_deadzone, left_max_input, left_min_output, left_curve);
             } else {
-                ProcessStickInputSquare(lx_test, ly_test, left_deadzone, left_max_input, left_min_output);
+                ProcessStickInputSquare(lx_test, ly_test, left_deadzone, left_max_input, left_min_output, left_curve);
             }
             left_curve_y[i] = std::sqrt(lx_test * lx_test + ly_test * ly_test); // Show output magnitude
 
@@ -799,9 +861,9 @@ void XInputWidget::DrawStickStatesExtended(float left_deadzone, float left_max_i
             float ry_test = y;
             bool right_circular = g_shared_state->right_stick_circular.load();
             if (right_circular) {
-                ProcessStickInputRadial(rx_test, ry_test, right_deadzone, right_max_input, right_min_output);
+                ProcessStickInputRadial(rx_test, ry_test, right_deadzone, right_max_input, right_min_output, right_curve);
             } else {
-                ProcessStickInputSquare(rx_test, ry_test, right_deadzone, right_max_input, right_min_output);
+                ProcessStickInputSquare(rx_test, ry_test, right_deadzone, right_max_input, right_min_output, right_curve);
             }
             right_curve_y[i] = std::sqrt(rx_test * rx_test + ry_test * ry_test); // Show output magnitude
 
@@ -1077,6 +1139,17 @@ void XInputWidget::LoadSettings() {
         g_shared_state->enable_dualsense_xinput.store(dualsense_xinput);
     }
 
+    // Load input sampling thread settings
+    bool sampler_enabled;
+    if (display_commander::config::get_config_value("DisplayCommander.XInputWidget", "InputSamplerEnabled", sampler_enabled)) {
+        g_shared_state->input_sampler_enabled.store(sampler_enabled);
+    }
+
+    int sampler_rate_hz;
+    if (display_commander::config::get_config_value("DisplayCommander.XInputWidget", "InputSamplerRateHz", sampler_rate_hz)) {
+        g_shared_state->input_sampler_rate_hz.store(std::clamp(sampler_rate_hz, 125, 2000));
+    }
+
     // Load left stick sensitivity setting
     float left_max_input;
     if (display_commander::config::get_config_value("DisplayCommander.XInputWidget", "LeftStickSensitivity", left_max_input)) {
@@ -1151,6 +1224,17 @@ void XInputWidget::LoadSettings() {
         g_shared_state->right_stick_circular.store(right_circular);
     }
 
+    // Load stick response curve settings
+    float left_curve;
+    if (display_commander::config::get_config_value("DisplayCommander.XInputWidget", "LeftStickCurve", left_curve)) {
+        g_shared_state->left_stick_curve.store(left_curve);
+    }
+
+    float right_curve;
+    if (display_commander::config::get_config_value("DisplayCommander.XInputWidget", "RightStickCurve", right_curve)) {
+        g_shared_state->right_stick_curve.store(right_curve);
+    }
+
     // Load autofire settings
     bool autofire_enabled;
     if (display_commander::config::get_config_value("DisplayCommander.XInputWidget", "AutofireEnabled", autofire_enabled)) {
@@ -1223,6 +1307,13 @@ void XInputWidget::SaveSettings() {
     display_commander::config::set_config_value("DisplayCommander.XInputWidget", "EnableDualSenseXInput",
                               g_shared_state->enable_dualsense_xinput.load());
 
+    // Save input sampling thread settings
+    display_commander::config::set_config_value("DisplayCommander.XInputWidget", "InputSamplerEnabled",
+                              g_shared_state->input_sampler_enabled.load());
+
+    display_commander::config::set_config_value("DisplayCommander.XInputWidget", "InputSamplerRateHz",
+                              g_shared_state->input_sampler_rate_hz.load());
+
     // Save left stick sensitivity setting
     display_commander::config::set_config_value("DisplayCommander.XInputWidget", "LeftStickSensitivity",
                               g_shared_state->left_stick_max_input.load());
@@ -1271,6 +1362,13 @@ void XInputWidget::SaveSettings() {
     display_commander::config::set_config_value("DisplayCommander.XInputWidget", "RightStickCircular",
                               g_shared_state->right_stick_circular.load());
 
+    // Save stick response curve settings
+    display_commander::config::set_config_value("DisplayCommander.XInputWidget", "LeftStickCurve",
+                              g_shared_state->left_stick_curve.load());
+
+    display_commander::config::set_config_value("DisplayCommander.XInputWidget", "RightStickCurve",
+                              g_shared_state->right_stick_curve.load());
+
     // Save autofire settings
     display_commander::config::set_config_value("DisplayCommander.XInputWidget", "AutofireEnabled",
                               g_shared_state->autofire_enabled.load());
@@ -1313,6 +1411,8 @@ void XInputWidget::SaveSettings() {
 
 std::shared_ptr<XInputSharedState> XInputWidget::GetSharedState() { return g_shared_state; }
 
+XInputSharedState *XInputWidget::GetSharedStatePtr() { return g_shared_state.get(); }
+
 // Global functions for integration
 void InitializeXInputWidget() {
     if (!g_xinput_widget) {
@@ -1346,7 +1446,7 @@ void DrawXInputWidget() {
 
 // Global functions for hooks to use
 void UpdateXInputState(DWORD user_index, const XINPUT_STATE *state) {
-    auto shared_state = XInputWidget::GetSharedState();
+    XInputSharedState *shared_state = XInputWidget::GetSharedStatePtr();
     if (!shared_state || user_index >= XUSER_MAX_COUNT || !state) {
         return;
     }
@@ -1503,7 +1603,7 @@ void UpdateBatteryStatus(DWORD user_index) {
         return;
     }
 
-    auto shared_state = XInputWidget::GetSharedState();
+    XInputSharedState *shared_state = XInputWidget::GetSharedStatePtr();
     if (!shared_state) {
         return;
     }
@@ -2179,12 +2279,53 @@ bool XInputWidget::IsAutofireTrigger(XInputSharedState::TriggerType trigger_type
 }
 
 // Global function for hooks to use
+utils::StickCurve GetLeftStickCurve(const XInputSharedState &shared_state) {
+    utils::StickCurve curve;
+    curve.deadzone = shared_state.left_stick_deadzone.load(std::memory_order_relaxed) / 100.0f; // Percentage to decimal
+    curve.max_input = shared_state.left_stick_max_input.load(std::memory_order_relaxed);
+    curve.min_output = shared_state.left_stick_min_output.load(std::memory_order_relaxed);
+    curve.exponent = shared_state.left_stick_curve.load(std::memory_order_relaxed);
+    curve.center_x = shared_state.left_stick_center_x.load(std::memory_order_relaxed);
+    curve.center_y = shared_state.left_stick_center_y.load(std::memory_order_relaxed);
+    curve.circular = shared_state.left_stick_circular.load(std::memory_order_relaxed);
+    return curve;
+}
+
+utils::StickCurve GetRightStickCurve(const XInputSharedState &shared_state) {
+    utils::StickCurve curve;
+    curve.deadzone = shared_state.right_stick_deadzone.load(std::memory_order_relaxed) / 100.0f; // Percentage to decimal
+    curve.max_input = shared_state.right_stick_max_input.load(std::memory_order_relaxed);
+    curve.min_output = shared_state.right_stick_min_output.load(std::memory_order_relaxed);
+    curve.exponent = shared_state.right_stick_curve.load(std::memory_order_relaxed);
+    curve.center_x = shared_state.right_stick_center_x.load(std::memory_order_relaxed);
+    curve.center_y = shared_state.right_stick_center_y.load(std::memory_order_relaxed);
+    curve.circular = shared_state.right_stick_circular.load(std::memory_order_relaxed);
+    return curve;
+}
+
+void ResetAutofireState() {
+    XInputSharedState *shared_state = XInputWidget::GetSharedStatePtr();
+    if (!shared_state) {
+        return;
+    }
+
+    utils::SRWLockExclusive lock(shared_state->autofire_lock);
+    for (auto &af_button : shared_state->autofire_buttons) {
+        af_button.is_holding_down.store(true);
+        af_button.phase_start_frame_id.store(0);
+    }
+    for (auto &af_trigger : shared_state->autofire_triggers) {
+        af_trigger.is_holding_down.store(true);
+        af_trigger.phase_start_frame_id.store(0);
+    }
+}
+
 void ProcessAutofire(DWORD user_index, XINPUT_STATE *pState) {
     if (!pState) {
         return;
     }
 
-    auto shared_state = XInputWidget::GetSharedState();
+    XInputSharedState *shared_state = XInputWidget::GetSharedStatePtr();
     if (!shared_state) {
         return;
     }
@@ -2193,15 +2334,7 @@ void ProcessAutofire(DWORD user_index, XINPUT_STATE *pState) {
     bool autofire_enabled = shared_state->autofire_enabled.load();
     if (!autofire_enabled) {
         // When autofire is disabled, reset all autofire button and trigger states to prevent stale state
-        utils::SRWLockExclusive lock(shared_state->autofire_lock);
-        for (auto &af_button : shared_state->autofire_buttons) {
-            af_button.is_holding_down.store(true);
-            af_button.phase_start_frame_id.store(0);
-        }
-        for (auto &af_trigger : shared_state->autofire_triggers) {
-            af_trigger.is_holding_down.store(true);
-            af_trigger.phase_start_frame_id.store(0);
-        }
+        ResetAutofireState();
         return;
     }
 
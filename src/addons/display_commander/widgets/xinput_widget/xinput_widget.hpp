@@ -9,6 +9,7 @@
 #include <windows.h>
 #include <xinput.h>
 #include "../../dualsense/dualsense_hid_wrapper.hpp"
+#include "../../utils/stick_response.hpp"
 
 
 // Guide button constant (not defined in standard XInput headers)
@@ -49,6 +50,8 @@ struct XInputSharedState {
     std::atomic<bool> enable_xinput_hooks{true}; // Enable XInput hooks (off by default)
     std::atomic<bool> swap_a_b_buttons{false};
     std::atomic<bool> enable_dualsense_xinput{false}; // Enable DualSense to XInput conversion
+    std::atomic<bool> input_sampler_enabled{false};   // Poll controllers on a dedicated thread
+    std::atomic<int> input_sampler_rate_hz{1000};     // Sampling thread rate
     std::atomic<float> left_stick_max_input{
         1.0f}; // Left stick sensitivity (max input) - 0.7 = 70% stick movement = 100% output
     std::atomic<float> right_stick_max_input{
@@ -63,6 +66,8 @@ struct XInputSharedState {
         0.0f}; // Right stick dead zone (min input) - 0.0 = no deadzone, 15.0 = ignores small movements
     std::atomic<bool> left_stick_circular{true};  // Left stick processing mode: true = circular (radial), false = square (separate axes)
     std::atomic<bool> right_stick_circular{true}; // Right stick processing mode: true = circular (radial), false = square (separate axes)
+    std::atomic<float> left_stick_curve{1.0f};  // Left stick response curve exponent - 1.0 = linear, 2.0 = finer aim near center
+    std::atomic<float> right_stick_curve{1.0f}; // Right stick response curve exponent - 1.0 = linear, 2.0 = finer aim near center
 
     // Stick center calibration
     std::atomic<float> left_stick_center_x{0.0f};  // Left stick X center offset
@@ -128,6 +133,9 @@ struct XInputSharedState {
     std::atomic<uint64_t> xinput_getstate_update_ns{0};
     std::atomic<uint64_t> xinput_getstateex_update_ns{0};
 
+    // Age of the input sample the game read for a frame, at present start (smoothed; sampling thread only)
+    std::atomic<uint64_t> input_to_present_ns{0};
+
     // Autofire settings
     struct AutofireButton {
         WORD button_mask;
@@ -211,6 +219,9 @@ class XInputWidget {
     // Get the shared state (thread-safe)
     static std::shared_ptr<XInputSharedState> GetSharedState();
 
+    // Same state without the refcount, for per-poll hook paths; g_shared_state is created once and never reset
+    static XInputSharedState *GetSharedStatePtr();
+
   private:
     // UI state
     bool is_initialized_ = false;
@@ -224,8 +235,8 @@ class XInputWidget {
     void DrawVibrationTest();
     void DrawButtonStates(const XINPUT_GAMEPAD &gamepad);
     void DrawStickStates(const XINPUT_GAMEPAD &gamepad);
-    void DrawStickStatesExtended(float left_deadzone, float left_max_input, float left_min_output, float right_deadzone,
-                                 float right_max_input, float right_min_output);
+    void DrawStickStatesExtended(float left_deadzone, float left_max_input, float left_min_output, float left_curve,
+                                 float right_deadzone, float right_max_input, float right_min_output, float right_curve);
     void DrawTriggerStates(const XINPUT_GAMEPAD &gamepad);
     void DrawBatteryStatus(int controller_index);
     void DrawDualSenseReport(int controller_index);
@@ -279,6 +290,11 @@ void UpdateBatteryStatus(DWORD user_index);
 void IncrementEventCounter(const std::string &event_type);
 void CheckAndHandleScreenshot();
 void ProcessAutofire(DWORD user_index, XINPUT_STATE *pState);
+void ResetAutofireState();
+
+// Stick settings as response curves for the thumbstick stage
+utils::StickCurve GetLeftStickCurve(const XInputSharedState &shared_state);
+utils::StickCurve GetRightStickCurve(const XInputSharedState &shared_state);
 
 // Recenter calibration functions for hooks
 void ProcessRecenterData(SHORT left_x, SHORT left_y, SHORT right_x, SHORT right_y);
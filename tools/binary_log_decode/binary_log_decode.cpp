@@ -0,0 +1,95 @@
+// Decodes Display Commander deferred binary logs (.dcbl, written when DISPLAY_COMMANDER_BINARY_LOG is set).
+//
+// Records are buffered per thread in the addon, so the file is only ordered per thread; by default the
+// decoder sorts all records by timestamp before printing them.
+//
+// Usage: binary_log_decode <log.dcbl> [--unsorted] [--level N]   (N: 1 = errors ... 4 = debug)
+
+#include "utils/binary_log.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct DecodedRecord {
+    uint64_t timestamp_ns = 0;
+    uint32_t thread_id = 0;
+    uint8_t level = 0;
+    std::string text;
+};
+
+const char* LevelName(uint8_t level) {
+    switch (level) {
+        case 1:  return "ERROR";
+        case 2:  return "WARN";
+        case 3:  return "INFO";
+        case 4:  return "DEBUG";
+        default: return "?";
+    }
+}
+
+void PrintUsage() { std::fprintf(stderr, "Usage: binary_log_decode <log.dcbl> [--unsorted] [--level N]\n"); }
+
+void PrintRecord(const DecodedRecord& record, uint64_t first_ns) {
+    const double seconds = static_cast<double>(record.timestamp_ns - first_ns) / 1e9;
+    std::printf("%12.6f [%5u] | %5s | %s\n", seconds, record.thread_id, LevelName(record.level), record.text.c_str());
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        PrintUsage();
+        return 1;
+    }
+    const char* path = argv[1];
+    bool sorted = true;
+    int max_level = 4;
+    for (int i = 2; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--unsorted") == 0) {
+            sorted = false;
+        } else if (std::strcmp(argv[i], "--level") == 0 && i + 1 < argc) {
+            max_level = std::atoi(argv[++i]);
+        } else {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    std::vector<DecodedRecord> records;
+    char text[4096];
+    const bool ok = utils::binlog::ReadFile(path, [&](const utils::binlog::RecordView& view) {
+        if (view.level > max_level) {
+            return;
+        }
+        utils::binlog::FormatRecord(view.format, view.args, view.args_size, text, sizeof(text));
+        records.push_back({view.timestamp_ns, view.thread_id, view.level, text});
+    });
+    if (!ok) {
+        std::fprintf(stderr, "Not a deferred log file (version %u): %s\n", utils::binlog::kFileVersion, path);
+        return 1;
+    }
+    if (records.empty()) {
+        return 0;
+    }
+
+    if (sorted) {
+        std::stable_sort(records.begin(), records.end(), [](const DecodedRecord& a, const DecodedRecord& b) {
+            return a.timestamp_ns < b.timestamp_ns;
+        });
+    }
+    uint64_t first_ns = records.front().timestamp_ns;
+    for (const DecodedRecord& record : records) {
+        first_ns = (std::min)(first_ns, record.timestamp_ns);
+    }
+    for (const DecodedRecord& record : records) {
+        PrintRecord(record, first_ns);
+    }
+    return 0;
+}
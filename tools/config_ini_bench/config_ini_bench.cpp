@@ -0,0 +1,271 @@
+// Benchmarks the config INI store (utils::IndexedIni, as used by config/display_commander_config.cpp) against the
+// IniFile it replaced: a vector of sections holding vectors of key/value pairs, loaded with getline, searched
+// linearly with string compares and saved through an ofstream to a temporary file that is renamed over the original.
+//
+// The file has --sections sections of --keys keys (5,000 keys by default), like a DisplayCommander.ini that grew
+// over many versions. Every round loads the file, looks up every key once and saves it. The indexed store reads the
+// file in one go and parses the buffer in one pass (the addon maps the file instead), and also reports the cost of a
+// save with nothing changed, which the addon skips. Reported is the best round in microseconds.
+//
+// Usage: config_ini_bench [--sections S] [--keys K] [--rounds R]
+
+#include "utils/indexed_ini.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// The previous IniFile, without the Windows-only parts
+class LegacyIni {
+  public:
+    bool Load(const std::string& path) {
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            return false;
+        }
+        sections_.clear();
+        Section* current = nullptr;
+        std::string line;
+        while (std::getline(file, line)) {
+            Trim(line, " \t\r\n");
+            if (line.empty() || line[0] == ';' || line[0] == '#') {
+                continue;
+            }
+            if (line[0] == '[' && line.back() == ']') {
+                sections_.push_back({line.substr(1, line.size() - 2), {}});
+                current = &sections_.back();
+            } else if (current != nullptr) {
+                const size_t equal_pos = line.find('=');
+                if (equal_pos != std::string::npos) {
+                    std::string key = line.substr(0, equal_pos);
+                    std::string value = line.substr(equal_pos + 1);
+                    Trim(key, " \t");
+                    Trim(value, " \t");
+                    current->values.emplace_back(std::move(key), std::move(value));
+                }
+            }
+        }
+        return true;
+    }
+
+    bool GetValue(const std::string& section, const std::string& key, std::string& value) const {
+        for (const Section& s : sections_) {
+            if (s.name != section) {
+                continue;
+            }
+            for (const auto& kv : s.values) {
+                if (kv.first == key) {
+                    value = kv.second;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    bool Save(const std::string& path) const {
+        const std::string temp_path = path + ".temp";
+        {
+            std::ofstream file(temp_path);
+            if (!file.is_open()) {
+                return false;
+            }
+            for (const Section& s : sections_) {
+                file << "[" << s.name << "]\n";
+                for (const auto& kv : s.values) {
+                    file << kv.first << "=" << kv.second << "\n";
+                }
+                file << "\n";
+            }
+        }
+        std::error_code ec;
+        std::filesystem::rename(temp_path, path, ec);
+        return !ec;
+    }
+
+  private:
+    struct Section {
+        std::string name;
+        std::vector<std::pair<std::string, std::string>> values;
+    };
+
+    static void Trim(std::string& text, const char* chars) {
+        const size_t first = text.find_first_not_of(chars);
+        if (first == std::string::npos) {
+            text.clear();
+            return;
+        }
+        text.erase(text.find_last_not_of(chars) + 1);
+        text.erase(0, first);
+    }
+
+    std::vector<Section> sections_;
+};
+
+bool ReadWholeFile(const std::string& path, std::string& contents) {
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    std::fseek(file, 0, SEEK_END);
+    const long size = std::ftell(file);
+    std::fseek(file, 0, SEEK_SET);
+    contents.resize(size > 0 ? static_cast<size_t>(size) : 0);
+    const bool ok = contents.empty() || std::fread(contents.data(), 1, contents.size(), file) == contents.size();
+    std::fclose(file);
+    return ok;
+}
+
+// Serialize, one write to a temporary file, rename over the original (WriteFileAtomically in the addon)
+bool SaveIndexed(const utils::IndexedIni& ini, const std::string& path) {
+    std::string contents;
+    ini.Serialize(contents);
+    const std::string temp_path = path + ".temp";
+    std::FILE* file = std::fopen(temp_path.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    const bool written = std::fwrite(contents.data(), 1, contents.size(), file) == contents.size();
+    if (std::fclose(file) != 0 || !written) {
+        return false;
+    }
+    std::error_code ec;
+    std::filesystem::rename(temp_path, path, ec);
+    return !ec;
+}
+
+using Clock = std::chrono::steady_clock;
+
+double MicrosecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+struct Options {
+    int sections = 50;
+    int keys = 100;
+    int rounds = 20;
+};
+
+Options ParseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--sections") == 0) {
+            options.sections = (std::max)(1, std::atoi(argv[i + 1]));
+        } else if (std::strcmp(argv[i], "--keys") == 0) {
+            options.keys = (std::max)(1, std::atoi(argv[i + 1]));
+        } else if (std::strcmp(argv[i], "--rounds") == 0) {
+            options.rounds = (std::max)(1, std::atoi(argv[i + 1]));
+        } else {
+            std::fprintf(stderr, "unknown option %s\n", argv[i]);
+            std::exit(1);
+        }
+    }
+    return options;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const Options options = ParseOptions(argc, argv);
+
+    const std::filesystem::path dir = std::filesystem::temp_directory_path() / "config_ini_bench";
+    std::filesystem::create_directories(dir);
+    const std::string source_path = (dir / "source.ini").string();
+    const std::string legacy_path = (dir / "legacy.ini").string();
+    const std::string indexed_path = (dir / "indexed.ini").string();
+
+    std::vector<std::pair<std::string, std::string>> keys;
+    {
+        std::ofstream file(source_path);
+        for (int s = 0; s < options.sections; ++s) {
+            const std::string section = "Section" + std::to_string(s);
+            file << "[" << section << "]\n";
+            for (int k = 0; k < options.keys; ++k) {
+                const std::string key = "setting_key_" + std::to_string(k);
+                file << key << " = " << (k * 1.5) << "\n";
+                keys.emplace_back(section, key);
+            }
+            file << "\n";
+        }
+    }
+    std::printf("%zu keys in %d sections, %d rounds\n", keys.size(), options.sections, options.rounds);
+
+    // Best round of each phase; the best one is the least disturbed one
+    double legacy_load = 1e30, legacy_lookup = 1e30, legacy_save = 1e30;
+    double indexed_load = 1e30, indexed_lookup = 1e30, indexed_save = 1e30, indexed_clean_save = 1e30;
+    size_t checksum = 0;
+    for (int round = 0; round < options.rounds; ++round) {
+        LegacyIni legacy;
+        auto start = Clock::now();
+        legacy.Load(source_path);
+        legacy_load = (std::min)(legacy_load, MicrosecondsSince(start));
+
+        start = Clock::now();
+        std::string value;
+        for (const auto& [section, key] : keys) {
+            if (legacy.GetValue(section, key, value)) {
+                checksum += value.size();
+            }
+        }
+        legacy_lookup = (std::min)(legacy_lookup, MicrosecondsSince(start));
+
+        start = Clock::now();
+        legacy.Save(legacy_path);
+        legacy_save = (std::min)(legacy_save, MicrosecondsSince(start));
+
+        utils::IndexedIni indexed;
+        start = Clock::now();
+        std::string contents;
+        ReadWholeFile(source_path, contents);
+        indexed.Parse(contents);
+        indexed_load = (std::min)(indexed_load, MicrosecondsSince(start));
+
+        start = Clock::now();
+        for (const auto& [section, key] : keys) {
+            if (const std::string* found = indexed.GetValue(section, key)) {
+                checksum += found->size();
+            }
+        }
+        indexed_lookup = (std::min)(indexed_lookup, MicrosecondsSince(start));
+
+        start = Clock::now();
+        indexed.MarkStructureDirty();
+        SaveIndexed(indexed, indexed_path);
+        indexed.MarkClean();
+        indexed_save = (std::min)(indexed_save, MicrosecondsSince(start));
+
+        // What SaveConfig() does when nothing changed
+        start = Clock::now();
+        if (indexed.IsDirty()) {
+            SaveIndexed(indexed, indexed_path);
+        }
+        indexed_clean_save = (std::min)(indexed_clean_save, MicrosecondsSince(start));
+    }
+
+    std::string legacy_output;
+    std::string indexed_output;
+    const bool same_output = ReadWholeFile(legacy_path, legacy_output) && ReadWholeFile(indexed_path, indexed_output)
+                             && legacy_output == indexed_output;
+
+    std::printf("load:   legacy %9.1f us, indexed %9.1f us (%.2fx)\n", legacy_load, indexed_load,
+                legacy_load / indexed_load);
+    std::printf("lookup: legacy %9.1f us, indexed %9.1f us (%.2fx), all keys once\n", legacy_lookup, indexed_lookup,
+                legacy_lookup / indexed_lookup);
+    std::printf("save:   legacy %9.1f us, indexed %9.1f us (%.2fx), unchanged store %.2f us\n", legacy_save,
+                indexed_save, legacy_save / indexed_save, indexed_clean_save);
+    std::printf("saved files identical: %s (checksum %zu)\n", same_output ? "yes" : "NO", checksum);
+
+    std::error_code ec;
+    std::filesystem::remove_all(dir, ec);
+    return same_output ? 0 : 1;
+}
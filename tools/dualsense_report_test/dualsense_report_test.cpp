@@ -0,0 +1,310 @@
+// Tests utils::DecodeDualSenseReport and utils::Crc32 (utils/dualsense_report.hpp):
+//  - the slicing-by-8 CRC-32 gives the standard check value and matches a bit-by-bit reference for every length and
+//    alignment, also when continued from a partial CRC;
+//  - a captured USB report decodes to the expected fields, and the same payload sent as a sealed Bluetooth report
+//    decodes to the same state;
+//  - flipping one bit of a Bluetooth report is rejected as BadCrc (and accepted with verify_crc = false);
+//  - random USB, Bluetooth and garbage reports of every length decode exactly like a naive byte-by-byte reference
+//    decoder written from the hid-playstation layout.
+//
+// Usage: dualsense_report_test [--iterations N] [--seed S]
+
+#include "utils/dualsense_report.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+
+int g_failures = 0;
+
+#define CHECK(condition)                                                       \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            std::printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+            ++g_failures;                                                      \
+        }                                                                      \
+    } while (false)
+
+using utils::DualSenseButtons;
+using utils::DualSenseDecodeResult;
+using utils::DualSenseState;
+
+struct Options {
+    int iterations = 500'000;
+    uint32_t seed = 42;
+};
+
+Options ParseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--iterations") == 0) {
+            options.iterations = std::atoi(argv[i + 1]);
+        } else if (std::strcmp(argv[i], "--seed") == 0) {
+            options.seed = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+        } else {
+            std::fprintf(stderr, "unknown option %s\n", argv[i]);
+            std::exit(2);
+        }
+    }
+    return options;
+}
+
+// Bit-by-bit reflected CRC-32 (polynomial 0xEDB88320)
+uint32_t ReferenceCrc32(const uint8_t* data, size_t size, uint32_t crc = 0) {
+    crc = ~crc;
+    for (size_t i = 0; i < size; ++i) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ ((crc & 1) != 0 ? 0xEDB88320u : 0u);
+        }
+    }
+    return ~crc;
+}
+
+// Field by field, from the hid-playstation input report layout
+bool ReferenceDecode(const uint8_t* report, size_t size, DualSenseState& state) {
+    size_t offset = 0;
+    bool bluetooth = false;
+    if (size >= 64 && report[0] == 0x01) {
+        offset = 1;
+    } else if (size >= 78 && report[0] == 0x31) {
+        offset = 2;
+        bluetooth = true;
+        uint8_t seeded[75];
+        seeded[0] = 0xA1;
+        std::memcpy(seeded + 1, report, 74);
+        const uint32_t stored =
+            report[74] | report[75] << 8 | report[76] << 16 | static_cast<uint32_t>(report[77]) << 24;
+        if (ReferenceCrc32(seeded, sizeof(seeded)) != stored) {
+            return false;
+        }
+    } else {
+        return false;
+    }
+    const uint8_t* p = report + offset;
+
+    static constexpr uint32_t kDpad[8] = {
+        DualSenseButtons::kDpadUp,
+        DualSenseButtons::kDpadUp | DualSenseButtons::kDpadRight,
+        DualSenseButtons::kDpadRight,
+        DualSenseButtons::kDpadDown | DualSenseButtons::kDpadRight,
+        DualSenseButtons::kDpadDown,
+        DualSenseButtons::kDpadDown | DualSenseButtons::kDpadLeft,
+        DualSenseButtons::kDpadLeft,
+        DualSenseButtons::kDpadUp | DualSenseButtons::kDpadLeft,
+    };
+    // Button bit per report bit, for bytes 7 (high nibble), 8 and 9
+    static constexpr uint32_t kByte7[8] = {0, 0, 0, 0, 0x4000, 0x1000, 0x2000, 0x8000};
+    static constexpr uint32_t kByte8[8] = {0x100, 0x200, 0x10000, 0x20000, 0x20, 0x10, 0x40, 0x80};
+    static constexpr uint32_t kByte9[8] = {0x400, 0x40000, 0x80000, 0, 0x100000, 0x200000, 0x400000, 0x800000};
+    uint32_t buttons = (p[7] & 0x0F) < 8 ? kDpad[p[7] & 0x0F] : 0;
+    for (int bit = 0; bit < 8; ++bit) {
+        buttons |= ((p[7] >> bit) & 1) != 0 ? kByte7[bit] : 0;
+        buttons |= ((p[8] >> bit) & 1) != 0 ? kByte8[bit] : 0;
+        buttons |= ((p[9] >> bit) & 1) != 0 ? kByte9[bit] : 0;
+    }
+
+    state.buttons = buttons;
+    state.left_x = p[0];
+    state.left_y = p[1];
+    state.right_x = p[2];
+    state.right_y = p[3];
+    state.left_trigger = p[4];
+    state.right_trigger = p[5];
+    state.sequence = p[6];
+    for (int axis = 0; axis < 3; ++axis) {
+        std::memcpy(&state.gyro[axis], p + 15 + 2 * axis, 2);
+        std::memcpy(&state.accel[axis], p + 21 + 2 * axis, 2);
+    }
+    std::memcpy(&state.sensor_timestamp, p + 27, 4);
+    state.temperature = static_cast<int8_t>(p[31]);
+    for (int t = 0; t < 2; ++t) {
+        const uint8_t* touch = p + 32 + 4 * t;
+        state.touch[t].active = (touch[0] & 0x80) == 0;
+        state.touch[t].id = touch[0] & 0x7F;
+        state.touch[t].x = static_cast<uint16_t>(touch[1] | (touch[2] & 0x0F) << 8);
+        state.touch[t].y = static_cast<uint16_t>(touch[2] >> 4 | touch[3] << 4);
+    }
+    state.battery_level = p[52] & 0x0F;
+    state.power_state = p[52] >> 4;
+    state.plugged = static_cast<uint8_t>((p[53] & 0x1F) | (p[54] & 1) << 5);
+    state.bluetooth = bluetooth;
+    return true;
+}
+
+bool SameState(const DualSenseState& a, const DualSenseState& b) {
+    bool same = a.buttons == b.buttons && a.left_x == b.left_x && a.left_y == b.left_y && a.right_x == b.right_x
+                && a.right_y == b.right_y && a.left_trigger == b.left_trigger && a.right_trigger == b.right_trigger
+                && a.sequence == b.sequence && a.battery_level == b.battery_level && a.power_state == b.power_state
+                && a.plugged == b.plugged && a.temperature == b.temperature && a.bluetooth == b.bluetooth
+                && a.sensor_timestamp == b.sensor_timestamp;
+    for (int axis = 0; axis < 3; ++axis) {
+        same = same && a.gyro[axis] == b.gyro[axis] && a.accel[axis] == b.accel[axis];
+    }
+    for (int t = 0; t < 2; ++t) {
+        same = same && a.touch[t].x == b.touch[t].x && a.touch[t].y == b.touch[t].y && a.touch[t].id == b.touch[t].id
+               && a.touch[t].active == b.touch[t].active;
+    }
+    return same;
+}
+
+// Writes the CRC of the first 74 bytes of a 0x31 report into its last four bytes
+void SealBluetoothReport(uint8_t* report) {
+    const uint32_t crc = utils::Crc32(report, utils::kDualSenseBtCrcOffset, utils::kDualSenseBtInputCrcPrefix);
+    for (int i = 0; i < 4; ++i) {
+        report[utils::kDualSenseBtCrcOffset + i] = static_cast<uint8_t>(crc >> (8 * i));
+    }
+}
+
+// Idle controller with cross + R1 held and one finger on the touchpad, battery 7 and charging
+const uint8_t kUsbReport[64] = {
+    0x01, 0x7F, 0x81, 0x80, 0x7E, 0x00, 0x00, 0x2A, 0x28, 0x02, 0x00, 0x00, 0x8A, 0x3B, 0x9C, 0x5E,
+    0xFF, 0xFF, 0x02, 0x00, 0xFD, 0xFF, 0x1C, 0x00, 0x3A, 0x20, 0x5C, 0x06, 0x7A, 0x12, 0x2E, 0x00,
+    0x17, 0x05, 0xC4, 0x23, 0x1D, 0x80, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x09, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE4, 0xB9, 0x17, 0x08, 0x17, 0x08, 0x00, 0x31, 0x55, 0xA9, 0x6B, 0xE5, 0xD1,
+};
+
+void TestCrcCheckValue() {
+    const char* check = "123456789";
+    CHECK(utils::Crc32(reinterpret_cast<const uint8_t*>(check), 9) == 0xCBF43926u);
+    CHECK(utils::Crc32(nullptr, 0) == 0);
+}
+
+void TestCrcMatchesReference(std::mt19937& rng) {
+    std::vector<uint8_t> buffer(600);
+    for (uint8_t& byte : buffer) {
+        byte = static_cast<uint8_t>(rng());
+    }
+    size_t mismatches = 0;
+    for (size_t offset = 0; offset < 9; ++offset) {
+        const uint8_t* data = buffer.data() + offset;
+        for (size_t size = 0; size < 300; ++size) {
+            const uint32_t expected = ReferenceCrc32(data, size);
+            const size_t head = size / 3;
+            mismatches += utils::Crc32(data, size) != expected;
+            mismatches += utils::Crc32(data + head, size - head, utils::Crc32(data, head)) != expected;
+        }
+    }
+    CHECK(mismatches == 0);
+}
+
+void TestUsbReport() {
+    DualSenseState state;
+    CHECK(utils::DecodeDualSenseReport(kUsbReport, sizeof(kUsbReport), state) == DualSenseDecodeResult::Ok);
+    CHECK(state.buttons == (DualSenseButtons::kCross | DualSenseButtons::kR1));
+    CHECK(state.left_x == 0x7F && state.left_y == 0x81 && state.right_x == 0x80 && state.right_y == 0x7E);
+    CHECK(state.touch[0].active && state.touch[0].x == 0x3C4 && state.touch[0].y == 0x1D2);
+    CHECK(!state.touch[1].active);
+    CHECK(state.battery_level == 7 && state.power_state == 1);
+    CHECK(!state.bluetooth);
+
+    DualSenseState reference;
+    CHECK(ReferenceDecode(kUsbReport, sizeof(kUsbReport), reference) && SameState(state, reference));
+    CHECK(utils::DecodeDualSenseReport(kUsbReport, 63, state) == DualSenseDecodeResult::TooShort);
+}
+
+void TestBluetoothMatchesUsb() {
+    uint8_t bluetooth[78] = {0x31, 0x10};
+    std::memcpy(bluetooth + 2, kUsbReport + 1, 63);
+    SealBluetoothReport(bluetooth);
+
+    DualSenseState usb_state;
+    DualSenseState bt_state;
+    CHECK(utils::DecodeDualSenseReport(kUsbReport, sizeof(kUsbReport), usb_state) == DualSenseDecodeResult::Ok);
+    CHECK(utils::DecodeDualSenseReport(bluetooth, sizeof(bluetooth), bt_state) == DualSenseDecodeResult::Ok);
+    CHECK(bt_state.bluetooth);
+    bt_state.bluetooth = false;
+    CHECK(SameState(bt_state, usb_state));
+}
+
+void TestOneBitCorruptionRejected() {
+    uint8_t bluetooth[78] = {0x31, 0x10};
+    std::memcpy(bluetooth + 2, kUsbReport + 1, 63);
+    SealBluetoothReport(bluetooth);
+
+    // Every single-bit flip in the covered bytes and in the stored CRC must be caught
+    size_t accepted = 0;
+    for (size_t byte = 0; byte < sizeof(bluetooth); ++byte) {
+        for (int bit = 0; bit < 8; ++bit) {
+            uint8_t corrupted[78];
+            std::memcpy(corrupted, bluetooth, sizeof(bluetooth));
+            corrupted[byte] ^= static_cast<uint8_t>(1u << bit);
+            DualSenseState state;
+            const DualSenseDecodeResult result = utils::DecodeDualSenseReport(corrupted, sizeof(corrupted), state);
+            if (byte == 0) {
+                accepted += result != DualSenseDecodeResult::UnknownReport;  // no longer a 0x31 report
+            } else {
+                accepted += result != DualSenseDecodeResult::BadCrc;
+            }
+        }
+    }
+    CHECK(accepted == 0);
+
+    bluetooth[40] ^= 1;
+    DualSenseState state;
+    state.left_x = 3;
+    CHECK(utils::DecodeDualSenseReport(bluetooth, sizeof(bluetooth), state) == DualSenseDecodeResult::BadCrc);
+    CHECK(state.left_x == 3);  // untouched on failure
+    CHECK(utils::DecodeDualSenseReport(bluetooth, sizeof(bluetooth), state, false) == DualSenseDecodeResult::Ok);
+}
+
+// Random reports of every length: mostly garbage, USB, and Bluetooth with a valid CRC three times out of four
+void TestFuzzAgainstReference(std::mt19937& rng, int iterations) {
+    size_t decoded = 0;
+    size_t mismatches = 0;
+    for (int it = 0; it < iterations; ++it) {
+        uint8_t report[utils::kDualSenseMaxReportSize + 2];
+        for (uint8_t& byte : report) {
+            byte = static_cast<uint8_t>(rng());
+        }
+        const size_t size = rng() % (sizeof(report) + 1);
+        const uint32_t kind = rng() % 4;
+        if (kind == 0) {
+            report[0] = 0x01;
+        } else if (kind == 1) {
+            report[0] = 0x31;
+            if (size >= 78 && rng() % 4 != 0) {
+                SealBluetoothReport(report);
+            }
+        }
+        DualSenseState actual;
+        DualSenseState expected;
+        const bool actual_ok = utils::DecodeDualSenseReport(report, size, actual) == DualSenseDecodeResult::Ok;
+        const bool expected_ok = ReferenceDecode(report, size, expected);
+        if (actual_ok != expected_ok || (actual_ok && !SameState(actual, expected))) {
+            if (mismatches++ < 5) {
+                std::printf("fuzz mismatch at iteration %d: size %zu, report id 0x%02X\n", it, size, report[0]);
+            }
+        }
+        decoded += actual_ok;
+    }
+    CHECK(mismatches == 0);
+    CHECK(iterations < 1000 || decoded > 0);
+    std::printf("fuzz: %d reports, %zu decoded\n", iterations, decoded);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const Options options = ParseOptions(argc, argv);
+    std::mt19937 rng(options.seed);
+
+    TestCrcCheckValue();
+    TestCrcMatchesReference(rng);
+    TestUsbReport();
+    TestBluetoothMatchesUsb();
+    TestOneBitCorruptionRejected();
+    TestFuzzAgainstReference(rng, options.iterations);
+
+    if (g_failures != 0) {
+        std::printf("%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    std::printf("all DualSense report tests passed\n");
+    return 0;
+}
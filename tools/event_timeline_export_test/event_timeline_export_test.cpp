@@ -0,0 +1,261 @@
+// Tests utils::EventTimeline (per-thread rings: lazy allocation, wrap-around, thread limit, torn-slot dropping under
+// concurrent capture, ReleaseBuffers with writers running) and checks the Chrome trace JSON and Perfetto exports of a
+// fixed two-frame capture byte for byte against the files in golden/.
+//
+// After an intended exporter change, regenerate the golden files with --update and review the diff.
+//
+// Usage: event_timeline_export_test [--golden-dir DIR] [--update]
+
+#include "utils/event_timeline.hpp"
+#include "utils/event_timeline_export.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+int g_failures = 0;
+
+#define CHECK(condition)                                                       \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            std::printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+            ++g_failures;                                                      \
+        }                                                                      \
+    } while (false)
+
+using utils::EventTimeline;
+using utils::TimelineCapture;
+using utils::TimelineEvent;
+
+uint32_t FakeThreadId() {
+    static std::atomic<uint32_t> next_tid{100};
+    return next_tid.fetch_add(1);
+}
+
+void TestLazyAllocation() {
+    EventTimeline timeline;
+    timeline.NameCurrentThread("idle");
+    timeline.RecordInstant(TimelineEvent::kPresent, 1, 1);
+    CHECK(timeline.Capture(0).threads.empty());  // named and recorded while disabled: no events buffer
+
+    timeline.SetEnabled(true);
+    timeline.RecordInstant(TimelineEvent::kPresent, 5, 2);
+    const TimelineCapture capture = timeline.Capture(0);
+    CHECK(capture.threads.size() == 1);
+    CHECK(!capture.threads.empty() && capture.threads[0].name == "idle");
+    CHECK(capture.records.size() == 1);
+    CHECK(!capture.records.empty() && capture.records[0].frame_id == 2);
+}
+
+void TestWrapAround() {
+    EventTimeline timeline;
+    timeline.SetEnabled(true);
+    const int64_t total = static_cast<int64_t>(EventTimeline::kEventsPerThread) + 100;
+    for (int64_t i = 0; i < total; ++i) {
+        timeline.Record(TimelineEvent::kPresent, i, i + 1, static_cast<uint64_t>(i));
+    }
+    const TimelineCapture capture = timeline.Capture(0);
+    CHECK(capture.records.size() == EventTimeline::kEventsPerThread);
+    CHECK(!capture.records.empty() && capture.records.front().begin_ns == 100);
+    CHECK(!capture.records.empty() && capture.records.back().begin_ns == total - 1);
+}
+
+void TestSinceAndOrder() {
+    EventTimeline timeline;
+    timeline.SetEnabled(true);
+    timeline.Record(TimelineEvent::kSimulation, 30, 40, 3);
+    std::thread other([&] {
+        timeline.RecordInstant(TimelineEvent::kGpuCompletion, 20, 2);
+        timeline.RecordInstant(TimelineEvent::kGpuCompletion, 5, 1);
+    });
+    other.join();
+    timeline.Record(TimelineEvent::kPresent, 10, 50, 1);
+
+    const TimelineCapture capture = timeline.Capture(10);
+    CHECK(capture.threads.size() == 2);
+    CHECK(capture.records.size() == 3);  // the event at 5 ns is before since_ns
+    for (size_t i = 1; i < capture.records.size(); ++i) {
+        CHECK(capture.records[i - 1].begin_ns <= capture.records[i].begin_ns);
+    }
+}
+
+void TestThreadLimit() {
+    EventTimeline timeline;
+    timeline.SetEnabled(true);
+    for (size_t t = 0; t < EventTimeline::kMaxThreads + 2; ++t) {
+        std::thread([&] { timeline.RecordInstant(TimelineEvent::kPresent, 1, 1); }).join();
+    }
+    CHECK(timeline.ThreadCount() == EventTimeline::kMaxThreads);
+    CHECK(timeline.Capture(0).records.size() == EventTimeline::kMaxThreads);
+}
+
+// Writers wrap their rings continuously while the main thread captures; every copied slot must be intact
+void TestConcurrentCapture() {
+    EventTimeline timeline;
+    timeline.SetEnabled(true);
+    std::atomic<bool> stop{false};
+    std::vector<std::thread> writers;
+    for (int w = 0; w < 3; ++w) {
+        writers.emplace_back([&, w] {
+            for (uint64_t i = 0; !stop.load(std::memory_order_relaxed); ++i) {
+                const int64_t v = static_cast<int64_t>(i);
+                timeline.Record(TimelineEvent::kPresent, v, v + 1, i, v * 3 + w);
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    size_t torn = 0;
+    for (int round = 0; round < 50; ++round) {
+        for (const utils::TimelineRecord& record : timeline.Capture(0).records) {
+            if (record.end_ns != record.begin_ns + 1 || static_cast<uint64_t>(record.begin_ns) != record.frame_id
+                || record.value / 3 != record.begin_ns) {
+                ++torn;
+            }
+        }
+    }
+    stop = true;
+    for (std::thread& writer : writers) {
+        writer.join();
+    }
+    CHECK(torn == 0);
+}
+
+void TestReleaseBuffers() {
+    for (int round = 0; round < 20; ++round) {
+        EventTimeline timeline;
+        timeline.SetEnabled(true);
+        std::atomic<bool> stop{false};
+        std::vector<std::thread> writers;
+        for (int w = 0; w < 3; ++w) {
+            writers.emplace_back([&] {
+                for (int64_t i = 0; !stop.load(std::memory_order_relaxed); ++i) {
+                    timeline.Record(TimelineEvent::kPresent, i, i + 1, static_cast<uint64_t>(i));
+                }
+            });
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        timeline.ReleaseBuffers();
+        CHECK(!timeline.IsEnabled());
+        CHECK(timeline.Capture(0).records.empty());
+        stop = true;
+        for (std::thread& writer : writers) {
+            writer.join();
+        }
+        CHECK(timeline.Capture(0).records.empty());
+    }
+}
+
+// Two frames on a named present thread plus a GPU completion from a second thread
+TimelineCapture GoldenCapture() {
+    EventTimeline timeline(FakeThreadId);
+    timeline.SetEnabled(true);
+    timeline.NameCurrentThread("Present \"main\"");
+    int64_t t = 1'000'000;
+    for (uint64_t frame = 1; frame <= 2; ++frame) {
+        timeline.Record(TimelineEvent::kSimulation, t, t + 2'000'000, frame);
+        timeline.Record(TimelineEvent::kRenderSubmit, t + 2'000'000, t + 5'000'500, frame);
+        timeline.Record(TimelineEvent::kLimiterSleep, t + 5'100'000, t + 9'000'000, frame, 1234);
+        timeline.RecordInstant(TimelineEvent::kReflexMarker, t + 9'000'001, frame, 4);
+        timeline.Record(TimelineEvent::kPresent, t + 9'000'001, t + 9'500'000, frame);
+        t += 10'000'000;
+    }
+    std::thread gpu([&] { timeline.RecordInstant(TimelineEvent::kGpuCompletion, 12'000'000, 1, 7'000'000); });
+    gpu.join();
+    return timeline.Capture(1'000'000);
+}
+
+bool ReadFile(const std::string& path, std::string& contents) {
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    contents.clear();
+    char buffer[4096];
+    size_t read = 0;
+    while ((read = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        contents.append(buffer, read);
+    }
+    std::fclose(file);
+    return true;
+}
+
+bool WriteFile(const std::string& path, const std::string& contents) {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    const bool written = std::fwrite(contents.data(), 1, contents.size(), file) == contents.size();
+    return (std::fclose(file) == 0) && written;
+}
+
+void CheckGolden(const std::string& path, const std::string& actual, bool update) {
+    if (update) {
+        CHECK(WriteFile(path, actual));
+        std::printf("updated %s\n", path.c_str());
+        return;
+    }
+    std::string expected;
+    if (!ReadFile(path, expected)) {
+        std::printf("FAILED: cannot read %s\n", path.c_str());
+        ++g_failures;
+        return;
+    }
+    if (expected != actual) {
+        size_t offset = 0;
+        while (offset < expected.size() && offset < actual.size() && expected[offset] == actual[offset]) {
+            ++offset;
+        }
+        std::printf("FAILED: %s differs at byte %zu (expected %zu bytes, got %zu)\n", path.c_str(), offset,
+                    expected.size(), actual.size());
+        ++g_failures;
+    }
+}
+
+void TestGoldenExports(const std::string& golden_dir, bool update) {
+    const TimelineCapture capture = GoldenCapture();
+    CHECK(capture.threads.size() == 2);
+    CHECK(capture.records.size() == 11);
+    const utils::TimelineProcess process{4242, "game.exe"};
+    CheckGolden(golden_dir + "/event_timeline.json", utils::ExportTimelineChromeJson(capture, process), update);
+    CheckGolden(golden_dir + "/event_timeline.perfetto-trace", utils::ExportTimelinePerfetto(capture, process),
+                update);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string golden_dir = EVENT_TIMELINE_GOLDEN_DIR;
+    bool update = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--golden-dir") == 0 && i + 1 < argc) {
+            golden_dir = argv[++i];
+        } else if (std::strcmp(argv[i], "--update") == 0) {
+            update = true;
+        } else {
+            std::fprintf(stderr, "unknown option %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    TestLazyAllocation();
+    TestWrapAround();
+    TestSinceAndOrder();
+    TestThreadLimit();
+    TestConcurrentCapture();
+    TestReleaseBuffers();
+    TestGoldenExports(golden_dir, update);
+
+    if (g_failures != 0) {
+        std::printf("%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    std::printf("all event timeline tests passed\n");
+    return 0;
+}
@@ -0,0 +1,241 @@
+// Tests utils::FrameLatencyRing (utils/frame_latency_ring.hpp):
+//  - every arrival order of the six frame stages finalizes the frame exactly once, on the stage that completes it,
+//    with the timestamps of the stages that arrived up to then;
+//  - duplicate stages, frames overtaken by a frame kSlots newer (abandoned) and stages for such frames (stale);
+//  - the percentile summary of the finalized history;
+//  - a present thread and a GPU thread racing to deliver the last stage of each frame finalize it exactly once.
+//
+// Usage: frame_latency_ring_test [--frames N]
+
+#include "utils/frame_latency_ring.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+namespace {
+
+int g_failures = 0;
+
+#define CHECK(condition)                                                       \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            std::printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+            ++g_failures;                                                      \
+        }                                                                      \
+    } while (false)
+
+using utils::FrameLatencyRecord;
+using utils::FrameLatencyRing;
+using utils::FrameStage;
+
+constexpr size_t kStageCount = static_cast<size_t>(FrameStage::kCount);
+
+struct Options {
+    uint64_t frames = 200'000;  // for the racing test
+};
+
+Options ParseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--frames") == 0) {
+            options.frames = (std::max)(uint64_t{64}, static_cast<uint64_t>(std::strtoull(argv[i + 1], nullptr, 10)));
+        } else {
+            std::fprintf(stderr, "unknown option %s\n", argv[i]);
+            std::exit(2);
+        }
+    }
+    return options;
+}
+
+// Distinct timestamp per stage, so a record shows which stages it picked up
+int64_t StageTimestamp(uint64_t frame_id, FrameStage stage) {
+    return static_cast<int64_t>(frame_id) * 1000 + 100 * static_cast<int64_t>(stage) + 7;
+}
+
+void TestInOrderFrame() {
+    FrameLatencyRing ring;
+    FrameLatencyRecord record;
+    CHECK(!ring.Record(1, FrameStage::kSimStart, 100));
+    CHECK(!ring.Record(1, FrameStage::kGpuQueued, 300));
+    CHECK(!ring.Record(1, FrameStage::kPresentStart, 400));
+    CHECK(!ring.Record(1, FrameStage::kPresentEnd, 500));
+    CHECK(ring.Record(1, FrameStage::kGpuDone, 800, &record));  // GPU finished after Present returned
+    CHECK(record.frame_id == 1);
+    CHECK(record.SimToDisplayNs() == 700);
+    CHECK(record.GpuLateNs() == 300);
+    CHECK(record.PresentDurationNs() == 100);
+
+    // No GPU fence queued: Present returning completes the frame
+    CHECK(ring.Record(2, FrameStage::kPresentEnd, 2000, &record));
+    CHECK(record.SimToDisplayNs() == 0 && record.GpuLateNs() == 0);
+    CHECK(ring.CompletedCount() == 2);
+}
+
+// All 720 arrival orders of the six stages, each in a fresh ring
+void TestOutOfOrderStages() {
+    std::array<FrameStage, kStageCount> order;
+    for (size_t i = 0; i < kStageCount; ++i) {
+        order[i] = static_cast<FrameStage>(i);
+    }
+    size_t permutations = 0;
+    size_t wrong_finalize = 0;
+    size_t wrong_record = 0;
+    do {
+        ++permutations;
+        FrameLatencyRing ring;
+        const uint64_t frame_id = 5;
+        uint32_t arrived = 0;
+        uint32_t expected_mask = 0;
+        size_t finalized_count = 0;
+        FrameLatencyRecord record;
+        for (const FrameStage stage : order) {
+            arrived |= utils::FrameStageBit(stage);
+            const bool completes = expected_mask == 0 && utils::IsFrameComplete(arrived);
+            if (completes) {
+                expected_mask = arrived;
+            }
+            const bool finalized = ring.Record(frame_id, stage, StageTimestamp(frame_id, stage), &record);
+            finalized_count += finalized;
+            wrong_finalize += finalized != completes;
+        }
+        wrong_finalize += finalized_count != 1;
+
+        FrameLatencyRecord history[1];
+        CHECK(ring.CopyHistory(history, 1) == 1);
+        bool same = history[0].frame_id == frame_id && history[0].stage_mask == expected_mask
+                    && record.stage_mask == expected_mask;
+        for (size_t i = 0; i < kStageCount; ++i) {
+            const FrameStage stage = static_cast<FrameStage>(i);
+            if (history[0].Has(stage)) {
+                same = same && history[0].At(stage) == StageTimestamp(frame_id, stage);
+            }
+        }
+        wrong_record += !same;
+    } while (std::next_permutation(order.begin(), order.end(), [](FrameStage a, FrameStage b) {
+        return static_cast<uint32_t>(a) < static_cast<uint32_t>(b);
+    }));
+    CHECK(permutations == 720);
+    CHECK(wrong_finalize == 0);
+    CHECK(wrong_record == 0);
+}
+
+void TestDuplicateStage() {
+    FrameLatencyRing ring;
+    CHECK(!ring.Record(2, FrameStage::kGpuQueued, 1300));
+    CHECK(!ring.Record(2, FrameStage::kGpuDone, 1350));
+    CHECK(!ring.Record(2, FrameStage::kGpuDone, 1360));  // duplicate before completion
+    CHECK(!ring.Record(2, FrameStage::kSimStart, 1000));
+    FrameLatencyRecord record;
+    CHECK(ring.Record(2, FrameStage::kPresentEnd, 1500, &record));
+    CHECK(record.At(FrameStage::kGpuDone) == 1350);  // the first arrival wins
+    CHECK(record.SimToDisplayNs() == 500 && record.GpuLateNs() == 0);
+    CHECK(!ring.Record(2, FrameStage::kPresentEnd, 1600));  // duplicate after completion
+    CHECK(ring.CompletedCount() == 1);
+}
+
+void TestAbandonedAndStale() {
+    FrameLatencyRing ring;
+    ring.Record(4, FrameStage::kGpuQueued, 1);
+    ring.Record(4 + FrameLatencyRing::kSlots, FrameStage::kSimStart, 2);  // takes over frame 4's slot
+    CHECK(ring.AbandonedCount() == 1);
+    CHECK(!ring.Record(4, FrameStage::kGpuDone, 3));
+    CHECK(ring.StaleCount() == 1);
+    CHECK(ring.CompletedCount() == 0);
+}
+
+void TestSummary() {
+    FrameLatencyRing ring;
+    // Sim-to-display of 1..100 ms, the GPU finishing 2 ms after Present on even frames
+    for (uint64_t frame = 1; frame <= 100; ++frame) {
+        const int64_t start = static_cast<int64_t>(frame) * 1'000'000'000;
+        const int64_t present_end = start + static_cast<int64_t>(frame) * 1'000'000;
+        ring.Record(frame, FrameStage::kSimStart, start);
+        if (frame % 2 == 0) {
+            ring.Record(frame, FrameStage::kGpuQueued, start);
+            ring.Record(frame, FrameStage::kGpuDone, present_end + 2'000'000);
+        }
+        ring.Record(frame, FrameStage::kPresentEnd, present_end);
+    }
+    ring.UpdateSummary();
+    const utils::FrameLatencySummary summary = ring.Summary();
+    CHECK(summary.count == 100);
+    CHECK(summary.sim_to_display_max_ms > 101.9f && summary.sim_to_display_max_ms < 102.1f);
+    CHECK(summary.sim_to_display_p50_ms > 49.0f && summary.sim_to_display_p50_ms < 54.0f);
+    CHECK(summary.sim_to_display_p50_ms <= summary.sim_to_display_p95_ms);
+    CHECK(summary.sim_to_display_p95_ms <= summary.sim_to_display_p99_ms);
+    CHECK(summary.sim_to_display_p99_ms <= summary.sim_to_display_max_ms);
+    CHECK(summary.gpu_late_avg_ms > 0.99f && summary.gpu_late_avg_ms < 1.01f);
+    CHECK(summary.gpu_late_p95_ms > 1.99f && summary.gpu_late_p95_ms < 2.01f);
+}
+
+// The present thread delivers sim start, GPU queued and present end; the GPU thread delivers GPU done. Whichever
+// arrives last finalizes the frame.
+void TestRacingLastStage(uint64_t frames) {
+    FrameLatencyRing ring;
+    std::atomic<uint64_t> finalized{0};
+    std::atomic<uint64_t> queued{0};
+    std::thread gpu([&] {
+        for (uint64_t next = 1; next <= frames;) {
+            if (queued.load(std::memory_order_acquire) < next) {
+                std::this_thread::yield();
+                continue;
+            }
+            if (ring.Record(next, FrameStage::kGpuDone, static_cast<int64_t>(next) * 10 + 7)) {
+                finalized.fetch_add(1);
+            }
+            ++next;
+        }
+    });
+    for (uint64_t frame = 1; frame <= frames; ++frame) {
+        ring.Record(frame, FrameStage::kSimStart, static_cast<int64_t>(frame) * 10);
+        ring.Record(frame, FrameStage::kGpuQueued, static_cast<int64_t>(frame) * 10 + 1);
+        queued.store(frame, std::memory_order_release);
+        if (ring.Record(frame, FrameStage::kPresentEnd, static_cast<int64_t>(frame) * 10 + 5)) {
+            finalized.fetch_add(1);
+        }
+        // Keep the GPU thread within half the slot window, so no frame is abandoned
+        while (frame >= FrameLatencyRing::kSlots / 2
+               && ring.CompletedCount() + FrameLatencyRing::kSlots / 2 < frame) {
+            std::this_thread::yield();
+        }
+    }
+    gpu.join();
+
+    FrameLatencyRecord history[FrameLatencyRing::kHistory];
+    const size_t count = ring.CopyHistory(history, FrameLatencyRing::kHistory);
+    size_t bad = 0;
+    for (size_t i = 0; i < count; ++i) {
+        bad += history[i].SimToDisplayNs() != 7 || history[i].GpuLateNs() != 2;
+    }
+    CHECK(finalized.load() == frames);
+    CHECK(ring.CompletedCount() == frames);
+    CHECK(ring.AbandonedCount() == 0);
+    CHECK(count == FrameLatencyRing::kHistory);
+    CHECK(bad == 0);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const Options options = ParseOptions(argc, argv);
+
+    TestInOrderFrame();
+    TestOutOfOrderStages();
+    TestDuplicateStage();
+    TestAbandonedAndStale();
+    TestSummary();
+    TestRacingLastStage(options.frames);
+
+    if (g_failures != 0) {
+        std::printf("%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    std::printf("all frame latency ring tests passed\n");
+    return 0;
+}
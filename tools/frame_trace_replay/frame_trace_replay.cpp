@@ -0,0 +1,354 @@
+// Offline replay of Display Commander frame traces (.dcft, recorded from the Developer tab).
+//
+// The trace is split into per-frame workloads (CPU time from sim start to the limiter, Present duration,
+// time after Present until the next sim start, GPU tail after render submit). Those workloads are then
+// replayed against a virtual clock with each limiter algorithm, so limiter changes can be A/B tested on
+// any platform. Limiter wake-up errors are resampled from the waits recorded in the trace.
+//
+// The present pacing delay (Main tab) is not modeled: it ran inside the post-Present time, which the replay treats
+// as fixed game work. Traces recorded with it are refused unless --allow-pacing-delay is given.
+//
+// Usage: frame_trace_replay <trace.dcft> [--fps N] [--mode all|recorded|none|onpresent|adaptive]
+//                           [--allow-pacing-delay]
+
+#include "dxgi/frame_pacing_model.hpp"
+#include "utils/frame_trace.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+using utils::FrameTraceEvent;
+using utils::FrameTraceRecord;
+
+constexpr int64_t kUnset = INT64_MIN;
+
+struct FrameWork {
+    int64_t cpu_ns = 0;           // sim start -> limiter start
+    int64_t submit_ns = 0;        // sim start -> render submit end
+    int64_t present_ns = 0;       // present start -> present end
+    int64_t post_present_ns = 0;  // present end -> next sim start
+    int64_t gpu_tail_ns = -1;     // render submit end -> GPU completion (-1 = not measured)
+
+    // Recorded timeline, used for the "recorded" row
+    int64_t sim_start = kUnset;
+    int64_t present_start = kUnset;
+    int64_t display = kUnset;
+};
+
+struct Trace {
+    std::vector<FrameWork> frames;
+    std::vector<int64_t> wake_errors_ns;  // recorded limiter wake - target
+    double median_target_fps = 0.0;
+};
+
+struct RawFrame {
+    int64_t sim_start = kUnset;
+    int64_t submit_end = kUnset;
+    int64_t limiter_start = kUnset;
+    int64_t present_start = kUnset;
+    int64_t present_end = kUnset;
+    int64_t gpu_completion = kUnset;
+    int64_t target_fps_milli = 0;
+};
+
+bool BuildTrace(std::vector<FrameTraceRecord> records, Trace& trace) {
+    std::stable_sort(records.begin(), records.end(),
+                     [](const FrameTraceRecord& a, const FrameTraceRecord& b) { return a.timestamp_ns < b.timestamp_ns; });
+
+    // Frames are delimited by sim start; everything until the next sim start belongs to the same frame
+    std::vector<RawFrame> raw;
+    std::vector<int64_t> gpu_completions;
+    for (const FrameTraceRecord& r : records) {
+        const auto type = static_cast<FrameTraceEvent>(r.type);
+        if (type == FrameTraceEvent::kSimStart) {
+            raw.emplace_back();
+            raw.back().sim_start = r.timestamp_ns;
+            continue;
+        }
+        if (type == FrameTraceEvent::kGpuCompletion) {
+            gpu_completions.push_back(r.timestamp_ns);
+            continue;
+        }
+        if (type == FrameTraceEvent::kLimiterWait) {
+            trace.wake_errors_ns.push_back(r.timestamp_ns - r.value);
+            continue;
+        }
+        if (raw.empty()) {
+            continue;
+        }
+        RawFrame& frame = raw.back();
+        switch (type) {
+        case FrameTraceEvent::kRenderSubmitEnd:
+            frame.submit_end = r.timestamp_ns;
+            break;
+        case FrameTraceEvent::kLimiterStart:
+            frame.limiter_start = r.timestamp_ns;
+            frame.target_fps_milli = r.value;
+            break;
+        case FrameTraceEvent::kPresentStart:
+            frame.present_start = r.timestamp_ns;
+            break;
+        case FrameTraceEvent::kPresentEnd:
+            frame.present_end = r.timestamp_ns;
+            break;
+        default:
+            break;
+        }
+    }
+
+    // GPU completions are matched to the latest frame submitted before them
+    size_t next_completion = 0;
+    for (size_t i = 0; i < raw.size(); ++i) {
+        if (raw[i].submit_end == kUnset) {
+            continue;
+        }
+        const int64_t next_submit = (i + 1 < raw.size() && raw[i + 1].submit_end != kUnset) ? raw[i + 1].submit_end
+                                                                                           : INT64_MAX;
+        while (next_completion < gpu_completions.size() && gpu_completions[next_completion] < raw[i].submit_end) {
+            ++next_completion;
+        }
+        if (next_completion < gpu_completions.size() && gpu_completions[next_completion] < next_submit) {
+            raw[i].gpu_completion = gpu_completions[next_completion++];
+        }
+    }
+
+    std::vector<int64_t> targets;
+    for (size_t i = 0; i + 1 < raw.size(); ++i) {
+        const RawFrame& f = raw[i];
+        if (f.submit_end == kUnset || f.limiter_start == kUnset || f.present_start == kUnset || f.present_end == kUnset) {
+            continue;
+        }
+        FrameWork w;
+        w.cpu_ns = f.limiter_start - f.sim_start;
+        w.submit_ns = f.submit_end - f.sim_start;
+        w.present_ns = f.present_end - f.present_start;
+        w.post_present_ns = raw[i + 1].sim_start - f.present_end;
+        if (f.gpu_completion != kUnset) {
+            w.gpu_tail_ns = f.gpu_completion - f.submit_end;
+        }
+        w.sim_start = f.sim_start;
+        w.present_start = f.present_start;
+        w.display = (std::max)(f.present_end, f.gpu_completion);
+        trace.frames.push_back(w);
+        if (f.target_fps_milli > 0) {
+            targets.push_back(f.target_fps_milli);
+        }
+    }
+
+    if (!targets.empty()) {
+        std::nth_element(targets.begin(), targets.begin() + targets.size() / 2, targets.end());
+        trace.median_target_fps = static_cast<double>(targets[targets.size() / 2]) / 1000.0;
+    }
+    return !trace.frames.empty();
+}
+
+// Virtual time; waits land at target + a wake-up error resampled from the recording
+class VirtualClock final : public dxgi::fps_limiter::PacingClock {
+  public:
+    explicit VirtualClock(const std::vector<int64_t>& wake_errors_ns) : wake_errors_ns_(wake_errors_ns) {}
+
+    int64_t NowNs() override { return now_ns_; }
+
+    void WaitUntilNs(int64_t target_ns) override {
+        if (target_ns <= now_ns_) {
+            return;
+        }
+        int64_t error_ns = 0;
+        if (!wake_errors_ns_.empty()) {
+            error_ns = wake_errors_ns_[next_error_++ % wake_errors_ns_.size()];
+        }
+        now_ns_ = (std::max)(now_ns_, target_ns + error_ns);
+    }
+
+    void Advance(int64_t ns) { now_ns_ += (std::max)(ns, int64_t{0}); }
+
+  private:
+    const std::vector<int64_t>& wake_errors_ns_;
+    int64_t now_ns_ = 0;
+    size_t next_error_ = 0;
+};
+
+struct Timeline {
+    std::vector<int64_t> frame_times_ns;  // present start to present start
+    std::vector<int64_t> latencies_ns;    // sim start to max(present end, GPU completion)
+};
+
+enum class ReplayMode { kNone, kOnPresent, kAdaptive };
+
+Timeline Replay(const Trace& trace, ReplayMode mode, double fps) {
+    VirtualClock clock(trace.wake_errors_ns);
+    dxgi::fps_limiter::FramePacingModel model;
+    int64_t last_time_point_ns = 0;
+    int64_t last_present_start = kUnset;
+    Timeline timeline;
+
+    for (const FrameWork& w : trace.frames) {
+        const int64_t sim_start = clock.NowNs();
+        clock.Advance(w.cpu_ns);
+        if (mode != ReplayMode::kNone && fps > 0.0) {
+            dxgi::fps_limiter::PaceFrame(clock, (mode == ReplayMode::kAdaptive) ? &model : nullptr, fps,
+                                         last_time_point_ns);
+        }
+        const int64_t present_start = clock.NowNs();
+        clock.Advance(w.present_ns);
+        int64_t display = clock.NowNs();
+        if (w.gpu_tail_ns >= 0) {
+            display = (std::max)(display, sim_start + w.submit_ns + w.gpu_tail_ns);
+        }
+        clock.Advance(w.post_present_ns);
+
+        if (last_present_start != kUnset) {
+            timeline.frame_times_ns.push_back(present_start - last_present_start);
+        }
+        last_present_start = present_start;
+        timeline.latencies_ns.push_back(display - sim_start);
+    }
+    return timeline;
+}
+
+Timeline Recorded(const Trace& trace) {
+    Timeline timeline;
+    for (size_t i = 0; i < trace.frames.size(); ++i) {
+        const FrameWork& w = trace.frames[i];
+        if (i > 0) {
+            timeline.frame_times_ns.push_back(w.present_start - trace.frames[i - 1].present_start);
+        }
+        timeline.latencies_ns.push_back(w.display - w.sim_start);
+    }
+    return timeline;
+}
+
+double Percentile(std::vector<int64_t> values, double q) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    const size_t rank = static_cast<size_t>(std::ceil(q * static_cast<double>(values.size())));
+    const size_t index = (std::min)(rank > 0 ? rank - 1 : 0, values.size() - 1);
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return static_cast<double>(values[index]);
+}
+
+double Mean(const std::vector<int64_t>& values) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    double sum = 0.0;
+    for (int64_t v : values) {
+        sum += static_cast<double>(v);
+    }
+    return sum / static_cast<double>(values.size());
+}
+
+double StdDev(const std::vector<int64_t>& values) {
+    if (values.size() < 2) {
+        return 0.0;
+    }
+    const double mean = Mean(values);
+    double sum_sq = 0.0;
+    for (int64_t v : values) {
+        sum_sq += (static_cast<double>(v) - mean) * (static_cast<double>(v) - mean);
+    }
+    return std::sqrt(sum_sq / static_cast<double>(values.size() - 1));
+}
+
+void PrintRow(const char* name, const Timeline& t) {
+    const double ms = 1e6;
+    const double mean_ft = Mean(t.frame_times_ns);
+    std::printf("%-10s %8.2f %8.3f %8.3f %8.3f %8.3f %9.3f %8.3f %8.3f\n", name, mean_ft > 0.0 ? 1e9 / mean_ft : 0.0,
+                mean_ft / ms, Percentile(t.frame_times_ns, 0.5) / ms, Percentile(t.frame_times_ns, 0.99) / ms,
+                Percentile(t.frame_times_ns, 0.999) / ms, StdDev(t.frame_times_ns) / ms, Mean(t.latencies_ns) / ms,
+                Percentile(t.latencies_ns, 0.99) / ms);
+}
+
+void PrintUsage() {
+    std::fprintf(stderr,
+                 "Usage: frame_trace_replay <trace.dcft> [--fps N] [--mode all|recorded|none|onpresent|adaptive]\n"
+                 "                          [--allow-pacing-delay]\n");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        PrintUsage();
+        return 1;
+    }
+    const char* path = argv[1];
+    double fps = 0.0;
+    std::string mode = "all";
+    bool allow_pacing_delay = false;
+    for (int i = 2; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--fps") == 0 && i + 1 < argc) {
+            fps = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--mode") == 0 && i + 1 < argc) {
+            mode = argv[++i];
+        } else if (std::strcmp(argv[i], "--allow-pacing-delay") == 0) {
+            allow_pacing_delay = true;
+        } else {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    utils::FrameTraceFileHeader header;
+    std::vector<FrameTraceRecord> records;
+    if (!utils::ReadFrameTrace(path, header, records)) {
+        std::fprintf(stderr, "Failed to read frame trace: %s\n", path);
+        return 1;
+    }
+    if (header.version < 2) {
+        std::fprintf(stderr, "Warning: version %u trace does not record whether the present pacing delay was on\n",
+                     header.version);
+    }
+    if ((header.flags & utils::FrameTraceFileHeader::kFlagPresentPacingDelay) != 0) {
+        const size_t delays = std::count_if(records.begin(), records.end(), [](const FrameTraceRecord& r) {
+            return r.type == static_cast<uint32_t>(FrameTraceEvent::kPresentPacingDelay);
+        });
+        if (!allow_pacing_delay) {
+            std::fprintf(stderr,
+                         "%s was recorded with the present pacing delay on (%zu delayed frames), which the replay does "
+                         "not model; pass --allow-pacing-delay to replay it as fixed post-Present work\n",
+                         path, delays);
+            return 1;
+        }
+        std::fprintf(stderr, "Warning: %zu frames include a present pacing delay, replayed as fixed post-Present work\n",
+                     delays);
+    }
+    Trace trace;
+    if (!BuildTrace(std::move(records), trace)) {
+        std::fprintf(stderr, "No complete frames in trace: %s\n", path);
+        return 1;
+    }
+    if (fps <= 0.0) {
+        fps = (trace.median_target_fps > 0.0) ? trace.median_target_fps : 60.0;
+    }
+
+    std::printf("%s: %zu frames, %zu limiter waits, replay target %.2f fps\n\n", path, trace.frames.size(),
+                trace.wake_errors_ns.size(), fps);
+    std::printf("%-10s %8s %8s %8s %8s %8s %9s %8s %8s\n", "mode", "fps", "ft avg", "ft p50", "ft p99", "ft p99.9",
+                "jitter sd", "lat avg", "lat p99");
+    std::printf("%-10s %8s %8s %8s %8s %8s %9s %8s %8s\n", "", "", "(ms)", "(ms)", "(ms)", "(ms)", "(ms)", "(ms)", "(ms)");
+
+    const bool all = (mode == "all");
+    if (all || mode == "recorded") {
+        PrintRow("recorded", Recorded(trace));
+    }
+    if (all || mode == "none") {
+        PrintRow("none", Replay(trace, ReplayMode::kNone, fps));
+    }
+    if (all || mode == "onpresent") {
+        PrintRow("onpresent", Replay(trace, ReplayMode::kOnPresent, fps));
+    }
+    if (all || mode == "adaptive") {
+        PrintRow("adaptive", Replay(trace, ReplayMode::kAdaptive, fps));
+    }
+    return 0;
+}
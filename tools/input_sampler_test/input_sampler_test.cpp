@@ -0,0 +1,276 @@
+// Tests utils::TripleBuffer and utils::InputSampler (utils/input_sampler.hpp) over a fake controller backend:
+//  - the triple buffer hands over the newest value only, and a reader racing the producer never sees a torn or older
+//    value;
+//  - on a manual clock: only requested pads are polled, demand expires after kDemandWindowNs, disconnected pads are
+//    retried every kDisconnectedRetryNs and go back to the full rate once reconnected, and Latest() rejects samples
+//    that are too old to stand in for a direct read;
+//  - with the sampler thread running on the real clock, readers of several pads get intact samples that never go
+//    back in sequence.
+//
+// Usage: input_sampler_test [--run-ms N]
+
+#include "utils/input_sampler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+
+int g_failures = 0;
+
+#define CHECK(condition)                                                       \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            std::printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+            ++g_failures;                                                      \
+        }                                                                      \
+    } while (false)
+
+constexpr uint32_t kErrorDeviceNotConnected = 1167;  // ERROR_DEVICE_NOT_CONNECTED
+
+// Three copies of the call count, so a torn copy shows
+struct FakeState {
+    uint64_t a = 0;
+    uint64_t b = 0;
+    uint64_t c = 0;
+};
+
+// Stands in for XInputGetState; the clock is manual unless real_clock is set
+struct FakeBackend {
+    using State = FakeState;
+
+    std::atomic<uint64_t> calls[4] = {};
+    std::atomic<bool> connected[4] = {true, true, false, true};
+    std::atomic<int64_t> manual_now_ns{1'000'000'000};
+    bool real_clock = false;
+
+    bool Sample(size_t pad, FakeState& state, uint32_t& result) {
+        const uint64_t call = calls[pad].fetch_add(1) + 1;
+        state = {call, call, call};
+        const bool is_connected = connected[pad].load();
+        result = is_connected ? 0 : kErrorDeviceNotConnected;
+        return is_connected;
+    }
+    int64_t NowNs() {
+        if (!real_clock) {
+            return manual_now_ns.load();
+        }
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+    void SleepUntilNs(int64_t target_ns) {
+        std::this_thread::sleep_until(std::chrono::steady_clock::time_point(std::chrono::nanoseconds(target_ns)));
+    }
+    void Advance(int64_t delta_ns) { manual_now_ns.fetch_add(delta_ns); }
+};
+
+using Sampler = utils::InputSampler<FakeBackend>;
+
+struct Options {
+    int run_ms = 300;  // threaded test duration
+};
+
+Options ParseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--run-ms") == 0) {
+            options.run_ms = (std::max)(50, std::atoi(argv[i + 1]));
+        } else {
+            std::fprintf(stderr, "unknown option %s\n", argv[i]);
+            std::exit(2);
+        }
+    }
+    return options;
+}
+
+void TestTripleBufferNewestOnly() {
+    utils::TripleBuffer<int> buffer;
+    CHECK(!buffer.Update());
+    buffer.WriteBuffer() = 1;
+    buffer.Publish();
+    buffer.WriteBuffer() = 2;
+    buffer.Publish();
+    CHECK(buffer.Update());
+    CHECK(buffer.Read() == 2);  // 1 was never read and is dropped
+    CHECK(!buffer.Update());
+    CHECK(buffer.Read() == 2);
+    buffer.WriteBuffer() = 3;
+    buffer.Publish();
+    CHECK(buffer.Update() && buffer.Read() == 3);
+}
+
+void TestTripleBufferConcurrent() {
+    utils::TripleBuffer<FakeState> buffer;
+    constexpr uint64_t kValues = 500'000;
+    std::atomic<bool> done{false};
+    std::thread producer([&] {
+        for (uint64_t value = 1; value <= kValues; ++value) {
+            buffer.WriteBuffer() = {value, value, value};
+            buffer.Publish();
+        }
+        done = true;
+    });
+    uint64_t last = 0;
+    size_t torn = 0;
+    size_t backwards = 0;
+    for (;;) {
+        const bool finished = done.load();
+        if (buffer.Update()) {
+            const FakeState& state = buffer.Read();
+            torn += state.a != state.b || state.b != state.c;
+            backwards += state.a <= last;
+            last = state.a;
+        }
+        if (finished && !buffer.Update()) {
+            break;
+        }
+    }
+    producer.join();
+    CHECK(torn == 0);
+    CHECK(backwards == 0);
+    CHECK(buffer.Read().a == kValues);
+}
+
+void TestDemandAndRetry() {
+    FakeBackend backend;
+    Sampler sampler(backend);
+
+    // Nothing requested: nothing polled
+    sampler.SampleOnce(backend.NowNs());
+    for (const std::atomic<uint64_t>& calls : backend.calls) {
+        CHECK(calls.load() == 0);
+    }
+
+    // Pad 0 connected, pad 2 disconnected
+    sampler.Request(0, backend.NowNs());
+    sampler.Request(2, backend.NowNs());
+    sampler.SampleOnce(backend.NowNs());
+    backend.Advance(1'000'000);
+    sampler.SampleOnce(backend.NowNs());
+    CHECK(backend.calls[0].load() == 2);
+    CHECK(backend.calls[1].load() == 0);
+    CHECK(backend.calls[2].load() == 1);  // not retried within kDisconnectedRetryNs
+
+    Sampler::Sample sample;
+    CHECK(sampler.Latest(0, backend.NowNs(), sample));
+    CHECK(sample.connected && sample.state.a == 2 && sample.sequence == 2 && sample.result == 0);
+    CHECK(sampler.Latest(2, backend.NowNs(), sample));
+    CHECK(!sample.connected && sample.result == kErrorDeviceNotConnected);
+    CHECK(!sampler.Latest(1, backend.NowNs(), sample));  // never sampled
+
+    // Pad 2 reconnects: picked up at the next retry, then polled every pass
+    backend.connected[2] = true;
+    backend.Advance(Sampler::kDisconnectedRetryNs);
+    sampler.Request(0, backend.NowNs());
+    sampler.Request(2, backend.NowNs());
+    sampler.SampleOnce(backend.NowNs());
+    CHECK(backend.calls[2].load() == 2);
+    backend.Advance(1'000'000);
+    sampler.SampleOnce(backend.NowNs());
+    CHECK(backend.calls[2].load() == 3);
+    CHECK(sampler.Latest(2, backend.NowNs(), sample) && sample.connected);
+
+    // Demand expires after kDemandWindowNs without a Request()
+    const uint64_t calls_before = backend.calls[0].load();
+    backend.Advance(Sampler::kDemandWindowNs + 1);
+    sampler.SampleOnce(backend.NowNs());
+    CHECK(backend.calls[0].load() == calls_before);
+    CHECK(sampler.Passes() == 6);  // passes count even when no pad is due
+}
+
+void TestLatestRejectsStaleSamples() {
+    FakeBackend backend;
+    Sampler sampler(backend);
+    sampler.SetRate(1000);  // 1 ms period: connected samples are good for max(4 periods, 20 ms)
+    sampler.Request(0, backend.NowNs());
+    sampler.Request(2, backend.NowNs());
+    sampler.SampleOnce(backend.NowNs());
+
+    Sampler::Sample sample;
+    backend.Advance(20'000'000);
+    CHECK(sampler.Latest(0, backend.NowNs(), sample));
+    backend.Advance(1);
+    CHECK(!sampler.Latest(0, backend.NowNs(), sample));
+    CHECK(sample.state.a == 1);  // still copied out, just reported as too old
+
+    // Disconnected samples stand in for twice the retry interval
+    CHECK(sampler.Latest(2, backend.NowNs(), sample) && !sample.connected);
+    backend.Advance(2 * Sampler::kDisconnectedRetryNs);
+    CHECK(!sampler.Latest(2, backend.NowNs(), sample));
+}
+
+// Sampler thread at 2 kHz; three readers on pad 0 and one on pad 3, all requesting on every read like the hook does
+void TestThreadedReaders(int run_ms) {
+    FakeBackend backend;
+    backend.real_clock = true;
+    Sampler sampler(backend);
+    sampler.Request(0, backend.NowNs());
+    sampler.Request(3, backend.NowNs());
+    sampler.Start(2000);
+    CHECK(sampler.IsRunning());
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> reads{0};
+    std::atomic<size_t> torn{0};
+    std::atomic<size_t> backwards{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&, r] {
+            const size_t pad = (r == 3) ? 3 : 0;
+            uint64_t last_sequence = 0;
+            while (!stop.load()) {
+                sampler.Request(pad, backend.NowNs());
+                Sampler::Sample sample;
+                if (sampler.Latest(pad, backend.NowNs(), sample)) {
+                    torn += sample.state.a != sample.state.b || sample.state.b != sample.state.c;
+                    backwards += sample.sequence < last_sequence;
+                    last_sequence = sample.sequence;
+                    reads.fetch_add(1);
+                }
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(run_ms));
+    stop = true;
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+    sampler.Stop();
+    CHECK(!sampler.IsRunning());
+
+    std::printf("threaded: %llu passes in %d ms at 2000 Hz, %llu reads\n",
+                static_cast<unsigned long long>(sampler.Passes()), run_ms,
+                static_cast<unsigned long long>(reads.load()));
+    CHECK(sampler.Passes() > 0);
+    CHECK(reads.load() > 0);
+    CHECK(torn.load() == 0);
+    CHECK(backwards.load() == 0);
+    CHECK(backend.calls[1].load() == 0 && backend.calls[2].load() == 0);  // never requested
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const Options options = ParseOptions(argc, argv);
+
+    TestTripleBufferNewestOnly();
+    TestTripleBufferConcurrent();
+    TestDemandAndRetry();
+    TestLatestRejectsStaleSamples();
+    TestThreadedReaders(options.run_ms);
+
+    if (g_failures != 0) {
+        std::printf("%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    std::printf("all input sampler tests passed\n");
+    return 0;
+}
@@ -0,0 +1,273 @@
+// Replays a per-frame sequence of NVSDK_NGX_Parameter_Set*/Get* calls against the NGX parameter store used by
+// the NGX hooks (utils/ngx_parameter_store.hpp) and against the previous copy-on-insert shared_ptr map, the way
+// the detours call them (one store update per call).
+//
+// The built-in sequence models one DLSS Super Resolution + Frame Generation evaluate (set calls plus the
+// read-backs the detours also record). A sequence file, e.g. written from the hook logs, replaces it with one
+// call per line: "set|get i|ui|ull|f|d <name>".
+//
+// Usage: ngx_param_bench [sequence.txt] [--frames N] [--reader]
+//   --reader  also run a thread that reads the summary parameters back in a loop (overlay open)
+
+#include "utils/ngx_parameter_store.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using utils::NgxParameterValue;
+
+// The store the hooks used before: copies the whole map whenever a new name shows up
+class LegacyParameterMap {
+  public:
+    void update(const std::string& key, const NgxParameterValue& value) {
+        {
+            auto current_data = data_.load();
+            if (current_data->find(key) != current_data->end()) {
+                (*current_data)[key] = value;
+                return;
+            }
+        }
+        auto current_data = data_.load();
+        auto new_data = std::make_shared<std::unordered_map<std::string, NgxParameterValue>>(*current_data);
+        (*new_data)[key] = value;
+        data_.store(new_data);
+    }
+
+    bool get(const std::string& key, NgxParameterValue& value) const {
+        auto current_data = data_.load();
+        auto it = current_data->find(key);
+        if (it != current_data->end()) {
+            value = it->second;
+            return true;
+        }
+        return false;
+    }
+
+  private:
+    std::atomic<std::shared_ptr<std::unordered_map<std::string, NgxParameterValue>>> data_ =
+        std::make_shared<std::unordered_map<std::string, NgxParameterValue>>();
+};
+
+enum class Op : uint8_t { kSet, kGet };
+
+struct Call {
+    Op op;
+    NgxParameterValue::Type type;
+    const char* name;
+};
+
+constexpr Call Set(NgxParameterValue::Type type, const char* name) { return {Op::kSet, type, name}; }
+constexpr Call Get(NgxParameterValue::Type type, const char* name) { return {Op::kGet, type, name}; }
+
+using T = NgxParameterValue;
+
+// One frame: SR evaluate parameters, then the frame generation constants (several not in the known list)
+const Call kRecordedFrame[] = {
+    Set(T::UINT, "Width"), Set(T::UINT, "Height"), Set(T::UINT, "OutWidth"), Set(T::UINT, "OutHeight"),
+    Set(T::INT, "PerfQualityValue"), Set(T::INT, "Reset"), Set(T::FLOAT, "Sharpness"),
+    Set(T::FLOAT, "MV.Scale.X"), Set(T::FLOAT, "MV.Scale.Y"), Set(T::FLOAT, "Jitter.Offset.X"),
+    Set(T::FLOAT, "Jitter.Offset.Y"), Set(T::FLOAT, "DLSS.Pre.Exposure"), Set(T::FLOAT, "DLSS.Exposure.Scale"),
+    Set(T::UINT, "DLSS.Render.Subrect.Dimensions.Width"), Set(T::UINT, "DLSS.Render.Subrect.Dimensions.Height"),
+    Set(T::UINT, "DLSS.Input.Color.Subrect.Base.X"), Set(T::UINT, "DLSS.Input.Color.Subrect.Base.Y"),
+    Set(T::UINT, "DLSS.Input.Depth.Subrect.Base.X"), Set(T::UINT, "DLSS.Input.Depth.Subrect.Base.Y"),
+    Set(T::UINT, "DLSS.Input.MV.Subrect.Base.X"), Set(T::UINT, "DLSS.Input.MV.Subrect.Base.Y"),
+    Set(T::FLOAT, "FrameTimeDeltaInMsec"), Set(T::UINT, "TonemapperType"), Get(T::UINT, "OutWidth"),
+    Get(T::UINT, "OutHeight"), Get(T::INT, "SuperSampling.FeatureInitResult"),
+    Set(T::INT, "DLSSG.EnableInterp"), Set(T::UINT, "DLSSG.MultiFrameCount"), Set(T::INT, "DLSSG.Reset"),
+    Set(T::FLOAT, "DLSSG.CameraNear"), Set(T::FLOAT, "DLSSG.CameraFar"), Set(T::FLOAT, "DLSSG.CameraFOV"),
+    Set(T::FLOAT, "DLSSG.CameraAspectRatio"), Set(T::FLOAT, "DLSSG.JitterOffsetX"),
+    Set(T::FLOAT, "DLSSG.JitterOffsetY"), Set(T::FLOAT, "DLSSG.MvecScaleX"), Set(T::FLOAT, "DLSSG.MvecScaleY"),
+    Set(T::INT, "DLSSG.DepthInverted"), Set(T::INT, "DLSSG.ColorBuffersHDR"),
+    Set(T::INT, "DLSSG.CameraMotionIncluded"), Set(T::INT, "DLSSG.OrthoProjection"),
+    Set(T::FLOAT, "DLSSG.CameraPosX"), Set(T::FLOAT, "DLSSG.CameraPosY"), Set(T::FLOAT, "DLSSG.CameraPosZ"),
+    Set(T::FLOAT, "DLSSG.CameraUpX"), Set(T::FLOAT, "DLSSG.CameraUpY"), Set(T::FLOAT, "DLSSG.CameraUpZ"),
+    Set(T::FLOAT, "DLSSG.CameraRightX"), Set(T::FLOAT, "DLSSG.CameraRightY"), Set(T::FLOAT, "DLSSG.CameraRightZ"),
+    Set(T::FLOAT, "DLSSG.CameraFwdX"), Set(T::FLOAT, "DLSSG.CameraFwdY"), Set(T::FLOAT, "DLSSG.CameraFwdZ"),
+    Set(T::ULL, "DLSSG.UserDebugFlags"), Set(T::INT, "Enable.OFA"), Get(T::UINT, "DLSSG.MultiFrameCount"),
+};
+
+// What GetDLSSGSummary reads while the overlay is open
+const char* const kSummaryNames[] = {
+    "DLSS.Render.Subrect.Dimensions.Width", "DLSS.Render.Subrect.Dimensions.Height", "OutWidth", "OutHeight",
+    "PerfQualityValue", "DLSSG.CameraAspectRatio", "DLSSG.CameraFOV", "DLSSG.JitterOffsetX", "DLSSG.JitterOffsetY",
+    "DLSS.Pre.Exposure", "DLSS.Exposure.Scale", "DLSSG.DepthInverted", "DLSSG.ColorBuffersHDR",
+    "DLSSG.CameraMotionIncluded", "FrameTimeDeltaInMsec", "Sharpness", "TonemapperType", "DLSSG.EnableInterp",
+    "DLSSG.MultiFrameCount", "Enable.OFA",
+};
+
+NgxParameterValue ValueFor(NgxParameterValue::Type type, uint64_t frame) {
+    switch (type) {
+        case T::INT:    return NgxParameterValue(static_cast<int>(frame & 1));
+        case T::UINT:   return NgxParameterValue(static_cast<unsigned int>(1920 + (frame & 7)));
+        case T::FLOAT:  return NgxParameterValue(static_cast<float>(frame) * 0.25f);
+        case T::DOUBLE: return NgxParameterValue(static_cast<double>(frame) * 0.5);
+        case T::ULL:    return NgxParameterValue(static_cast<uint64_t>(frame));
+    }
+    return NgxParameterValue();
+}
+
+bool ParseType(const std::string& text, NgxParameterValue::Type& type) {
+    if (text == "i") type = T::INT;
+    else if (text == "ui") type = T::UINT;
+    else if (text == "ull") type = T::ULL;
+    else if (text == "f") type = T::FLOAT;
+    else if (text == "d") type = T::DOUBLE;
+    else return false;
+    return true;
+}
+
+// Names are kept alive in `names` so calls carry stable pointers, like string literals in a game
+bool LoadSequence(const char* path, std::vector<Call>& calls, std::vector<std::unique_ptr<std::string>>& names) {
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream fields(line);
+        std::string op;
+        std::string type_text;
+        std::string name;
+        NgxParameterValue::Type type;
+        if (!(fields >> op >> type_text >> name) || (op != "set" && op != "get") || !ParseType(type_text, type)) {
+            continue;
+        }
+        names.push_back(std::make_unique<std::string>(name));
+        calls.push_back({op == "set" ? Op::kSet : Op::kGet, type, names.back()->c_str()});
+    }
+    return !calls.empty();
+}
+
+// The detours construct std::string(InName) for every call and update the map from both Set and Get
+double ReplayLegacy(const std::vector<Call>& calls, uint64_t frames, LegacyParameterMap& map) {
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t frame = 0; frame < frames; ++frame) {
+        for (const Call& call : calls) {
+            map.update(std::string(call.name), ValueFor(call.type, frame));
+        }
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count();
+}
+
+double ReplayStore(const std::vector<Call>& calls, uint64_t frames, utils::NgxParameterStore& store) {
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t frame = 0; frame < frames; ++frame) {
+        for (const Call& call : calls) {
+            store.Set(call.name, ValueFor(call.type, frame));
+        }
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count();
+}
+
+template <typename ReadFn> std::thread StartReader(std::atomic<bool>& stop, std::atomic<uint64_t>& reads, ReadFn read) {
+    return std::thread([&stop, &reads, read]() {
+        uint64_t count = 0;
+        while (!stop.load(std::memory_order_relaxed)) {
+            for (const char* name : kSummaryNames) {
+                read(name);
+                ++count;
+            }
+        }
+        reads.store(count);
+    });
+}
+
+void Report(const char* label, double total_ns, uint64_t frames, size_t calls_per_frame, uint64_t reads) {
+    const double calls = static_cast<double>(frames) * static_cast<double>(calls_per_frame);
+    std::printf("%-24s %9.1f ns/frame %7.1f ns/call", label, total_ns / static_cast<double>(frames), total_ns / calls);
+    if (reads != 0) {
+        std::printf("   reader: %.1f M reads/s", static_cast<double>(reads) / total_ns * 1000.0);
+    }
+    std::printf("\n");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const char* sequence_path = nullptr;
+    uint64_t frames = 200000;
+    bool with_reader = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frames = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--reader") == 0) {
+            with_reader = true;
+        } else if (argv[i][0] != '-') {
+            sequence_path = argv[i];
+        } else {
+            std::fprintf(stderr, "Usage: ngx_param_bench [sequence.txt] [--frames N] [--reader]\n");
+            return 1;
+        }
+    }
+
+    std::vector<Call> calls;
+    std::vector<std::unique_ptr<std::string>> names;
+    if (sequence_path != nullptr) {
+        if (!LoadSequence(sequence_path, calls, names)) {
+            std::fprintf(stderr, "No calls read from %s\n", sequence_path);
+            return 1;
+        }
+    } else {
+        calls.assign(std::begin(kRecordedFrame), std::end(kRecordedFrame));
+    }
+    if (frames == 0) {
+        frames = 1;
+    }
+    std::printf("%zu calls per frame, %llu frames%s\n", calls.size(), static_cast<unsigned long long>(frames),
+                with_reader ? ", with a reader thread" : "");
+
+    LegacyParameterMap legacy;
+    static utils::NgxParameterStore store;
+    // Warm up: the first frame inserts every name
+    ReplayLegacy(calls, 1, legacy);
+    ReplayStore(calls, 1, store);
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> reads{0};
+    std::thread reader;
+
+    if (with_reader) {
+        reader = StartReader(stop, reads, [&legacy](const char* name) {
+            NgxParameterValue value;
+            legacy.get(std::string(name), value);
+        });
+    }
+    const double legacy_ns = ReplayLegacy(calls, frames, legacy);
+    if (with_reader) {
+        stop.store(true);
+        reader.join();
+    }
+    Report("shared_ptr map (old)", legacy_ns, frames, calls.size(), reads.load());
+
+    stop.store(false);
+    reads.store(0);
+    if (with_reader) {
+        reader = StartReader(stop, reads, [](const char* name) {
+            float value = 0.0f;
+            store.GetAsFloat(name, value);
+        });
+    }
+    const double store_ns = ReplayStore(calls, frames, store);
+    if (with_reader) {
+        stop.store(true);
+        reader.join();
+    }
+    Report("NgxParameterStore", store_ns, frames, calls.size(), reads.load());
+    std::printf("speedup: %.1fx\n", legacy_ns / store_ns);
+    return 0;
+}
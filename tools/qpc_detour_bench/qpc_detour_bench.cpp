@@ -0,0 +1,216 @@
+// Benchmarks the QueryPerformanceCounter detour (hooks/timeslowdown_hooks.cpp) over a mocked original, in calls per
+// second on one thread, against the detour it replaced.
+//
+// The previous detour counted every call, checked g_initialized_with_hwnd and the hook type, loaded
+// g_timeslowdown_state as an atomic<shared_ptr> (a lock in common STL implementations) and read up to three
+// settings. The current one flushes a thread-local call count every 256 calls, then does one relaxed load of the
+// published scaling mode; only when scaling is active does it call the noinline slow path, which reads the
+// VirtualClockState snapshot from a SeqlockRing and maps the real ticks to virtual ticks.
+//
+// "disabled" is the default setup: hook installed, timeslowdown off. "active" scales time by 0.5. The mocked
+// original is also timed on its own as the floor.
+//
+// Usage: qpc_detour_bench [--calls N]
+
+#include "utils/counter_registry.hpp"
+#include "utils/seqlock_ring.hpp"
+#include "utils/virtual_clock.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+#if defined(_MSC_VER)
+#define BENCH_NOINLINE __declspec(noinline)
+#else
+#define BENCH_NOINLINE __attribute__((noinline))
+#endif
+
+namespace {
+
+using QpcFn = bool (*)(int64_t*);
+
+int64_t g_fake_qpc = 0;
+
+// Stands in for QueryPerformanceCounter_Original: a monotonic tick counter
+BENCH_NOINLINE bool MockOriginal(int64_t* count) {
+    *count = ++g_fake_qpc;
+    return true;
+}
+
+enum class TimerHookType : int { None = 0, Enabled = 1, EnableRenderThread = 2, EnableNonRenderThread = 3 };
+
+// Settings the previous detour read on every call
+std::atomic<bool> g_initialized_with_hwnd{true};
+std::atomic<int> g_qpc_hook_type{static_cast<int>(TimerHookType::Enabled)};
+std::atomic<bool> g_timeslowdown_enabled{false};
+std::atomic<bool> g_timeslowdown_compatibility_mode{false};
+std::atomic<float> g_timeslowdown_multiplier{1.0f};
+
+namespace legacy {
+
+struct TimeslowdownState {
+    int64_t original_quad_ts = 0;
+    int64_t original_quad_value = 0;
+    double multiplier = 1.0;
+};
+
+std::atomic<uint64_t> g_qpc_call_count{0};
+std::atomic<std::shared_ptr<const TimeslowdownState>> g_timeslowdown_state{std::make_shared<TimeslowdownState>()};
+
+bool ShouldApplyHookById() {
+    const auto type = static_cast<TimerHookType>(g_qpc_hook_type.load());
+    return type == TimerHookType::Enabled;  // the render-thread variants compare thread ids on top
+}
+
+BENCH_NOINLINE bool Detour(int64_t* count) {
+    g_qpc_call_count.fetch_add(1, std::memory_order_relaxed);
+    const bool result = MockOriginal(count);
+    if (!result || count == nullptr || !g_initialized_with_hwnd.load()) {
+        return result;
+    }
+    if (!ShouldApplyHookById()) {
+        return result;
+    }
+    auto current_state = g_timeslowdown_state.load();
+    if (!g_timeslowdown_enabled.load() && g_timeslowdown_compatibility_mode.load()) {
+        return result;
+    }
+    if (current_state->original_quad_ts > 0 || g_timeslowdown_enabled.load()) {
+        const int64_t now_qpc = *count;
+        const float new_multiplier = g_timeslowdown_enabled.load() ? g_timeslowdown_multiplier.load() : 1.0f;
+        if (current_state->original_quad_ts == 0 || current_state->multiplier != new_multiplier) {
+            auto new_state = std::make_shared<TimeslowdownState>(*current_state);
+            if (new_state->original_quad_ts == 0) {
+                new_state->original_quad_ts = now_qpc;
+                new_state->original_quad_value = now_qpc;
+            } else {
+                new_state->original_quad_value =
+                    current_state->original_quad_value
+                    + static_cast<int64_t>((now_qpc - current_state->original_quad_ts) * current_state->multiplier);
+                new_state->original_quad_ts = now_qpc;
+            }
+            new_state->multiplier = new_multiplier;
+            g_timeslowdown_state.store(new_state);
+            current_state = new_state;
+        }
+        *count = current_state->original_quad_value
+                 + static_cast<int64_t>((now_qpc - current_state->original_quad_ts) * current_state->multiplier);
+    }
+    return true;
+}
+
+} // namespace legacy
+
+namespace current {
+
+constexpr size_t kTimerSources = 9;
+constexpr size_t kQpcSource = 0;
+constexpr uint32_t kQpcCallCountBatch = 256;
+
+using TimeslowdownState = utils::VirtualClockState<kTimerSources>;
+
+utils::CounterRegistry<uint64_t, kTimerSources> g_timer_hook_call_counts;
+thread_local uint32_t tls_qpc_pending_calls = 0;
+std::atomic<TimerHookType> g_qpc_scaling_mode{TimerHookType::None};
+utils::SeqlockRing<TimeslowdownState, 4> g_timeslowdown_state;
+
+BENCH_NOINLINE bool ReadVirtualTimerSource(int64_t real_qpc, uint64_t& value) {
+    utils::SeqlockRing<TimeslowdownState, 4>::Entry entry;
+    if (!g_timeslowdown_state.ReadLatest(entry)) {
+        return false;
+    }
+    value = entry.value.SourceValueAt(kQpcSource, real_qpc);
+    return true;
+}
+
+BENCH_NOINLINE bool Detour(int64_t* count) {
+    if (++tls_qpc_pending_calls == kQpcCallCountBatch) {
+        g_timer_hook_call_counts.Increment(kQpcSource, 0, kQpcCallCountBatch);
+        tls_qpc_pending_calls = 0;
+    }
+    const bool result = MockOriginal(count);
+    const TimerHookType mode = g_qpc_scaling_mode.load(std::memory_order_relaxed);
+    if (mode == TimerHookType::None || !result || count == nullptr) {
+        return result;
+    }
+    uint64_t virtual_qpc = 0;
+    if (ReadVirtualTimerSource(*count, virtual_qpc)) {
+        *count = static_cast<int64_t>(virtual_qpc);
+    }
+    return result;
+}
+
+} // namespace current
+
+struct Options {
+    uint64_t calls = 20'000'000;  // per run
+};
+
+Options ParseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--calls") == 0) {
+            options.calls = (std::max)(uint64_t{1}, static_cast<uint64_t>(std::strtoull(argv[i + 1], nullptr, 10)));
+        } else {
+            std::fprintf(stderr, "unknown option %s\n", argv[i]);
+            std::exit(1);
+        }
+    }
+    return options;
+}
+
+// Best of 5 runs, in million calls per second
+double MillionCallsPerSecond(QpcFn fn, uint64_t calls) {
+    double best = 0.0;
+    for (int run = 0; run < 5; ++run) {
+        int64_t value = 0;
+        int64_t checksum = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < calls; ++i) {
+            fn(&value);
+            checksum += value;
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (checksum == 42) {
+            std::printf(" ");  // keeps the loop from being optimized away
+        }
+        best = (std::max)(best, static_cast<double>(calls) / seconds / 1e6);
+    }
+    return best;
+}
+
+void Report(const char* name, double legacy, double current) {
+    std::printf("%-10s old %7.1f M calls/s, new %7.1f M calls/s (%.1fx)\n", name, legacy, current, current / legacy);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const uint64_t calls = ParseOptions(argc, argv).calls;
+    std::printf("%llu calls per run, best of 5\n", static_cast<unsigned long long>(calls));
+    std::printf("mocked original: %.1f M calls/s\n", MillionCallsPerSecond(&MockOriginal, calls));
+
+    Report("disabled", MillionCallsPerSecond(&legacy::Detour, calls), MillionCallsPerSecond(&current::Detour, calls));
+
+    // Timeslowdown at 0.5x, published the way RefreshTimeslowdownState() does it
+    g_timeslowdown_enabled.store(true);
+    g_timeslowdown_multiplier.store(0.5f);
+    current::TimeslowdownState state;
+    state.Start(g_fake_qpc, 10'000'000, utils::VirtualClockSegment::RateFromMultiplier(0.5));
+    state.SetSourceEpoch(current::kQpcSource, static_cast<uint64_t>(g_fake_qpc), 10'000'000);
+    current::g_timeslowdown_state.Push(state, 0);
+    current::g_qpc_scaling_mode.store(TimerHookType::Enabled);
+
+    Report("active", MillionCallsPerSecond(&legacy::Detour, calls), MillionCallsPerSecond(&current::Detour, calls));
+
+    const uint64_t counted = current::g_timer_hook_call_counts.Load(current::kQpcSource);
+    std::printf("new detour counted %llu calls in batches of %u\n", static_cast<unsigned long long>(counted),
+                current::kQpcCallCountBatch);
+    return 0;
+}
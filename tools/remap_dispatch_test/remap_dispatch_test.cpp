@@ -0,0 +1,240 @@
+// Tests the compiled input remap table (utils/remap_dispatch.hpp):
+//  - recorded XInput button-state sequences (one wButtons value per poll) produce the expected key/action edges:
+//    hold and tap, Guide chords, chords pressed before Guide, Guide released before the chorded button, several
+//    edges in one poll, unbound buttons;
+//  - gamepad outputs, invalid bindings, and rebasing a controller onto a new table;
+//  - concurrent polls of one controller dispatch every press exactly once and pair it with one release;
+//  - readers of RemapTablePublisher never see a table torn between two generations.
+//
+// Usage: remap_dispatch_test [--polls N]
+
+#include "utils/remap_dispatch.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+int g_failures = 0;
+
+#define CHECK(condition)                                                       \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            std::printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+            ++g_failures;                                                      \
+        }                                                                      \
+    } while (false)
+
+using utils::RemapBinding;
+using utils::RemapControllerSlot;
+using utils::RemapControllerState;
+using utils::RemapDispatchTable;
+using utils::RemapEdge;
+using utils::RemapEvent;
+using utils::RemapOutput;
+
+// XINPUT_GAMEPAD_* bits
+constexpr uint16_t kDpadUp = 0x0001;
+constexpr uint16_t kStart = 0x0010;
+constexpr uint16_t kGuide = 0x0400;
+constexpr uint16_t kA = 0x1000;
+constexpr uint16_t kB = 0x2000;
+constexpr uint16_t kX = 0x4000;
+constexpr uint16_t kY = 0x8000;
+
+struct Options {
+    int polls = 200'000;  // per thread in the concurrent poll test
+};
+
+Options ParseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--polls") == 0) {
+            options.polls = (std::max)(1000, std::atoi(argv[i + 1]));
+        } else {
+            std::fprintf(stderr, "unknown option %s\n", argv[i]);
+            std::exit(2);
+        }
+    }
+    return options;
+}
+
+const std::vector<RemapBinding> kBindings = {
+    {kA, RemapOutput::kKeyboard, 0, 32, true, false},      // A -> space, held while A is
+    {kB, RemapOutput::kKeyboard, 0, 27, false, false},     // B -> escape, tapped
+    {kDpadUp, RemapOutput::kAction, 0, 5, false, true},    // Guide + Up -> action 5
+    {kX, RemapOutput::kGamepad, 0, kY, true, false},       // X -> also Y
+    {kStart, RemapOutput::kKeyboard, 0, 99, true, true},   // Guide + Start -> key 99, held
+    {0x0003, RemapOutput::kKeyboard, 0, 1, true, false},   // two source bits: ignored
+};
+
+// Feeds one wButtons value per poll; the result lists each poll's edges ("+payload" / "-payload") followed by '|'
+std::string Replay(const RemapDispatchTable& table, RemapControllerState& state, const std::vector<uint16_t>& polls) {
+    std::string out;
+    RemapEvent events[utils::kRemapButtonCount];
+    for (const uint16_t buttons : polls) {
+        const size_t count = utils::StepRemapStates(table, state, buttons, events);
+        for (size_t i = 0; i < count; ++i) {
+            out += (events[i].edge == RemapEdge::kPress) ? '+' : '-';
+            out += std::to_string(events[i].binding.payload);
+            out += ' ';
+        }
+        out += '|';
+    }
+    return out;
+}
+
+struct RecordedSequence {
+    const char* name;
+    std::vector<uint16_t> polls;
+    const char* expected;
+};
+
+void TestRecordedSequences() {
+    const RemapDispatchTable table = utils::CompileRemapTable(kBindings.data(), kBindings.size(), kGuide);
+    CHECK(table.bound_mask == (kA | kB | kDpadUp | kX | kStart));
+    CHECK(table.gamepad_mask == kX);
+
+    const RecordedSequence sequences[] = {
+        {"hold and tap", {kA, kA, 0, kB, 0}, "+32 ||-32 |+27 ||"},
+        {"chord needs Guide", {kDpadUp, 0, kGuide, kGuide | kDpadUp, kDpadUp, 0}, "|||+5 |||"},
+        {"chord pressed before Guide", {kDpadUp, kDpadUp | kGuide, kGuide, kGuide | kDpadUp, 0}, "|||+5 ||"},
+        {"Guide released first", {kGuide, kGuide | kStart, kStart, 0}, "|+99 ||-99 |"},
+        {"two edges in one poll", {kA | kB, 0}, "+32 +27 |-32 |"},
+        {"unbound buttons", {kY, kY | 0x0002, 0x0002, 0}, "||||"},
+        {"bounce", {kA, 0, kA, 0}, "+32 |-32 |+32 |-32 |"},
+    };
+    for (const RecordedSequence& sequence : sequences) {
+        RemapControllerState state;
+        const std::string actual = Replay(table, state, sequence.polls);
+        if (actual != sequence.expected) {
+            std::printf("FAILED sequence \"%s\": expected \"%s\", got \"%s\"\n", sequence.name, sequence.expected,
+                        actual.c_str());
+            ++g_failures;
+        }
+    }
+}
+
+void TestGamepadOutput() {
+    const RemapDispatchTable table = utils::CompileRemapTable(kBindings.data(), kBindings.size(), kGuide);
+    CHECK(utils::ApplyGamepadRemaps(table, kX) == (kX | kY));
+    CHECK(utils::ApplyGamepadRemaps(table, kA) == kA);
+    CHECK(utils::ApplyGamepadRemaps(table, 0) == 0);
+}
+
+// Swapping tables releases held outputs of the old one; buttons still down fire only after being pressed again
+void TestRebase() {
+    const RemapDispatchTable old_table = utils::CompileRemapTable(kBindings.data(), kBindings.size(), kGuide);
+    const RemapDispatchTable new_table = utils::CompileRemapTable(kBindings.data(), 2, kGuide);
+    RemapControllerSlot slot;
+    RemapEvent events[utils::kRemapButtonCount];
+    size_t count = 0;
+    CHECK(slot.Step(old_table, 0, kA, events, count) && count == 1);
+
+    count = slot.Rebase(old_table, 1, events);
+    CHECK(count == 1 && events[0].edge == RemapEdge::kRelease && events[0].binding.payload == 32);
+    CHECK(!slot.Step(new_table, 0, 0, events, count));  // still polling with the old generation
+    CHECK(slot.Step(new_table, 1, kA, events, count) && count == 0);  // A still down: blocked
+    CHECK(slot.Step(new_table, 1, 0, events, count) && count == 0);   // released silently
+    CHECK(slot.Step(new_table, 1, kA, events, count) && count == 1 && events[0].edge == RemapEdge::kPress);
+}
+
+// Several threads poll the same controller with overlapping button states
+void TestConcurrentPolls(int polls) {
+    const RemapDispatchTable table = utils::CompileRemapTable(kBindings.data(), kBindings.size(), kGuide);
+    RemapControllerSlot slot;
+    std::atomic<int> presses{0};
+    std::atomic<int> releases{0};
+    const auto count_events = [&](const RemapEvent* events, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            (events[i].edge == RemapEdge::kPress ? presses : releases).fetch_add(1);
+        }
+    };
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t] {
+            RemapEvent events[utils::kRemapButtonCount];
+            size_t count = 0;
+            for (int i = 0; i < polls; ++i) {
+                const uint16_t buttons = (((i / 3) + t) & 1) != 0 ? kA : 0;
+                if (slot.Step(table, 0, buttons, events, count)) {
+                    count_events(events, count);
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    RemapEvent events[utils::kRemapButtonCount];
+    size_t count = 0;
+    CHECK(slot.Step(table, 0, 0, events, count));
+    count_events(events, count);
+    CHECK(presses.load() > 0);
+    CHECK(presses.load() == releases.load());
+}
+
+// Alternates two tables while a reader copies; every successful read must be one of them as a whole
+void TestPublisherNoTornReads() {
+    const RemapDispatchTable odd = utils::CompileRemapTable(kBindings.data(), kBindings.size(), kGuide);
+    const RemapDispatchTable even = utils::CompileRemapTable(kBindings.data(), 2, kGuide);
+    utils::RemapTablePublisher publisher;
+
+    RemapDispatchTable table;
+    uint16_t generation = 99;
+    CHECK(publisher.TryRead(table, generation) && generation == 0 && table.bound_mask == 0);
+
+    std::atomic<bool> stop{false};
+    std::atomic<int> reads{0};
+    std::atomic<int> torn{0};
+    std::thread reader([&] {
+        RemapDispatchTable copy;
+        uint16_t copy_generation = 0;
+        while (!stop.load()) {
+            if (publisher.TryRead(copy, copy_generation) && copy_generation != 0) {
+                const RemapDispatchTable& expected = (copy_generation & 1) != 0 ? odd : even;
+                if (std::memcmp(&copy, &expected, sizeof(copy)) != 0) {
+                    torn.fetch_add(1);
+                }
+                reads.fetch_add(1);
+            }
+        }
+    });
+    // Keep publishing until the reader has seen plenty of tables, also on a single core
+    for (int i = 1; i <= 2'000'000 && reads.load() < 20'000; ++i) {
+        publisher.Publish((i & 1) != 0 ? odd : even);
+        if (i % 256 == 0) {
+            std::this_thread::yield();
+        }
+    }
+    stop = true;
+    reader.join();
+    CHECK(reads.load() > 0);
+    CHECK(torn.load() == 0);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const Options options = ParseOptions(argc, argv);
+
+    TestRecordedSequences();
+    TestGamepadOutput();
+    TestRebase();
+    TestConcurrentPolls(options.polls);
+    TestPublisherNoTornReads();
+
+    if (g_failures != 0) {
+        std::printf("%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    std::printf("all remap dispatch tests passed\n");
+    return 0;
+}
@@ -0,0 +1,210 @@
+// Tests utils::SettingsChangeBus and utils::SettingsSnapshot (utils/settings_change_bus.hpp):
+//  - Publish() bumps the generation and hands section/key to every subscriber; callbacks may publish or unsubscribe
+//    themselves;
+//  - a snapshot reloads only when the generation moved;
+//  - stress: a writer stores a setting and publishes while reader threads cache it in snapshots. A snapshot built at
+//    generation g must hold a value at least as new as the one published for g, and after the writer is done every
+//    reader must see the final value. Subscribers come and go on another thread meanwhile.
+//
+// Usage: settings_change_bus_test [--writes N] [--readers R]
+
+#include "utils/settings_change_bus.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+int g_failures = 0;
+
+#define CHECK(condition)                                                       \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            std::printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+            ++g_failures;                                                      \
+        }                                                                      \
+    } while (false)
+
+using utils::SettingsChange;
+using utils::SettingsChangeBus;
+using utils::SettingsSnapshot;
+
+struct Options {
+    int writes = 200'000;
+    int readers = 3;
+};
+
+Options ParseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--writes") == 0) {
+            options.writes = (std::max)(100, std::atoi(argv[i + 1]));
+        } else if (std::strcmp(argv[i], "--readers") == 0) {
+            options.readers = (std::max)(1, std::atoi(argv[i + 1]));
+        } else {
+            std::fprintf(stderr, "unknown option %s\n", argv[i]);
+            std::exit(2);
+        }
+    }
+    return options;
+}
+
+void TestPublishAndSubscribe() {
+    SettingsChangeBus bus;
+    CHECK(bus.Generation() == 0);
+    bus.Publish("DisplayCommander", "fps_limit");  // no subscribers yet
+    CHECK(bus.Generation() == 1);
+
+    std::vector<std::string> seen;
+    const auto id = bus.Subscribe([&](const SettingsChange& change) {
+        seen.push_back(std::to_string(change.generation) + " " + std::string(change.section) + "/"
+                       + std::string(change.key));
+    });
+    bus.Publish("DisplayCommander", "fps_limit");
+    bus.Publish("DisplayCommander.Swapchain", "");
+    bus.Unsubscribe(id);
+    bus.Publish("DisplayCommander", "fps_limit");
+    CHECK(bus.Generation() == 4);
+    CHECK(seen.size() == 2);
+    CHECK(seen.size() == 2 && seen[0] == "2 DisplayCommander/fps_limit");
+    CHECK(seen.size() == 2 && seen[1] == "3 DisplayCommander.Swapchain/");
+    bus.Unsubscribe(id);  // unknown ids are ignored
+}
+
+void TestCallbacksMayPublishAndUnsubscribe() {
+    SettingsChangeBus bus;
+    int once_calls = 0;
+    int cascade_calls = 0;
+    SettingsChangeBus::SubscriptionId once_id = 0;
+    once_id = bus.Subscribe([&](const SettingsChange&) {
+        ++once_calls;
+        bus.Unsubscribe(once_id);
+    });
+    bus.Subscribe([&](const SettingsChange& change) {
+        ++cascade_calls;
+        if (change.key == "derived_source") {
+            bus.Publish("DisplayCommander", "derived");  // a setting derived from another one
+        }
+    });
+    bus.Publish("DisplayCommander", "derived_source");
+    bus.Publish("DisplayCommander", "other");
+    CHECK(once_calls == 1);
+    CHECK(cascade_calls == 3);
+    CHECK(bus.Generation() == 3);
+}
+
+void TestSnapshotReloadsOnlyOnChange() {
+    SettingsChangeBus bus;
+    SettingsSnapshot<int> snapshot;
+    int loads = 0;
+    int value = 7;
+    const auto load = [&] {
+        ++loads;
+        return value;
+    };
+    CHECK(snapshot.Get(bus, load) == 7);  // the first Get always loads, even at generation 0
+    CHECK(snapshot.Get(bus, load) == 7);
+    CHECK(loads == 1 && snapshot.Version() == 0);
+
+    value = 8;  // changed without a Publish: the snapshot keeps the old value
+    CHECK(snapshot.Get(bus, load) == 7);
+    bus.Publish("DisplayCommander", "value");
+    CHECK(snapshot.Get(bus, load) == 8);
+    CHECK(snapshot.Get(bus, load) == 8);
+    CHECK(loads == 2 && snapshot.Version() == 1);
+}
+
+void TestStressNoStaleSnapshot(int writes, int reader_count) {
+    SettingsChangeBus bus;
+    std::atomic<int> setting{0};
+    std::atomic<bool> done{false};
+    std::atomic<long> callbacks{0};
+    std::atomic<long> stale{0};
+    std::atomic<long> reloads{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < reader_count; ++r) {
+        readers.emplace_back([&] {
+            SettingsSnapshot<int> snapshot;
+            long local_reloads = 0;
+            for (;;) {
+                const bool finished = done.load();
+                const uint64_t before = snapshot.Version();
+                const int value = snapshot.Get(bus, [&] { return setting.load(std::memory_order_relaxed); });
+                if (snapshot.Version() != before) {
+                    ++local_reloads;
+                    // Generation g is published after value g was stored
+                    if (static_cast<uint64_t>(value) < snapshot.Version()) {
+                        stale.fetch_add(1);
+                    }
+                }
+                if (finished) {
+                    // The writer was done before this Get: it must have seen the final value
+                    if (value != writes) {
+                        stale.fetch_add(1);
+                    }
+                    break;
+                }
+            }
+            reloads.fetch_add(local_reloads);
+        });
+    }
+
+    // Subscribers come and go while the writer publishes
+    std::thread churn([&] {
+        while (!done.load()) {
+            const auto id = bus.Subscribe([&](const SettingsChange& change) {
+                if (change.generation == 0 || change.key != "value") {
+                    stale.fetch_add(1);
+                }
+                callbacks.fetch_add(1);
+            });
+            std::this_thread::yield();
+            bus.Unsubscribe(id);
+        }
+    });
+
+    std::thread writer([&] {
+        for (int i = 1; i <= writes; ++i) {
+            setting.store(i, std::memory_order_relaxed);
+            bus.Publish("DisplayCommander", "value");
+        }
+        done = true;
+    });
+    writer.join();
+    churn.join();
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+
+    std::printf("stress: %d writes, %ld reloads across %d readers, %ld callbacks\n", writes, reloads.load(),
+                reader_count, callbacks.load());
+    CHECK(bus.Generation() == static_cast<uint64_t>(writes));
+    CHECK(stale.load() == 0);
+    CHECK(reloads.load() >= reader_count);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const Options options = ParseOptions(argc, argv);
+
+    TestPublishAndSubscribe();
+    TestCallbacksMayPublishAndUnsubscribe();
+    TestSnapshotReloadsOnlyOnChange();
+    TestStressNoStaleSnapshot(options.writes, options.readers);
+
+    if (g_failures != 0) {
+        std::printf("%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    std::printf("all settings change bus tests passed\n");
+    return 0;
+}
@@ -0,0 +1,176 @@
+// Tests utils::SettingsTable and the schema checks of utils/settings_registry.hpp:
+//  - IsValidSchema() rejects empty or duplicate keys, ranges that do not contain the default, fractional int/bool
+//    values and bool ranges other than 0..1 (checked with static_assert, so a regression fails the build);
+//  - a table starts at the defaults, stores its slots in one 64-byte-aligned array of 4-byte atomics, and Set()
+//    clamps to the schema range;
+//  - LoadAll() keeps defaults for missing keys, falls back to the default and writes it back for out-of-range or
+//    non-finite values, ignores text that does not parse, and counts the settings that differ from their default.
+// The CMake file also compiles this source with SETTINGS_REGISTRY_TEST_UNKNOWN_KEY / _MISTYPED_KEY and expects the
+// build to fail.
+//
+// Usage: settings_registry_test
+
+#include "utils/settings_registry.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <utility>
+
+namespace {
+
+int g_failures = 0;
+
+#define CHECK(condition)                                                       \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            std::printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+            ++g_failures;                                                      \
+        }                                                                      \
+    } while (false)
+
+using utils::SettingDef;
+
+constexpr std::array<SettingDef, 4> kSchema = {
+    utils::BoolSettingDef("DisplayCommander.Test", "enabled", true),
+    utils::IntSettingDef("DisplayCommander.Test", "mode", 2, 0, 3),
+    utils::FloatSettingDef("DisplayCommander.Test", "multiplier", 1.1f, 0.5f, 4.0f),
+    utils::FloatSettingDef("DisplayCommander.Test", "min_ms", 0.0f, 0.0f, 100.0f),
+};
+
+constexpr auto kEnabled = utils::MakeSettingId<bool>(kSchema, "enabled");
+constexpr auto kMode = utils::MakeSettingId<int>(kSchema, "mode");
+constexpr auto kMultiplier = utils::MakeSettingId<float>(kSchema, "multiplier");
+constexpr auto kMinMs = utils::MakeSettingId<float>(kSchema, "min_ms");
+static_assert(kEnabled.index == 0 && kMode.index == 1 && kMultiplier.index == 2 && kMinMs.index == 3);
+
+#if defined(SETTINGS_REGISTRY_TEST_UNKNOWN_KEY)
+constexpr auto kUnknown = utils::MakeSettingId<int>(kSchema, "no_such_key");
+#elif defined(SETTINGS_REGISTRY_TEST_MISTYPED_KEY)
+constexpr auto kMistyped = utils::MakeSettingId<float>(kSchema, "mode");
+#endif
+
+using Table = utils::SettingsTable<kSchema>;
+
+// Schema rules
+static_assert(utils::IsValidSchema(kSchema));
+static_assert(!utils::IsValidSchema(std::array<SettingDef, 1>{utils::IntSettingDef("S", "", 0, 0, 1)}));
+static_assert(!utils::IsValidSchema(std::array<SettingDef, 1>{utils::IntSettingDef("", "key", 0, 0, 1)}));
+static_assert(!utils::IsValidSchema(
+    std::array<SettingDef, 2>{utils::IntSettingDef("S", "key", 0, 0, 1), utils::BoolSettingDef("T", "key", false)}));
+static_assert(!utils::IsValidSchema(std::array<SettingDef, 1>{utils::IntSettingDef("S", "key", 5, 0, 3)}));
+static_assert(!utils::IsValidSchema(std::array<SettingDef, 1>{utils::IntSettingDef("S", "key", 1, 3, 0)}));
+static_assert(!utils::IsValidSchema(std::array<SettingDef, 1>{utils::FloatSettingDef("S", "key", 9.0f, 0.0f, 1.0f)}));
+static_assert(!utils::IsValidSchema(
+    std::array<SettingDef, 1>{SettingDef{"S", "key", utils::SettingType::kInt, 0.5, 0.0, 1.0}}));
+static_assert(!utils::IsValidSchema(
+    std::array<SettingDef, 1>{SettingDef{"S", "key", utils::SettingType::kBool, 0.0, 0.0, 2.0}}));
+
+// Stands in for the config store: text per "section/key", and a log of written-back values
+struct FakeConfig {
+    std::map<std::string, std::string> values;
+    std::map<std::string, std::string> written;
+
+    auto Getter() {
+        return [this](const char* section, const char* key, std::string& text) {
+            const auto it = values.find(std::string(section) + "/" + key);
+            if (it == values.end()) {
+                return false;
+            }
+            text = it->second;
+            return true;
+        };
+    }
+    auto Setter() {
+        return [this](const char* section, const char* key, const std::string& text) {
+            written[std::string(section) + "/" + key] = text;
+        };
+    }
+};
+
+void TestDefaultsAndLayout() {
+    Table table;
+    CHECK(table.Get(kEnabled) == true);
+    CHECK(table.Get(kMode) == 2);
+    CHECK(table.Get(kMultiplier) == 1.1f);
+    CHECK(table.Get(kMinMs) == 0.0f);
+    for (size_t i = 0; i < Table::kCount; ++i) {
+        CHECK(table.IsDefault(i));
+    }
+    CHECK(alignof(Table) == 64);
+    CHECK(reinterpret_cast<uintptr_t>(&table.Atomic(kEnabled)) % 64 == 0);
+    CHECK(reinterpret_cast<const char*>(&table.Atomic(kMultiplier))
+              - reinterpret_cast<const char*>(&table.Atomic(kEnabled))
+          == 8);
+    CHECK(table.ValueAsString(kEnabled.index) == "1");
+    CHECK(table.ValueAsString(kMode.index) == "2");
+}
+
+void TestSetClamps() {
+    Table table;
+    CHECK(table.Set(kMode, 7) && table.Get(kMode) == 3);
+    CHECK(!table.Set(kMode, 3));  // unchanged
+    CHECK(table.Set(kMode, -1) && table.Get(kMode) == 0);
+    CHECK(table.Set(kMultiplier, 0.1f) && table.Get(kMultiplier) == 0.5f);
+    CHECK(table.Set(kEnabled, false) && !table.Get(kEnabled));
+    CHECK(!table.IsDefault(kEnabled.index));
+    table.ResetToDefaults();
+    CHECK(table.Get(kMode) == 2 && table.Get(kEnabled) && table.Get(kMultiplier) == 1.1f);
+}
+
+void TestLoadAll() {
+    // Nothing stored: every setting keeps its default, nothing is written back
+    {
+        Table table;
+        FakeConfig config;
+        CHECK(table.LoadAll(config.Getter(), config.Setter()) == 0);
+        CHECK(config.written.empty());
+    }
+    // Valid values, an int stored with a fraction, and text that does not parse
+    {
+        Table table;
+        FakeConfig config;
+        config.values["DisplayCommander.Test/enabled"] = "0";
+        config.values["DisplayCommander.Test/mode"] = "1.9";  // integers drop the fraction
+        config.values["DisplayCommander.Test/multiplier"] = "2.5";
+        config.values["DisplayCommander.Test/min_ms"] = "fast";  // not a number: default, not rewritten
+        CHECK(table.LoadAll(config.Getter(), config.Setter()) == 3);
+        CHECK(!table.Get(kEnabled) && table.Get(kMode) == 1 && table.Get(kMultiplier) == 2.5f);
+        CHECK(table.Get(kMinMs) == 0.0f);
+        CHECK(config.written.empty());
+    }
+    // Out of range, non-0/1 bool and non-finite values fall back to the default and are written back
+    {
+        Table table;
+        table.Set(kMode, 0);
+        FakeConfig config;
+        config.values["DisplayCommander.Test/enabled"] = "2";
+        config.values["DisplayCommander.Test/mode"] = "9";
+        config.values["DisplayCommander.Test/multiplier"] = "inf";
+        config.values["DisplayCommander.Test/min_ms"] = "nan";
+        CHECK(table.LoadAll(config.Getter(), config.Setter()) == 0);
+        CHECK(table.Get(kMode) == 2);  // the default, not the value stored before the load
+        CHECK(config.written.size() == 4);
+        CHECK(config.written["DisplayCommander.Test/enabled"] == "1");
+        CHECK(config.written["DisplayCommander.Test/mode"] == "2");
+        CHECK(config.written["DisplayCommander.Test/multiplier"] == std::to_string(1.1f));
+        CHECK(config.written["DisplayCommander.Test/min_ms"] == std::to_string(0.0f));
+    }
+}
+
+} // namespace
+
+int main() {
+    TestDefaultsAndLayout();
+    TestSetClamps();
+    TestLoadAll();
+
+    if (g_failures != 0) {
+        std::printf("%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    std::printf("all settings registry tests passed\n");
+    return 0;
+}
@@ -0,0 +1,224 @@
+// Tails the shared stats block published by Display Commander (see utils/shared_stats_block.hpp).
+//
+// Windows: attach to a running game by process id (named mapping "Local\DisplayCommanderStats_<pid>").
+// Any platform: map the file given by DISPLAY_COMMANDER_STATS_FILE in the game's environment, e.g. under
+// Proton set DISPLAY_COMMANDER_STATS_FILE=Z:\tmp\dc_stats.bin and run `stats_tail /tmp/dc_stats.bin`.
+//
+// Usage: stats_tail <pid | file> [--interval-ms N] [--once] [--histogram]
+
+#include "utils/shared_stats_block.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+using utils::SharedStatsBlock;
+using utils::SharedStatsSnapshot;
+
+void PrintUsage() {
+    std::fprintf(stderr,
+                 "Usage: stats_tail <pid | file> [--interval-ms N] [--once] [--histogram]\n"
+#ifdef _WIN32
+                 "  pid   attach to the shared memory block of a running process\n"
+#endif
+                 "  file  map a file-backed block (DISPLAY_COMMANDER_STATS_FILE)\n");
+}
+
+bool IsNumber(const char* text) {
+    if (*text == '\0') {
+        return false;
+    }
+    for (const char* c = text; *c != '\0'; ++c) {
+        if (*c < '0' || *c > '9') {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Read-only view of a stats block
+class BlockView {
+  public:
+    BlockView() = default;
+    BlockView(const BlockView&) = delete;
+    BlockView& operator=(const BlockView&) = delete;
+    ~BlockView() { Close(); }
+
+    bool Open(const char* target) {
+#ifdef _WIN32
+        if (IsNumber(target)) {
+            const std::string name = std::string(utils::kSharedStatsMappingPrefix) + target;
+            mapping_ = OpenFileMappingA(FILE_MAP_READ, FALSE, name.c_str());
+        } else {
+            file_ = CreateFileA(target, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file_ == INVALID_HANDLE_VALUE) {
+                return false;
+            }
+            mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        }
+        if (mapping_ == nullptr) {
+            return false;
+        }
+        view_ = MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, sizeof(SharedStatsBlock));
+        return view_ != nullptr;
+#else
+        if (IsNumber(target)) {
+            std::fprintf(stderr, "Process ids are only supported on Windows; pass the stats file instead\n");
+            return false;
+        }
+        fd_ = open(target, O_RDONLY);
+        if (fd_ < 0) {
+            return false;
+        }
+        struct stat st = {};
+        if (fstat(fd_, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(SharedStatsBlock)) {
+            return false;
+        }
+        void* view = mmap(nullptr, sizeof(SharedStatsBlock), PROT_READ, MAP_SHARED, fd_, 0);
+        if (view == MAP_FAILED) {
+            return false;
+        }
+        view_ = view;
+        return true;
+#endif
+    }
+
+    void Close() {
+#ifdef _WIN32
+        if (view_ != nullptr) {
+            UnmapViewOfFile(view_);
+        }
+        if (mapping_ != nullptr) {
+            CloseHandle(mapping_);
+        }
+        if (file_ != INVALID_HANDLE_VALUE) {
+            CloseHandle(file_);
+        }
+        mapping_ = nullptr;
+        file_ = INVALID_HANDLE_VALUE;
+#else
+        if (view_ != nullptr) {
+            munmap(view_, sizeof(SharedStatsBlock));
+        }
+        if (fd_ >= 0) {
+            close(fd_);
+        }
+        fd_ = -1;
+#endif
+        view_ = nullptr;
+    }
+
+    const SharedStatsBlock* block() const { return static_cast<const SharedStatsBlock*>(view_); }
+
+  private:
+    void* view_ = nullptr;
+#ifdef _WIN32
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE mapping_ = nullptr;
+#else
+    int fd_ = -1;
+#endif
+};
+
+double NsToMs(int64_t ns) { return static_cast<double>(ns) / 1e6; }
+
+void PrintSnapshot(const SharedStatsSnapshot& s, bool histogram) {
+    std::printf("#%-6llu %7.1f fps  ft p50 %6.2f  p99 %6.2f  p99.9 %6.2f ms  lows %6.1f / %6.1f fps  (%u frames)\n",
+                static_cast<unsigned long long>(s.update_count), s.fps, s.median_frame_time_ms, s.p99_frame_time_ms,
+                s.p999_frame_time_ms, s.one_percent_low_fps, s.point_one_percent_low_fps, s.frame_count);
+    std::printf("        sim %6.2f  submit %6.2f  present %6.2f  gpu %6.2f  reshade %6.2f  reflex sleep %6.2f ms\n",
+                NsToMs(s.simulation_duration_ns), NsToMs(s.render_submit_duration_ns), NsToMs(s.present_duration_ns),
+                NsToMs(s.gpu_duration_ns), NsToMs(s.reshade_overhead_duration_ns), NsToMs(s.reflex_sleep_duration_ns));
+    std::printf("        limiter sleep %6.2f / %6.2f ms  late last %6.3f  mean %6.3f  max %6.3f ms  (%u frames)\n",
+                NsToMs(s.limiter_sleep_before_present_ns), NsToMs(s.limiter_sleep_after_present_ns),
+                NsToMs(s.limiter_late_last_ns), NsToMs(s.limiter_late_mean_ns), NsToMs(s.limiter_late_max_ns),
+                s.late_sample_count);
+
+    if (!histogram) {
+        return;
+    }
+    uint32_t peak = 0;
+    for (uint32_t count : s.frame_time_bins) {
+        peak = (count > peak) ? count : peak;
+    }
+    for (size_t i = 0; i < SharedStatsSnapshot::kFrameTimeBinCount; ++i) {
+        const uint32_t count = s.frame_time_bins[i];
+        if (count == 0) {
+            continue;
+        }
+        const int width = static_cast<int>((50ull * count + peak - 1) / peak);
+        const float low_ms = static_cast<float>(i) * SharedStatsSnapshot::kFrameTimeBinWidthMs;
+        const bool last = (i + 1 == SharedStatsSnapshot::kFrameTimeBinCount);
+        std::printf("        %6.1f%s ms %8u %.*s\n", low_ms, last ? "+" : " ", count, width,
+                    "##################################################");
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        PrintUsage();
+        return 1;
+    }
+    const char* target = argv[1];
+    int interval_ms = 1000;
+    bool once = false;
+    bool histogram = false;
+    for (int i = 2; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--interval-ms") == 0 && i + 1 < argc) {
+            interval_ms = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--once") == 0) {
+            once = true;
+        } else if (std::strcmp(argv[i], "--histogram") == 0) {
+            histogram = true;
+        } else {
+            PrintUsage();
+            return 1;
+        }
+    }
+    interval_ms = (interval_ms > 10) ? interval_ms : 10;
+
+    BlockView view;
+    if (!view.Open(target)) {
+        std::fprintf(stderr, "Cannot map stats block: %s\n", target);
+        return 1;
+    }
+    const SharedStatsBlock* block = view.block();
+    if (!block->IsCompatible()) {
+        std::fprintf(stderr, "%s: not a stats block of version %u (magic 0x%08x, version %u)\n", target,
+                     SharedStatsBlock::kVersion, block->magic, block->version);
+        return 1;
+    }
+    std::printf("Display Commander stats from pid %u\n", block->writer_pid);
+
+    uint64_t last_update = 0;
+    for (;;) {
+        SharedStatsSnapshot snapshot;
+        if (block->TryRead(snapshot) && snapshot.update_count != last_update) {
+            last_update = snapshot.update_count;
+            PrintSnapshot(snapshot, histogram);
+            std::fflush(stdout);
+            if (once) {
+                return 0;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(interval_ms));
+    }
+}
@@ -0,0 +1,231 @@
+// Tests utils::StickResponseEngine (utils/stick_response.hpp) over a set of stick curves, combined left/right:
+//  - Apply() (SSE2 on x86, NEON on AArch64) matches ApplyScalar() bit for bit on every stick axis, and leaves
+//    untouched triggers untouched;
+//  - ApplyScalar() stays within one SHORT step of the previous per-call path: ShortToFloat, recenter,
+//    ProcessStickInputRadial/Square and FloatToShort, copied below from utils/general_utils.cpp and the old XInput
+//    hook, which need Windows headers.
+// Every curve pair sees the full -32768..32767 sweep on each axis followed by random positions.
+//
+// Usage: stick_response_test [--samples N] [--seed S]
+
+#include "utils/stick_response.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+namespace {
+
+int g_failures = 0;
+
+#define CHECK(condition)                                                       \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            std::printf("FAILED %s:%d: %s\n", __FILE__, __LINE__, #condition); \
+            ++g_failures;                                                      \
+        }                                                                      \
+    } while (false)
+
+using utils::GamepadAxes;
+using utils::StickCurve;
+using utils::StickResponseEngine;
+
+struct Options {
+    int samples = 200'000;  // per curve pair, including the 65536-step sweep
+    uint32_t seed = 1;
+};
+
+Options ParseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--samples") == 0) {
+            options.samples = (std::max)(65536, std::atoi(argv[i + 1]));
+        } else if (std::strcmp(argv[i], "--seed") == 0) {
+            options.seed = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+        } else {
+            std::fprintf(stderr, "unknown option %s\n", argv[i]);
+            std::exit(2);
+        }
+    }
+    return options;
+}
+
+// --- Previous path (utils/general_utils.cpp, hooks/xinput_hooks.cpp before the engine) ---
+
+float ShortToFloat(int16_t value) { return (static_cast<float>(value) - (-32768.0f)) / 65535.0f * 2.0f - 1.0f; }
+
+int16_t FloatToShort(float value) {
+    value = (std::max)(-1.0f, (std::min)(1.0f, value));
+    return static_cast<int16_t>((value + 1.0f) / 2.0f * 65535.0f + (-32768.0f));
+}
+
+float recenter(float value, float center) { return (value - center) / (1 + std::abs(center)); }
+
+void ProcessStickInputRadial(float& x, float& y, float deadzone, float max_input, float min_output,
+                             float curve_exponent) {
+    float magnitude = std::sqrt(x * x + y * y);
+    if (magnitude < 0.0001f) {
+        x = 0.0f;
+        y = 0.0f;
+        return;
+    }
+    if (magnitude < deadzone) {
+        x = 0.0f;
+        y = 0.0f;
+        return;
+    }
+    float scaled_magnitude = (std::min)(1.0f, (std::max)(0.0f, magnitude - deadzone) / (max_input - deadzone));
+    if (curve_exponent != 1.0f) {
+        scaled_magnitude = std::pow(scaled_magnitude, curve_exponent);
+    }
+    float output_magnitude = min_output + (scaled_magnitude * (1.0f - min_output));
+    output_magnitude = std::clamp(output_magnitude, 0.0f, 1.0f);
+    x = x * output_magnitude / magnitude;
+    y = y * output_magnitude / magnitude;
+}
+
+void ProcessStickAxisSquare(float& v, float deadzone, float max_input, float min_output, float curve_exponent) {
+    float abs_v = std::abs(v);
+    float sign_v = (v >= 0.0f) ? 1.0f : -1.0f;
+    if (abs_v < deadzone) {
+        v = 0.0f;
+        return;
+    }
+    float scaled_v = (std::min)(1.0f, (std::max)(0.0f, (abs_v - deadzone) / (max_input - deadzone)));
+    if (curve_exponent != 1.0f) {
+        scaled_v = std::pow(scaled_v, curve_exponent);
+    }
+    float output_v = min_output + (scaled_v * (1.0f - min_output));
+    output_v = std::clamp(output_v, 0.0f, 1.0f);
+    v = sign_v * output_v;
+}
+
+void ProcessStickInputSquare(float& x, float& y, float deadzone, float max_input, float min_output,
+                             float curve_exponent) {
+    ProcessStickAxisSquare(x, deadzone, max_input, min_output, curve_exponent);
+    ProcessStickAxisSquare(y, deadzone, max_input, min_output, curve_exponent);
+}
+
+void PreviousPath(const StickCurve& curve, int16_t& raw_x, int16_t& raw_y) {
+    float x = recenter(ShortToFloat(raw_x), curve.center_x);
+    float y = recenter(ShortToFloat(raw_y), curve.center_y);
+    if (curve.circular) {
+        ProcessStickInputRadial(x, y, curve.deadzone, curve.max_input, curve.min_output, curve.exponent);
+    } else {
+        ProcessStickInputSquare(x, y, curve.deadzone, curve.max_input, curve.min_output, curve.exponent);
+    }
+    raw_x = FloatToShort(x);
+    raw_y = FloatToShort(y);
+}
+
+// --- Tests ---
+
+struct NamedCurve {
+    const char* name;
+    StickCurve curve;
+    bool degenerate;  // max_input <= deadzone: the previous path divides by zero or a negative range
+};
+
+const NamedCurve kCurves[] = {
+    {"default", StickCurve{}, false},
+    {"radial, centered", StickCurve{0.15f, 0.8f, 0.2f, 1.0f, 0.01f, -0.02f, true}, false},
+    {"square", StickCurve{0.1f, 0.9f, 0.0f, 1.0f, 0.0f, 0.0f, false}, false},
+    {"radial, exponent 2", StickCurve{0.05f, 1.0f, 0.3f, 2.0f, 0.0f, 0.0f, true}, false},
+    {"square, exponent 1.5", StickCurve{0.2f, 0.7f, 0.1f, 1.5f, -0.03f, 0.02f, false}, false},
+    {"degenerate", StickCurve{0.5f, 0.1f, 0.0f, 1.0f, 0.0f, 0.0f, true}, true},
+};
+
+struct PairResult {
+    size_t simd_mismatches = 0;
+    size_t trigger_changes = 0;
+    long max_step_error = 0;
+    size_t off_by_one = 0;
+};
+
+PairResult RunPair(const NamedCurve& left, const NamedCurve& right, int samples, std::mt19937& rng) {
+    std::uniform_int_distribution<int> axis(-32768, 32767);
+    StickResponseEngine engine;
+    engine.Configure(left.curve, right.curve);
+    PairResult result;
+    for (int n = 0; n < samples; ++n) {
+        GamepadAxes input;
+        if (n < 65536) {
+            input.left_x = static_cast<int16_t>(n - 32768);
+            input.left_y = static_cast<int16_t>(32767 - n);
+            input.right_x = static_cast<int16_t>(n - 32768);
+            input.right_y = 0;
+        } else {
+            input.left_x = static_cast<int16_t>(axis(rng));
+            input.left_y = static_cast<int16_t>(axis(rng));
+            input.right_x = static_cast<int16_t>(axis(rng));
+            input.right_y = static_cast<int16_t>(axis(rng));
+        }
+        input.left_trigger = static_cast<uint8_t>(n & 0xFF);
+        input.right_trigger = static_cast<uint8_t>((n >> 8) & 0xFF);
+
+        GamepadAxes scalar = input;
+        GamepadAxes vector = input;
+        engine.ApplyScalar(scalar);
+        engine.Apply(vector);
+        result.simd_mismatches += scalar.left_x != vector.left_x || scalar.left_y != vector.left_y
+                                  || scalar.right_x != vector.right_x || scalar.right_y != vector.right_y;
+        result.trigger_changes +=
+            vector.left_trigger != input.left_trigger || vector.right_trigger != input.right_trigger;
+
+        if (left.degenerate || right.degenerate) {
+            continue;
+        }
+        int16_t expected[4] = {input.left_x, input.left_y, input.right_x, input.right_y};
+        PreviousPath(left.curve, expected[0], expected[1]);
+        PreviousPath(right.curve, expected[2], expected[3]);
+        const int16_t actual[4] = {scalar.left_x, scalar.left_y, scalar.right_x, scalar.right_y};
+        for (int lane = 0; lane < 4; ++lane) {
+            const long error = std::labs(static_cast<long>(expected[lane]) - actual[lane]);
+            result.off_by_one += error != 0;
+            result.max_step_error = (std::max)(result.max_step_error, error);
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const Options options = ParseOptions(argc, argv);
+    std::mt19937 rng(options.seed);
+#if defined(STICK_RESPONSE_HAS_SSE2)
+    std::printf("vector path: SSE2\n");
+#elif defined(STICK_RESPONSE_HAS_NEON)
+    std::printf("vector path: NEON\n");
+#else
+    std::printf("vector path: none (Apply() is the scalar path)\n");
+#endif
+
+    for (const NamedCurve& left : kCurves) {
+        for (const NamedCurve& right : kCurves) {
+            const PairResult result = RunPair(left, right, options.samples, rng);
+            if (result.simd_mismatches != 0 || result.trigger_changes != 0 || result.max_step_error > 1) {
+                std::printf("FAILED %s / %s: %zu vector mismatches, %zu trigger changes, max error %ld steps\n",
+                            left.name, right.name, result.simd_mismatches, result.trigger_changes,
+                            result.max_step_error);
+                ++g_failures;
+            } else if (&left == &right && left.degenerate) {
+                std::printf("%-22s vector path matches (no previous-path reference)\n", left.name);
+            } else if (&left == &right) {
+                std::printf("%-22s max error %ld step, %zu of %d axes off by one\n", left.name,
+                            result.max_step_error, result.off_by_one, 4 * options.samples);
+            }
+        }
+    }
+
+    if (g_failures != 0) {
+        std::printf("%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    std::printf("all stick response tests passed\n");
+    return 0;
+}
@@ -0,0 +1,188 @@
+// Benchmarks utils::TrackedObjectTable (the swapchain tracking table used by the present hooks) against the
+// reader/writer-locked std::unordered_set it replaced.
+//
+// Reader threads play the present path: look up a tracked swapchain and bump a per-entry counter. One writer
+// thread plays swapchain churn: create, track, untrack at a configurable rate. Reported are lookups per second
+// per reader and the worst lookup latency seen.
+//
+// Usage: tracked_table_bench [--readers N] [--seconds S] [--churn-us U]
+
+#include "utils/tracked_object_table.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+struct FakeSwapchain {
+    alignas(16) char data[64];
+};
+
+struct EntryStats {
+    std::atomic<uint64_t> presents{0};
+};
+
+// What SwapchainTrackingManager did before: an unordered container behind an SRW lock
+class LockedTable {
+  public:
+    bool Insert(FakeSwapchain* key) {
+        std::unique_lock lock(mutex_);
+        return entries_.try_emplace(key).second;
+    }
+    bool Remove(FakeSwapchain* key) {
+        std::unique_lock lock(mutex_);
+        return entries_.erase(key) != 0;
+    }
+    bool CountPresent(FakeSwapchain* key) {
+        std::shared_lock lock(mutex_);
+        auto it = entries_.find(key);
+        if (it == entries_.end()) {
+            return false;
+        }
+        it->second.presents.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+  private:
+    std::shared_mutex mutex_;
+    std::unordered_map<FakeSwapchain*, EntryStats> entries_;
+};
+
+class RcuTable {
+  public:
+    bool Insert(FakeSwapchain* key) { return table_.Insert(key); }
+    bool Remove(FakeSwapchain* key) { return table_.Remove(key); }
+    bool CountPresent(FakeSwapchain* key) {
+        Table::ReadGuard guard(table_);
+        EntryStats* stats = table_.Find(key, guard);
+        if (stats == nullptr) {
+            return false;
+        }
+        stats->presents.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+  private:
+    using Table = utils::TrackedObjectTable<FakeSwapchain*, EntryStats>;
+    Table table_;
+};
+
+struct Options {
+    int readers = 2;
+    double seconds = 2.0;
+    int churn_us = 50;
+};
+
+struct Result {
+    double lookups_per_second_per_reader = 0.0;
+    double max_lookup_ns = 0.0;
+    uint64_t churn_ops = 0;
+};
+
+template <typename TableT> Result Run(const Options& options) {
+    static FakeSwapchain swapchains[8];
+    TableT table;
+    // Two long-lived swapchains (game + overlay) that presents hit
+    table.Insert(&swapchains[0]);
+    table.Insert(&swapchains[1]);
+
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> total_lookups{0};
+    std::atomic<int64_t> max_lookup_ns{0};
+    std::atomic<uint64_t> churn_ops{0};
+
+    std::thread writer([&]() {
+        uint64_t ops = 0;
+        size_t next = 2;
+        while (!stop.load(std::memory_order_relaxed)) {
+            FakeSwapchain* key = &swapchains[next];
+            table.Insert(key);
+            table.Remove(key);
+            next = (next == 7) ? 2 : next + 1;
+            ops += 2;
+            if (options.churn_us > 0) {
+                std::this_thread::sleep_for(std::chrono::microseconds(options.churn_us));
+            }
+        }
+        churn_ops.store(ops);
+    });
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < options.readers; ++r) {
+        readers.emplace_back([&, r]() {
+            uint64_t lookups = 0;
+            int64_t worst = 0;
+            FakeSwapchain* key = &swapchains[r & 1];
+            while (!stop.load(std::memory_order_relaxed)) {
+                // Time batches so the clock does not dominate, and single lookups now and then for the tail
+                if ((lookups & 1023) == 0) {
+                    const auto start = std::chrono::steady_clock::now();
+                    table.CountPresent(key);
+                    const auto elapsed = std::chrono::steady_clock::now() - start;
+                    worst = (std::max)(worst,
+                                       static_cast<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                                                                .count()));
+                } else {
+                    table.CountPresent(key);
+                }
+                ++lookups;
+            }
+            total_lookups.fetch_add(lookups);
+            int64_t seen = max_lookup_ns.load();
+            while (worst > seen && !max_lookup_ns.compare_exchange_weak(seen, worst)) {
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::duration<double>(options.seconds));
+    stop.store(true);
+    writer.join();
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+
+    Result result;
+    result.lookups_per_second_per_reader =
+        static_cast<double>(total_lookups.load()) / options.seconds / static_cast<double>(options.readers);
+    result.max_lookup_ns = static_cast<double>(max_lookup_ns.load());
+    result.churn_ops = churn_ops.load();
+    return result;
+}
+
+void Report(const char* label, const Result& result, double seconds) {
+    std::printf("%-22s %8.1f M lookups/s/reader   max sampled lookup %8.0f ns   churn %8.0f ops/s\n", label,
+                result.lookups_per_second_per_reader / 1e6, result.max_lookup_ns,
+                static_cast<double>(result.churn_ops) / seconds);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--readers") == 0 && i + 1 < argc) {
+            options.readers = (std::max)(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) {
+            options.seconds = (std::max)(0.1, std::atof(argv[++i]));
+        } else if (std::strcmp(argv[i], "--churn-us") == 0 && i + 1 < argc) {
+            options.churn_us = (std::max)(0, std::atoi(argv[++i]));
+        } else {
+            std::fprintf(stderr, "Usage: tracked_table_bench [--readers N] [--seconds S] [--churn-us U]\n");
+            return 1;
+        }
+    }
+    std::printf("%d reader(s), %.1f s, writer churn every %d us\n", options.readers, options.seconds,
+                options.churn_us);
+    Report("shared_mutex + map", Run<LockedTable>(options), options.seconds);
+    Report("TrackedObjectTable", Run<RcuTable>(options), options.seconds);
+    return 0;
+}
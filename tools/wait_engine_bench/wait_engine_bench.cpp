@@ -0,0 +1,157 @@
+// Measures the precision/CPU trade-off of the calibrated wait engine (utils::WaitEngine, as used by
+// utils::wait_until_ns_precise in the frame limiters) with the portable sleep backends.
+//
+// Every configuration performs --waits waits of --wait-us each, one after the other like a frame limiter does, after
+// a warm-up that lets the engine calibrate. The two ends of the curve are a plain OS sleep to the target (no CPU, OS
+// wake-up error) and a pure _mm_pause spin (exact, the whole wait on the CPU). In between, the engine runs with a
+// sweep of target precisions. Reported are the p50/p99/max wake-up error in microseconds (positive = late) and the
+// spin time per wait, in microseconds and as a share of the wait.
+//
+// The Windows backends (waitable timer, mwaitx, tpause) live in the addon and are not part of this benchmark.
+//
+// Usage: wait_engine_bench [--wait-us N] [--waits W]
+
+#include "utils/wait_engine.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+
+#if defined(_WIN32)
+int64_t NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+#else
+int64_t NowNs() { return utils::PosixMonotonicNowNs(); }
+#endif
+
+// std::this_thread::sleep_for; available everywhere
+class SleepForBackend final : public utils::WaitBackend {
+  public:
+    const char* Name() const override { return "sleep_for"; }
+    utils::WaitBackendKind Kind() const override { return utils::WaitBackendKind::kSleep; }
+    double CpuCostPerNs() const override { return 0.0; }
+    void WaitUntil(int64_t target_ns, utils::WaitNowNsFn now_ns) override {
+        const int64_t delta_ns = target_ns - now_ns();
+        if (delta_ns > 0) {
+            std::this_thread::sleep_for(std::chrono::nanoseconds(delta_ns));
+        }
+    }
+};
+
+struct Options {
+    int64_t wait_us = 4000;
+    int waits = 500;
+};
+
+Options ParseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (std::strcmp(argv[i], "--wait-us") == 0) {
+            options.wait_us = (std::max)(int64_t{10}, static_cast<int64_t>(std::atoll(argv[i + 1])));
+        } else if (std::strcmp(argv[i], "--waits") == 0) {
+            options.waits = (std::max)(1, std::atoi(argv[i + 1]));
+        } else {
+            std::fprintf(stderr, "unknown option %s\n", argv[i]);
+            std::exit(1);
+        }
+    }
+    return options;
+}
+
+struct Result {
+    std::vector<int64_t> errors_ns;
+    int64_t total_spin_ns = 0;
+};
+
+void PrintResult(const char* name, Result& result, int64_t wait_ns) {
+    std::vector<int64_t>& errors = result.errors_ns;
+    std::sort(errors.begin(), errors.end());
+    const auto quantile = [&errors](double q) {
+        return errors[(std::min)(errors.size() - 1, static_cast<size_t>(q * static_cast<double>(errors.size())))];
+    };
+    const double spin_per_wait_ns = static_cast<double>(result.total_spin_ns) / static_cast<double>(errors.size());
+    std::printf("%-22s %9.1f %9.1f %9.1f %11.1f %7.1f%%\n", name, quantile(0.5) / 1000.0, quantile(0.99) / 1000.0,
+                errors.back() / 1000.0, spin_per_wait_ns / 1000.0, 100.0 * spin_per_wait_ns / wait_ns);
+}
+
+// Back-to-back waits of wait_ns through wait(target_ns), which returns the spin time it spent
+template <typename WaitFn>
+Result RunWaits(const Options& options, int warmup, WaitFn&& wait) {
+    const int64_t wait_ns = options.wait_us * 1000;
+    Result result;
+    result.errors_ns.reserve(options.waits);
+    int64_t target_ns = NowNs();
+    for (int i = -warmup; i < options.waits; ++i) {
+        // Schedule from the previous target like the limiters do, but never into the past
+        target_ns = (std::max)(target_ns + wait_ns, NowNs() + wait_ns / 2);
+        const int64_t spin_ns = wait(target_ns);
+        const int64_t error_ns = NowNs() - target_ns;
+        if (i >= 0) {
+            result.errors_ns.push_back(error_ns);
+            result.total_spin_ns += spin_ns;
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const Options options = ParseOptions(argc, argv);
+    const int64_t wait_ns = options.wait_us * 1000;
+
+    SleepForBackend sleep_for;
+    utils::PauseSpinBackend pause;
+#if !defined(_WIN32)
+    utils::ClockNanosleepBackend clock_nanosleep_backend;
+    utils::NanosleepBackend nanosleep_backend;
+    utils::WaitBackend* const plain_sleeper = &clock_nanosleep_backend;
+#else
+    utils::WaitBackend* const plain_sleeper = &sleep_for;
+#endif
+
+    std::printf("%d waits of %lld us\n", options.waits, static_cast<long long>(options.wait_us));
+    std::printf("%-22s %9s %9s %9s %11s %8s\n", "", "p50 us", "p99 us", "max us", "spin us", "spin");
+
+    Result sleep_only = RunWaits(options, 0, [&](int64_t target_ns) {
+        plain_sleeper->WaitUntil(target_ns, &NowNs);
+        return int64_t{0};
+    });
+    PrintResult(plain_sleeper->Name(), sleep_only, wait_ns);
+
+    static constexpr int64_t kPrecisionsUs[] = {500, 100, 20, 5, 1};
+    for (const int64_t precision_us : kPrecisionsUs) {
+        utils::WaitEngine engine(&NowNs, precision_us * 1000);
+        engine.AddBackend(&sleep_for);
+#if !defined(_WIN32)
+        engine.AddBackend(&clock_nanosleep_backend);
+        engine.AddBackend(&nanosleep_backend);
+#endif
+        engine.AddBackend(&pause);
+        // Enough warm-up for every sleeper to leave its uncalibrated 2 ms margin
+        Result result = RunWaits(options, 128, [&](int64_t target_ns) {
+            engine.WaitUntil(target_ns);
+            return engine.GetStats().last_spin_ns;
+        });
+        char name[32];
+        std::snprintf(name, sizeof(name), "engine, %lld us", static_cast<long long>(precision_us));
+        PrintResult(name, result, wait_ns);
+    }
+
+    Result spin_only = RunWaits(options, 0, [&](int64_t target_ns) {
+        const int64_t start_ns = NowNs();
+        pause.WaitUntil(target_ns, &NowNs);
+        return NowNs() - start_ns;
+    });
+    PrintResult(pause.Name(), spin_only, wait_ns);
+    return 0;
+}